@@ -16,6 +16,9 @@
 #include "fsl_smc_hal.h"
 #include "fsl_debug_console.h"
 #include "communicationStateMachine.h"
+#include "board.h"
+#include "delay.h"
+#include "eventlog.h"
 
 
 /* UART definitions */
@@ -27,6 +30,156 @@
     #define BOARD_DEBUG_UART_BAUD       115200
 #endif
 
+/* limits of the UART0 dividers, baud = clock / (OSR * SBR) */
+#define UART0_OSR_MIN               4U
+#define UART0_OSR_MAX               32U
+#define UART0_OSR_BOTHEDGE          8U      // below this the data is sampled on both edges
+#define UART0_SBR_MAX               8191U
+
+/* SIM_SOPT2 UART0SRC values */
+#define UART0_CLOCK_FLL             1U      // MCGFLLCLK, locked to the crystal
+#define UART0_CLOCK_MCGIRCLK        3U      // fast IRC, keeps running in VLPS
+
+/* ucUartPendingSharedBus with no change pending */
+#define UART0_BUS_NO_CHANGE         0xFFU
+
+/* receive buffer: written by the interruption, read by the main loop */
+volatile unsigned char ucUartRxBuffer[UART0_RX_BUFFER_SIZE];
+volatile unsigned char ucUartRxHead = 0;
+volatile unsigned char ucUartRxTail = 0;
+volatile unsigned int uiUartRxOverflows = 0;
+
+/* transmit buffer: written by the main loop, emptied by the interruption */
+volatile unsigned char ucUartTxBuffer[UART0_TX_BUFFER_SIZE];
+volatile unsigned char ucUartTxHead = 0;
+volatile unsigned char ucUartTxTail = 0;
+unsigned char ucUartTxIrq = 0;              // 0 until UART0_enableIRQ, the bytes are sent polling
+
+/* baud rate in use, and the one to apply when the response is sent */
+unsigned int uiUartBaudRate = BOARD_DEBUG_UART_BAUD;
+int iUartBaudError = 0;
+unsigned int uiUartPendingBaudRate = 0;
+
+/* when set, the received bytes skip the buffer */
+uart_receive_callback_t fUartReceiveCallback = 0;
+
+/* RS-485 multi-drop bus, and the mode to apply when the response is sent */
+unsigned char ucUartSharedBus = 0;
+unsigned char ucUartPendingSharedBus = UART0_BUS_NO_CHANGE;
+
+/* 1 while the UART0 runs from MCGIRCLK, see UART0_enterStopClock */
+unsigned char ucUartStopClock = 0;
+
+
+/* ************************************************ */
+/* Method name:        UART0_findDividers           */
+/* Method description: Find the OSR and SBR closest */
+/*                     to a baud rate. A higher OSR */
+/*                     wins a tie, it samples each  */
+/*                     bit more times               */
+/* Input params:       uiClock: UART0 clock in Hz   */
+/*                     uiBaudRate: wanted baud rate */
+/*                     pucOsr: oversampling ratio   */
+/*                     pusSbr: baud rate divider    */
+/* Output params:      error in hundredths of       */
+/*                     percent                      */
+/* ************************************************ */
+static int UART0_findDividers(unsigned int uiClock, unsigned int uiBaudRate, unsigned char *pucOsr, unsigned short *pusSbr)
+{
+    unsigned int uiBestDiff = 0xFFFFFFFFU;
+    unsigned int uiOsr, uiSbr, uiDiff;
+    int iDiff = 0;
+
+    for(uiOsr = UART0_OSR_MAX; uiOsr >= UART0_OSR_MIN; uiOsr--){
+        uiSbr = (uiClock + uiOsr * uiBaudRate / 2) / (uiOsr * uiBaudRate);
+        if(0 == uiSbr || UART0_SBR_MAX < uiSbr)
+            continue;
+
+        uiDiff = uiClock / (uiOsr * uiSbr);
+        uiDiff = (uiDiff > uiBaudRate) ? uiDiff - uiBaudRate : uiBaudRate - uiDiff;
+        if(uiDiff < uiBestDiff){
+            uiBestDiff = uiDiff;
+            *pucOsr = (unsigned char)uiOsr;
+            *pusSbr = (unsigned short)uiSbr;
+            iDiff = (int)(uiClock / (uiOsr * uiSbr)) - (int)uiBaudRate;
+        }
+    }
+
+    if(0xFFFFFFFFU == uiBestDiff)
+        return 10000;
+    return iDiff * 100 / (int)(uiBaudRate / 100);
+}
+
+/* ************************************************ */
+/* Method name:        UART0_sendNext               */
+/* Method description: Move the oldest queued byte  */
+/*                     to the data register, or     */
+/*                     stop the transmit            */
+/*                     interruption when there is   */
+/*                     none. TDRE must be set       */
+/* Input params:       n/a                          */
+/* Output params:      n/a                          */
+/* ************************************************ */
+static void UART0_sendNext(void)
+{
+    if(ucUartTxTail == ucUartTxHead){
+        UART0_C2 &= ~UART0_C2_TIE_MASK;
+        return;
+    }
+
+    UART0_D = ucUartTxBuffer[ucUartTxTail];
+    ucUartTxTail = (ucUartTxTail + 1) & (UART0_TX_BUFFER_SIZE - 1);
+}
+
+/* ************************************************ */
+/* Method name:        UART0_setClock               */
+/* Method description: Select the UART0 clock and   */
+/*                     program the dividers. The    */
+/*                     transmitter and the receiver */
+/*                     are off meanwhile, so the    */
+/*                     line must be idle            */
+/* Input params:       ucSource: UART0_CLOCK_*      */
+/*                     uiClock: its frequency in Hz */
+/* Output params:      error in hundredths of       */
+/*                     percent                      */
+/* ************************************************ */
+static int UART0_setClock(unsigned char ucSource, unsigned int uiClock)
+{
+    unsigned char ucOsr = UART0_OSR_MAX;
+    unsigned short usSbr = 1;
+    int iError = UART0_findDividers(uiClock, uiUartBaudRate, &ucOsr, &usSbr);
+
+    UART0_C2 &= ~(UART0_C2_TE_MASK | UART0_C2_RE_MASK);
+    SIM_SOPT2 = (SIM_SOPT2 & ~SIM_SOPT2_UART0SRC_MASK) | SIM_SOPT2_UART0SRC(ucSource);
+    UART0_BDH = (UART0_BDH & ~UART0_BDH_SBR_MASK) | UART0_BDH_SBR(usSbr >> 8);
+    UART0_BDL = UART0_BDL_SBR(usSbr);
+    UART0_C4 = (UART0_C4 & ~UART0_C4_OSR_MASK) | UART0_C4_OSR(ucOsr - 1);
+    if(UART0_OSR_BOTHEDGE > ucOsr)
+        UART0_C5 |= UART0_C5_BOTHEDGE_MASK;
+    else
+        UART0_C5 &= ~UART0_C5_BOTHEDGE_MASK;
+    UART0_C2 |= UART0_C2_TE_MASK | UART0_C2_RE_MASK;
+
+    ucUartStopClock = (UART0_CLOCK_MCGIRCLK == ucSource);
+    return iError;
+}
+
+/* ************************************************ */
+/* Method name:        UART0_applyBaudRate          */
+/* Method description: Wait for the transmission to */
+/*                     end and program the dividers */
+/*                     on the FLL clock             */
+/* Input params:       uiBaudRate: new baud rate    */
+/* Output params:      n/a                          */
+/* ************************************************ */
+static void UART0_applyBaudRate(unsigned int uiBaudRate)
+{
+    /* the last character of the response must leave at the old rate */
+    UART0_flush();
+
+    uiUartBaudRate = uiBaudRate;
+    iUartBaudError = UART0_setClock(UART0_CLOCK_FLL, CLOCK_SYS_GetPllFllClockFreq());
+}
 
 /* ************************************************ */
 /* Method name:        UART0_init               */
@@ -47,6 +200,9 @@ void UART0_init (void)
 
     /* Init the debug console (UART) */
     DbgConsole_Init(BOARD_DEBUG_UART_INSTANCE, BOARD_DEBUG_UART_BAUD, kDebugConsoleLPSCI);
+
+    /* same dividers the baud rate command would choose, so the error is known */
+    UART0_applyBaudRate(BOARD_DEBUG_UART_BAUD);
 }
 
 /* ************************************************ */
@@ -59,6 +215,10 @@ void UART0_init (void)
 /* ************************************************ */
 void UART0_enableIRQ(void)
 {
+    ucUartRxHead = 0;
+    ucUartRxTail = 0;
+    ucUartTxIrq = 1;
+
     /* Enable interruption in the NVIC */
     NVIC_EnableIRQ(UART0_IRQn);
 
@@ -70,14 +230,358 @@ void UART0_enableIRQ(void)
 /* ************************************************ */
 /* Method name:        UART0_IRQHandler             */
 /* Method description: Serial port interruption     */
-/*                     handler method. It Reads the */
-/*                     new character and send it to */
-/*                     the communicationStateMachine*/
+/*                     handler method. It only      */
+/*                     stores the new character in  */
+/*                     the receive buffer and feeds */
+/*                     the transmitter              */
 /* Input params:       n/a                          */
 /* Output params:      n/a                          */
 /* ************************************************ */
 void UART0_IRQHandler(void)
 {
-    processByteCommunication(debug_getchar());
+    unsigned char ucNext;
+
+    /* an overrun stops the receiver until the flag is cleared */
+    if(UART0_S1 & UART0_S1_OR_MASK){
+        UART0_S1 = UART0_S1_OR_MASK;
+        uiUartRxOverflows++;
+        eventlog_write(EVENTLOG_RX_OVERFLOW, 0, (int)uiUartRxOverflows);
+    }
+
+    if((UART0_C2 & UART0_C2_TIE_MASK) && (UART0_S1 & UART0_S1_TDRE_MASK))
+        UART0_sendNext();
+
+    if(UART0_S1 & UART0_S1_RDRF_MASK){
+        unsigned char ucByte = UART0_D;
+
+        if(fUartReceiveCallback){
+            fUartReceiveCallback(ucByte);
+            return;
+        }
+
+        ucNext = (ucUartRxHead + 1) & (UART0_RX_BUFFER_SIZE - 1);
+        if(ucNext == ucUartRxTail){
+            uiUartRxOverflows++;
+            eventlog_write(EVENTLOG_RX_OVERFLOW, 0, (int)uiUartRxOverflows);
+        }else{
+            ucUartRxBuffer[ucUartRxHead] = ucByte;
+            ucUartRxHead = ucNext;
+        }
+    }
+}
+
+/* ************************************************ */
+/* Method name:        UART0_processReceived        */
+/* Method description: Send the buffered characters */
+/*                     to the communicationState-   */
+/*                     Machine and apply a pending  */
+/*                     baud rate or bus mode. Called*/
+/*                     from the main loop           */
+/* Input params:       n/a                          */
+/* Output params:      n/a                          */
+/* ************************************************ */
+void UART0_processReceived(void)
+{
+    /* only the interruption moves the head and only this loop moves the tail */
+    while(ucUartRxTail != ucUartRxHead){
+        processByteCommunication(ucUartRxBuffer[ucUartRxTail]);
+        ucUartRxTail = (ucUartRxTail + 1) & (UART0_RX_BUFFER_SIZE - 1);
+    }
+
+    if(uiUartPendingBaudRate){
+        UART0_applyBaudRate(uiUartPendingBaudRate);
+        eventlog_write(EVENTLOG_BAUD_RATE, 0, (int)uiUartPendingBaudRate);
+        uiUartPendingBaudRate = 0;
+    }
+
+    /* the response went out with the transceiver of the old mode */
+    if(UART0_BUS_NO_CHANGE != ucUartPendingSharedBus){
+        UART0_setSharedBus(ucUartPendingSharedBus);
+        ucUartPendingSharedBus = UART0_BUS_NO_CHANGE;
+    }
+}
+
+/* ************************************************ */
+/* Method name:        UART0_requestBaudRate        */
+/* Method description: Change the baud rate after   */
+/*                     the current response is sent */
+/* Input params:       uiBaudRate: new baud rate    */
+/* Output params:      1 if accepted, 0 if out of   */
+/*                     range or too inaccurate      */
+/* ************************************************ */
+unsigned char UART0_requestBaudRate(unsigned int uiBaudRate)
+{
+    unsigned char ucOsr;
+    unsigned short usSbr;
+    int iError;
+
+    if(UART0_MIN_BAUD > uiBaudRate || UART0_MAX_BAUD < uiBaudRate)
+        return 0;
+
+    iError = UART0_findDividers(CLOCK_SYS_GetPllFllClockFreq(), uiBaudRate, &ucOsr, &usSbr);
+    if(UART0_MAX_BAUD_ERROR < iError || -(int)UART0_MAX_BAUD_ERROR > iError)
+        return 0;
+
+    uiUartPendingBaudRate = uiBaudRate;
+    return 1;
+}
+
+/* ************************************************ */
+/* Method name:        UART0_getBaudRate            */
+/* Method description: Baud rate in use             */
+/* Input params:       n/a                          */
+/* Output params:      baud rate                    */
+/* ************************************************ */
+unsigned int UART0_getBaudRate(void)
+{
+    return uiUartBaudRate;
+}
+
+/* ************************************************ */
+/* Method name:        UART0_getBaudError           */
+/* Method description: Error of the real baud rate  */
+/*                     against the requested one    */
+/* Input params:       n/a                          */
+/* Output params:      error in hundredths of       */
+/*                     percent, negative if slower  */
+/* ************************************************ */
+int UART0_getBaudError(void)
+{
+    return iUartBaudError;
+}
+
+/* ************************************************ */
+/* Method name:        UART0_setReceiveCallback     */
+/* Method description: Hand the received bytes to a */
+/*                     protocol that needs their    */
+/*                     timing (Modbus RTU). The     */
+/*                     callback runs in the UART    */
+/*                     interruption                 */
+/* Input params:       fCallback: function called   */
+/*                     with each byte, 0 to go back */
+/*                     to the receive buffer        */
+/* Output params:      n/a                          */
+/* ************************************************ */
+void UART0_setReceiveCallback(uart_receive_callback_t fCallback)
+{
+    fUartReceiveCallback = fCallback;
+}
+
+/* ************************************************ */
+/* Method name:        UART0_setSharedBus           */
+/* Method description: Drive the RS-485 transceiver */
+/*                     enable and wait the          */
+/*                     turnaround before answers    */
+/* Input params:       ucShared: 1 on a multi-drop  */
+/*                     bus, 0 point to point        */
+/* Output params:      n/a                          */
+/* ************************************************ */
+void UART0_setSharedBus(unsigned char ucShared)
+{
+    /* driver enable as output, low (receiving) */
+    SIM_SCGC5 |= SIM_SCGC5_PORTE_MASK;
+    RS485_DE_PORT_BASE_PNT->PCR[RS485_DE_PIN] = PORT_PCR_MUX(RS485_DE_ALT);
+    RS485_DE_GPIO_BASE_PNT->PCOR = 1U << RS485_DE_PIN;
+    RS485_DE_GPIO_BASE_PNT->PDDR |= 1U << RS485_DE_PIN;
+
+    ucUartSharedBus = ucShared;
+}
+
+/* ************************************************ */
+/* Method name:        UART0_requestSharedBus       */
+/* Method description: Change the bus mode after the*/
+/*                     current response is sent     */
+/* Input params:       ucShared: 1 on a multi-drop  */
+/*                     bus, 0 point to point        */
+/* Output params:      n/a                          */
+/* ************************************************ */
+void UART0_requestSharedBus(unsigned char ucShared)
+{
+    ucUartPendingSharedBus = ucShared ? 1U : 0U;
+}
+
+/* ************************************************ */
+/* Method name:        UART0_transmitBegin          */
+/* Method description: Take the bus for an answer   */
+/* Input params:       n/a                          */
+/* Output params:      n/a                          */
+/* ************************************************ */
+void UART0_transmitBegin(void)
+{
+    /* UART0_TURNAROUND_CHARS characters of 10 bits, at any core clock */
+    unsigned int uiUs = (UART0_TURNAROUND_CHARS * 10U * 1000000U + uiUartBaudRate - 1) / uiUartBaudRate;
+
+    if(!ucUartSharedBus)
+        return;
+
+    delay_us(uiUs);
+    RS485_DE_GPIO_BASE_PNT->PSOR = 1U << RS485_DE_PIN;
+}
+
+/* ************************************************ */
+/* Method name:        UART0_transmitEnd            */
+/* Method description: Release the bus when the     */
+/*                     last character of the answer */
+/*                     has left                     */
+/* Input params:       n/a                          */
+/* Output params:      n/a                          */
+/* ************************************************ */
+void UART0_transmitEnd(void)
+{
+    if(!ucUartSharedBus)
+        return;
+
+    UART0_flush();
+    RS485_DE_GPIO_BASE_PNT->PCOR = 1U << RS485_DE_PIN;
 }
 
+/* ************************************************ */
+/* Method name:        UART0_putChar                */
+/* Method description: Queue a byte to be sent by   */
+/*                     the interruption. Waits only */
+/*                     while the buffer is full     */
+/* Input params:       ucByte: byte to send         */
+/* Output params:      n/a                          */
+/* ************************************************ */
+void UART0_putChar(unsigned char ucByte)
+{
+    unsigned char ucNext = (ucUartTxHead + 1) & (UART0_TX_BUFFER_SIZE - 1);
+
+    /* with the interruptions masked (or not enabled yet) nobody else empties the buffer */
+    while(ucNext == ucUartTxTail){
+        if((!ucUartTxIrq || __get_PRIMASK()) && (UART0_S1 & UART0_S1_TDRE_MASK))
+            UART0_sendNext();
+    }
+
+    ucUartTxBuffer[ucUartTxHead] = ucByte;
+    ucUartTxHead = ucNext;
+
+    if(ucUartTxIrq)
+        UART0_C2 |= UART0_C2_TIE_MASK;
+    else
+        while(ucUartTxTail != ucUartTxHead)
+            if(UART0_S1 & UART0_S1_TDRE_MASK)
+                UART0_sendNext();
+}
+
+/* ************************************************ */
+/* Method name:        UART0_flush                  */
+/* Method description: Wait until the queued bytes  */
+/*                     and the last stop bit have   */
+/*                     left                         */
+/* Input params:       n/a                          */
+/* Output params:      n/a                          */
+/* ************************************************ */
+void UART0_flush(void)
+{
+    while(ucUartTxTail != ucUartTxHead){
+        if((!ucUartTxIrq || __get_PRIMASK()) && (UART0_S1 & UART0_S1_TDRE_MASK))
+            UART0_sendNext();
+    }
+    while(!(UART0_S1 & UART0_S1_TC_MASK));
+}
+
+/* ************************************************ */
+/* Method name:        UART0_getRxOverflows         */
+/* Method description: Characters lost because the  */
+/*                     receive buffer was full      */
+/* Input params:       n/a                          */
+/* Output params:      number of characters         */
+/* ************************************************ */
+unsigned int UART0_getRxOverflows(void)
+{
+    return uiUartRxOverflows;
+}
+
+/* ************************************************ */
+/* Method name:        UART0_hasReceived            */
+/* Method description: Check if there are bytes the */
+/*                     main loop did not process    */
+/* Input params:       n/a                          */
+/* Output params:      1 if there are, 0 if not     */
+/* ************************************************ */
+unsigned char UART0_hasReceived(void)
+{
+    return ucUartRxTail != ucUartRxHead;
+}
+
+/* ************************************************ */
+/* Method name:        UART0_isIdle                 */
+/* Method description: Check that nothing is being  */
+/*                     sent or received and no baud */
+/*                     rate or bus mode change is   */
+/*                     pending                      */
+/* Input params:       n/a                          */
+/* Output params:      1 if idle, 0 if not          */
+/* ************************************************ */
+unsigned char UART0_isIdle(void)
+{
+    return ucUartTxTail == ucUartTxHead && (UART0_S1 & UART0_S1_TC_MASK)
+           && !(UART0_S2 & UART0_S2_RAF_MASK) && 0 == uiUartPendingBaudRate
+           && UART0_BUS_NO_CHANGE == ucUartPendingSharedBus;
+}
+
+/* ************************************************ */
+/* Method name:        UART0_enterStopClock         */
+/* Method description: Move the UART0 to MCGIRCLK,  */
+/*                     which runs in VLPR and VLPS, */
+/*                     so a received byte wakes the */
+/*                     MCU and is not lost. Called  */
+/*                     with the interruptions masked*/
+/* Input params:       n/a                          */
+/* Output params:      1 on MCGIRCLK, 0 if the line */
+/*                     is busy or the baud rate is  */
+/*                     too far from its dividers    */
+/* ************************************************ */
+unsigned char UART0_enterStopClock(void)
+{
+    unsigned char ucOsr;
+    unsigned short usSbr;
+    unsigned int uiClock = CLOCK_SYS_GetInternalRefClockFreq();
+    int iError;
+
+    if(ucUartStopClock)
+        return 1;
+    if(!UART0_isIdle())
+        return 0;
+
+    iError = UART0_findDividers(uiClock, uiUartBaudRate, &ucOsr, &usSbr);
+    if(UART0_MAX_BAUD_ERROR < iError || -(int)UART0_MAX_BAUD_ERROR > iError)
+        return 0;
+
+    UART0_setClock(UART0_CLOCK_MCGIRCLK, uiClock);
+    return 1;
+}
+
+/* ************************************************ */
+/* Method name:        UART0_exitStopClock          */
+/* Method description: Move the UART0 back to the   */
+/*                     FLL once it is locked again, */
+/*                     the IRC drifts with the      */
+/*                     temperature. Called with the */
+/*                     interruptions masked         */
+/* Input params:       n/a                          */
+/* Output params:      1 on the FLL, 0 if the line  */
+/*                     is busy                      */
+/* ************************************************ */
+unsigned char UART0_exitStopClock(void)
+{
+    if(!ucUartStopClock)
+        return 1;
+    if(!UART0_isIdle())
+        return 0;
+
+    iUartBaudError = UART0_setClock(UART0_CLOCK_FLL, CLOCK_SYS_GetPllFllClockFreq());
+    return 1;
+}
+
+/* ************************************************ */
+/* Method name:        UART0_isOnStopClock          */
+/* Method description: Check the UART0 clock        */
+/* Input params:       n/a                          */
+/* Output params:      1 on MCGIRCLK, 0 on the FLL  */
+/* ************************************************ */
+unsigned char UART0_isOnStopClock(void)
+{
+    return ucUartStopClock;
+}
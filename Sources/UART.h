@@ -9,6 +9,39 @@
 #ifndef UART_H_
 #define UART_H_
 
+/* received bytes waiting for the main loop, must be a power of 2 */
+#define UART0_RX_BUFFER_SIZE    64U
+
+/* bytes waiting to be sent by the interruption, must be a power of 2 */
+#define UART0_TX_BUFFER_SIZE    128U
+
+/*
+ * baud rates accepted by UART0_requestBaudRate. With the 40 MHz FLL clock
+ * (FEE, see mcg.c) baud = 40 MHz / (OSR * SBR), and the best dividers give:
+ *
+ *    baud     OSR  SBR   error
+ *    9600      9   463  -0.01 %
+ *    19200     4   521  -0.03 %
+ *    38400     7   149  -0.13 %
+ *    57600     5   139  -0.08 %
+ *    115200   29    12  -0.22 %
+ *    230400   29     6  -0.22 %
+ *    460800   29     3  -0.22 %
+ *    921600   22     2  -1.36 %   (above UART0_MAX_BAUD)
+ *
+ * 8N1 frames tolerate about 2 % between both ends, so the error of
+ * the board is kept under UART0_MAX_BAUD_ERROR
+ */
+#define UART0_MIN_BAUD          9600U
+#define UART0_MAX_BAUD          460800U
+#define UART0_MAX_BAUD_ERROR    100U        // in hundredths of percent (1 %)
+
+/* silence before an answer on a shared bus, lets the master release the line */
+#define UART0_TURNAROUND_CHARS  2U
+
+/* takes the received bytes in the interruption instead of the buffer */
+typedef void (*uart_receive_callback_t)(unsigned char ucByte);
+
 /* ************************************************ */
 /* Method name:        UART_init                    */
 /* Method description: Initialize the UART0         */
@@ -31,12 +64,189 @@ void UART0_enableIRQ(void);
 /* ************************************************ */
 /* Method name:        UART0_IRQHandler             */
 /* Method description: Serial port interruption     */
-/*                     handler method. It Reads the */
-/*                     new character and send it to */
-/*                     the communicationStateMachine*/
+/*                     handler method. It only      */
+/*                     stores the new character in  */
+/*                     the receive buffer           */
 /* Input params:       n/a                          */
 /* Output params:      n/a                          */
 /* ************************************************ */
 void UART0_IRQHandler(void);
 
+/* ************************************************ */
+/* Method name:        UART0_processReceived        */
+/* Method description: Send the buffered characters */
+/*                     to the communicationState-   */
+/*                     Machine and apply a pending  */
+/*                     baud rate. Called from the   */
+/*                     main loop                    */
+/* Input params:       n/a                          */
+/* Output params:      n/a                          */
+/* ************************************************ */
+void UART0_processReceived(void);
+
+/* ************************************************ */
+/* Method name:        UART0_requestBaudRate        */
+/* Method description: Change the baud rate after   */
+/*                     the current response is sent */
+/* Input params:       uiBaudRate: new baud rate    */
+/* Output params:      1 if accepted, 0 if out of   */
+/*                     range or too inaccurate      */
+/* ************************************************ */
+unsigned char UART0_requestBaudRate(unsigned int uiBaudRate);
+
+/* ************************************************ */
+/* Method name:        UART0_getBaudRate            */
+/* Method description: Baud rate in use             */
+/* Input params:       n/a                          */
+/* Output params:      baud rate                    */
+/* ************************************************ */
+unsigned int UART0_getBaudRate(void);
+
+/* ************************************************ */
+/* Method name:        UART0_getBaudError           */
+/* Method description: Error of the real baud rate  */
+/*                     against the requested one    */
+/* Input params:       n/a                          */
+/* Output params:      error in hundredths of       */
+/*                     percent, negative if slower  */
+/* ************************************************ */
+int UART0_getBaudError(void);
+
+/* ************************************************ */
+/* Method name:        UART0_setReceiveCallback     */
+/* Method description: Hand the received bytes to a */
+/*                     protocol that needs their    */
+/*                     timing (Modbus RTU). The     */
+/*                     callback runs in the UART    */
+/*                     interruption                 */
+/* Input params:       fCallback: function called   */
+/*                     with each byte, 0 to go back */
+/*                     to the receive buffer        */
+/* Output params:      n/a                          */
+/* ************************************************ */
+void UART0_setReceiveCallback(uart_receive_callback_t fCallback);
+
+/* ************************************************ */
+/* Method name:        UART0_setSharedBus           */
+/* Method description: Drive the RS-485 transceiver */
+/*                     enable and wait the          */
+/*                     turnaround before answers    */
+/* Input params:       ucShared: 1 on a multi-drop  */
+/*                     bus, 0 point to point        */
+/* Output params:      n/a                          */
+/* ************************************************ */
+void UART0_setSharedBus(unsigned char ucShared);
+
+/* ************************************************ */
+/* Method name:        UART0_requestSharedBus       */
+/* Method description: Change the bus mode after the*/
+/*                     current response is sent     */
+/* Input params:       ucShared: 1 on a multi-drop  */
+/*                     bus, 0 point to point        */
+/* Output params:      n/a                          */
+/* ************************************************ */
+void UART0_requestSharedBus(unsigned char ucShared);
+
+/* ************************************************ */
+/* Method name:        UART0_transmitBegin          */
+/* Method description: Take the bus for an answer   */
+/* Input params:       n/a                          */
+/* Output params:      n/a                          */
+/* ************************************************ */
+void UART0_transmitBegin(void);
+
+/* ************************************************ */
+/* Method name:        UART0_transmitEnd            */
+/* Method description: Release the bus when the     */
+/*                     last character of the answer */
+/*                     has left                     */
+/* Input params:       n/a                          */
+/* Output params:      n/a                          */
+/* ************************************************ */
+void UART0_transmitEnd(void);
+
+/* ************************************************ */
+/* Method name:        UART0_putChar                */
+/* Method description: Queue a byte to be sent by   */
+/*                     the interruption. Waits only */
+/*                     while the buffer is full     */
+/* Input params:       ucByte: byte to send         */
+/* Output params:      n/a                          */
+/* ************************************************ */
+void UART0_putChar(unsigned char ucByte);
+
+/* ************************************************ */
+/* Method name:        UART0_flush                  */
+/* Method description: Wait until the queued bytes  */
+/*                     and the last stop bit have   */
+/*                     left                         */
+/* Input params:       n/a                          */
+/* Output params:      n/a                          */
+/* ************************************************ */
+void UART0_flush(void);
+
+/* ************************************************ */
+/* Method name:        UART0_getRxOverflows         */
+/* Method description: Characters lost because the  */
+/*                     receive buffer was full      */
+/* Input params:       n/a                          */
+/* Output params:      number of characters         */
+/* ************************************************ */
+unsigned int UART0_getRxOverflows(void);
+
+/* ************************************************ */
+/* Method name:        UART0_hasReceived            */
+/* Method description: Check if there are bytes the */
+/*                     main loop did not process    */
+/* Input params:       n/a                          */
+/* Output params:      1 if there are, 0 if not     */
+/* ************************************************ */
+unsigned char UART0_hasReceived(void);
+
+/* ************************************************ */
+/* Method name:        UART0_isIdle                 */
+/* Method description: Check that nothing is being  */
+/*                     sent or received and no baud */
+/*                     rate or bus mode change is   */
+/*                     pending                      */
+/* Input params:       n/a                          */
+/* Output params:      1 if idle, 0 if not          */
+/* ************************************************ */
+unsigned char UART0_isIdle(void);
+
+/* ************************************************ */
+/* Method name:        UART0_enterStopClock         */
+/* Method description: Move the UART0 to MCGIRCLK,  */
+/*                     which runs in VLPR and VLPS, */
+/*                     so a received byte wakes the */
+/*                     MCU and is not lost. Called  */
+/*                     with the interruptions masked*/
+/* Input params:       n/a                          */
+/* Output params:      1 on MCGIRCLK, 0 if the line */
+/*                     is busy or the baud rate is  */
+/*                     too far from its dividers    */
+/* ************************************************ */
+unsigned char UART0_enterStopClock(void);
+
+/* ************************************************ */
+/* Method name:        UART0_exitStopClock          */
+/* Method description: Move the UART0 back to the   */
+/*                     FLL once it is locked again, */
+/*                     the IRC drifts with the      */
+/*                     temperature. Called with the */
+/*                     interruptions masked         */
+/* Input params:       n/a                          */
+/* Output params:      1 on the FLL, 0 if the line  */
+/*                     is busy                      */
+/* ************************************************ */
+unsigned char UART0_exitStopClock(void);
+
+/* ************************************************ */
+/* Method name:        UART0_isOnStopClock          */
+/* Method description: Check the UART0 clock        */
+/* Input params:       n/a                          */
+/* Output params:      1 on MCGIRCLK, 0 on the FLL  */
+/* ************************************************ */
+unsigned char UART0_isOnStopClock(void);
+
 #endif /* UART_H_ */
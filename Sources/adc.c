@@ -11,12 +11,17 @@
 
 #include "board.h"
 #include "adc.h"
+#include "fsl_clock_manager.h"
 #include "lut_adc_3v3.h"
 
 #define ADC0_SC1A_COCO (ADC0_SC1A >> 7)
 #define ADC0_SC2_ADACT (ADC0_SC2 >> 7)
 
 #define ADC_CFG1_BUS_CLK_2   01U
+#define ADC_CFG1_ASYNC_CLK   03U
+
+/* 16-bit conversions need an ADC clock of at least 2 MHz */
+#define ADC_MIN_CLOCK_HZ     2000000U
 #define ADC_CFG1_CONVERSION  11U
 #define ADC_CFG1_SAMPLE_TIME  0U
 #define ADC_CFG1_CLK_DIVIDER 00U
@@ -83,6 +88,26 @@ void adc_initADCModule(void)
 }
 
 
+/* ************************************************** */
+/* Method name:        adc_updateClock                */
+/* Method description: Choose the ADC clock after a   */
+/*                     bus clock change: bus/2 in RUN,*/
+/*                     the asynchronous ADACK when    */
+/*                     the bus is too slow (VLPR)     */
+/* Input params:       n/a                            */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void adc_updateClock(void)
+{
+    unsigned int uiClock = ADC_CFG1_BUS_CLK_2;
+
+    if(ADC_MIN_CLOCK_HZ > CLOCK_SYS_GetBusClockFreq() / 2U)
+        uiClock = ADC_CFG1_ASYNC_CLK;
+
+    ADC0_CFG1 = (ADC0_CFG1 & ~ADC_CFG1_ADICLK_MASK) | ADC_CFG1_ADICLK(uiClock);
+}
+
+
 /* ************************************************** */
 /* Method name:        adc_initConvertion             */
 /* Method description: init a conversion from A to D  */
@@ -22,6 +22,18 @@
 void adc_initADCModule(void);
 
 
+/* ************************************************** */
+/* Method name:        adc_updateClock                */
+/* Method description: Choose the ADC clock after a   */
+/*                     bus clock change: bus/2 in RUN,*/
+/*                     the asynchronous ADACK when    */
+/*                     the bus is too slow (VLPR)     */
+/* Input params:       n/a                            */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void adc_updateClock(void);
+
+
 /* ************************************************** */
 /* Method name:        adc_initConvertion             */
 /* Method description: init a conversion from A to D  */
@@ -10,7 +10,19 @@
 
 #include "board.h"
 #include "aquecedorECooler.h"
-#include "util.h"
+#include "delay.h"
+#include "fsl_clock_manager.h"
+
+/* PWM period: 0xFFFF counts of MCGFLLCLK/32 (1.25 MHz), kept on the other TPM clocks */
+#define PWM_PERIOD_US       52428U
+#define PWM_MAX_PRESCALER   7U
+
+/* CnSC mode and level bits, and the time a write to them takes to be acknowledged (a few TPM clocks) */
+#define PWM_CHANNEL_MODE_MASK   0x3CU
+#define PWM_CHANNEL_ACK_US      10U
+
+/* counts of a PWM period, the 100% duty cycle */
+unsigned int uiPwmPeriodCounts = 0xFFFF;
 
 
 /* ************************************************ */
@@ -21,6 +33,8 @@
 /* Output params:      n/a                          */
 /* ************************************************ */
 void PWM_init(void){
+    unsigned int uiDeadline;
+
     /* release clock to TPM1 */
     SIM_SCGC6 |= 1<<25;
 
@@ -61,13 +75,49 @@ void PWM_init(void){
     TPM1_C1SC = uiTPM1_C1SC_aux;
 
     /*
-     * Initializes both duty cycles to 0%
-     * -obs: delay needed to ensure code will work if any changes to the duty cycle
-     *       are made shortly after this method is called
+     * The channel mode writes are synchronized to the TPM clock, wait for them
+     * before the CnV writes, so a duty cycle set right after this method is kept
     */
+    uiDeadline = delay_getDeadlineUs(PWM_CHANNEL_ACK_US);
+    while(((TPM1_C0SC & PWM_CHANNEL_MODE_MASK) != (uiTPM1_C0SC_aux & PWM_CHANNEL_MODE_MASK) ||
+           (TPM1_C1SC & PWM_CHANNEL_MODE_MASK) != (uiTPM1_C1SC_aux & PWM_CHANNEL_MODE_MASK)) &&
+          !delay_isExpiredUs(uiDeadline));
+
+    /* Initializes both duty cycles to 0% */
     TPM1_C0V = 0x0000;
     TPM1_C1V = 0x0000;
-    util_genDelay100ms();
+}
+
+/* ************************************************ */
+/* Method name:        PWM_updateClock              */
+/* Method description: Keep the PWM frequency and   */
+/*                     the duty cycles after a TPM  */
+/*                     clock change (MCGFLLCLK in   */
+/*                     RUN, MCGIRCLK in VLPR)       */
+/* Input params:       n/a                          */
+/* Output params:      n/a                          */
+/* ************************************************ */
+void PWM_updateClock(void){
+    float fHeaterDuty = getDutyCycleHeater();
+    float fCoolerDuty = getDutyCycleCooler();
+    unsigned int uiClockKhz = CLOCK_SYS_GetTpmFreq(1U) / 1000U;
+    unsigned int uiPrescaler = 0;
+
+    /* smallest prescaler whose period fits in the 16 bits counter */
+    while(PWM_MAX_PRESCALER > uiPrescaler && 0xFFFFU < (uiClockKhz >> uiPrescaler) * PWM_PERIOD_US / 1000U)
+        uiPrescaler++;
+    uiPwmPeriodCounts = (uiClockKhz >> uiPrescaler) * PWM_PERIOD_US / 1000U;
+
+    /* the prescaler can only be written with the counter stopped */
+    TPM1_SC &= ~TPM_SC_CMOD_MASK;
+    while(TPM1_SC & TPM_SC_CMOD_MASK);
+    TPM1_SC = (TPM1_SC & ~TPM_SC_PS_MASK) | TPM_SC_PS(uiPrescaler);
+    TPM1_CNT = 0;
+    TPM1_MOD = uiPwmPeriodCounts - 1U;
+
+    heater_PWMDuty(fHeaterDuty);
+    coolerfan_PWMDuty(fCoolerDuty);
+    TPM1_SC |= TPM_SC_CMOD(1);
 }
 
 /* **************************************************** */
@@ -113,7 +163,7 @@ void coolerfan_PWMDuty(float fCoolerDuty){
     if(0 <= fCoolerDuty && 1 >= fCoolerDuty){
 
         /* Sets a float variable that multiply the max count value with the duty cycle */
-        float fDC = 0xFFFF;
+        float fDC = (float)uiPwmPeriodCounts;
         fDC = fDC*fCoolerDuty;
 
         /* convert value to int and pass it to the duty cycle register, setting the new DC  */
@@ -134,7 +184,7 @@ void heater_PWMDuty(float fHeaterDuty){
     if(0 <= fHeaterDuty && 1 >= fHeaterDuty){
 
         /* Sets a float variable that multiply the max count value with the duty cycle */
-        float fDC = 0xFFFF;
+        float fDC = (float)uiPwmPeriodCounts;
         fDC = fDC*fHeaterDuty;
 
         /* convert value to int and pass it to the duty cycle register, setting the new DC  */
@@ -150,7 +200,7 @@ void heater_PWMDuty(float fHeaterDuty){
 /* *************************************************************************** */
 float getDutyCycleCooler(){
     unsigned int uiCounter = TPM1_C1V;
-    float fDC = (float)(uiCounter) / (float)(0xFFFF);
+    float fDC = (float)(uiCounter) / (float)(uiPwmPeriodCounts);
     return fDC;
 }
 
@@ -162,6 +212,6 @@ float getDutyCycleCooler(){
 /* *************************************************************************** */
 float getDutyCycleHeater(){
     unsigned int uiCounter = TPM1_C0V;
-    float fDC = (float)(uiCounter) / (float)(0xFFFF);
+    float fDC = (float)(uiCounter) / (float)(uiPwmPeriodCounts);
     return fDC;
 }
@@ -19,6 +19,17 @@
 /* ************************************************ */
 void PWM_init(void);
 
+/* ************************************************ */
+/* Method name:        PWM_updateClock              */
+/* Method description: Keep the PWM frequency and   */
+/*                     the duty cycles after a TPM  */
+/*                     clock change (MCGFLLCLK in   */
+/*                     RUN, MCGIRCLK in VLPR)       */
+/* Input params:       n/a                          */
+/* Output params:      n/a                          */
+/* ************************************************ */
+void PWM_updateClock(void);
+
 /* **************************************************** */
 /* Method name:        coolerfan_init                   */
 /* Method description: Initialize the fan cooler device */
@@ -0,0 +1,415 @@
+/* ***************************************************************** */
+/* File name:        binaryProtocol.c                                */
+/* File description: Framed binary command protocol: frame parser    */
+/*                   with CRC check, command execution and responses */
+/* Author name:      Grupo 18 - Renato Pepe                          */
+/*                              Joao Victor Matoso                   */
+/* Creation date:    19oct2026                                       */
+/* Revision date:    19oct2026                                       */
+/* ***************************************************************** */
+
+#include "binaryProtocol.h"
+#include "crc16.h"
+#include "delay.h"
+#include "console.h"
+#include "paramRegistry.h"
+#include "UART.h"
+
+/* states of the frame parser */
+#define BINPROTO_WAIT_SOF       0U
+#define BINPROTO_LEN            1U
+#define BINPROTO_SEQ            2U
+#define BINPROTO_CMD            3U
+#define BINPROTO_PAYLOAD        4U
+#define BINPROTO_CRC_LOW        5U
+#define BINPROTO_CRC_HIGH       6U
+
+/* SOF, LEN, SEQ, CMD and the 2 CRC bytes */
+#define BINPROTO_OVERHEAD       6U
+
+/* bytes of each entry in the GET response and in the SET request */
+#define BINPROTO_GET_ENTRY      6U
+#define BINPROTO_SET_ENTRY      5U
+
+typedef union {
+    float fValue;
+    unsigned int uiValue;
+    int iValue;
+} binproto_value_type;
+
+/* frame being received */
+unsigned char ucBinprotoState = BINPROTO_WAIT_SOF;
+unsigned char ucBinprotoLength;
+unsigned char ucBinprotoSeq;
+unsigned char ucBinprotoCmd;
+unsigned char ucBinprotoPayload[BINPROTO_MAX_PAYLOAD];
+unsigned char ucBinprotoCount;
+unsigned short usBinprotoCrc;
+unsigned short usBinprotoReceivedCrc;
+
+/* last response sent, repeated when the same request arrives again */
+unsigned char ucBinprotoResponse[BINPROTO_MAX_PAYLOAD + BINPROTO_OVERHEAD];
+unsigned char ucBinprotoResponseLength = 0;
+unsigned char ucBinprotoLastSeq;
+unsigned short usBinprotoLastCrc;
+
+/* discards a frame that stopped in the middle, restarted on every byte */
+unsigned int uiBinprotoDeadline;
+
+/* statistics, read with #gq */
+unsigned int uiBinprotoFrames = 0;      // frames with a valid CRC, retries included
+unsigned int uiBinprotoErrors = 0;      // bad CRC, bad length or timeout
+
+/* ************************************************** */
+/* Method name:        binaryProtocol_getGapMs        */
+/* Method description: Silence that discards a frame  */
+/*                     being received: a maximum      */
+/*                     frame at the current baud rate */
+/* Input params:       n/a                            */
+/* Output params:      milliseconds                   */
+/* ************************************************** */
+static unsigned int binaryProtocol_getGapMs(void)
+{
+    unsigned int uiBaudRate = UART0_getBaudRate();
+    unsigned int uiGapMs = ((BINPROTO_MAX_PAYLOAD + BINPROTO_OVERHEAD) * 10U * 1000U + uiBaudRate - 1U) / uiBaudRate;
+
+    return (BINPROTO_GAP_MIN_MS > uiGapMs) ? BINPROTO_GAP_MIN_MS : uiGapMs;
+}
+
+/* ************************************************** */
+/* Method name:        binaryProtocol_isStale         */
+/* Method description: Check if the frame being       */
+/*                     received stopped in the middle */
+/* Input params:       n/a                            */
+/* Output params:      1 if it did, 0 if not          */
+/* ************************************************** */
+static unsigned char binaryProtocol_isStale(void)
+{
+    return BINPROTO_WAIT_SOF != ucBinprotoState && delay_isExpiredMs(uiBinprotoDeadline);
+}
+
+/* ************************************************** */
+/* Method name:        binaryProtocol_putValue        */
+/* Method description: Write 4 bytes little endian    */
+/* Input params:       pucBuffer: destination         */
+/*                     uiValue: value                 */
+/* Output params:      n/a                            */
+/* ************************************************** */
+static void binaryProtocol_putValue(unsigned char *pucBuffer, unsigned int uiValue)
+{
+    pucBuffer[0] = (unsigned char)uiValue;
+    pucBuffer[1] = (unsigned char)(uiValue >> 8);
+    pucBuffer[2] = (unsigned char)(uiValue >> 16);
+    pucBuffer[3] = (unsigned char)(uiValue >> 24);
+}
+
+/* ************************************************** */
+/* Method name:        binaryProtocol_getValue        */
+/* Method description: Read 4 bytes little endian     */
+/* Input params:       pucBuffer: source              */
+/* Output params:      value                          */
+/* ************************************************** */
+static unsigned int binaryProtocol_getValue(const unsigned char *pucBuffer)
+{
+    return (unsigned int)pucBuffer[0] | ((unsigned int)pucBuffer[1] << 8)
+         | ((unsigned int)pucBuffer[2] << 16) | ((unsigned int)pucBuffer[3] << 24);
+}
+
+/* ************************************************** */
+/* Method name:        binaryProtocol_buildFrame      */
+/* Method description: Put SOF, header and CRC around */
+/*                     a payload                      */
+/* Input params:       pucFrame: destination, room    */
+/*                     for the payload plus           */
+/*                     BINPROTO_OVERHEAD bytes        */
+/*                     ucCmd, ucSeq: header           */
+/*                     pucPayload: payload            */
+/*                     ucLength: payload length       */
+/* Output params:      frame length                   */
+/* ************************************************** */
+static unsigned char binaryProtocol_buildFrame(unsigned char *pucFrame, unsigned char ucCmd, unsigned char ucSeq,
+                                               const unsigned char *pucPayload, unsigned char ucLength)
+{
+    unsigned short usCrc;
+    unsigned char ucIndex;
+
+    pucFrame[0] = BINPROTO_SOF;
+    pucFrame[1] = ucLength;
+    pucFrame[2] = ucSeq;
+    pucFrame[3] = ucCmd;
+    for(ucIndex = 0; ucIndex < ucLength; ucIndex++)
+        pucFrame[4 + ucIndex] = pucPayload[ucIndex];
+
+    usCrc = crc16_compute(&pucFrame[1], 3 + ucLength);
+    pucFrame[4 + ucLength] = (unsigned char)usCrc;
+    pucFrame[5 + ucLength] = (unsigned char)(usCrc >> 8);
+    return ucLength + BINPROTO_OVERHEAD;
+}
+
+/* ************************************************** */
+/* Method name:        binaryProtocol_send            */
+/* Method description: Frame and send the response to */
+/*                     an executed request, and keep  */
+/*                     it for retransmission          */
+/* Input params:       ucCmd: response command        */
+/*                     pucPayload: response payload   */
+/*                     ucLength: payload length       */
+/* Output params:      n/a                            */
+/* ************************************************** */
+static void binaryProtocol_send(unsigned char ucCmd, const unsigned char *pucPayload, unsigned char ucLength)
+{
+    unsigned char ucIndex;
+
+    ucBinprotoResponseLength = binaryProtocol_buildFrame(ucBinprotoResponse, ucCmd, ucBinprotoSeq, pucPayload, ucLength);
+
+    for(ucIndex = 0; ucIndex < ucBinprotoResponseLength; ucIndex++)
+        console_putChar(ucBinprotoResponse[ucIndex]);
+}
+
+/* ************************************************** */
+/* Method name:        binaryProtocol_execute         */
+/* Method description: Run the command of a valid     */
+/*                     frame and send the response    */
+/* Input params:       n/a                            */
+/* Output params:      n/a                            */
+/* ************************************************** */
+static void binaryProtocol_execute(void)
+{
+    unsigned char ucResponse[BINPROTO_MAX_PAYLOAD];
+    unsigned char ucStatus = BINPROTO_STATUS_OK;
+    unsigned char ucIndex, ucLength = 0;
+
+    switch(ucBinprotoCmd){
+    case BINPROTO_CMD_PING:
+        break;
+
+    case BINPROTO_CMD_GET:
+        if(BINPROTO_MAX_PAYLOAD < ucBinprotoLength * BINPROTO_GET_ENTRY){
+            ucStatus = BINPROTO_STATUS_LENGTH;
+            break;
+        }
+        for(ucIndex = 0; ucIndex < ucBinprotoLength && BINPROTO_STATUS_OK == ucStatus; ucIndex++){
+            const param_descriptor_type *pParam = param_findGet(ucBinprotoPayload[ucIndex]);
+            binproto_value_type value;
+
+            if(pParam && pParam->fGet){
+                float fValue = pParam->fGet();
+
+                /* floats go as they are, the other formats as integers */
+                ucResponse[ucLength] = pParam->ucLetter;
+                if(PARAM_FORMAT_FLOAT == pParam->ucFormat){
+                    ucResponse[ucLength + 1] = BINPROTO_TYPE_FLOAT;
+                    value.fValue = fValue;
+                }else if(PARAM_FORMAT_INT == pParam->ucFormat){
+                    ucResponse[ucLength + 1] = BINPROTO_TYPE_INT;
+                    value.iValue = (int)fValue;
+                }else{
+                    ucResponse[ucLength + 1] = BINPROTO_TYPE_UINT;
+                    value.uiValue = (unsigned int)fValue;
+                }
+                binaryProtocol_putValue(&ucResponse[ucLength + 2], value.uiValue);
+                ucLength += BINPROTO_GET_ENTRY;
+            }else{
+                ucStatus = BINPROTO_STATUS_UNKNOWN_PARAM;
+            }
+        }
+        break;
+
+    case BINPROTO_CMD_SET:
+        if(0 == ucBinprotoLength || 0 != ucBinprotoLength % BINPROTO_SET_ENTRY){
+            ucStatus = BINPROTO_STATUS_LENGTH;
+            break;
+        }
+        /* stops at the first parameter refused */
+        for(ucIndex = 0; ucIndex < ucBinprotoLength && BINPROTO_STATUS_OK == ucStatus; ucIndex += BINPROTO_SET_ENTRY){
+            const param_descriptor_type *pParam = param_findSet(ucBinprotoPayload[ucIndex]);
+            binproto_value_type value;
+
+            value.uiValue = binaryProtocol_getValue(&ucBinprotoPayload[ucIndex + 1]);
+            if(!pParam){
+                ucStatus = BINPROTO_STATUS_UNKNOWN_PARAM;
+            }else if(PARAM_OK != param_set(pParam, value.fValue)){
+                ucStatus = BINPROTO_STATUS_RANGE;
+            }
+        }
+        ucResponse[0] = ucStatus;
+        ucLength = 1;
+        break;
+
+    default:
+        ucStatus = BINPROTO_STATUS_UNKNOWN_CMD;
+    }
+
+    if(BINPROTO_STATUS_OK != ucStatus && BINPROTO_CMD_SET != ucBinprotoCmd){
+        binaryProtocol_send(BINPROTO_CMD_NAK, &ucStatus, 1);
+    }else{
+        binaryProtocol_send(ucBinprotoCmd | BINPROTO_RESPONSE_MASK, ucResponse, ucLength);
+    }
+}
+
+/* ************************************************** */
+/* Method name:        binaryProtocol_frameReceived   */
+/* Method description: Check the CRC and duplicates   */
+/*                     of a complete frame            */
+/* Input params:       n/a                            */
+/* Output params:      n/a                            */
+/* ************************************************** */
+static void binaryProtocol_frameReceived(void)
+{
+    unsigned char ucIndex;
+
+    if(usBinprotoCrc != usBinprotoReceivedCrc){
+        unsigned char ucStatus = BINPROTO_STATUS_CRC;
+        uiBinprotoErrors++;
+
+        /* not cached: the retry of a lost response must still find the real one */
+        binaryProtocol_sendFrame(BINPROTO_CMD_NAK, ucBinprotoSeq, &ucStatus, 1);
+        return;
+    }
+    uiBinprotoFrames++;
+
+    /* retry of the last request: the response was lost, send it again without running the command */
+    if(ucBinprotoResponseLength && ucBinprotoSeq == ucBinprotoLastSeq && usBinprotoCrc == usBinprotoLastCrc){
+        for(ucIndex = 0; ucIndex < ucBinprotoResponseLength; ucIndex++)
+            console_putChar(ucBinprotoResponse[ucIndex]);
+        return;
+    }
+
+    ucBinprotoLastSeq = ucBinprotoSeq;
+    usBinprotoLastCrc = usBinprotoCrc;
+    binaryProtocol_execute();
+}
+
+/* ************************************************** */
+/* Method name:        binaryProtocol_processByte     */
+/* Method description: Feed a received byte to the    */
+/*                     frame parser. Bytes outside a  */
+/*                     frame are left to the ASCII    */
+/*                     state machine                  */
+/* Input params:       ucByte: byte read from the UART*/
+/* Output params:      1 if the byte belongs to a     */
+/*                     binary frame, 0 if not         */
+/* ************************************************** */
+unsigned char binaryProtocol_processByte(unsigned char ucByte)
+{
+    /* the rest of a frame cut by a silence is not waited for: this byte may start the next one */
+    if(binaryProtocol_isStale()){
+        ucBinprotoState = BINPROTO_WAIT_SOF;
+        uiBinprotoErrors++;
+    }
+    uiBinprotoDeadline = delay_getDeadlineMs(binaryProtocol_getGapMs());
+
+    switch(ucBinprotoState){
+    case BINPROTO_WAIT_SOF:
+        if(BINPROTO_SOF != ucByte)
+            return 0;
+        usBinprotoCrc = CRC16_INIT;
+        ucBinprotoState = BINPROTO_LEN;
+        break;
+
+    case BINPROTO_LEN:
+        if(BINPROTO_MAX_PAYLOAD < ucByte){
+            /* cannot be a valid frame, wait for the next SOF */
+            ucBinprotoState = BINPROTO_WAIT_SOF;
+            uiBinprotoErrors++;
+            break;
+        }
+        ucBinprotoLength = ucByte;
+        usBinprotoCrc = crc16_update(usBinprotoCrc, ucByte);
+        ucBinprotoState = BINPROTO_SEQ;
+        break;
+
+    case BINPROTO_SEQ:
+        ucBinprotoSeq = ucByte;
+        usBinprotoCrc = crc16_update(usBinprotoCrc, ucByte);
+        ucBinprotoState = BINPROTO_CMD;
+        break;
+
+    case BINPROTO_CMD:
+        ucBinprotoCmd = ucByte;
+        usBinprotoCrc = crc16_update(usBinprotoCrc, ucByte);
+        ucBinprotoCount = 0;
+        ucBinprotoState = (0 < ucBinprotoLength) ? BINPROTO_PAYLOAD : BINPROTO_CRC_LOW;
+        break;
+
+    case BINPROTO_PAYLOAD:
+        ucBinprotoPayload[ucBinprotoCount++] = ucByte;
+        usBinprotoCrc = crc16_update(usBinprotoCrc, ucByte);
+        if(ucBinprotoCount == ucBinprotoLength)
+            ucBinprotoState = BINPROTO_CRC_LOW;
+        break;
+
+    case BINPROTO_CRC_LOW:
+        usBinprotoReceivedCrc = ucByte;
+        ucBinprotoState = BINPROTO_CRC_HIGH;
+        break;
+
+    case BINPROTO_CRC_HIGH:
+        usBinprotoReceivedCrc |= (unsigned short)ucByte << 8;
+        ucBinprotoState = BINPROTO_WAIT_SOF;
+        UART0_transmitBegin();
+        binaryProtocol_frameReceived();
+        UART0_transmitEnd();
+        break;
+    }
+    return 1;
+}
+
+/* ************************************************** */
+/* Method name:        binaryProtocol_sendFrame       */
+/* Method description: Send a frame the host did not  */
+/*                     ask for (telemetry). It is not */
+/*                     kept for retransmission        */
+/* Input params:       ucCmd: command                 */
+/*                     ucSeq: sequence of the sender  */
+/*                     pucPayload: payload            */
+/*                     ucLength: up to                */
+/*                     BINPROTO_MAX_PAYLOAD           */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void binaryProtocol_sendFrame(unsigned char ucCmd, unsigned char ucSeq, const unsigned char *pucPayload, unsigned char ucLength)
+{
+    unsigned char ucFrame[BINPROTO_MAX_PAYLOAD + BINPROTO_OVERHEAD];
+    unsigned char ucFrameLength = binaryProtocol_buildFrame(ucFrame, ucCmd, ucSeq, pucPayload, ucLength);
+    unsigned char ucIndex;
+
+    for(ucIndex = 0; ucIndex < ucFrameLength; ucIndex++)
+        console_putChar(ucFrame[ucIndex]);
+}
+
+/* ************************************************** */
+/* Method name:        binaryProtocol_isReceiving     */
+/* Method description: Check if a frame is being      */
+/*                     received                       */
+/* Input params:       n/a                            */
+/* Output params:      1 inside a frame, 0 if not     */
+/* ************************************************** */
+unsigned char binaryProtocol_isReceiving(void)
+{
+    return BINPROTO_WAIT_SOF != ucBinprotoState && !binaryProtocol_isStale();
+}
+
+/* ************************************************** */
+/* Method name:        binaryProtocol_getStatistics   */
+/* Method description: Read the frame counters        */
+/* Input params:       puiFrames: valid frames        */
+/*                     puiErrors: discarded frames    */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void binaryProtocol_getStatistics(unsigned int *puiFrames, unsigned int *puiErrors)
+{
+    *puiFrames = uiBinprotoFrames;
+    *puiErrors = uiBinprotoErrors;
+}
+
+/* ************************************************** */
+/* Method name:        binaryProtocol_resetStatistics */
+/* Method description: Clear the frame counters       */
+/* Input params:       n/a                            */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void binaryProtocol_resetStatistics(void)
+{
+    uiBinprotoFrames = 0;
+    uiBinprotoErrors = 0;
+}
@@ -0,0 +1,111 @@
+/* ***************************************************************** */
+/* File name:        binaryProtocol.h                                */
+/* File description: Framed binary command protocol, an alternative  */
+/*                   to the ASCII commands on the same UART. Frames: */
+/*                                                                   */
+/*   SOF | LEN | SEQ | CMD | PAYLOAD[LEN] | CRC low | CRC high       */
+/*                                                                   */
+/*                   SOF is 0xA5 (never part of an ASCII command),   */
+/*                   the CRC-16/MODBUS covers LEN to the end of the  */
+/*                   payload. Each response echoes SEQ and has CMD   */
+/*                   with the bit 7 set, so a host can keep many     */
+/*                   requests in flight and match the answers. A     */
+/*                   repeated request (same SEQ and CRC) gets the    */
+/*                   last response again without running twice, so  */
+/*                   a host can retry safely. Multi-byte values are  */
+/*                   little endian                                   */
+/* Author name:      Grupo 18 - Renato Pepe                          */
+/*                              Joao Victor Matoso                   */
+/* Creation date:    19oct2026                                       */
+/* Revision date:    19oct2026                                       */
+/* ***************************************************************** */
+
+#ifndef SOURCES_BINARYPROTOCOL_H_
+#define SOURCES_BINARYPROTOCOL_H_
+
+/* start of frame */
+#define BINPROTO_SOF                0xA5U
+
+/* max payload in both directions */
+#define BINPROTO_MAX_PAYLOAD        96U
+
+/* a frame being received is discarded after a silence as long as a
+ * maximum frame at the current baud rate, never shorter than
+ * BINPROTO_GAP_MIN_MS: the bytes are parsed by the main loop, in bursts */
+#define BINPROTO_GAP_MIN_MS         50U
+
+/* commands, the response has the bit 7 set */
+#define BINPROTO_CMD_PING           0x01U   // empty payload, empty response
+#define BINPROTO_CMD_GET            0x02U   // payload: letters; response: [letter, type, value(4)] for each
+#define BINPROTO_CMD_SET            0x03U   // payload: [letter, float(4)] for each; response: [status]
+#define BINPROTO_RESPONSE_MASK      0x80U
+#define BINPROTO_CMD_NAK            0xFFU   // response to a bad frame, payload: [status]
+#define BINPROTO_CMD_TELEMETRY      0xC0U   // sent by the board without a request, see telemetry.h
+#define BINPROTO_CMD_LOG            0xC1U   // sent by the board without a request, see eventlog.h
+
+/* value types in the GET response */
+#define BINPROTO_TYPE_FLOAT         1U
+#define BINPROTO_TYPE_UINT          2U
+#define BINPROTO_TYPE_INT           3U
+
+/* status codes */
+#define BINPROTO_STATUS_OK              0U
+#define BINPROTO_STATUS_CRC             1U
+#define BINPROTO_STATUS_LENGTH          2U
+#define BINPROTO_STATUS_UNKNOWN_CMD     3U
+#define BINPROTO_STATUS_UNKNOWN_PARAM   4U
+#define BINPROTO_STATUS_RANGE           5U
+
+/* ************************************************** */
+/* Method name:        binaryProtocol_processByte     */
+/* Method description: Feed a received byte to the    */
+/*                     frame parser. Bytes outside a  */
+/*                     frame are left to the ASCII    */
+/*                     state machine                  */
+/* Input params:       ucByte: byte read from the UART*/
+/* Output params:      1 if the byte belongs to a     */
+/*                     binary frame, 0 if not         */
+/* ************************************************** */
+unsigned char binaryProtocol_processByte(unsigned char ucByte);
+
+/* ************************************************** */
+/* Method name:        binaryProtocol_sendFrame       */
+/* Method description: Send a frame the host did not  */
+/*                     ask for (telemetry). It is not */
+/*                     kept for retransmission        */
+/* Input params:       ucCmd: command                 */
+/*                     ucSeq: sequence of the sender  */
+/*                     pucPayload: payload            */
+/*                     ucLength: up to                */
+/*                     BINPROTO_MAX_PAYLOAD           */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void binaryProtocol_sendFrame(unsigned char ucCmd, unsigned char ucSeq, const unsigned char *pucPayload, unsigned char ucLength);
+
+/* ************************************************** */
+/* Method name:        binaryProtocol_isReceiving     */
+/* Method description: Check if a frame is being      */
+/*                     received                       */
+/* Input params:       n/a                            */
+/* Output params:      1 inside a frame, 0 if not     */
+/* ************************************************** */
+unsigned char binaryProtocol_isReceiving(void);
+
+/* ************************************************** */
+/* Method name:        binaryProtocol_getStatistics   */
+/* Method description: Read the frame counters        */
+/* Input params:       puiFrames: valid frames        */
+/*                     puiErrors: discarded frames    */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void binaryProtocol_getStatistics(unsigned int *puiFrames, unsigned int *puiErrors);
+
+/* ************************************************** */
+/* Method name:        binaryProtocol_resetStatistics */
+/* Method description: Clear the frame counters       */
+/* Input params:       n/a                            */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void binaryProtocol_resetStatistics(void);
+
+#endif /* SOURCES_BINARYPROTOCOL_H_ */
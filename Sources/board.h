@@ -52,6 +52,15 @@
 /*                 END OF TEMPERATURE SENSOR DIODE DEFINITIONS    */
 
 
+/*                 RS-485 TRANSCEIVER DEFINITIONS                 */
+/* driver enable of the transceiver: high while the board transmits */
+#define  RS485_DE_PORT_BASE_PNT     PORTE                         /* peripheral port base pointer */
+#define  RS485_DE_GPIO_BASE_PNT     PTE                           /* peripheral gpio base pointer */
+#define  RS485_DE_PIN               20U                           /* driver enable pin */
+#define  RS485_DE_ALT               0x01u                         /* GPIO */
+/*                 END OF RS-485 TRANSCEIVER DEFINITIONS          */
+
+
 /*                 General uC definitions                 */
 
 /* Clock gate control */
@@ -0,0 +1,151 @@
+/* ***************************************************************** */
+/* File name:        boot.c                                          */
+/* File description: Boot sequencer. The cycle counter starts at the */
+/*                   reset clock, the cycles counted until the RUN   */
+/*                   clock is set are converted to us at that clock  */
+/*                   and the rest at the RUN clock. The boot is over */
+/*                   before the power manager may change the clock   */
+/* Author name:      Grupo 18 - Renato Pepe                          */
+/*                              Joao Victor Matoso                   */
+/* Creation date:    19oct2026                                       */
+/* Revision date:    19oct2026                                       */
+/* ***************************************************************** */
+
+#include "boot.h"
+#include "cyclecounter.h"
+
+/* boot time until the clock change, and the cycle count there */
+unsigned int uiBootClockUs = 0;
+unsigned int uiBootClockCycles = 0;
+
+unsigned int uiBootControlUs = 0;
+unsigned int uiBootDoneUs = 0;
+
+/* deferred tasks and the next one to run */
+const boot_task_t *pBootTasks = 0;
+unsigned char ucBootTasks = 0;
+unsigned char ucBootNextTask = 0;
+
+/* set after the last task, read by the periodic interruption */
+volatile unsigned char ucBootDone = 0;
+
+/* ************************************************** */
+/* Method name:        boot_getElapsedUs              */
+/* Method description: Time since boot_start          */
+/* Input params:       n/a                            */
+/* Output params:      time in us                     */
+/* ************************************************** */
+static unsigned int boot_getElapsedUs(void)
+{
+    return uiBootClockUs + cyclecounter_cyclesToUs(cyclecounter_get() - uiBootClockCycles);
+}
+
+/* ************************************************** */
+/* Method name:        boot_start                     */
+/* Method description: Start the boot time on the     */
+/*                     cycle counter, at the reset    */
+/*                     clock. Called first in boardInit*/
+/* Input params:       n/a                            */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void boot_start(void)
+{
+    cyclecounter_init();
+}
+
+/* ************************************************** */
+/* Method name:        boot_clockChanged              */
+/* Method description: Keep the boot time across the  */
+/*                     change to the RUN clock. Called*/
+/*                     after mcg_clockInit            */
+/* Input params:       n/a                            */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void boot_clockChanged(void)
+{
+    /* the cycles of the FLL lock are counted at the reset clock, a few more us than true */
+    uiBootClockCycles = cyclecounter_get();
+    uiBootClockUs = cyclecounter_cyclesToUs(uiBootClockCycles);
+    cyclecounter_updateClock();
+}
+
+/* ************************************************** */
+/* Method name:        boot_setControlStarted         */
+/* Method description: Record the boot time of the    */
+/*                     first control tick and install */
+/*                     the deferred tasks             */
+/* Input params:       pTasks: run in this order      */
+/*                     ucTasks: number of tasks       */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void boot_setControlStarted(const boot_task_t *pTasks, unsigned char ucTasks)
+{
+    uiBootControlUs = boot_getElapsedUs();
+
+    pBootTasks = pTasks;
+    ucBootTasks = ucTasks;
+    ucBootNextTask = 0;
+    if(0 == ucTasks){
+        uiBootDoneUs = uiBootControlUs;
+        ucBootDone = 1;
+    }
+}
+
+/* ************************************************** */
+/* Method name:        boot_runNext                   */
+/* Method description: Run the next deferred task,    */
+/*                     the boot time is recorded after*/
+/*                     the last one                   */
+/* Input params:       n/a                            */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void boot_runNext(void)
+{
+    if(ucBootNextTask >= ucBootTasks)
+        return;
+
+    pBootTasks[ucBootNextTask++]();
+
+    /* the periodic interruption starts using the modules when it sees the boot done */
+    if(ucBootNextTask == ucBootTasks){
+        uiBootDoneUs = boot_getElapsedUs();
+        ucBootDone = 1;
+    }
+}
+
+/* ************************************************** */
+/* Method name:        boot_isDone                    */
+/* Method description: Check that every deferred task */
+/*                     ran                            */
+/* Input params:       n/a                            */
+/* Output params:      1 if done, 0 if not            */
+/* ************************************************** */
+unsigned char boot_isDone(void)
+{
+    return ucBootDone;
+}
+
+/* ************************************************** */
+/* Method name:        boot_getControlUs              */
+/* Method description: Time from main to the first    */
+/*                     control tick. The startup code */
+/*                     before main is not counted     */
+/* Input params:       n/a                            */
+/* Output params:      time in us                     */
+/* ************************************************** */
+unsigned int boot_getControlUs(void)
+{
+    return uiBootControlUs;
+}
+
+/* ************************************************** */
+/* Method name:        boot_getDoneUs                 */
+/* Method description: Time from main to the end of   */
+/*                     the deferred tasks             */
+/* Input params:       n/a                            */
+/* Output params:      time in us, 0 while they run   */
+/* ************************************************** */
+unsigned int boot_getDoneUs(void)
+{
+    return uiBootDoneUs;
+}
@@ -0,0 +1,92 @@
+/* ***************************************************************** */
+/* File name:        boot.h                                          */
+/* File description: Boot sequencer. boardInit brings up the control */
+/*                   path and the first control tick runs at once;   */
+/*                   the serial port and the local interface are     */
+/*                   initialized afterwards by the main loop, one    */
+/*                   task per pass, while the periodic interruption  */
+/*                   already runs. The times from main to the first  */
+/*                   control tick and to the end of the tasks are    */
+/*                   measured on the cycle counter                   */
+/* Author name:      Grupo 18 - Renato Pepe                          */
+/*                              Joao Victor Matoso                   */
+/* Creation date:    19oct2026                                       */
+/* Revision date:    19oct2026                                       */
+/* ***************************************************************** */
+
+#ifndef SOURCES_BOOT_H_
+#define SOURCES_BOOT_H_
+
+/* deferred initialization, run by the main loop */
+typedef void (*boot_task_t)(void);
+
+/* ************************************************** */
+/* Method name:        boot_start                     */
+/* Method description: Start the boot time on the     */
+/*                     cycle counter, at the reset    */
+/*                     clock. Called first in boardInit*/
+/* Input params:       n/a                            */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void boot_start(void);
+
+/* ************************************************** */
+/* Method name:        boot_clockChanged              */
+/* Method description: Keep the boot time across the  */
+/*                     change to the RUN clock. Called*/
+/*                     after mcg_clockInit            */
+/* Input params:       n/a                            */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void boot_clockChanged(void);
+
+/* ************************************************** */
+/* Method name:        boot_setControlStarted         */
+/* Method description: Record the boot time of the    */
+/*                     first control tick and install */
+/*                     the deferred tasks             */
+/* Input params:       pTasks: run in this order      */
+/*                     ucTasks: number of tasks       */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void boot_setControlStarted(const boot_task_t *pTasks, unsigned char ucTasks);
+
+/* ************************************************** */
+/* Method name:        boot_runNext                   */
+/* Method description: Run the next deferred task,    */
+/*                     the boot time is recorded after*/
+/*                     the last one                   */
+/* Input params:       n/a                            */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void boot_runNext(void);
+
+/* ************************************************** */
+/* Method name:        boot_isDone                    */
+/* Method description: Check that every deferred task */
+/*                     ran                            */
+/* Input params:       n/a                            */
+/* Output params:      1 if done, 0 if not            */
+/* ************************************************** */
+unsigned char boot_isDone(void);
+
+/* ************************************************** */
+/* Method name:        boot_getControlUs              */
+/* Method description: Time from main to the first    */
+/*                     control tick. The startup code */
+/*                     before main is not counted     */
+/* Input params:       n/a                            */
+/* Output params:      time in us                     */
+/* ************************************************** */
+unsigned int boot_getControlUs(void);
+
+/* ************************************************** */
+/* Method name:        boot_getDoneUs                 */
+/* Method description: Time from main to the end of   */
+/*                     the deferred tasks             */
+/* Input params:       n/a                            */
+/* Output params:      time in us, 0 while they run   */
+/* ************************************************** */
+unsigned int boot_getDoneUs(void);
+
+#endif /* SOURCES_BOOT_H_ */
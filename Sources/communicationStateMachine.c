@@ -11,14 +11,12 @@
 
 #include "communicationStateMachine.h"
 #include "util.h"
-#include "fsl_debug_console.h"
-#include "ledSwi.h"
-#include "aquecedorECooler.h"
-#include "adc.h"
-#include "lcd.h"
-#include "pid.h"
-#include "tacometro.h"
-#include "timer.h"
+#include "console.h"
+#include "paramRegistry.h"
+#include "binaryProtocol.h"
+#include "UART.h"
+#include "publish.h"
+#include "node.h"
 
 /*states of the UART communication state machine*/
 #define IDLE    '0'
@@ -27,32 +25,90 @@
 #define SET     '3'
 #define PARAM   '4'
 #define VALUE   '5'
+#define SUBSCRIBE '6'
 
 /*Max digits which will be read on the SET state*/
 #define MAX_VALUE_LENGTH    7
 
+/*Max letters in a batched get (#g<letters>;), '*' gets every parameter with a value*/
+#define MAX_BATCH_PARAMS    16
+
+/*Start of the lines pushed by the subscriptions (#p and #o)*/
+#define PUSH_PREFIX         "!"
+
 /*Global variables*/
 unsigned char ucUartState = IDLE;
 unsigned char ucValueCount;
-extern unsigned int uiTimerConfigTimeSeconds;
-extern unsigned int uiTimerConfigPIDStatus;
+
+/*
+ * parser statistics (#gq;), to compare protocol and formatter changes on the board:
+ * bytes received, ASCII commands run and dropped, bytes outside any command and the
+ * longest run of them (bytes needed to resync after garbage)
+ */
+unsigned int uiStatRxBytes = 0;
+unsigned int uiStatCommands = 0;
+unsigned int uiStatDropped = 0;
+unsigned int uiStatGarbageBytes = 0;
+unsigned int uiStatGarbageRun = 0;
+unsigned int uiStatMaxResync = 0;
+
+/* values printed by printParserStatistics */
+#define PARSER_STATISTICS   8U
+
+/* ******************************************************************************************************* */
+/* Method name:        countResync                                                                         */
+/* Method description: A command or frame started: close the current run of garbage bytes                  */
+/* Input params:       n/a                                                                                 */
+/* Output params:      n/a                                                                                 */
+/* ******************************************************************************************************* */
+static void countResync(void){
+    if(uiStatMaxResync < uiStatGarbageRun)
+        uiStatMaxResync = uiStatGarbageRun;
+    uiStatGarbageRun = 0;
+}
 
 /* ******************************************************************************************************* */
 /* Method name:        processByteCommunication                                                            */
-/* Method description: Method that handles the UART interruption, works like a state machine               */
+/* Method description: Method that handles the bytes received by the UART, works like a state machine.     */
+/*                     Called from the main loop, the UART interruption only buffers the bytes             */
 /* Input params:       ucByte - byte that was read from the UART                                           */
 /* Output params:      n/a                                                                                 */
 /* ******************************************************************************************************* */
 void processByteCommunication(unsigned char ucByte) {
     static unsigned char ucParam;
     static unsigned char ucValue[MAX_VALUE_LENGTH + 1];
+    static unsigned char ucParamList[MAX_BATCH_PARAMS + 1];
+    static unsigned char ucParamCount;
+    static unsigned char ucCommand;
+    unsigned char ucPreviousState = ucUartState;
+    unsigned char ucCommandDone = 0;
+
+    uiStatRxBytes++;
+
+    /* on a shared bus the commands for the other boards are dropped without parsing */
+    if (!node_acceptByte(ucByte))
+        return;
+
+    /* binary frames (started by BINPROTO_SOF) have their own parser */
+    if (binaryProtocol_processByte(ucByte)) {
+        if(IDLE != ucUartState)
+            uiStatDropped++;
+        ucUartState = IDLE;
+        countResync();
+        return;
+    }
 
     if ('#' == ucByte) {
+        /* a new command in the middle of another one */
+        if(IDLE != ucUartState)
+            uiStatDropped++;
         ucUartState = READY;
+        countResync();
     } else {
         if (IDLE != ucUartState) {
             switch (ucUartState) {
             case READY:
+                ucCommand = ucByte;
                 switch (ucByte) {
                 case 'g':
                     ucUartState = GET;
@@ -60,23 +116,35 @@ void processByteCommunication(unsigned char ucByte) {
                 case 's':
                     ucUartState = SET;
                     break;
+                case 'p':
+                case 'o':
+                    ucUartState = SUBSCRIBE;
+                    break;
                 default:
                     ucUartState = IDLE;
                 }
                 break;
 
             case GET:
-                if ('t' == ucByte || 'c' == ucByte || 'a' == ucByte || 'p' == ucByte || 'i' == ucByte
-                		|| 'd' == ucByte || 's' == ucByte || 'g' == ucByte || 'r' == ucByte || 'm' == ucByte) {
-                    ucParam = ucByte;
+                if (param_findGet(ucByte) || '*' == ucByte || '?' == ucByte) {
+                    ucParamList[0] = ucByte;
+                    ucParamCount = 1;
                     ucUartState = PARAM;
                 } else
                     ucUartState = IDLE;
                 break;
 
             case SET:
-                if ('t' == ucByte || 'i' == ucByte || 'c' == ucByte || 'a' == ucByte || 'p' == ucByte
-                		|| 'd' == ucByte || 's' == ucByte || 'b' == ucByte || 'n' == ucByte || 'm' == ucByte || 'k' == ucByte) {
+                if (param_findSet(ucByte)) {
+                    ucParam = ucByte;
+                    ucValueCount = 0;
+                    ucUartState = VALUE;
+                } else
+                    ucUartState = IDLE;
+                break;
+
+            case SUBSCRIBE:
+                if (param_findGet(ucByte) && param_findGet(ucByte)->fGet) {
                     ucParam = ucByte;
                     ucValueCount = 0;
                     ucUartState = VALUE;
@@ -85,9 +153,25 @@ void processByteCommunication(unsigned char ucByte) {
                 break;
 
             case PARAM:
-                if(';' == ucByte)
-                    returnParam(ucParam);
-                ucUartState = IDLE;
+                if(';' == ucByte){
+                    /* a single letter keeps the verbose response, a list (or '*') gets one compact line */
+                    ucCommandDone = 1;
+                    UART0_transmitBegin();
+                    if('?' == ucParamList[0]){
+                        printHelp();
+                    }else if(1 == ucParamCount && '*' != ucParamList[0]){
+                        returnParam(ucParamList[0]);
+                    }else{
+                        ucParamList[ucParamCount] = '\0';
+                        returnParamList(ucParamList);
+                    }
+                    UART0_transmitEnd();
+                    ucUartState = IDLE;
+                }
+                else if(param_findGet(ucByte) && MAX_BATCH_PARAMS > ucParamCount && param_findGet(ucParamList[0]))
+                    ucParamList[ucParamCount++] = ucByte;
+                else
+                    ucUartState = IDLE;
                 break;
 
             case VALUE:
@@ -98,14 +182,32 @@ void processByteCommunication(unsigned char ucByte) {
                 else {
                     if(';' == ucByte){
                         ucValue[ucValueCount] = '\0';
-                        setParam(ucParam, ucValue);
+                        ucCommandDone = 1;
+                        UART0_transmitBegin();
+                        if('s' == ucCommand)
+                            setParam(ucParam, ucValue);
+                        else
+                            subscribeParam(ucCommand, ucParam, ucValue);
+                        UART0_transmitEnd();
                     }
                     ucUartState = IDLE;
                 }
                 break;
             }
+        } else {
+            /* byte outside any command */
+            uiStatGarbageBytes++;
+            uiStatGarbageRun++;
         }
     }
+
+    /* the command ended: run or dropped */
+    if(IDLE != ucPreviousState && IDLE == ucUartState){
+        if(ucCommandDone)
+            uiStatCommands++;
+        else
+            uiStatDropped++;
+    }
 }
 
 /* ******************************************************************************************************* */
@@ -117,153 +219,44 @@ void processByteCommunication(unsigned char ucByte) {
 /* Output params:      n/a                                                                                 */
 /* ******************************************************************************************************* */
 void setParam(unsigned char ucParam, unsigned char *ucValue){
+    const param_descriptor_type *pParam = param_findSet(ucParam);
     float fValue = convertStringToFloat(ucValue);
+    char cResponse[PARAM_VALUE_SIZE];
+    char cError[3] = "#x";
 
-    /*
-     * debug printf method takes a signed char, this block turns ucValue into a signed char
-     *  to avoid any conflict involving the data types
-    */
-    char cValue[MAX_VALUE_LENGTH + 1];
-    unsigned int uiValueCounter = 0;
-    while(*ucValue){
-    	cValue[uiValueCounter] = *(ucValue++);
-    	uiValueCounter++;
-    }
-    cValue[uiValueCounter] = '\0';
-
-    switch(ucParam){
-    /* Interface operation mode */
-
-    case 'k':
-      /* Switches keyboard on
-       * obs: can't switch it off since keyboard and UART share some common pins on PORT A,
-       *      this means that UART can switch it on but after that switch the UART is deactivated
-       *      If user try to give UART command while keyboard is activated it may press the button 2
-      */
-      if(fValue){
-    	  /* response */
-    	  debug_printf("Keyboard activated (UART disabled) \n \r");
-          keyboard kbConfig[4] = {NOTSET, BUTTON, BUTTON, BUTTON};
-          initKeyboard(kbConfig);
-      }
-        break;
-
-    /* Temperature set point */
-    case 't':
-        pid_setTemperatureSetpoint(fValue);
-
-        /* response */
-        debug_printf("Temperature setPoint set to:");
-        debug_printf(cValue);
-        debug_printf("\n \r");
-        break;
-
-    /* Cooler duty cycle */
-    case 'c':
-        coolerfan_PWMDuty(fValue);
+    if(!pParam)
+        return;
 
+    switch(param_set(pParam, fValue)){
+    case PARAM_OK:
         /* response */
-        debug_printf("Cooler DC set to:");
-        debug_printf(cValue);
-        debug_printf("\n \r");
-        break;
-
-    /* Heater duty cycle */
-    case 'a':
-        /* heater duty cycle is capped at 50% to not damage the diode */
-        if(0.5 < fValue){
-            fValue = 0.5;
-            debug_printf("#aError DC>0,5; \n \r");
-            return;
+        console_putString(pParam->cLabel);
+        if(PARAM_FORMAT_ONOFF == pParam->ucFormat){
+            console_putString(" is ");
+        }else{
+            console_putString(" set to: ");
         }
-        heater_PWMDuty(fValue);
-
-        /* response */
-        debug_printf("Heater DC set to:");
-        debug_printf(cValue);
-        debug_printf("\n \r");
-        break;
-
-    /**** Set PID parameters ****/
-    /* Proportional gain */
-    case 'p':
-        pid_setKp(fValue);
-
-        /* response */
-        debug_printf("Kp set to:");
-        debug_printf(cValue);
-        debug_printf("\n \r");
-        break;
-
-    /* Integral gain */
-    case 'i':
-        pid_setKi(fValue);
-
-        /* response */
-        debug_printf("Ki set to:");
-        debug_printf(cValue);
-        debug_printf("\n \r");
+        param_formatNumber(pParam->ucFormat, fValue, cResponse);
+        console_putString(cResponse);
+        console_putString("\n \r");
         break;
 
-    /* Derivative gain */
-    case 'd':
-        pid_setKd(fValue);
-
-        /* response */
-        debug_printf("Kd set to:");
-        debug_printf(cValue);
-        debug_printf("\n \r");
-        break;
-
-    /* Switch control on/off */
-    case 's':
-        if(1 == fValue) {
-        	debug_printf("PID is ON");
-            pid_turnOnOff(1);
-        }
-        else {
-        	debug_printf("PID is OFF");
-            pid_turnOnOff(0);
-        }
-        debug_printf("\n \r");
+    case PARAM_ERROR_RANGE:
+        cError[1] = ucParam;
+        console_putString(cError);
+        console_putString("Error range ");
+        param_formatNumber(pParam->ucFormat, pParam->fMin, cResponse);
+        console_putString(cResponse);
+        console_putString("..");
+        param_formatNumber(pParam->ucFormat, pParam->fMax, cResponse);
+        console_putString(cResponse);
+        console_putString("; \n \r");
         break;
 
-    /* timer setup: turn PID on or off */
-    case 'b':
-    	if(1 == fValue){
-    		debug_printf("Timer will turn PID ON \n \r");
-    		uiTimerConfigPIDStatus = 1;
-    	}else{
-    		debug_printf("Timer will turn PID OFF \n \r");
-    		uiTimerConfigPIDStatus = 0;
-    	}
-    	break;
-
-    /* timer setup: time (in seconds)*/
-    case 'n':
-    	;
-    	unsigned int uiTimerTime = (unsigned int)fValue;
-    	//max value is equal to 9999min
-    	if(599940 < uiTimerTime){
-    		uiTimerTime = 599940;
-    	}
-    	uiTimerConfigTimeSeconds = uiTimerTime;
-    	debug_printf("Timer is going to be set to: ");
-    	char cAuxTimerTimeSet[7];
-    	unsignedIntToString(cAuxTimerTimeSet, uiTimerConfigTimeSeconds, 6);
-    	debug_printf(cAuxTimerTimeSet);
-    	debug_printf("seconds \n \r");
-    	break;
-    /* turn timer on or off */
-    case 'm':
-    	if(1 == fValue){
-    		debug_printf("Timer turned ON \n \r");
-    		timer_start(uiTimerConfigTimeSeconds, uiTimerConfigPIDStatus);
-    	}else{
-    		debug_printf("Timer turned OFF \n \r");
-    		timer_abort();
-    	}
-    	break;
+    default:
+        cError[1] = ucParam;
+        console_putString(cError);
+        console_putString("Error invalid; \n \r");
     }
 }
 
@@ -274,116 +267,237 @@ void setParam(unsigned char ucParam, unsigned char *ucValue){
 /* Output params:      n/a                                                             */
 /* *********************************************************************************** */
 void returnParam(unsigned char ucParam){
-    char cResponseValueString[8];
-
-    switch(ucParam){
-    /* Current temperature */
-    case 't':
-        /* read temperature and convert to string */
-        convertFloatToString(adc_getTemperature(), cResponseValueString, 7);
+    const param_descriptor_type *pParam = param_findGet(ucParam);
+    char cResponseValueString[PARAM_VALUE_SIZE];
 
-        /* response */
-        debug_printf("Current Temperature = ");
-        debug_printf(cResponseValueString);
-        debug_printf("\n \r");
-        break;
+    if(!pParam)
+        return;
 
-    /* Cooler duty cycle */
-    case 'c':
-        /* read cooler duty cycle and convert to string */
-        convertFloatToString(getDutyCycleCooler(), cResponseValueString, 7);
-
-        /* response */
-        debug_printf("Current Cooler DC = ");
-        debug_printf(cResponseValueString);
-        debug_printf("\n \r");
-        break;
+    if(pParam->fPrint){
+        pParam->fPrint();
+        return;
+    }
 
-    /* Heater duty cycle */
-    case 'a':
-        /* read heater duty cycle and convert to string */
-        convertFloatToString(getDutyCycleHeater(), cResponseValueString, 7);
+    /* "<label> = <value> <unit>" */
+    param_formatValue(pParam, cResponseValueString);
+    console_putString(pParam->cLabel);
+    console_putString(" = ");
+    console_putString(cResponseValueString);
+    console_putString(" ");
+    console_putString(pParam->cUnit);
+    console_putString("\n \r");
+}
 
-        /* response */
-        debug_printf("Current Heater DC = ");
-        debug_printf(cResponseValueString);
-        debug_printf("\n \r");
-        break;
+/* *********************************************************************************** */
+/* Method name:        printParamLine                                                  */
+/* Method description: Print the values of many parameters in one line, formatted as   */
+/*                     "<prefix><letter>=<value>;" for each one                        */
+/* Input params:       ucParams  - string of parameter letters, "*" for all of them    */
+/*                     cPrefix   - start of the line                                   */
+/* Output params:      n/a                                                             */
+/* *********************************************************************************** */
+static void printParamLine(unsigned char *ucParams, char *cPrefix){
+    char cValue[PARAM_VALUE_SIZE];
+    const param_descriptor_type *pParam;
+    unsigned char ucIndex;
+
+    /* streamed to the transmit buffer, no line is assembled */
+    console_putString(cPrefix);
+
+    for(ucIndex = 0; ; ucIndex++){
+        /* '*' walks the whole registry, otherwise the letters given */
+        if('*' == ucParams[0]){
+            if(param_getCount() <= ucIndex)
+                break;
+            pParam = param_getByIndex(ucIndex);
+            if(!(PARAM_FLAG_GET & pParam->ucFlags))
+                continue;
+        }else{
+            if('\0' == ucParams[ucIndex])
+                break;
+            pParam = param_findGet(ucParams[ucIndex]);
+        }
 
-    /**** Get PID parameters ****/
-    /* Proportional gain */
-    case 'p':
-        convertFloatToString(pid_getKp(), cResponseValueString, 7);
+        /* parameters without a single value (e.g. the schedule table) are skipped */
+        if(param_formatValue(pParam, cValue)){
+            console_putChar(pParam->ucLetter);
+            console_putChar('=');
+            console_putString(cValue);
+            console_putChar(';');
+        }
+    }
+    console_putString("\n \r");
+}
 
-        /* response */
-        debug_printf("Kp = ");
-        debug_printf(cResponseValueString);
-        debug_printf("\n \r");
-        break;
+/* *********************************************************************************** */
+/* Method name:        returnParamList                                                 */
+/* Method description: Print the values of many parameters in one line, formatted as   */
+/*                     "<letter>=<value>;" for each one                                */
+/* Input params:       ucParams  - string of parameter letters, "*" for all of them    */
+/* Output params:      n/a                                                             */
+/* *********************************************************************************** */
+void returnParamList(unsigned char *ucParams){
+    printParamLine(ucParams, "");
+}
 
-    /* Integral gain */
-    case 'i':
-        convertFloatToString(pid_getKi(), cResponseValueString, 7);
+/* *********************************************************************************** */
+/* Method name:        pushParamList                                                   */
+/* Method description: Push subscribed values, formatted like returnParamList with a   */
+/*                     PUSH_PREFIX in front so the host tells them from the responses  */
+/* Input params:       ucParams  - string of parameter letters                         */
+/* Output params:      n/a                                                             */
+/* *********************************************************************************** */
+void pushParamList(unsigned char *ucParams){
+    printParamLine(ucParams, PUSH_PREFIX);
+}
 
-        /* response */
-        debug_printf("Ki = ");
-        debug_printf(cResponseValueString);
-        debug_printf("\n \r");
-        break;
+/* *********************************************************************************** */
+/* Method name:        subscribeParam                                                  */
+/* Method description: Subscribe a parameter and print acknowledge:                    */
+/*                     #p<letter><ms>; pushes it every period,                         */
+/*                     #o<letter><threshold>; pushes it when it changes that much,     */
+/*                     a 0 value cancels the subscription                              */
+/* Input params:       ucCommand - 'p' or 'o'                                          */
+/*                     ucParam   - parameter letter                                    */
+/*                     ucValue   - string that contains the value (in ASCII)           */
+/* Output params:      n/a                                                             */
+/* *********************************************************************************** */
+void subscribeParam(unsigned char ucCommand, unsigned char ucParam, unsigned char *ucValue){
+    const param_descriptor_type *pParam = param_findGet(ucParam);
+    float fValue = convertStringToFloat(ucValue);
+    char cResponse[PARAM_VALUE_SIZE];
+    char cError[3] = "#x";
+    unsigned char ucAccepted;
+
+    if(!pParam)
+        return;
+
+    cError[1] = ucCommand;
+    if('p' == ucCommand){
+        /* written this way a NaN (bad number) is out of range too */
+        if(!((float)PUBLISH_MAX_PERIOD_MS >= fValue)){
+            console_putString(cError);
+            console_putString("Error range 0..");
+            param_formatUnsigned(PUBLISH_MAX_PERIOD_MS, cResponse);
+            console_putString(cResponse);
+            console_putString("; \n \r");
+            return;
+        }
+        ucAccepted = publish_setPeriod(ucParam, (unsigned int)fValue);
+    }else{
+        if(!(0.0f <= fValue)){
+            console_putString(cError);
+            console_putString("Error invalid; \n \r");
+            return;
+        }
+        ucAccepted = publish_setThreshold(ucParam, fValue);
+    }
 
-    /* Derivative gain */
-    case 'd':
-        convertFloatToString(pid_getKd(), cResponseValueString, 7);
+    /* table full */
+    if(!ucAccepted){
+        console_putString(cError);
+        console_putString("Error full; \n \r");
+        return;
+    }
 
-        /* response */
-        debug_printf("Kd = ");
-        debug_printf(cResponseValueString);
-        debug_printf("\n \r");
-        break;
+    /* response */
+    console_putString(pParam->cLabel);
+    if(0.0f == fValue){
+        console_putString(('p' == ucCommand) ? " periodic push off" : " push on change off");
+    }else if('p' == ucCommand){
+        console_putString(" pushed every ");
+        param_formatUnsigned((unsigned int)fValue, cResponse);
+        console_putString(cResponse);
+        console_putString(" ms");
+    }else{
+        console_putString(" pushed on change of ");
+        param_formatNumber(pParam->ucFormat, fValue, cResponse);
+        console_putString(cResponse);
+        console_putString(" ");
+        console_putString(pParam->cUnit);
+    }
+    console_putString("\n \r");
+}
 
-    /* check PID status */
-    case 's':
-    	if(pid_isOn()){
-    		debug_printf("PID is on \n \r");
-    	}else{
-    		debug_printf("PID if off \n \r");
-    	}
-        break;
+/* *********************************************************************************** */
+/* Method name:        printHelp                                                       */
+/* Method description: List the parameters of the registry (#g?;), one per line:       */
+/*                     "<g/s><letter> <label> [<unit>] <min>..<max>"                   */
+/* Input params:       n/a                                                             */
+/* Output params:      n/a                                                             */
+/* *********************************************************************************** */
+void printHelp(void){
+    char cValue[PARAM_VALUE_SIZE];
+    char cCommand[4] = "#xx";
+    unsigned char ucIndex;
+
+    for(ucIndex = 0; ucIndex < param_getCount(); ucIndex++){
+        const param_descriptor_type *pParam = param_getByIndex(ucIndex);
+
+        cCommand[1] = (PARAM_FLAG_SET & pParam->ucFlags) ? 's' : 'g';
+        cCommand[2] = pParam->ucLetter;
+        console_putString(cCommand);
+        if((PARAM_FLAG_SET & pParam->ucFlags) && (PARAM_FLAG_GET & pParam->ucFlags)){
+            console_putString("/g");
+        }
+        console_putString(" ");
+        console_putString(pParam->cLabel);
+        if('\0' != pParam->cUnit[0]){
+            console_putString(" [");
+            console_putString(pParam->cUnit);
+            console_putString("]");
+        }
+        if(PARAM_FLAG_SET & pParam->ucFlags){
+            console_putString(" ");
+            param_formatNumber(pParam->ucFormat, pParam->fMin, cValue);
+            console_putString(cValue);
+            console_putString("..");
+            param_formatNumber(pParam->ucFormat, pParam->fMax, cValue);
+            console_putString(cValue);
+        }
+        console_putString("\n \r");
+    }
+}
 
-     /* Check temperature setPoint */
-    case 'g':
-    	convertFloatToString(pid_getTemperatureSetpoint(), cResponseValueString, 7);
-
-    	/* response */
-        debug_printf("Temp setPoint = ");
-        debug_printf(cResponseValueString);
-        debug_printf("\n \r");
-    	break;
-
-    /* check cooler RPM */
-    case 'r':
-    	unsignedIntToString(cResponseValueString, tachometer_getSpeed(), 7);
-
-    	/* response */
-    	debug_printf("Cooler RPM = ");
-    	debug_printf(cResponseValueString);
-    	debug_printf("\n \r");
-    	break;
-
-    /* check timer status */
-    case'm':
-    	debug_printf("Timer is: ");
-
-    	if(1 == timer_isOn()){
-    		debug_printf("ON, with ");
-    		unsignedIntToString(cResponseValueString, timer_getTimeLeft()/1000, 6);
-    		debug_printf(cResponseValueString);
-    		debug_printf("seconds left \n \r");
-
-
-    	}else{
-    		debug_printf("OFF \n \r");
-    	}
-    	break;
+/* *********************************************************************************** */
+/* Method name:        printParserStatistics                                           */
+/* Method description: Print the parser statistics (#gq;)                              */
+/* Input params:       n/a                                                             */
+/* Output params:      n/a                                                             */
+/* *********************************************************************************** */
+void printParserStatistics(void){
+    static char * const cKeys[PARSER_STATISTICS] = {"rx=", "cmd=", "drop=", "garbage=", "resync=", "frames=", "frameErr=", "overflow="};
+    unsigned int uiValues[PARSER_STATISTICS];
+    unsigned char ucIndex;
+
+    uiValues[0] = uiStatRxBytes;
+    uiValues[1] = uiStatCommands;
+    uiValues[2] = uiStatDropped;
+    uiValues[3] = uiStatGarbageBytes;
+    uiValues[4] = uiStatMaxResync;
+    binaryProtocol_getStatistics(&uiValues[5], &uiValues[6]);
+    uiValues[7] = UART0_getRxOverflows();
+
+    for(ucIndex = 0; ucIndex < PARSER_STATISTICS; ucIndex++){
+        console_putString(cKeys[ucIndex]);
+        console_putUnsigned(uiValues[ucIndex]);
+        console_putChar(';');
     }
+    console_putString("\n \r");
+}
+
+/* *********************************************************************************** */
+/* Method name:        resetParserStatistics                                           */
+/* Method description: Clear the parser statistics (#sq0;)                             */
+/* Input params:       n/a                                                             */
+/* Output params:      n/a                                                             */
+/* *********************************************************************************** */
+void resetParserStatistics(void){
+    uiStatRxBytes = 0;
+    uiStatCommands = 0;
+    uiStatDropped = 0;
+    uiStatGarbageBytes = 0;
+    uiStatGarbageRun = 0;
+    uiStatMaxResync = 0;
+    binaryProtocol_resetStatistics();
 }
@@ -14,7 +14,8 @@
 
 /* ******************************************************************************************************* */
 /* Method name:        processByteCommunication                                                            */
-/* Method description: Method that handles the UART interruption, works like a state machine               */
+/* Method description: Method that handles the bytes received by the UART, works like a state machine.     */
+/*                     Called from the main loop, the UART interruption only buffers the bytes             */
 /* Input params:       ucByte - byte that was read from the UART                                           */
 /* Output params:      n/a                                                                                 */
 /* ******************************************************************************************************* */
@@ -38,5 +39,63 @@ void setParam(unsigned char ucParam, unsigned char *ucValue);
 /* *********************************************************************************** */
 void returnParam(unsigned char ucParam);
 
+/* *********************************************************************************** */
+/* Method name:        returnParamList                                                 */
+/* Method description: Print the values of many parameters in one line, formatted as   */
+/*                     "<letter>=<value>;" for each one                                */
+/* Input params:       ucParams  - string of parameter letters, "*" for all of them    */
+/* Output params:      n/a                                                             */
+/* *********************************************************************************** */
+void returnParamList(unsigned char *ucParams);
+
+/* *********************************************************************************** */
+/* Method name:        pushParamList                                                   */
+/* Method description: Push subscribed values, formatted like returnParamList with a   */
+/*                     "!" in front so the host tells them from the responses          */
+/* Input params:       ucParams  - string of parameter letters                         */
+/* Output params:      n/a                                                             */
+/* *********************************************************************************** */
+void pushParamList(unsigned char *ucParams);
+
+/* *********************************************************************************** */
+/* Method name:        subscribeParam                                                  */
+/* Method description: Subscribe a parameter and print acknowledge:                    */
+/*                     #p<letter><ms>; pushes it every period,                         */
+/*                     #o<letter><threshold>; pushes it when it changes that much,     */
+/*                     a 0 value cancels the subscription                              */
+/* Input params:       ucCommand - 'p' or 'o'                                          */
+/*                     ucParam   - parameter letter                                    */
+/*                     ucValue   - string that contains the value (in ASCII)           */
+/* Output params:      n/a                                                             */
+/* *********************************************************************************** */
+void subscribeParam(unsigned char ucCommand, unsigned char ucParam, unsigned char *ucValue);
+
+/* *********************************************************************************** */
+/* Method name:        printHelp                                                       */
+/* Method description: List the parameters of the registry (#g?;), one per line:       */
+/*                     "<g/s><letter> <label> [<unit>] <min>..<max>"                   */
+/* Input params:       n/a                                                             */
+/* Output params:      n/a                                                             */
+/* *********************************************************************************** */
+void printHelp(void);
+
+/* *********************************************************************************** */
+/* Method name:        printParserStatistics                                           */
+/* Method description: Print the parser counters in one line (#gq;): bytes received,   */
+/*                     ASCII commands run and dropped, garbage bytes, longest resync,  */
+/*                     binary frames received and discarded                            */
+/* Input params:       n/a                                                             */
+/* Output params:      n/a                                                             */
+/* *********************************************************************************** */
+void printParserStatistics(void);
+
+/* *********************************************************************************** */
+/* Method name:        resetParserStatistics                                           */
+/* Method description: Clear the parser counters (#sq0;)                               */
+/* Input params:       n/a                                                             */
+/* Output params:      n/a                                                             */
+/* *********************************************************************************** */
+void resetParserStatistics(void);
+
 
 #endif /* SOURCES_COMMUNICATIONSTATEMACHINE_H_ */
@@ -0,0 +1,81 @@
+/* ***************************************************************** */
+/* File name:        console.c                                       */
+/* File description: Text output of the serial protocols, the        */
+/*                   numbers are converted by numconv                */
+/* Author name:      Grupo 18 - Renato Pepe                          */
+/*                              Joao Victor Matoso                   */
+/* Creation date:    19oct2026                                       */
+/* Revision date:    19oct2026                                       */
+/* ***************************************************************** */
+
+#include "console.h"
+#include "UART.h"
+#include "numconv.h"
+
+/* ************************************************** */
+/* Method name:        console_putChar                */
+/* Method description: Send one byte                  */
+/* Input params:       ucByte: byte                   */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void console_putChar(unsigned char ucByte)
+{
+    UART0_putChar(ucByte);
+}
+
+/* ************************************************** */
+/* Method name:        console_putString              */
+/* Method description: Send a string as it is, '%' is */
+/*                     not a format                   */
+/* Input params:       cString: zero terminated       */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void console_putString(const char *cString)
+{
+    while(*cString)
+        UART0_putChar((unsigned char)*cString++);
+}
+
+/* ************************************************** */
+/* Method name:        console_putUnsigned            */
+/* Method description: Send an integer without the    */
+/*                     leading zeros                  */
+/* Input params:       uiValue: value                 */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void console_putUnsigned(unsigned int uiValue)
+{
+    char cText[NUMCONV_STRING_SIZE];
+
+    numconv_formatUnsigned(uiValue, cText);
+    console_putString(cText);
+}
+
+/* ************************************************** */
+/* Method name:        console_putInt                 */
+/* Method description: Send a signed integer          */
+/* Input params:       iValue: value                  */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void console_putInt(int iValue)
+{
+    console_putFixed(iValue, 0);
+}
+
+/* ************************************************** */
+/* Method name:        console_putFixed               */
+/* Method description: Send a fixed-point value, e.g. */
+/*                     (-1234, 2) is "-12,34"         */
+/* Input params:       iValue: value in units of      */
+/*                     10^-ucDecimals                 */
+/*                     ucDecimals: digits after the   */
+/*                     separator, up to 9             */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void console_putFixed(int iValue, unsigned char ucDecimals)
+{
+    char cText[NUMCONV_STRING_SIZE];
+
+    numconv_formatFixed(iValue, ucDecimals, cText);
+    console_putString(cText);
+}
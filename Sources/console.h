@@ -0,0 +1,63 @@
+/* ***************************************************************** */
+/* File name:        console.h                                       */
+/* File description: Text output of the serial protocols. Strings    */
+/*                   and integers go straight to the UART0 transmit  */
+/*                   buffer without the printf of the SDK, which is  */
+/*                   linked out when nobody calls debug_printf       */
+/*                   (test/console_bench, make -C test size)         */
+/* Author name:      Grupo 18 - Renato Pepe                          */
+/*                              Joao Victor Matoso                   */
+/* Creation date:    19oct2026                                       */
+/* Revision date:    19oct2026                                       */
+/* ***************************************************************** */
+
+#ifndef SOURCES_CONSOLE_H_
+#define SOURCES_CONSOLE_H_
+
+/* ************************************************** */
+/* Method name:        console_putChar                */
+/* Method description: Send one byte                  */
+/* Input params:       ucByte: byte                   */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void console_putChar(unsigned char ucByte);
+
+/* ************************************************** */
+/* Method name:        console_putString              */
+/* Method description: Send a string as it is, '%' is */
+/*                     not a format                   */
+/* Input params:       cString: zero terminated       */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void console_putString(const char *cString);
+
+/* ************************************************** */
+/* Method name:        console_putUnsigned            */
+/* Method description: Send an integer without the    */
+/*                     leading zeros                  */
+/* Input params:       uiValue: value                 */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void console_putUnsigned(unsigned int uiValue);
+
+/* ************************************************** */
+/* Method name:        console_putInt                 */
+/* Method description: Send a signed integer          */
+/* Input params:       iValue: value                  */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void console_putInt(int iValue);
+
+/* ************************************************** */
+/* Method name:        console_putFixed               */
+/* Method description: Send a fixed-point value, e.g. */
+/*                     (-1234, 2) is "-12,34"         */
+/* Input params:       iValue: value in units of      */
+/*                     10^-ucDecimals                 */
+/*                     ucDecimals: digits after the   */
+/*                     separator, up to 9             */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void console_putFixed(int iValue, unsigned char ucDecimals);
+
+#endif /* SOURCES_CONSOLE_H_ */
@@ -0,0 +1,55 @@
+/* ***************************************************************** */
+/* File name:        crc16.c                                         */
+/* File description: CRC-16/MODBUS computed bit by bit, which costs  */
+/*                   no flash for a table and is fast enough for the */
+/*                   UART byte rate                                  */
+/* Author name:      Grupo 18 - Renato Pepe                          */
+/*                              Joao Victor Matoso                   */
+/* Creation date:    19oct2026                                       */
+/* Revision date:    19oct2026                                       */
+/* ***************************************************************** */
+
+#include "crc16.h"
+
+/* 0x8005 reflected */
+#define CRC16_POLY_REFLECTED    0xA001U
+
+/* ************************************************** */
+/* Method name:        crc16_update                   */
+/* Method description: Add one byte to a CRC-16/MODBUS*/
+/*                     computation, so the CRC can be */
+/*                     computed while bytes arrive    */
+/* Input params:       usCrc: current value, start    */
+/*                     with CRC16_INIT                */
+/*                     ucByte: new byte               */
+/* Output params:      updated CRC                    */
+/* ************************************************** */
+unsigned short crc16_update(unsigned short usCrc, unsigned char ucByte)
+{
+    unsigned char ucBit;
+
+    usCrc ^= ucByte;
+    for(ucBit = 0; ucBit < 8; ucBit++){
+        if(usCrc & 1U)
+            usCrc = (usCrc >> 1) ^ CRC16_POLY_REFLECTED;
+        else
+            usCrc >>= 1;
+    }
+    return usCrc;
+}
+
+/* ************************************************** */
+/* Method name:        crc16_compute                  */
+/* Method description: CRC-16/MODBUS of a buffer      */
+/* Input params:       pucData: buffer                */
+/*                     uiLength: bytes in the buffer  */
+/* Output params:      CRC, sent low byte first       */
+/* ************************************************** */
+unsigned short crc16_compute(const unsigned char *pucData, unsigned int uiLength)
+{
+    unsigned short usCrc = CRC16_INIT;
+
+    while(uiLength--)
+        usCrc = crc16_update(usCrc, *pucData++);
+    return usCrc;
+}
@@ -0,0 +1,37 @@
+/* ***************************************************************** */
+/* File name:        crc16.h                                         */
+/* File description: CRC-16 used by the serial protocols             */
+/* Author name:      Grupo 18 - Renato Pepe                          */
+/*                              Joao Victor Matoso                   */
+/* Creation date:    19oct2026                                       */
+/* Revision date:    19oct2026                                       */
+/* ***************************************************************** */
+
+#ifndef SOURCES_CRC16_H_
+#define SOURCES_CRC16_H_
+
+/* CRC-16/MODBUS: reflected polynomial 0x8005, initial value 0xFFFF */
+#define CRC16_INIT      0xFFFFU
+
+/* ************************************************** */
+/* Method name:        crc16_update                   */
+/* Method description: Add one byte to a CRC-16/MODBUS*/
+/*                     computation, so the CRC can be */
+/*                     computed while bytes arrive    */
+/* Input params:       usCrc: current value, start    */
+/*                     with CRC16_INIT                */
+/*                     ucByte: new byte               */
+/* Output params:      updated CRC                    */
+/* ************************************************** */
+unsigned short crc16_update(unsigned short usCrc, unsigned char ucByte);
+
+/* ************************************************** */
+/* Method name:        crc16_compute                  */
+/* Method description: CRC-16/MODBUS of a buffer      */
+/* Input params:       pucData: buffer                */
+/*                     uiLength: bytes in the buffer  */
+/* Output params:      CRC, sent low byte first       */
+/* ************************************************** */
+unsigned short crc16_compute(const unsigned char *pucData, unsigned int uiLength);
+
+#endif /* SOURCES_CRC16_H_ */
@@ -0,0 +1,117 @@
+/* ***************************************************************** */
+/* File name:        cyclecounter.c                                  */
+/* File description: Free running cycle count. The SysTick counts    */
+/*                   down from 2^24 - 1 and interrupts on each wrap, */
+/*                   which adds the high bits                        */
+/* Author name:      Grupo 18 - Renato Pepe                          */
+/*                              Joao Victor Matoso                   */
+/* Creation date:    19oct2026                                       */
+/* Revision date:    19oct2026                                       */
+/* ***************************************************************** */
+
+#include "cyclecounter.h"
+#include "board.h"
+#include "fsl_clock_manager.h"
+
+#define CYCLECOUNTER_RELOAD     0x00FFFFFFU
+#define CYCLECOUNTER_BITS       24U
+
+/* wraps of the SysTick, the high bits of the count */
+volatile unsigned int uiCyclecounterWraps = 0;
+
+/* core clock in MHz */
+unsigned int uiCyclecounterPerUs = 1;
+
+/* ************************************************** */
+/* Method name:        SysTick_Handler                */
+/* Method description: Count a wrap of the SysTick    */
+/* Input params:       n/a                            */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void SysTick_Handler(void)
+{
+    uiCyclecounterWraps++;
+}
+
+/* ************************************************** */
+/* Method name:        cyclecounter_init              */
+/* Method description: Start the SysTick free running */
+/*                     on the core clock              */
+/* Input params:       n/a                            */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void cyclecounter_init(void)
+{
+    cyclecounter_updateClock();
+
+    SysTick->CTRL = 0;
+    SysTick->LOAD = CYCLECOUNTER_RELOAD;
+    SysTick->VAL = 0;
+    SysTick->CTRL = SysTick_CTRL_CLKSOURCE_Msk | SysTick_CTRL_TICKINT_Msk | SysTick_CTRL_ENABLE_Msk;
+}
+
+/* ************************************************** */
+/* Method name:        cyclecounter_updateClock       */
+/* Method description: Read the core clock again,     */
+/*                     after a clock mode change      */
+/* Input params:       n/a                            */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void cyclecounter_updateClock(void)
+{
+    uiCyclecounterPerUs = CLOCK_SYS_GetCoreClockFreq() / 1000000U;
+    if(0 == uiCyclecounterPerUs)
+        uiCyclecounterPerUs = 1;
+}
+
+/* ************************************************** */
+/* Method name:        cyclecounter_get               */
+/* Method description: Cycles since the start. Wraps  */
+/*                     at 32 bits (107 s at 40 MHz),  */
+/*                     so compare differences only    */
+/* Input params:       n/a                            */
+/* Output params:      cycle count                    */
+/* ************************************************** */
+unsigned int cyclecounter_get(void)
+{
+    unsigned int uiPrimask = __get_PRIMASK();
+    unsigned int uiWraps;
+    unsigned int uiValue;
+
+    __disable_irq();
+    uiWraps = uiCyclecounterWraps;
+    uiValue = SysTick->VAL;
+
+    /* a wrap not counted yet: inside an interruption, or just now */
+    if(SCB->ICSR & SCB_ICSR_PENDSTSET_Msk){
+        uiWraps++;
+        uiValue = SysTick->VAL;
+    }
+    __set_PRIMASK(uiPrimask);
+
+    return (uiWraps << CYCLECOUNTER_BITS) + (CYCLECOUNTER_RELOAD - uiValue);
+}
+
+/* ************************************************** */
+/* Method name:        cyclecounter_usToCycles        */
+/* Method description: Cycles in a time at the clock  */
+/*                     in use                         */
+/* Input params:       uiUs: time in us               */
+/* Output params:      cycles                         */
+/* ************************************************** */
+unsigned int cyclecounter_usToCycles(unsigned int uiUs)
+{
+    return uiUs * uiCyclecounterPerUs;
+}
+
+/* ************************************************** */
+/* Method name:        cyclecounter_cyclesToUs        */
+/* Method description: Time of a number of cycles at  */
+/*                     the clock in use               */
+/* Input params:       uiCycles: cycles               */
+/* Output params:      time in us                     */
+/* ************************************************** */
+unsigned int cyclecounter_cyclesToUs(unsigned int uiCycles)
+{
+    return uiCycles / uiCyclecounterPerUs;
+}
@@ -0,0 +1,61 @@
+/* ***************************************************************** */
+/* File name:        cyclecounter.h                                  */
+/* File description: Free running count of core clock cycles, made   */
+/*                   of the 24 bit SysTick and a count of its wraps. */
+/*                   Used to time short waits and to measure code    */
+/* Author name:      Grupo 18 - Renato Pepe                          */
+/*                              Joao Victor Matoso                   */
+/* Creation date:    19oct2026                                       */
+/* Revision date:    19oct2026                                       */
+/* ***************************************************************** */
+
+#ifndef SOURCES_CYCLECOUNTER_H_
+#define SOURCES_CYCLECOUNTER_H_
+
+/* ************************************************** */
+/* Method name:        cyclecounter_init              */
+/* Method description: Start the SysTick free running */
+/*                     on the core clock              */
+/* Input params:       n/a                            */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void cyclecounter_init(void);
+
+/* ************************************************** */
+/* Method name:        cyclecounter_updateClock       */
+/* Method description: Read the core clock again,     */
+/*                     after a clock mode change      */
+/* Input params:       n/a                            */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void cyclecounter_updateClock(void);
+
+/* ************************************************** */
+/* Method name:        cyclecounter_get               */
+/* Method description: Cycles since the start. Wraps  */
+/*                     at 32 bits (107 s at 40 MHz),  */
+/*                     so compare differences only    */
+/* Input params:       n/a                            */
+/* Output params:      cycle count                    */
+/* ************************************************** */
+unsigned int cyclecounter_get(void);
+
+/* ************************************************** */
+/* Method name:        cyclecounter_usToCycles        */
+/* Method description: Cycles in a time at the clock  */
+/*                     in use                         */
+/* Input params:       uiUs: time in us               */
+/* Output params:      cycles                         */
+/* ************************************************** */
+unsigned int cyclecounter_usToCycles(unsigned int uiUs);
+
+/* ************************************************** */
+/* Method name:        cyclecounter_cyclesToUs        */
+/* Method description: Time of a number of cycles at  */
+/*                     the clock in use               */
+/* Input params:       uiCycles: cycles               */
+/* Output params:      time in us                     */
+/* ************************************************** */
+unsigned int cyclecounter_cyclesToUs(unsigned int uiCycles);
+
+#endif /* SOURCES_CYCLECOUNTER_H_ */
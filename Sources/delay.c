@@ -0,0 +1,131 @@
+/* ***************************************************************** */
+/* File name:        delay.c                                         */
+/* File description: Delays and timeouts on the free running         */
+/*                   counters. The deadlines are compared as signed  */
+/*                   differences, so they work across the wrap of    */
+/*                   the counters as long as they are less than half */
+/*                   of the range ahead                              */
+/* Author name:      Grupo 18 - Renato Pepe                          */
+/*                              Joao Victor Matoso                   */
+/* Creation date:    19oct2026                                       */
+/* Revision date:    19oct2026                                       */
+/* ***************************************************************** */
+
+#include "delay.h"
+#include "cyclecounter.h"
+#include "rtc.h"
+
+/* ************************************************** */
+/* Method name:        delay_us                       */
+/* Method description: Busy wait. The SysTick stops in*/
+/*                     WAIT and VLPS, and its wraps   */
+/*                     are lost if the interruptions  */
+/*                     stay masked longer than 2^24   */
+/*                     cycles (419 ms at 40 MHz)      */
+/* Input params:       uiUs: time in us, up to 53 s at*/
+/*                     40 MHz                         */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void delay_us(unsigned int uiUs)
+{
+    delay_waitUs(delay_getDeadlineUs(uiUs));
+}
+
+/* ************************************************** */
+/* Method name:        delay_ms                       */
+/* Method description: Busy wait                      */
+/* Input params:       uiMs: time in ms               */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void delay_ms(unsigned int uiMs)
+{
+    /* 1 ms steps, the cycles of a long wait would not fit the signed compare */
+    while(uiMs--)
+        delay_us(1000U);
+}
+
+/* ************************************************** */
+/* Method name:        delay_getDeadlineUs            */
+/* Method description: Deadline from now, valid while */
+/*                     the core clock does not change */
+/* Input params:       uiUs: time in us, up to 53 s at*/
+/*                     40 MHz                         */
+/* Output params:      deadline in cycles             */
+/* ************************************************** */
+unsigned int delay_getDeadlineUs(unsigned int uiUs)
+{
+    return cyclecounter_get() + cyclecounter_usToCycles(uiUs);
+}
+
+/* ************************************************** */
+/* Method name:        delay_getBootDeadlineUs        */
+/* Method description: Deadline counted from the start*/
+/*                     of the cycle counter, for the  */
+/*                     power on delays of the devices */
+/* Input params:       uiUs: time in us               */
+/* Output params:      deadline in cycles             */
+/* ************************************************** */
+unsigned int delay_getBootDeadlineUs(unsigned int uiUs)
+{
+    return cyclecounter_usToCycles(uiUs);
+}
+
+/* ************************************************** */
+/* Method name:        delay_isExpiredUs              */
+/* Method description: Check a deadline in cycles     */
+/* Input params:       uiDeadline: delay_getDeadlineUs*/
+/* Output params:      1 if expired, 0 if not         */
+/* ************************************************** */
+unsigned char delay_isExpiredUs(unsigned int uiDeadline)
+{
+    return 0 <= (int)(cyclecounter_get() - uiDeadline);
+}
+
+/* ************************************************** */
+/* Method name:        delay_waitUs                   */
+/* Method description: Busy wait until a deadline in  */
+/*                     cycles                         */
+/* Input params:       uiDeadline: delay_getDeadlineUs*/
+/* Output params:      n/a                            */
+/* ************************************************** */
+void delay_waitUs(unsigned int uiDeadline)
+{
+    while(!delay_isExpiredUs(uiDeadline));
+}
+
+/* ************************************************** */
+/* Method name:        delay_getMs                    */
+/* Method description: Time since the RTC started, not*/
+/*                     changed by setting the clock.  */
+/*                     Wraps at 32 bits (49 days), so */
+/*                     compare differences only       */
+/* Input params:       n/a                            */
+/* Output params:      milliseconds                   */
+/* ************************************************** */
+unsigned int delay_getMs(void)
+{
+    return rtc_getUptimeMs();
+}
+
+/* ************************************************** */
+/* Method name:        delay_getDeadlineMs            */
+/* Method description: Deadline from now, counted in  */
+/*                     every power mode               */
+/* Input params:       uiMs: time in ms, up to 24 days*/
+/* Output params:      deadline in ms                 */
+/* ************************************************** */
+unsigned int delay_getDeadlineMs(unsigned int uiMs)
+{
+    return rtc_getUptimeMs() + uiMs;
+}
+
+/* ************************************************** */
+/* Method name:        delay_isExpiredMs              */
+/* Method description: Check a deadline in ms         */
+/* Input params:       uiDeadline: delay_getDeadlineMs*/
+/* Output params:      1 if expired, 0 if not         */
+/* ************************************************** */
+unsigned char delay_isExpiredMs(unsigned int uiDeadline)
+{
+    return 0 <= (int)(rtc_getUptimeMs() - uiDeadline);
+}
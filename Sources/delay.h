@@ -0,0 +1,105 @@
+/* ***************************************************************** */
+/* File name:        delay.h                                         */
+/* File description: Header file containing the functions/methods    */
+/*                   interfaces for the delays and timeouts. The us  */
+/*                   delays count the core cycles (cyclecounter), so */
+/*                   they hold at any clock; the ms deadlines count  */
+/*                   the RTC (LPO), which also runs while sleeping.  */
+/*                   A deadline is a point in time, checked without  */
+/*                   blocking with delay_isExpiredUs/Ms              */
+/* Author name:      Grupo 18 - Renato Pepe                          */
+/*                              Joao Victor Matoso                   */
+/* Creation date:    19oct2026                                       */
+/* Revision date:    19oct2026                                       */
+/* ***************************************************************** */
+
+#ifndef SOURCES_DELAY_H_
+#define SOURCES_DELAY_H_
+
+/* ************************************************** */
+/* Method name:        delay_us                       */
+/* Method description: Busy wait. The SysTick stops in*/
+/*                     WAIT and VLPS, and its wraps   */
+/*                     are lost if the interruptions  */
+/*                     stay masked longer than 2^24   */
+/*                     cycles (419 ms at 40 MHz)      */
+/* Input params:       uiUs: time in us, up to 53 s at*/
+/*                     40 MHz                         */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void delay_us(unsigned int uiUs);
+
+/* ************************************************** */
+/* Method name:        delay_ms                       */
+/* Method description: Busy wait                      */
+/* Input params:       uiMs: time in ms               */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void delay_ms(unsigned int uiMs);
+
+/* ************************************************** */
+/* Method name:        delay_getDeadlineUs            */
+/* Method description: Deadline from now, valid while */
+/*                     the core clock does not change */
+/* Input params:       uiUs: time in us, up to 53 s at*/
+/*                     40 MHz                         */
+/* Output params:      deadline in cycles             */
+/* ************************************************** */
+unsigned int delay_getDeadlineUs(unsigned int uiUs);
+
+/* ************************************************** */
+/* Method name:        delay_getBootDeadlineUs        */
+/* Method description: Deadline counted from the start*/
+/*                     of the cycle counter, for the  */
+/*                     power on delays of the devices */
+/* Input params:       uiUs: time in us               */
+/* Output params:      deadline in cycles             */
+/* ************************************************** */
+unsigned int delay_getBootDeadlineUs(unsigned int uiUs);
+
+/* ************************************************** */
+/* Method name:        delay_isExpiredUs              */
+/* Method description: Check a deadline in cycles     */
+/* Input params:       uiDeadline: delay_getDeadlineUs*/
+/* Output params:      1 if expired, 0 if not         */
+/* ************************************************** */
+unsigned char delay_isExpiredUs(unsigned int uiDeadline);
+
+/* ************************************************** */
+/* Method name:        delay_waitUs                   */
+/* Method description: Busy wait until a deadline in  */
+/*                     cycles                         */
+/* Input params:       uiDeadline: delay_getDeadlineUs*/
+/* Output params:      n/a                            */
+/* ************************************************** */
+void delay_waitUs(unsigned int uiDeadline);
+
+/* ************************************************** */
+/* Method name:        delay_getMs                    */
+/* Method description: Time since the RTC started, not*/
+/*                     changed by setting the clock.  */
+/*                     Wraps at 32 bits (49 days), so */
+/*                     compare differences only       */
+/* Input params:       n/a                            */
+/* Output params:      milliseconds                   */
+/* ************************************************** */
+unsigned int delay_getMs(void);
+
+/* ************************************************** */
+/* Method name:        delay_getDeadlineMs            */
+/* Method description: Deadline from now, counted in  */
+/*                     every power mode               */
+/* Input params:       uiMs: time in ms, up to 24 days*/
+/* Output params:      deadline in ms                 */
+/* ************************************************** */
+unsigned int delay_getDeadlineMs(unsigned int uiMs);
+
+/* ************************************************** */
+/* Method name:        delay_isExpiredMs              */
+/* Method description: Check a deadline in ms         */
+/* Input params:       uiDeadline: delay_getDeadlineMs*/
+/* Output params:      1 if expired, 0 if not         */
+/* ************************************************** */
+unsigned char delay_isExpiredMs(unsigned int uiDeadline);
+
+#endif /* SOURCES_DELAY_H_ */
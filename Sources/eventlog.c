@@ -0,0 +1,187 @@
+/* ***************************************************************** */
+/* File name:        eventlog.c                                      */
+/* File description: Tokenized event log. Writing an event copies    */
+/*                   ten bytes with the interruptions masked, the    */
+/*                   formatting is left to the host                  */
+/* Author name:      Grupo 18 - Renato Pepe                          */
+/*                              Joao Victor Matoso                   */
+/* Creation date:    19oct2026                                       */
+/* Revision date:    19oct2026                                       */
+/* ***************************************************************** */
+
+#include "eventlog.h"
+#include "binaryProtocol.h"
+#include "timer.h"
+#include "board.h"
+
+/* time base of the events */
+#define EVENTLOG_TICK_MS            100U
+
+/* LOST */
+#define EVENTLOG_HEADER_SIZE        1U
+
+#define EVENTLOG_FRAME_RECORDS      ((BINPROTO_MAX_PAYLOAD - EVENTLOG_HEADER_SIZE) / EVENTLOG_RECORD_SIZE)
+
+typedef struct eventlog_record_type {
+    unsigned int uiTime;
+    unsigned char ucId;
+    unsigned char ucArg;
+    int iValue;
+} eventlog_record_type;
+
+/* ring written by anybody, read by the main loop */
+eventlog_record_type eventlogBuffer[EVENTLOG_SIZE];
+volatile unsigned char ucEventlogHead = 0;
+volatile unsigned char ucEventlogTail = 0;
+volatile unsigned int uiEventlogLost = 0;
+
+timer_entry_t eventlogTimer;
+volatile unsigned int uiEventlogTicks = 0;
+
+unsigned char ucEventlogEnabled = 0;
+unsigned char ucEventlogSeq = 0;
+
+/* ************************************************** */
+/* Method name:        eventlog_tick                  */
+/* Method description: Timer callback, count a tick   */
+/* Input params:       pvArg: not used                */
+/* Output params:      n/a                            */
+/* ************************************************** */
+static void eventlog_tick(void *pvArg)
+{
+    (void)pvArg;
+    uiEventlogTicks++;
+}
+
+/* ************************************************** */
+/* Method name:        eventlog_putLong               */
+/* Method description: Write 32 bits little endian    */
+/* Input params:       pucOut: destination            */
+/*                     uiValue: value                 */
+/* Output params:      n/a                            */
+/* ************************************************** */
+static void eventlog_putLong(unsigned char *pucOut, unsigned int uiValue)
+{
+    pucOut[0] = (unsigned char)uiValue;
+    pucOut[1] = (unsigned char)(uiValue >> 8);
+    pucOut[2] = (unsigned char)(uiValue >> 16);
+    pucOut[3] = (unsigned char)(uiValue >> 24);
+}
+
+/* ************************************************** */
+/* Method name:        eventlog_init                  */
+/* Method description: Start the time base and log    */
+/*                     the boot                       */
+/* Input params:       n/a                            */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void eventlog_init(void)
+{
+    timer_startPeriodic(&eventlogTimer, EVENTLOG_TICK_MS, eventlog_tick, 0);
+    eventlog_write(EVENTLOG_BOOT, 0, 0);
+}
+
+/* ************************************************** */
+/* Method name:        eventlog_write                 */
+/* Method description: Store an event, overwriting    */
+/*                     the oldest one if the ring is  */
+/*                     full. Safe in interruptions    */
+/* Input params:       eId: EVENTLOG_*                */
+/*                     ucArg: small argument          */
+/*                     iValue: value argument         */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void eventlog_write(eventlog_id_type eId, unsigned char ucArg, int iValue)
+{
+    unsigned int uiPrimask = __get_PRIMASK();
+    eventlog_record_type *pRecord;
+    unsigned char ucNext;
+
+    __disable_irq();
+
+    ucNext = (ucEventlogHead + 1) & (EVENTLOG_SIZE - 1);
+    if(ucNext == ucEventlogTail){
+        ucEventlogTail = (ucEventlogTail + 1) & (EVENTLOG_SIZE - 1);
+        uiEventlogLost++;
+    }
+
+    pRecord = &eventlogBuffer[ucEventlogHead];
+    pRecord->uiTime = uiEventlogTicks;
+    pRecord->ucId = (unsigned char)eId;
+    pRecord->ucArg = ucArg;
+    pRecord->iValue = iValue;
+    ucEventlogHead = ucNext;
+
+    __set_PRIMASK(uiPrimask);
+}
+
+/* ************************************************** */
+/* Method name:        eventlog_setEnabled            */
+/* Method description: Start or stop sending the      */
+/*                     events. They are stored anyway */
+/* Input params:       ucEnabled: 1 to send           */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void eventlog_setEnabled(unsigned char ucEnabled)
+{
+    ucEventlogEnabled = ucEnabled;
+}
+
+/* ************************************************** */
+/* Method name:        eventlog_isEnabled             */
+/* Method description: Check if the events are sent   */
+/* Input params:       n/a                            */
+/* Output params:      1 if sent, 0 if not            */
+/* ************************************************** */
+unsigned char eventlog_isEnabled(void)
+{
+    return ucEventlogEnabled;
+}
+
+/* ************************************************** */
+/* Method name:        eventlog_update                */
+/* Method description: Send the stored events in one  */
+/*                     frame. Called from the main    */
+/*                     loop                           */
+/* Input params:       n/a                            */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void eventlog_update(void)
+{
+    unsigned char ucPayload[EVENTLOG_HEADER_SIZE + EVENTLOG_FRAME_RECORDS * EVENTLOG_RECORD_SIZE];
+    unsigned char ucLength = EVENTLOG_HEADER_SIZE;
+    unsigned char ucCount;
+    unsigned int uiPrimask;
+
+    if(!ucEventlogEnabled || ucEventlogTail == ucEventlogHead)
+        return;
+
+    uiPrimask = __get_PRIMASK();
+    __disable_irq();
+    ucPayload[0] = (255U < uiEventlogLost) ? 255U : (unsigned char)uiEventlogLost;
+    uiEventlogLost = 0;
+    __set_PRIMASK(uiPrimask);
+
+    for(ucCount = 0; ucCount < EVENTLOG_FRAME_RECORDS; ucCount++){
+        eventlog_record_type record;
+
+        /* a write in an interruption may move the tail when the ring is full */
+        uiPrimask = __get_PRIMASK();
+        __disable_irq();
+        if(ucEventlogTail == ucEventlogHead){
+            __set_PRIMASK(uiPrimask);
+            break;
+        }
+        record = eventlogBuffer[ucEventlogTail];
+        ucEventlogTail = (ucEventlogTail + 1) & (EVENTLOG_SIZE - 1);
+        __set_PRIMASK(uiPrimask);
+
+        eventlog_putLong(&ucPayload[ucLength], record.uiTime);
+        ucPayload[ucLength + 4] = record.ucId;
+        ucPayload[ucLength + 5] = record.ucArg;
+        eventlog_putLong(&ucPayload[ucLength + 6], (unsigned int)record.iValue);
+        ucLength += EVENTLOG_RECORD_SIZE;
+    }
+
+    binaryProtocol_sendFrame(BINPROTO_CMD_LOG, ucEventlogSeq++, ucPayload, ucLength);
+}
@@ -0,0 +1,105 @@
+/* ***************************************************************** */
+/* File name:        eventlog.h                                      */
+/* File description: Tokenized event log. An event is stored as its  */
+/*                   ID and raw arguments in a RAM ring, cheap       */
+/*                   enough to call from the control loop and the    */
+/*                   interruptions; the text never goes in the       */
+/*                   firmware. When enabled (#sz1;) the main loop    */
+/*                   sends the events in binary frames (CMD          */
+/*                   BINPROTO_CMD_LOG, SEQ counts the log frames):   */
+/*                                                                   */
+/*   LOST | records of TIME(4) ID(1) ARG(1) VALUE(4)                 */
+/*                                                                   */
+/*                   LOST: events overwritten since the last frame,  */
+/*                   up to 255. TIME: 100 ms ticks since the boot.   */
+/*                   Numbers are little endian. A host decoder       */
+/*                   builds its table from EVENTLOG_MESSAGES, with   */
+/*                   EVENTLOG_HOST_TABLE defined before including    */
+/*                   this file. In the text %c is ARG as a           */
+/*                   character, %u ARG as a number and %d VALUE      */
+/* Author name:      Grupo 18 - Renato Pepe                          */
+/*                              Joao Victor Matoso                   */
+/* Creation date:    19oct2026                                       */
+/* Revision date:    19oct2026                                       */
+/* ***************************************************************** */
+
+#ifndef SOURCES_EVENTLOG_H_
+#define SOURCES_EVENTLOG_H_
+
+/* events, new ones go at the end so the IDs known by a host stay valid */
+#define EVENTLOG_MESSAGES(X)                                                        \
+    X(EVENTLOG_BOOT,            "boot")                                             \
+    X(EVENTLOG_PARAM_SET,       "parameter %c set to %d/1000")                      \
+    X(EVENTLOG_PARAM_RANGE,     "parameter %c refused %d/1000, out of range")       \
+    X(EVENTLOG_PARAM_INVALID,   "parameter %c refused %d/1000 by the setter")       \
+    X(EVENTLOG_RX_OVERFLOW,     "UART receive overflow, %d in total")               \
+    X(EVENTLOG_BAUD_RATE,       "baud rate changed to %d")                          \
+    X(EVENTLOG_PROTOCOL,        "protocol %u (0 ASCII, 1 Modbus RTU)")
+
+#define EVENTLOG_ENUM(id, text)     id,
+
+typedef enum eventlog_id_type {
+    EVENTLOG_MESSAGES(EVENTLOG_ENUM)
+    EVENTLOG_COUNT
+} eventlog_id_type;
+
+#ifdef EVENTLOG_HOST_TABLE
+#define EVENTLOG_TEXT(id, text)     text,
+static const char * const eventlogText[EVENTLOG_COUNT] = { EVENTLOG_MESSAGES(EVENTLOG_TEXT) };
+#endif
+
+/* events kept until the main loop sends them, power of 2 */
+#define EVENTLOG_SIZE               32U
+
+/* bytes of a record in the frame */
+#define EVENTLOG_RECORD_SIZE        10U
+
+/* ************************************************** */
+/* Method name:        eventlog_init                  */
+/* Method description: Start the time base and log    */
+/*                     the boot                       */
+/* Input params:       n/a                            */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void eventlog_init(void);
+
+/* ************************************************** */
+/* Method name:        eventlog_write                 */
+/* Method description: Store an event, overwriting    */
+/*                     the oldest one if the ring is  */
+/*                     full. Safe in interruptions    */
+/* Input params:       eId: EVENTLOG_*                */
+/*                     ucArg: small argument          */
+/*                     iValue: value argument         */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void eventlog_write(eventlog_id_type eId, unsigned char ucArg, int iValue);
+
+/* ************************************************** */
+/* Method name:        eventlog_setEnabled            */
+/* Method description: Start or stop sending the      */
+/*                     events. They are stored anyway */
+/* Input params:       ucEnabled: 1 to send           */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void eventlog_setEnabled(unsigned char ucEnabled);
+
+/* ************************************************** */
+/* Method name:        eventlog_isEnabled             */
+/* Method description: Check if the events are sent   */
+/* Input params:       n/a                            */
+/* Output params:      1 if sent, 0 if not            */
+/* ************************************************** */
+unsigned char eventlog_isEnabled(void);
+
+/* ************************************************** */
+/* Method name:        eventlog_update                */
+/* Method description: Send the stored events in one  */
+/*                     frame. Called from the main    */
+/*                     loop                           */
+/* Input params:       n/a                            */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void eventlog_update(void);
+
+#endif /* SOURCES_EVENTLOG_H_ */
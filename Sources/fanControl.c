@@ -0,0 +1,200 @@
+/* ***************************************************************** */
+/* File name:        fanControl.c                                    */
+/* File description: Closed-loop cooler fan speed controller. A PI   */
+/*                   loop with feedforward closes on the tachometer  */
+/*                   reading and drives the cooler duty cycle        */
+/* Author name:      Grupo 18 - Renato Pepe                          */
+/*                              Joao Victor Matoso                   */
+/* Creation date:    19oct2026                                       */
+/* Revision date:    19oct2026                                       */
+/* ***************************************************************** */
+
+#include "fanControl.h"
+#include "aquecedorECooler.h"
+
+fan_control_data_type fanConfig;
+
+/* ************************************************** */
+/* Method name:        fanControl_init                */
+/* Method description: Initialize the fan speed       */
+/*                     controller (turned off)        */
+/* Input params:       n/a                            */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void fanControl_init(void)
+{
+    /* 1000 RPM of error moves the duty cycle by 10% */
+    fanConfig.fKp = 0.0001;
+    fanConfig.fKi = 0.00001;          // same integral action per second as at 200 ms
+    fanConfig.fError_sum = 0.0;
+    fanConfig.fPreviousFOut = 0.0;
+    fanConfig.uiTargetRpm = 0;
+    fanConfig.iTrackingError = 0;
+    fanConfig.uiCascadeTimer = 0;
+    fanConfig.ucCascadeHeating = 0;
+    fanConfig.ucControlOn = 0;
+}
+
+/* ************************************************** */
+/* Method name:        fanControl_setTargetRpm        */
+/* Method description: Set the desired fan speed and  */
+/*                     turn the RPM control mode on.  */
+/*                     A target of 0 turns the mode   */
+/*                     off and stops the fan          */
+/* Input params:       uiTargetRpm: desired speed,    */
+/*                     capped at FAN_CONTROL_MAX_RPM  */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void fanControl_setTargetRpm(unsigned int uiTargetRpm)
+{
+    if(0 == uiTargetRpm){
+        fanControl_turnOff();
+        coolerfan_PWMDuty(0.0f);
+        return;
+    }
+
+    if(FAN_CONTROL_MAX_RPM < uiTargetRpm){
+        uiTargetRpm = FAN_CONTROL_MAX_RPM;
+    }
+
+    /* starting from off: clear the integrator so the loop starts from the feedforward */
+    if(0 == fanConfig.ucControlOn){
+        fanConfig.fError_sum = 0.0;
+        fanConfig.fPreviousFOut = 0.0;
+        fanConfig.ucControlOn = 1;
+    }
+
+    fanConfig.uiTargetRpm = uiTargetRpm;
+}
+
+/* ************************************************** */
+/* Method name:        fanControl_getTargetRpm        */
+/* Method description: Get the desired fan speed      */
+/* Input params:       n/a                            */
+/* Output params:      Target speed in RPM            */
+/* ************************************************** */
+unsigned int fanControl_getTargetRpm(void)
+{
+    return fanConfig.uiTargetRpm;
+}
+
+/* ************************************************** */
+/* Method name:        fanControl_turnOff             */
+/* Method description: Leave the RPM control mode so  */
+/*                     the cooler duty cycle can be   */
+/*                     set directly again             */
+/* Input params:       n/a                            */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void fanControl_turnOff(void)
+{
+    fanConfig.ucControlOn = 0;
+    fanConfig.uiTargetRpm = 0;
+    fanConfig.iTrackingError = 0;
+    fanConfig.uiCascadeTimer = 0;
+    fanConfig.ucCascadeHeating = 0;
+}
+
+/* ************************************************** */
+/* Method name:        fanControl_isOn                */
+/* Method description: Get status of the RPM control  */
+/* Input params:       n/a                            */
+/* Output params:      1 if turned on, 0 if off       */
+/* ************************************************** */
+unsigned char fanControl_isOn(void)
+{
+    return fanConfig.ucControlOn;
+}
+
+/* ************************************************** */
+/* Method name:        fanControl_getTrackingError    */
+/* Method description: Get the last tracking error    */
+/* Input params:       n/a                            */
+/* Output params:      target - measured speed (RPM), */
+/*                     0 if the control is off        */
+/* ************************************************** */
+int fanControl_getTrackingError(void)
+{
+    return fanConfig.iTrackingError;
+}
+
+/* ************************************************** */
+/* Method name:        fanControl_update              */
+/* Method description: Run one step of the PI loop    */
+/*                     and update the cooler duty     */
+/*                     cycle. Must be called every    */
+/*                     FAN_CONTROL_PERIOD_MS          */
+/* Input params:       uiMeasuredRpm: tachometer data */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void fanControl_update(unsigned int uiMeasuredRpm)
+{
+    float fError, fOut;
+
+    /* Check if RPM control is on */
+    if(0 == fanConfig.ucControlOn){
+        return;
+    }
+
+    fanConfig.iTrackingError = (int)fanConfig.uiTargetRpm - (int)uiMeasuredRpm;
+    fError = (float)fanConfig.iTrackingError;
+
+    /* Anti-windup */
+    if(1.0f > fanConfig.fPreviousFOut && 0.0f <= fanConfig.fPreviousFOut){
+        fanConfig.fError_sum += fError;
+    }
+
+    /* feedforward from the nominal fan curve plus the PI correction */
+    fOut = (float)fanConfig.uiTargetRpm / (float)FAN_CONTROL_MAX_RPM
+         + fanConfig.fKp*fError
+         + fanConfig.fKi*fanConfig.fError_sum;
+
+    fanConfig.fPreviousFOut = fOut;
+
+    if(1.0f < fOut)
+        fOut = 1.0f;
+
+    else if(0.0f > fOut)
+        fOut = 0.0f;
+
+    coolerfan_PWMDuty(fOut);
+}
+
+/* ************************************************** */
+/* Method name:        fanControl_applyCascade        */
+/* Method description: Apply the temperature effort   */
+/*                     with the cooler cascade on: a  */
+/*                     positive one drives the heater,*/
+/*                     a negative one becomes the fan */
+/*                     target, changed once every     */
+/*                     FAN_CONTROL_CASCADE_RATIO      */
+/*                     periods. Called every control  */
+/*                     period                         */
+/* Input params:       fEffort: -100 to 100           */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void fanControl_applyCascade(float fEffort)
+{
+    if(0.0f > fEffort){
+        heater_PWMDuty(0.0f);
+        fanConfig.ucCascadeHeating = 0;
+
+        /*
+         * the inner loop runs FAN_CONTROL_CASCADE_RATIO times between target changes,
+         * so it rejects fan disturbances before they reach the temperature
+         */
+        if(0 == fanConfig.uiCascadeTimer)
+            fanControl_setTargetRpm((unsigned int)(-fEffort*FAN_CONTROL_MAX_RPM/100));
+        if(FAN_CONTROL_CASCADE_RATIO <= ++fanConfig.uiCascadeTimer)
+            fanConfig.uiCascadeTimer = 0;
+    }else{
+        /* the fan is stopped once, when the effort turns positive */
+        if(!fanConfig.ucCascadeHeating){
+            fanControl_setTargetRpm(0);
+            fanConfig.ucCascadeHeating = 1;
+        }
+        /* the next cooling period sets a target at once */
+        fanConfig.uiCascadeTimer = 0;
+        heater_PWMDuty(fEffort/100);
+    }
+}
@@ -0,0 +1,122 @@
+/* ***************************************************************** */
+/* File name:        fanControl.h                                    */
+/* File description: Header file containing the functions/methods    */
+/*                   interfaces for the closed-loop cooler fan speed */
+/*                   (RPM) controller                                */
+/* Author name:      Grupo 18 - Renato Pepe                          */
+/*                              Joao Victor Matoso                   */
+/* Creation date:    19oct2026                                       */
+/* Revision date:    19oct2026                                       */
+/* ***************************************************************** */
+
+#ifndef SOURCES_FANCONTROL_H_
+#define SOURCES_FANCONTROL_H_
+
+/* nominal fan speed with 100% duty cycle, used as feedforward and target limit */
+#define FAN_CONTROL_MAX_RPM     5000U
+
+/* inner loop period, on every tachometer refresh (100ms tick) */
+#define FAN_CONTROL_PERIOD_MS   100U
+
+/*
+ * in the cooler cascade the outer (temperature) loop changes the RPM target
+ * once every this many inner loop periods, so the fan speed settles and its
+ * disturbances are rejected before the outer loop acts again
+ */
+#define FAN_CONTROL_CASCADE_RATIO   5U
+
+typedef struct fan_control_data_type {
+    float fKp, fKi;              // PI gains (duty cycle per RPM of error)
+    float fError_sum;            // integrator cumulative error
+    float fPreviousFOut;         // used in the anti-windup
+    unsigned int uiTargetRpm;    // desired fan speed
+    int iTrackingError;          // last target - measured speed, in RPM
+    unsigned int uiCascadeTimer; // control periods since the cascade changed the target
+    unsigned char ucCascadeHeating; // the cascade is heating and has stopped the fan
+    unsigned char ucControlOn;
+} fan_control_data_type;
+
+
+/* ************************************************** */
+/* Method name:        fanControl_init                */
+/* Method description: Initialize the fan speed       */
+/*                     controller (turned off)        */
+/* Input params:       n/a                            */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void fanControl_init(void);
+
+/* ************************************************** */
+/* Method name:        fanControl_setTargetRpm        */
+/* Method description: Set the desired fan speed and  */
+/*                     turn the RPM control mode on.  */
+/*                     A target of 0 turns the mode   */
+/*                     off and stops the fan          */
+/* Input params:       uiTargetRpm: desired speed,    */
+/*                     capped at FAN_CONTROL_MAX_RPM  */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void fanControl_setTargetRpm(unsigned int uiTargetRpm);
+
+/* ************************************************** */
+/* Method name:        fanControl_getTargetRpm        */
+/* Method description: Get the desired fan speed      */
+/* Input params:       n/a                            */
+/* Output params:      Target speed in RPM            */
+/* ************************************************** */
+unsigned int fanControl_getTargetRpm(void);
+
+/* ************************************************** */
+/* Method name:        fanControl_turnOff             */
+/* Method description: Leave the RPM control mode so  */
+/*                     the cooler duty cycle can be   */
+/*                     set directly again             */
+/* Input params:       n/a                            */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void fanControl_turnOff(void);
+
+/* ************************************************** */
+/* Method name:        fanControl_isOn                */
+/* Method description: Get status of the RPM control  */
+/* Input params:       n/a                            */
+/* Output params:      1 if turned on, 0 if off       */
+/* ************************************************** */
+unsigned char fanControl_isOn(void);
+
+/* ************************************************** */
+/* Method name:        fanControl_getTrackingError    */
+/* Method description: Get the last tracking error    */
+/* Input params:       n/a                            */
+/* Output params:      target - measured speed (RPM), */
+/*                     0 if the control is off        */
+/* ************************************************** */
+int fanControl_getTrackingError(void);
+
+/* ************************************************** */
+/* Method name:        fanControl_update              */
+/* Method description: Run one step of the PI loop    */
+/*                     and update the cooler duty     */
+/*                     cycle. Must be called every    */
+/*                     FAN_CONTROL_PERIOD_MS          */
+/* Input params:       uiMeasuredRpm: tachometer data */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void fanControl_update(unsigned int uiMeasuredRpm);
+
+/* ************************************************** */
+/* Method name:        fanControl_applyCascade        */
+/* Method description: Apply the temperature effort   */
+/*                     with the cooler cascade on: a  */
+/*                     positive one drives the heater,*/
+/*                     a negative one becomes the fan */
+/*                     target, changed once every     */
+/*                     FAN_CONTROL_CASCADE_RATIO      */
+/*                     periods. Called every control  */
+/*                     period                         */
+/* Input params:       fEffort: -100 to 100           */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void fanControl_applyCascade(float fEffort);
+
+#endif /* SOURCES_FANCONTROL_H_ */
@@ -9,414 +9,476 @@
 /* *************************************************************** */
 
 #include "interfacelocal.h"
-#include "timer.h"
+#include "fanControl.h"
+#include "keypad.h"
+#include "cyclecounter.h"
+
+
+/* how a field is written */
+#define INTERFACE_FORMAT_FLOAT      0U      /* ',' as decimal separator */
+#define INTERFACE_FORMAT_UINT       1U      /* zeros on the left */
+#define INTERFACE_FORMAT_ONOFF      2U
+#define INTERFACE_FORMAT_CUSTOM     3U      /* written by fFormat */
+
+#define INTERFACE_COLUMNS           16U
+#define INTERFACE_MENU_FIELDS       2U
+#define INTERFACE_STATUS_FIELDS     2U
+
+/* a value shown on the LCD, written over the text of its line */
+typedef struct interface_field_type {
+    unsigned char ucColumn;
+    unsigned char ucWidth;
+    unsigned char ucFormat;                     /* INTERFACE_FORMAT_* */
+    float (*fGet)(void);                        /* 0 if the field is not used */
+    void (*fFormat)(float fValue, char *cText); /* writes ucWidth chars */
+} interface_field_type;
+
+/*
+ * a menu: the line 1 and the value changed by the buttons,
+ * button 2 subtracts fStep and button 3 adds it
+ */
+typedef struct interface_menu_type {
+    const char *cLine;                          /* INTERFACE_COLUMNS chars */
+    interface_field_type xField[INTERFACE_MENU_FIELDS];
+    float (*fGet)(void);                        /* 0 if the buttons change nothing */
+    void (*fSet)(float fValue);
+    float fStep;
+    void (*fKeys)(int iButton1, int iButton2, int iButton4); /* buttons handled by the menu, 0 for the step */
+} interface_menu_type;
 
-
-/* Menu types for local interface, each one controls a different aspect */
-typedef enum {DEFAULT, TEMPSET, COOLTOMAX, PIDSWITCH, KP, KI, KD, COOLERDC, HEATERDC, TIMERSET, TIMERSTATUS, UART} menu;
-
-menu mInterface = UART;
 extern unsigned int uiTachometerData;
 extern unsigned int fFilteredTemperature;
 unsigned int uiTimerConfigTimeSeconds = 0;
 unsigned int uiTimerConfigPIDStatus = 1;
 unsigned int uiCoolToMaxStatus = 0;
 
-/* ******************************************************************  */
-/* Method name:        localInterfaceHandler                           */
-/* Method description: Method that will be called by the interruption, */
-/*                     reads buttons and display LCD data              */
-/* Input params:       n/a                                             */
-/* Output params:      n/a                                             */
-/* ******************************************************************  */
-void localInterfaceHandler(){
-
-    char cLCDLine1[16] = "\0";
-    char cLCDLine2[16] = "\0";
+/* getters and setters of the menus */
+static float interface_getTemperature(void)    { return (float)fFilteredTemperature; }
+static float interface_getHeaterPercent(void)  { return 100.0f * getDutyCycleHeater(); }
+static float interface_getCoolerPercent(void)  { return 100.0f * getDutyCycleCooler(); }
+static float interface_getRpm(void)            { return (float)uiTachometerData; }
+static float interface_getCoolToMax(void)      { return (float)uiCoolToMaxStatus; }
+static float interface_getPidOn(void)          { return (float)pid_isOn(); }
+static float interface_getTimerAction(void)    { return (float)uiTimerConfigPIDStatus; }
+static float interface_getTimerTime(void)      { return (float)uiTimerConfigTimeSeconds; }
+static float interface_getTimerOn(void)        { return (float)pid_isTimerOn(); }
+static float interface_getTimerLeft(void)      { return (float)(pid_getTimerTimeLeft() / 1000U); }
+static float interface_getUartOn(void)         { return (float)(-1 == readButton(2)); }
+
+static void interface_setPidOn(float fValue)   { pid_turnOnOff(0.5f < fValue); }
+
+/* leaves the RPM control mode */
+static void interface_setCooler(float fValue)
+{
+    fanControl_turnOff();
+    coolerfan_PWMDuty(fValue);
+}
 
-    /*
-     * Button 4 changes to next interface
-     * Button 2 decreases parameters / switch functions off
-     * Button 3 increases parameters / switch functions on
-    */
-    int iButton1 = readButton(2);
-    int iButton2 = readButton(3);
-    int iButton4 = readButton(4);
-
-    /* Seconds LCD line will always show current Temperature and setPoint Temperature */
-    char cAuxLine2[5] = "T=";
-    append_string(cLCDLine2, 16, cAuxLine2);
-    convertFloatToString(fFilteredTemperature, cAuxLine2, 5);
-    append_string(cLCDLine2, 16, cAuxLine2);
-    cAuxLine2[0] = 'C';
-    cAuxLine2[1] = ' ';
-    cAuxLine2[2] = 'S';
-    cAuxLine2[3] = '=';
-    cAuxLine2[4] = '\0';
-    append_string(cLCDLine2, 16, cAuxLine2);
-    convertFloatToString(pid_getTemperatureSetpoint(), cAuxLine2, 5);
-    append_string(cLCDLine2, 16, cAuxLine2);
-    cLCDLine2[14] = 'C';
-    cLCDLine2[15] = '\0';
-
-    /* if Button 4 was pressed, change to next interface (unless it's on the UART menu) */
-    if(1==iButton4 && UART != mInterface){
-        mInterface++;
+/* cools the system to room temperature: PID off, heater DC 0 and cooler DC max */
+static void interface_setCoolToMax(float fValue)
+{
+    if(0.5f < fValue && 0 == uiCoolToMaxStatus){
+        uiCoolToMaxStatus = 1;
+        pid_turnOnOff(0);
+        fanControl_turnOff();
+        heater_PWMDuty(0.0f);
+        coolerfan_PWMDuty(1.0);
+    }else if(0.5f >= fValue && 1 == uiCoolToMaxStatus){
+        uiCoolToMaxStatus = 0;
+        coolerfan_PWMDuty(0.0f);
     }
+}
 
-    switch(mInterface){
-
-    case DEFAULT:
-        /* Default screen, will show heater DC and Cooler RPM on line 1 */
-        /* [Aq=xx% Co=xxxx] */
-        ;
-        char cAuxAq[4] = "Aq=";
-        append_string(cLCDLine1, 16, cAuxAq);
-        char cHeaterDC[3];
-        convertFloatToString(100*getDutyCycleHeater(), cHeaterDC, 3);
-        append_string(cLCDLine1, 16, cHeaterDC);
-
-        char cLCDCoolerText[10] = "% Co=";
-        char cCoolerRPM[6];
-        unsignedIntToString(cCoolerRPM, uiTachometerData, 4);
-        append_string(cLCDCoolerText, 10, cCoolerRPM);
-        append_string(cLCDLine1, 16, cLCDCoolerText);
-        break;
-    case TEMPSET:
-        /* Menu to control the temperature setpoint */
-        /* [T SP= xx,x] */
-
-        /* increase or decreases setPoint temp by 0.5C according to button pressed */
-        if(1==iButton1){
-            pid_setTemperatureSetpoint(pid_getTemperatureSetpoint() - 0.5f);
-        }else if(1==iButton2){
-            pid_setTemperatureSetpoint(pid_getTemperatureSetpoint() + 0.5f);
-        }
+/* turn the timer on with the config, or abort it */
+static void interface_setTimerOn(float fValue)
+{
+    if(0.5f < fValue)
+        pid_startTimer(uiTimerConfigTimeSeconds, uiTimerConfigPIDStatus);
+    else
+        pid_abortTimer();
+}
 
-        /* Print setPoint data on line 1 */
-        char cAuxSP[7] = "T SP= ";
-        append_string(cLCDLine1, 16, cAuxSP);
-        char cSetPoint[5];
-        convertFloatToString(pid_getTemperatureSetpoint(), cSetPoint, 5);
-        append_string(cLCDLine1, 16, cSetPoint);
-        break;
+/* [ ON] / [OFF], the ON is right aligned on this menu */
+static void interface_formatCoolToMax(float fValue, char *cText)
+{
+    cText[0] = (0.5f < fValue) ? ' ' : 'O';
+    cText[1] = (0.5f < fValue) ? 'O' : 'F';
+    cText[2] = (0.5f < fValue) ? 'N' : 'F';
+}
 
-    case COOLTOMAX:
-    	/* Cools the system to room temperature, turns PID off, set heater DC to 0, and cooler DC to max */
-    	/* [COOLMAX: xxx] */
-
-    	/* if button 2 is pressed turns it off, if button 3 is pressed turns it on */
-    	if(1==iButton1 && (1 == uiCoolToMaxStatus)){
-    		uiCoolToMaxStatus = 0;
-    		coolerfan_PWMDuty(0.0f);
-    	}else if(1==iButton2 && 0 == uiCoolToMaxStatus){
-    		uiCoolToMaxStatus = 1;
-    		pid_turnOnOff(0);
-    		heater_PWMDuty(0.0f);
-    		coolerfan_PWMDuty(1.0);
-    	}
-
-    	/* print status on screen */
-    	char cAuxCoolToMax[10] = "COOLMAX: ";
-    	append_string(cLCDLine1, 16, cAuxCoolToMax);
-    	if(uiCoolToMaxStatus){
-    		cAuxCoolToMax[0] = ' ';
-    		cAuxCoolToMax[1] = 'O';
-    		cAuxCoolToMax[2] = 'N';
-    		cAuxCoolToMax[3] = '\0';
-    		append_string(cLCDLine1, 16, cAuxCoolToMax);
-    	}else{
-    		cAuxCoolToMax[0] = 'O';
-    		cAuxCoolToMax[1] = 'F';
-    		cAuxCoolToMax[2] = 'F';
-    		cAuxCoolToMax[3] = '\0';
-    		append_string(cLCDLine1, 16, cAuxCoolToMax);
-    	}
-    	break;
-    case PIDSWITCH:
-        /* Menu to switch the temperature controller on/off */
-        /* [PID is xxx] */
-
-        /* Button 2 turns PID off, Button 3 turns PID on */
-        if(1==iButton1){
-            pid_turnOnOff(0);
-        }else if(1==iButton2){
-            pid_turnOnOff(1);
-        }
+/* a number and its unit right after it, "XXX" when it does not fit included */
+static void interface_formatNumberUnit(unsigned int uiValue, int iDigits, const char *cUnit, char *cText)
+{
+    unsignedIntToString(cText, uiValue, iDigits);
+    while(*cText)
+        cText++;
+    while(*cUnit)
+        *cText++ = *cUnit++;
+    *cText = '\0';
+}
 
-        /* Print PID status */
-        char cAuxPID[8] = "PID is ";
-        append_string(cLCDLine1, 16, cAuxPID);
-        if(pid_isOn()){
-            char cPIDon[3] = "ON";
-            append_string(cLCDLine1, 16, cPIDon);
-        }else{
-            char cPIDoff[5] = "OFF";
-            append_string(cLCDLine1, 16, cPIDoff);
-        }
-        break;
-    case KP:
-        /* Menu to display and change PID Kp parameter */
-        /*[Kp = xxx]*/
-
-        /* button 2 decreases Kp by 1 and button 3 increases by 1 */
-        if(1==iButton1){
-            pid_setKp(pid_getKp() - 1.0f);
-        }else if(1==iButton2){
-            pid_setKp(pid_getKp() + 1.0f);
-        }
+/* [xxxxs  ] under 5 minutes, [xxxxmin] from 5 minutes */
+static void interface_formatTimerTime(float fValue, char *cText)
+{
+    unsigned int uiSeconds = (unsigned int)fValue;
 
-        /* print Kp data */
-        char cAuxKp[6] = "Kp = ";
-        append_string(cLCDLine1, 16, cAuxKp);
-        convertFloatToString(pid_getKp(), cAuxKp, 4);
-        append_string(cLCDLine1, 16, cAuxKp);
-        break;
-    case KI:
-        /* Menu to display and change PID Ki parameter */
-        /*[Ki = x,xx]*/
-
-        /* button 2 decreases Ki by 0.05 and button 3 increases by 0.05 */
-        if(1==iButton1){
-            pid_setKi(pid_getKi() - 0.05f);
-        }else if(1==iButton2){
-            pid_setKi(pid_getKi() + 0.05f);
-        }
+    if(300 > uiSeconds)
+        interface_formatNumberUnit(uiSeconds, 4, "s", cText);
+    else
+        interface_formatNumberUnit(uiSeconds / 60, 4, "min", cText);
+}
 
-        /* print Ki data */
-        char cAuxKi[6] = "Ki = ";
-        append_string(cLCDLine1, 16, cAuxKi);
-        convertFloatToString(pid_getKi(), cAuxKi, 5);
-        append_string(cLCDLine1, 16, cAuxKi);
-        break;
-    case KD:
-        /* Menu to display and change PID Kd parameter */
-        /* [Kd = xxx] */
-
-        /* button 2 decreases Kd by 1 and button 3 increases by 1 */
-        if(1==iButton1){
-            pid_setKd(pid_getKd() - 1.0f);
-        }else if(1==iButton2){
-            pid_setKd(pid_getKd() + 1.0f);
-        }
+/* [xxxxmin] from 10 minutes, [XminXXs] under 10 minutes */
+static void interface_formatTimeLeft(float fValue, char *cText)
+{
+    unsigned int uiSeconds = (unsigned int)fValue;
 
-        /* print Kd data */
-        char cAuxKd[6] = "Kd = ";
-        append_string(cLCDLine1, 16, cAuxKd);
-        convertFloatToString(pid_getKd(), cAuxKd, 4);
-        append_string(cLCDLine1, 16, cAuxKd);
-        break;
-    case COOLERDC:
-        /* Menu to display cooler info and change cooler DC */
-        /* [C:DC=xx% R=xxxx] */
-
-        /* button 2 decreases cooler DC by 5% and button 3 increases by 5% */
-        if(1==iButton1){
-            coolerfan_PWMDuty(getDutyCycleCooler() - 0.05f);
-        }else if(1==iButton2){
-            coolerfan_PWMDuty(getDutyCycleCooler() + 0.05f);
-        }
+    if(10*60 <= uiSeconds){
+        interface_formatNumberUnit(uiSeconds / 60, 4, "min", cText);
+    }else{
+        interface_formatNumberUnit(uiSeconds / 60, 1, "min", cText);
+        interface_formatNumberUnit(uiSeconds % 60, 2, "s", &cText[4]);
+    }
+}
 
-        /* print cooler data */
-        char cAuxCDC[6] = "C:DC=";
-        append_string(cLCDLine1, 16, cAuxCDC);
-        convertFloatToString(getDutyCycleCooler()*100, cAuxCDC, 3);
-        append_string(cLCDLine1, 16, cAuxCDC);
-        char cAuxCRPM[5] = "% R=";
-        append_string(cLCDLine1, 16, cAuxCRPM);
-        unsignedIntToString(cAuxCRPM, uiTachometerData, 4);
-        append_string(cLCDLine1, 16, cAuxCRPM);
-        break;
-    case HEATERDC:
-        /* menu to change the heater DC */
-        /* [Aq:DC=xx%] */
-
-        /* button 2 decreases heater DC by 5% and button 3 increases by 5% */
-        if(1==iButton1){
-            heater_PWMDuty(getDutyCycleHeater() - 0.05f);
-        }else if(1==iButton2){
-            heater_PWMDuty(getDutyCycleHeater() + 0.05f);
-        }
+/*
+ * if buttons 2 and 3 are pressed at the same time switch if PID is gonna be turned ON or OFF with timer
+ * else changes the set time, button 2 decreases and button 3 increases time
+ * the step grows with the time: 5s up to 5min, 1min up to 1h, 5min up to the max (9999min)
+ */
+static void interface_keysTimerSet(int iButton1, int iButton2, int iButton4)
+{
+    unsigned int uiStep;
+
+    if(1 == iButton1 && 1 == iButton2){
+        uiTimerConfigPIDStatus = !uiTimerConfigPIDStatus;
+        return;
+    }
 
-        /* print heater data */
-        char cAuxHDC[7] = "Aq:DC=";
-        append_string(cLCDLine1, 16, cAuxHDC);
-        convertFloatToString(getDutyCycleHeater()*100, cAuxHDC, 3);
-        append_string(cLCDLine1, 16, cAuxHDC);
-        cLCDLine1[8] = '%';
-        cLCDLine1[9] = '\0';
-        break;
+    if(300 > uiTimerConfigTimeSeconds)
+        uiStep = 5;
+    else if(3600 > uiTimerConfigTimeSeconds)
+        uiStep = 60;
+    else
+        uiStep = 300;
+
+    if(1 == iButton1 && 0 < uiTimerConfigTimeSeconds){
+        uiTimerConfigTimeSeconds -= uiStep;
+    }else if(1 == iButton2 && 599940 > uiTimerConfigTimeSeconds){
+        uiTimerConfigTimeSeconds += uiStep;
+    }
+}
 
-    case TIMERSET:
-        /* Configure the timer time and if the PID will be turned ON or OFF */
-        /* [P:xxx t:xxxxmin] / [P:xxx t:xxxxs] */
-
-        /*
-         * if button 2 and 3 are pressed at the same time switch if PID is gonna be turned ON or OFF with timer
-         * else changes the set time, button 1 decreases and button 2 increases time
-         * set time increase/decrease changes to make user's life easier
-         */
-        if(1==iButton1 && 1==iButton2){
-            if(uiTimerConfigPIDStatus){
-                uiTimerConfigPIDStatus = 0;
-            }else{
-                uiTimerConfigPIDStatus = 1;
-            }
+static void interface_keysUart(int iButton1, int iButton2, int iButton4);
+
+/* the menus, in the order button 4 steps through them; the last one is the start */
+const interface_menu_type interfaceMenuTable[] = {
+    /* [Aq=xx% Co=xxxx] */
+    {"Aq=  % Co=      ", {{3, 2, INTERFACE_FORMAT_FLOAT, interface_getHeaterPercent, 0},
+                          {10, 4, INTERFACE_FORMAT_UINT, interface_getRpm, 0}},
+                         0, 0, 0.0f, 0},
+    /* [T SP= xx,x] */
+    {"T SP=           ", {{6, 4, INTERFACE_FORMAT_FLOAT, pid_getTemperatureSetpoint, 0}},
+                         pid_getTemperatureSetpoint, pid_setTemperatureSetpoint, 0.5f, 0},
+    /* [COOLMAX: xxx] */
+    {"COOLMAX:        ", {{9, 3, INTERFACE_FORMAT_CUSTOM, interface_getCoolToMax, interface_formatCoolToMax}},
+                         interface_getCoolToMax, interface_setCoolToMax, 1.0f, 0},
+    /* [PID is xxx] */
+    {"PID is          ", {{7, 3, INTERFACE_FORMAT_ONOFF, interface_getPidOn, 0}},
+                         interface_getPidOn, interface_setPidOn, 1.0f, 0},
+    /* [Kp = xxx] */
+    {"Kp =            ", {{5, 3, INTERFACE_FORMAT_FLOAT, pid_getKp, 0}},
+                         pid_getKp, pid_setKp, 1.0f, 0},
+    /* [Ki = x,xx] */
+    {"Ki =            ", {{5, 4, INTERFACE_FORMAT_FLOAT, pid_getKi, 0}},
+                         pid_getKi, pid_setKi, 0.05f, 0},
+    /* [Kd = xxx] */
+    {"Kd =            ", {{5, 3, INTERFACE_FORMAT_FLOAT, pid_getKd, 0}},
+                         pid_getKd, pid_setKd, 1.0f, 0},
+    /* [C:DC=xx% R=xxxx] */
+    {"C:DC=  % R=     ", {{5, 2, INTERFACE_FORMAT_FLOAT, interface_getCoolerPercent, 0},
+                          {11, 4, INTERFACE_FORMAT_UINT, interface_getRpm, 0}},
+                         getDutyCycleCooler, interface_setCooler, 0.05f, 0},
+    /* [Aq:DC=xx%] */
+    {"Aq:DC=  %       ", {{6, 2, INTERFACE_FORMAT_FLOAT, interface_getHeaterPercent, 0}},
+                         getDutyCycleHeater, heater_PWMDuty, 0.05f, 0},
+    /* [P:xxx t:xxxxmin] / [P:xxx t:xxxxs] */
+    {"P:    t:        ", {{2, 4, INTERFACE_FORMAT_ONOFF, interface_getTimerAction, 0},
+                          {8, 7, INTERFACE_FORMAT_CUSTOM, interface_getTimerTime, interface_formatTimerTime}},
+                         0, 0, 0.0f, interface_keysTimerSet},
+    /* [isXXX t:xxxxmin] / [isxxx t:XminXXs] */
+    {"is    t:        ", {{2, 4, INTERFACE_FORMAT_ONOFF, interface_getTimerOn, 0},
+                          {8, 7, INTERFACE_FORMAT_CUSTOM, interface_getTimerLeft, interface_formatTimeLeft}},
+                         interface_getTimerOn, interface_setTimerOn, 1.0f, 0},
+    /* [UART is xxx] */
+    {"UART is         ", {{8, 3, INTERFACE_FORMAT_ONOFF, interface_getUartOn, 0}},
+                         0, 0, 0.0f, interface_keysUart},
+};
+
+#define INTERFACE_MENUS     (sizeof(interfaceMenuTable) / sizeof(interfaceMenuTable[0]))
+
+/* Seconds LCD line will always show current Temperature and setPoint Temperature */
+/* [T=xx,xC S=xx,xC] */
+const char cInterfaceStatusLine[] = "T=    C S=    C ";
+const interface_field_type interfaceStatusFields[INTERFACE_STATUS_FIELDS] = {
+    {2, 4, INTERFACE_FORMAT_FLOAT, interface_getTemperature, 0},
+    {10, 4, INTERFACE_FORMAT_FLOAT, pid_getTemperatureSetpoint, 0},
+};
+
+unsigned char ucInterfaceMenu = INTERFACE_MENUS - 1;
+
+/* text on the LCD, the menu it shows and the values of its fields */
+char cInterfaceLine[2][INTERFACE_COLUMNS + 1];
+unsigned char ucInterfaceShownMenu = 0xFF;
+float fInterfaceMenuValue[INTERFACE_MENU_FIELDS];
+float fInterfaceStatusValue[INTERFACE_STATUS_FIELDS];
+unsigned char ucInterfaceStatusShown = 0;
+
+/* CPU cycles of the last refresh and the maximum */
+unsigned int uiInterfaceRefreshCycles = 0;
+unsigned int uiInterfaceRefreshMaxCycles = 0;
+
+/*
+ * If the keyboard b2 and b3 are OFF then button4 will reactivate them
+ * If the keyboard b2 and b3 are ON then button4 will switch to next menu
+ * obs: turning the buttons 2 and 3 ON will deactivate UART
+ */
+static void interface_keysUart(int iButton1, int iButton2, int iButton4)
+{
+    if(1 == iButton4){
+        if(-1 == iButton1){
+            keyboard kbTurnButtonsOn[4] = {NOTSET, BUTTON, BUTTON, BUTTON};
+            initKeyboard(kbTurnButtonsOn);
+            keypad_configure();
         }else{
-            if(0 == uiTimerConfigTimeSeconds){
-                //if Timer time is at 0 button 1 does nothing and button 2 increases time by 5s
-                if(1==iButton2){
-                    uiTimerConfigTimeSeconds += 5;
-                }
-            }else if(0 < uiTimerConfigTimeSeconds && 300 > uiTimerConfigTimeSeconds){
-                //if Timer time is bwetween 0s and 5min, button 1 and button 2 deacreses/increases time by 5s
-                if(1==iButton1){
-                    uiTimerConfigTimeSeconds -= 5;
-                }else if(1==iButton2){
-                    uiTimerConfigTimeSeconds += 5;
-                }
-            }else if(300 <= uiTimerConfigTimeSeconds && 3600 > uiTimerConfigTimeSeconds){
-                //if Timer is between 5min and 1h, button 1 and 2 decreases/increases time by 1min
-                if(1==iButton1){
-                    uiTimerConfigTimeSeconds -= 60;
-                }else if(1==iButton2){
-                    uiTimerConfigTimeSeconds += 60;
-                }
-            }else if(3600 <= uiTimerConfigTimeSeconds && 599940 > uiTimerConfigTimeSeconds){
-                //if Timer is between 1h and max(9999min), button 1 and 2 decreases/increases time by 5min
-                if(1==iButton1){
-                    uiTimerConfigTimeSeconds -= 300;
-                }else if(1==iButton2){
-                    uiTimerConfigTimeSeconds += 300;
-                }
-            }else if(599940 <= uiTimerConfigTimeSeconds){
-                //if timer is at max button 2 does nothing and button 1 decreases time by 5min
-                if(1==iButton1){
-                    uiTimerConfigTimeSeconds -= 300;
-                }
-            }
+            ucInterfaceMenu = 0;
         }
+    }
+    /* pressing button2 will switch button 2 and 3 off and activate UART */
+    else if(1 == iButton1){
+        keyboard kbTurnButtonsOff[4] = {NOTSET, NOTSET, NOTSET, BUTTON};
+        initKeyboard(kbTurnButtonsOff);
+        keypad_configure();
+        /* Configure the UART module */
+        UART0_init();
+        /* Enable UART interruptions */
+        UART0_enableIRQ();
+    }
+}
 
-        /* print timer PID status (that timer will switch PID to) and time */
-        char cAuxTimer[7] = "P:";
-        append_string(cLCDLine1, 16, cAuxTimer);
-        if(uiTimerConfigPIDStatus){
-        	char cAuxPIDSwitchON[5] = "ON  ";
-        	append_string(cLCDLine1, 16, cAuxPIDSwitchON);
-        }else{
-         	char cAuxPIDSwitchOFF[5] = "OFF ";
-            append_string(cLCDLine1, 16, cAuxPIDSwitchOFF);
-        }
-        cAuxTimer[0] = 't';
-        cAuxTimer[1] = ':';
-        cAuxTimer[2] = '\0';
-        append_string(cLCDLine1, 16, cAuxTimer);
-
-        //if config time is less than 5 minutes display in seconds, else display in minutes.
-        if(300 > uiTimerConfigTimeSeconds){
-        	unsignedIntToString(cAuxTimer, uiTimerConfigTimeSeconds, 4);
-        	append_string(cLCDLine1, 16, cAuxTimer);
-        	cAuxTimer[0] = 's';
-        	cAuxTimer[1] = '\0';
-        	append_string(cLCDLine1, 16, cAuxTimer);
-        }else{
-        	unsignedIntToString(cAuxTimer, uiTimerConfigTimeSeconds/60, 4);
-        	append_string(cLCDLine1, 16, cAuxTimer);
-        	cAuxTimer[0] = 'm';
-        	cAuxTimer[1] = 'i';
-        	cAuxTimer[2] = 'n';
-        	cAuxTimer[3] = '\0';
-        	append_string(cLCDLine1, 16, cAuxTimer);
-        }
+/* ************************************************** */
+/* Method name:        interface_applyKeys            */
+/* Method description: Apply the buttons to the       */
+/*                     current menu                   */
+/* Input params:       iButton1, iButton2, iButton4:  */
+/*                     1 if pressed, 0 if not, -1 if  */
+/*                     not configured as a button     */
+/* Output params:      n/a                            */
+/* ************************************************** */
+static void interface_applyKeys(int iButton1, int iButton2, int iButton4)
+{
+    const interface_menu_type *pMenu;
+
+    /*
+     * Button 4 changes to next interface (the last one handles it). The
+     * menu reached sees the same buttons, so with the buttons on the UART
+     * menu passes button 4 straight on to the first one
+     */
+    if(1 == iButton4 && INTERFACE_MENUS - 1 > ucInterfaceMenu)
+        ucInterfaceMenu++;
+
+    pMenu = &interfaceMenuTable[ucInterfaceMenu];
+    if(pMenu->fKeys){
+        pMenu->fKeys(iButton1, iButton2, iButton4);
+    }else if(pMenu->fSet){
+        /* Button 2 decreases, button 3 increases */
+        if(1 == iButton1)
+            pMenu->fSet(pMenu->fGet() - pMenu->fStep);
+        else if(1 == iButton2)
+            pMenu->fSet(pMenu->fGet() + pMenu->fStep);
+    }
+}
+
+/* ************************************************** */
+/* Method name:        interface_writeField           */
+/* Method description: Write a value over its place   */
+/*                     in a line                      */
+/* Input params:       pField: field                  */
+/*                     fValue: value                  */
+/*                     cLine: line text               */
+/* Output params:      n/a                            */
+/* ************************************************** */
+static void interface_writeField(const interface_field_type *pField, float fValue, char *cLine)
+{
+    char cText[INTERFACE_COLUMNS + 1];
+    unsigned char ucIndex;
+
+    switch(pField->ucFormat){
+    case INTERFACE_FORMAT_FLOAT:
+        convertFloatToString(fValue, cText, pField->ucWidth + 1);
         break;
-    case TIMERSTATUS:
-        /* Show if timer is on and how much time is left */
-    	/* [isXXX t:xxxxmin] / [isxxx t:XminXXs] */
-
-    	/* button 2 will deactivate timer, button 3 will turn it on with previosly set config  */
-    	if(1==iButton1){
-    		timer_abort();
-    	}else if(1==iButton2){
-    		timer_start(uiTimerConfigTimeSeconds, uiTimerConfigPIDStatus);
-    	}
-
-    	/* print if timer is on or off and time left */
-    	char cAuxTimerStatus[8] = "is";
-    	append_string(cLCDLine1, 16, cAuxTimerStatus);
-    	if(timer_isOn()){
-    		char cAuxTON[7] = "ON  t:";
-    		append_string(cLCDLine1, 16, cAuxTON);
-    	}else{
-    		char cAuxTOFF[7] = "OFF t:";
-    		append_string(cLCDLine1, 16, cAuxTOFF);
-    	}
-
-    	/* display only minutes if time left is greater than 10min, else show minutes and seconds */
-    	unsigned int uiTimeLeft = timer_getTimeLeft();
-    	if(10*60*1000 <= uiTimeLeft){
-    		unsignedIntToString(cAuxTimerStatus, uiTimeLeft/(1000*60), 4);
-    		append_string(cLCDLine1, 16, cAuxTimerStatus);
-    		cAuxTimerStatus[0] = 'm';
-    		cAuxTimerStatus[1] = 'i';
-    		cAuxTimerStatus[2] = 'n';
-    		cAuxTimerStatus[3] = '\0';
-    		append_string(cLCDLine1, 16, cAuxTimerStatus);
-    	}else{
-    		unsignedIntToString(cAuxTimerStatus, uiTimeLeft/(1000*60), 1);
-    		append_string(cLCDLine1, 16, cAuxTimerStatus);
-    		cAuxTimerStatus[0] = 'm';
-    		cAuxTimerStatus[1] = 'i';
-    		cAuxTimerStatus[2] = 'n';
-    		cAuxTimerStatus[3] = '\0';
-    		append_string(cLCDLine1, 16, cAuxTimerStatus);
-    		unsignedIntToString(cAuxTimerStatus, (uiTimeLeft/(1000))%60, 2);
-    		append_string(cLCDLine1, 16, cAuxTimerStatus);
-    		cAuxTimerStatus[0] = 's';
-    		cAuxTimerStatus[1] = '\0';
-    		append_string(cLCDLine1, 16, cAuxTimerStatus);
-    	}
+    case INTERFACE_FORMAT_UINT:
+        unsignedIntToString(cText, (unsigned int)fValue, pField->ucWidth);
         break;
-    case UART:
-        /*
-         * If the keyboard b2 and b3 are OFF then button4 will reactivate them
-         * If the keyboard b2 and b3 are ON then button4 will switch to next menu
-         * obs: turning the buttons 2 and 3 ON will deactivate UART
-        */
-        if(1==iButton4){
-            if(-1 == iButton1){
-                keyboard kbTurnButtonsOn[4] = {NOTSET, BUTTON, BUTTON, BUTTON};
-                initKeyboard(kbTurnButtonsOn);
-            }else{
-                mInterface = DEFAULT;
-            }
+    case INTERFACE_FORMAT_ONOFF:
+        cText[0] = 'O';
+        cText[1] = (0.5f < fValue) ? 'N' : 'F';
+        cText[2] = (0.5f < fValue) ? '\0' : 'F';
+        cText[3] = '\0';
+        break;
+    default:
+        pField->fFormat(fValue, cText);
+        break;
+    }
+
+    /* shorter texts are padded with spaces */
+    for(ucIndex = 0; ucIndex < pField->ucWidth; ucIndex++){
+        if('\0' == cText[ucIndex]){
+            for(; ucIndex < pField->ucWidth; ucIndex++)
+                cLine[pField->ucColumn + ucIndex] = ' ';
+            break;
         }
-        /* pressing button2 will switch button 2 and 3 off and activate UART */
-        else if(1==iButton1){
-            keyboard kbTurnButtonsOff[4] = {NOTSET, NOTSET, NOTSET, BUTTON};
-            initKeyboard(kbTurnButtonsOff);
-            /* Configure the UART module */
-            UART0_init();
-            /* Enable UART interruptions */
-            UART0_enableIRQ();
+        cLine[pField->ucColumn + ucIndex] = cText[ucIndex];
+    }
+}
+
+/* ************************************************** */
+/* Method name:        interface_renderFields         */
+/* Method description: Write the fields whose value   */
+/*                     changed                        */
+/* Input params:       pField: fields of the line     */
+/*                     ucFields: number of fields     */
+/*                     fShown: values on the line     */
+/*                     ucAll: 1 to write all fields   */
+/*                     cLine: line text               */
+/* Output params:      1 if the line changed          */
+/* ************************************************** */
+static unsigned char interface_renderFields(const interface_field_type *pField, unsigned char ucFields, float *fShown, unsigned char ucAll, char *cLine)
+{
+    unsigned char ucChanged = ucAll;
+    unsigned char ucIndex;
+    float fValue;
+
+    for(ucIndex = 0; ucIndex < ucFields && pField[ucIndex].fGet; ucIndex++){
+        fValue = pField[ucIndex].fGet();
+        if(ucAll || fValue != fShown[ucIndex]){
+            fShown[ucIndex] = fValue;
+            interface_writeField(&pField[ucIndex], fValue, cLine);
+            ucChanged = 1;
         }
+    }
+    return ucChanged;
+}
 
-        /* print UART status */
-        char cUARTAux[9] = "UART is ";
-        append_string(cLCDLine1, 16, cUARTAux);
-        if(-1 == iButton1){
-            char cUARTOn[3] = "ON";
-            append_string(cLCDLine1, 16, cUARTOn);
+/* ************************************************** */
+/* Method name:        interface_copyLine             */
+/* Method description: Start a line from its text     */
+/* Input params:       cLine: line text               */
+/*                     cTemplate: text of the line    */
+/* Output params:      n/a                            */
+/* ************************************************** */
+static void interface_copyLine(char *cLine, const char *cTemplate)
+{
+    unsigned char ucIndex;
+
+    for(ucIndex = 0; ucIndex < INTERFACE_COLUMNS; ucIndex++)
+        cLine[ucIndex] = cTemplate[ucIndex];
+    cLine[INTERFACE_COLUMNS] = '\0';
+}
+
+/* ******************************************************************  */
+/* Method name:        localInterfaceHandler                           */
+/* Method description: Method that will be called by the interruption, */
+/*                     applies the keypad events and display LCD data  */
+/* Input params:       n/a                                             */
+/* Output params:      n/a                                             */
+/* ******************************************************************  */
+void localInterfaceHandler(){
+
+    keypad_event_type eEvent;
+    unsigned int uiStart = cyclecounter_get();
+    unsigned char ucNewMenu;
+
+    /*
+     * Button 4 changes to next interface
+     * Button 2 decreases parameters / switch functions off
+     * Button 3 increases parameters / switch functions on
+     * Buttons 2 and 3 repeat while held, faster the longer they are held
+    */
+    while(keypad_getEvent(&eEvent)){
+        int iButton1 = (-1 == readButton(2)) ? -1 : 0;
+        int iButton2 = (-1 == readButton(3)) ? -1 : 0;
+        int iButton4 = 0;
+
+        if(KEYPAD_EVENT_PRESS == eEvent.ucType){
+            if(2 == eEvent.ucKey){
+                iButton1 = 1;
+                /* pressed together with button 3 */
+                if(keypad_isPressed(3))
+                    iButton2 = 1;
+            }else if(3 == eEvent.ucKey){
+                iButton2 = 1;
+                if(keypad_isPressed(2))
+                    iButton1 = 1;
+            }else if(4 == eEvent.ucKey){
+                iButton4 = 1;
+            }
+        }else if(KEYPAD_EVENT_REPEAT == eEvent.ucType){
+            if(2 == eEvent.ucKey)
+                iButton1 = 1;
+            else if(3 == eEvent.ucKey)
+                iButton2 = 1;
+            else
+                continue;
         }else{
-            char cUARTOff[4] = "OFF";
-            append_string(cLCDLine1, 16, cUARTOff);
+            continue;
         }
-        break;
+
+        interface_applyKeys(iButton1, iButton2, iButton4);
     }
 
+    /* a new menu writes its whole line, then only the values that changed */
+    ucNewMenu = (ucInterfaceShownMenu != ucInterfaceMenu);
+    if(ucNewMenu){
+        ucInterfaceShownMenu = ucInterfaceMenu;
+        interface_copyLine(cInterfaceLine[0], interfaceMenuTable[ucInterfaceMenu].cLine);
+    }
+    if(!ucInterfaceStatusShown)
+        interface_copyLine(cInterfaceLine[1], cInterfaceStatusLine);
+
     /* Updates LCD text */
-    lcd_writeText(0, cLCDLine1);
-    lcd_writeText(1, cLCDLine2);
+    if(interface_renderFields(interfaceMenuTable[ucInterfaceMenu].xField, INTERFACE_MENU_FIELDS, fInterfaceMenuValue, ucNewMenu, cInterfaceLine[0]))
+        lcd_writeText(0, cInterfaceLine[0]);
+    if(interface_renderFields(interfaceStatusFields, INTERFACE_STATUS_FIELDS, fInterfaceStatusValue, !ucInterfaceStatusShown, cInterfaceLine[1]))
+        lcd_writeText(1, cInterfaceLine[1]);
+    ucInterfaceStatusShown = 1;
+
+    uiInterfaceRefreshCycles = cyclecounter_get() - uiStart;
+    if(uiInterfaceRefreshMaxCycles < uiInterfaceRefreshCycles)
+        uiInterfaceRefreshMaxCycles = uiInterfaceRefreshCycles;
 }
 
+/* ************************************************** */
+/* Method name:        localInterface_getRefreshCycles*/
+/* Method description: CPU cost of the interface      */
+/*                     refresh, LCD writes included   */
+/* Input params:       puiLast: cycles of the last    */
+/*                     puiMax: maximum cycles         */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void localInterface_getRefreshCycles(unsigned int *puiLast, unsigned int *puiMax)
+{
+    *puiLast = uiInterfaceRefreshCycles;
+    *puiMax = uiInterfaceRefreshMaxCycles;
+}
 
-
+/* ************************************************** */
+/* Method name:        localInterface_resetRefreshMax */
+/* Method description: Clear the maximum refresh cost */
+/* Input params:       n/a                            */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void localInterface_resetRefreshMax(void)
+{
+    uiInterfaceRefreshMaxCycles = 0;
+}
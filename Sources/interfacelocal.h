@@ -26,4 +26,22 @@
 /* ******************************************************************  */
 void localInterfaceHandler();
 
+/* ************************************************** */
+/* Method name:        localInterface_getRefreshCycles*/
+/* Method description: CPU cost of the interface      */
+/*                     refresh, LCD writes included   */
+/* Input params:       puiLast: cycles of the last    */
+/*                     puiMax: maximum cycles         */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void localInterface_getRefreshCycles(unsigned int *puiLast, unsigned int *puiMax);
+
+/* ************************************************** */
+/* Method name:        localInterface_resetRefreshMax */
+/* Method description: Clear the maximum refresh cost */
+/* Input params:       n/a                            */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void localInterface_resetRefreshMax(void);
+
 #endif /* SOURCES_INTERFACELOCAL_H_ */
@@ -0,0 +1,296 @@
+/* ***************************************************************** */
+/* File name:        keypad.c                                        */
+/* File description: Keypad service. Times are counted in scans of   */
+/*                   KEYPAD_SCAN_MS                                  */
+/* Author name:      Grupo 18 - Renato Pepe                          */
+/*                              Joao Victor Matoso                   */
+/* Creation date:    19oct2026                                       */
+/* Revision date:    19oct2026                                       */
+/* ***************************************************************** */
+
+#include "keypad.h"
+#include "ledSwi.h"
+#include "pit.h"
+#include "board.h"
+
+#define KEYPAD_PIT_CHANNEL      1U
+
+/* PORT_PCR IRQC values */
+#define KEYPAD_IRQC_DISABLED    0x0U
+#define KEYPAD_IRQC_FALLING     0xAU
+
+#define KEYPAD_QUEUE_MASK       (KEYPAD_QUEUE_SIZE - 1U)
+
+/* times in scans */
+#define KEYPAD_DEBOUNCE_SCANS       (KEYPAD_DEBOUNCE_MS / KEYPAD_SCAN_MS)
+#define KEYPAD_LONG_PRESS_SCANS     (KEYPAD_LONG_PRESS_MS / KEYPAD_SCAN_MS)
+#define KEYPAD_REPEAT_DELAY_SCANS   (KEYPAD_REPEAT_DELAY_MS / KEYPAD_SCAN_MS)
+#define KEYPAD_REPEAT_START_SCANS   (KEYPAD_REPEAT_START_MS / KEYPAD_SCAN_MS)
+#define KEYPAD_REPEAT_STEP_SCANS    (KEYPAD_REPEAT_STEP_MS / KEYPAD_SCAN_MS)
+#define KEYPAD_REPEAT_MIN_SCANS     (KEYPAD_REPEAT_MIN_MS / KEYPAD_SCAN_MS)
+
+/* PORTA pin of each button, as in ledSwi */
+const unsigned char ucKeypadPin[KEYPAD_KEYS] = {1U, 2U, 4U, 5U};
+
+/* last level read and the scans it has been stable */
+unsigned char ucKeypadRaw[KEYPAD_KEYS];
+unsigned char ucKeypadStable[KEYPAD_KEYS];
+
+/* debounced state, the scans it has been held and the next repeat */
+unsigned char ucKeypadPressed[KEYPAD_KEYS];
+unsigned short usKeypadHeld[KEYPAD_KEYS];
+unsigned short usKeypadNextRepeat[KEYPAD_KEYS];
+unsigned char ucKeypadRepeatInterval[KEYPAD_KEYS];
+
+/* event queue, written by the scan */
+keypad_event_type eKeypadQueue[KEYPAD_QUEUE_SIZE];
+volatile unsigned char ucKeypadHead = 0;
+volatile unsigned char ucKeypadTail = 0;
+
+/* ************************************************** */
+/* Method name:        keypad_push                    */
+/* Method description: Queue an event, dropped if the */
+/*                     queue is full                  */
+/* Input params:       ucKey: 1 to KEYPAD_KEYS        */
+/*                     ucType: KEYPAD_EVENT_*         */
+/* Output params:      n/a                            */
+/* ************************************************** */
+static void keypad_push(unsigned char ucKey, unsigned char ucType)
+{
+    unsigned char ucNext = (ucKeypadHead + 1U) & KEYPAD_QUEUE_MASK;
+
+    if(ucNext != ucKeypadTail){
+        eKeypadQueue[ucKeypadHead].ucKey = ucKey;
+        eKeypadQueue[ucKeypadHead].ucType = ucType;
+        ucKeypadHead = ucNext;
+    }
+}
+
+/* ************************************************** */
+/* Method name:        keypad_arm                     */
+/* Method description: Enable the press interruption  */
+/*                     of the buttons. Starts the     */
+/*                     scan if one is already pressed */
+/* Input params:       n/a                            */
+/* Output params:      n/a                            */
+/* ************************************************** */
+static void keypad_arm(void)
+{
+    unsigned char ucKey;
+    unsigned char ucPressed = 0;
+
+    for(ucKey = 0; ucKey < KEYPAD_KEYS; ucKey++){
+        if(BUTTON == kbMcLab2[ucKey]){
+            PORTA_PCR(ucKeypadPin[ucKey]) = (PORTA_PCR(ucKeypadPin[ucKey]) & ~PORT_PCR_IRQC_MASK) | PORT_PCR_ISF_MASK | PORT_PCR_IRQC(KEYPAD_IRQC_FALLING);
+            if(1 == readButton(ucKey + 1))
+                ucPressed = 1;
+        }else{
+            PORTA_PCR(ucKeypadPin[ucKey]) = (PORTA_PCR(ucKeypadPin[ucKey]) & ~PORT_PCR_IRQC_MASK) | PORT_PCR_ISF_MASK;
+        }
+    }
+
+    /* a press before the interruption was enabled */
+    if(ucPressed)
+        pit_start(KEYPAD_PIT_CHANNEL);
+}
+
+/* ************************************************** */
+/* Method name:        keypad_disarm                  */
+/* Method description: Disable the interruption of    */
+/*                     all the buttons, the scan      */
+/*                     reads them while it runs       */
+/* Input params:       n/a                            */
+/* Output params:      n/a                            */
+/* ************************************************** */
+static void keypad_disarm(void)
+{
+    unsigned char ucKey;
+
+    for(ucKey = 0; ucKey < KEYPAD_KEYS; ucKey++)
+        PORTA_PCR(ucKeypadPin[ucKey]) = (PORTA_PCR(ucKeypadPin[ucKey]) & ~PORT_PCR_IRQC_MASK) | PORT_PCR_ISF_MASK;
+}
+
+/* ************************************************** */
+/* Method name:        keypad_scan                    */
+/* Method description: Debounce the buttons and queue */
+/*                     their events. Runs in the PIT  */
+/*                     interruption                   */
+/* Input params:       n/a                            */
+/* Output params:      n/a                            */
+/* ************************************************** */
+static void keypad_scan(void)
+{
+    unsigned char ucKey;
+    unsigned char ucActive = 0;
+    int iLevel;
+
+    for(ucKey = 0; ucKey < KEYPAD_KEYS; ucKey++){
+        iLevel = readButton(ucKey + 1);
+
+        /* not a button now */
+        if(-1 == iLevel){
+            ucKeypadRaw[ucKey] = 0;
+            ucKeypadStable[ucKey] = KEYPAD_DEBOUNCE_SCANS;
+            ucKeypadPressed[ucKey] = 0;
+            continue;
+        }
+
+        if((unsigned char)iLevel != ucKeypadRaw[ucKey]){
+            ucKeypadRaw[ucKey] = (unsigned char)iLevel;
+            ucKeypadStable[ucKey] = 0;
+        }else if(KEYPAD_DEBOUNCE_SCANS > ucKeypadStable[ucKey]){
+            ucKeypadStable[ucKey]++;
+        }
+
+        /* the level was stable long enough */
+        if(KEYPAD_DEBOUNCE_SCANS <= ucKeypadStable[ucKey] && ucKeypadRaw[ucKey] != ucKeypadPressed[ucKey]){
+            ucKeypadPressed[ucKey] = ucKeypadRaw[ucKey];
+            if(ucKeypadPressed[ucKey]){
+                keypad_push(ucKey + 1, KEYPAD_EVENT_PRESS);
+                usKeypadHeld[ucKey] = 0;
+                usKeypadNextRepeat[ucKey] = KEYPAD_REPEAT_DELAY_SCANS;
+                ucKeypadRepeatInterval[ucKey] = KEYPAD_REPEAT_START_SCANS;
+            }else{
+                keypad_push(ucKey + 1, KEYPAD_EVENT_RELEASE);
+            }
+        }else if(ucKeypadPressed[ucKey]){
+            usKeypadHeld[ucKey]++;
+            if(KEYPAD_LONG_PRESS_SCANS == usKeypadHeld[ucKey])
+                keypad_push(ucKey + 1, KEYPAD_EVENT_LONG);
+
+            /* each repeat comes sooner, down to the minimum interval */
+            if(usKeypadNextRepeat[ucKey] == usKeypadHeld[ucKey]){
+                keypad_push(ucKey + 1, KEYPAD_EVENT_REPEAT);
+                usKeypadNextRepeat[ucKey] += ucKeypadRepeatInterval[ucKey];
+                if(KEYPAD_REPEAT_MIN_SCANS + KEYPAD_REPEAT_STEP_SCANS <= ucKeypadRepeatInterval[ucKey])
+                    ucKeypadRepeatInterval[ucKey] -= KEYPAD_REPEAT_STEP_SCANS;
+                else
+                    ucKeypadRepeatInterval[ucKey] = KEYPAD_REPEAT_MIN_SCANS;
+            }
+        }
+
+        if(ucKeypadRaw[ucKey] || ucKeypadPressed[ucKey] || KEYPAD_DEBOUNCE_SCANS > ucKeypadStable[ucKey])
+            ucActive = 1;
+    }
+
+    /* all released: wait for the next press without scanning */
+    if(!ucActive){
+        pit_stop(KEYPAD_PIT_CHANNEL);
+        keypad_arm();
+    }
+}
+
+/* ************************************************** */
+/* Method name:        PORTA_IRQHandler               */
+/* Method description: A button was pressed, start    */
+/*                     the scan                       */
+/* Input params:       n/a                            */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void PORTA_IRQHandler(void)
+{
+    /* the bounces don't interrupt again while the scan runs */
+    keypad_disarm();
+    PORTA_ISFR = PORTA_ISFR;
+    pit_start(KEYPAD_PIT_CHANNEL);
+}
+
+/* ************************************************** */
+/* Method name:        keypad_init                    */
+/* Method description: Set up the PIT channel and the */
+/*                     PORTA interruption. The        */
+/*                     keyboard must be initialized   */
+/* Input params:       n/a                            */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void keypad_init(void)
+{
+    pit_setPeriod(KEYPAD_PIT_CHANNEL, KEYPAD_SCAN_MS * 1000U, keypad_scan);
+    keypad_configure();
+    NVIC_EnableIRQ(PORTA_IRQn);
+}
+
+/* ************************************************** */
+/* Method name:        keypad_configure               */
+/* Method description: Follow a new keyboard setup,   */
+/*                     to be called after each        */
+/*                     initKeyboard. Only the pins    */
+/*                     set as BUTTON interrupt        */
+/* Input params:       n/a                            */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void keypad_configure(void)
+{
+    unsigned char ucKey;
+    unsigned int uiPrimask = __get_PRIMASK();
+    __disable_irq();
+
+    pit_stop(KEYPAD_PIT_CHANNEL);
+    for(ucKey = 0; ucKey < KEYPAD_KEYS; ucKey++){
+        ucKeypadRaw[ucKey] = 0;
+        ucKeypadStable[ucKey] = KEYPAD_DEBOUNCE_SCANS;
+        ucKeypadPressed[ucKey] = 0;
+    }
+    keypad_arm();
+
+    __set_PRIMASK(uiPrimask);
+}
+
+/* ************************************************** */
+/* Method name:        keypad_getEvent                */
+/* Method description: Take the oldest event          */
+/* Input params:       pEvent: event read             */
+/* Output params:      1 if there was one, 0 if not   */
+/* ************************************************** */
+unsigned char keypad_getEvent(keypad_event_type *pEvent)
+{
+    unsigned char ucFound = 0;
+    unsigned int uiPrimask = __get_PRIMASK();
+    __disable_irq();
+
+    if(ucKeypadTail != ucKeypadHead){
+        *pEvent = eKeypadQueue[ucKeypadTail];
+        ucKeypadTail = (ucKeypadTail + 1U) & KEYPAD_QUEUE_MASK;
+        ucFound = 1;
+    }
+
+    __set_PRIMASK(uiPrimask);
+    return ucFound;
+}
+
+/* ************************************************** */
+/* Method name:        keypad_hasEvent                */
+/* Method description: Check if there are events      */
+/* Input params:       n/a                            */
+/* Output params:      1 if there are, 0 if not       */
+/* ************************************************** */
+unsigned char keypad_hasEvent(void)
+{
+    return ucKeypadTail != ucKeypadHead;
+}
+
+/* ************************************************** */
+/* Method name:        keypad_isPressed               */
+/* Method description: Debounced state of a button    */
+/* Input params:       ucKey: 1 to KEYPAD_KEYS        */
+/* Output params:      1 if pressed, 0 if not         */
+/* ************************************************** */
+unsigned char keypad_isPressed(unsigned char ucKey)
+{
+    if(1 > ucKey || KEYPAD_KEYS < ucKey)
+        return 0;
+    return ucKeypadPressed[ucKey - 1];
+}
+
+/* ************************************************** */
+/* Method name:        keypad_isScanning              */
+/* Method description: Check if the PIT scan runs, a  */
+/*                     button is pressed or bouncing  */
+/* Input params:       n/a                            */
+/* Output params:      1 if scanning, 0 if waiting    */
+/*                     for a press                    */
+/* ************************************************** */
+unsigned char keypad_isScanning(void)
+{
+    return pit_isRunning(KEYPAD_PIT_CHANNEL);
+}
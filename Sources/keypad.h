@@ -0,0 +1,104 @@
+/* ***************************************************************** */
+/* File name:        keypad.h                                        */
+/* File description: Keypad service of the McLab2 buttons. A press   */
+/*                   interrupts on PORTA and starts a scan on the    */
+/*                   PIT channel 1, which debounces the buttons in   */
+/*                   time and queues press, release, long press and  */
+/*                   auto-repeat events. The scan stops when all the */
+/*                   buttons are released                            */
+/* Author name:      Grupo 18 - Renato Pepe                          */
+/*                              Joao Victor Matoso                   */
+/* Creation date:    19oct2026                                       */
+/* Revision date:    19oct2026                                       */
+/* ***************************************************************** */
+
+#ifndef SOURCES_KEYPAD_H_
+#define SOURCES_KEYPAD_H_
+
+/* buttons, numbered 1 to 4 as in readButton */
+#define KEYPAD_KEYS             4U
+
+/* scan period while a button is active */
+#define KEYPAD_SCAN_MS          10U
+
+/* a level must be stable this long to be accepted */
+#define KEYPAD_DEBOUNCE_MS      20U
+
+/* hold time of the long press event */
+#define KEYPAD_LONG_PRESS_MS    1000U
+
+/* auto-repeat: first repeat after the delay, then the interval */
+/* shrinks by a step on each repeat down to the minimum         */
+#define KEYPAD_REPEAT_DELAY_MS  400U
+#define KEYPAD_REPEAT_START_MS  200U
+#define KEYPAD_REPEAT_STEP_MS   20U
+#define KEYPAD_REPEAT_MIN_MS    20U
+
+/* events, the queue must be a power of 2 */
+#define KEYPAD_EVENT_PRESS      1U
+#define KEYPAD_EVENT_RELEASE    2U
+#define KEYPAD_EVENT_LONG       3U
+#define KEYPAD_EVENT_REPEAT     4U
+#define KEYPAD_QUEUE_SIZE       16U
+
+typedef struct keypad_event_type {
+    unsigned char ucKey;                // 1 to KEYPAD_KEYS
+    unsigned char ucType;               // KEYPAD_EVENT_*
+} keypad_event_type;
+
+/* ************************************************** */
+/* Method name:        keypad_init                    */
+/* Method description: Set up the PIT channel and the */
+/*                     PORTA interruption. The        */
+/*                     keyboard must be initialized   */
+/* Input params:       n/a                            */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void keypad_init(void);
+
+/* ************************************************** */
+/* Method name:        keypad_configure               */
+/* Method description: Follow a new keyboard setup,   */
+/*                     to be called after each        */
+/*                     initKeyboard. Only the pins    */
+/*                     set as BUTTON interrupt        */
+/* Input params:       n/a                            */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void keypad_configure(void);
+
+/* ************************************************** */
+/* Method name:        keypad_getEvent                */
+/* Method description: Take the oldest event          */
+/* Input params:       pEvent: event read             */
+/* Output params:      1 if there was one, 0 if not   */
+/* ************************************************** */
+unsigned char keypad_getEvent(keypad_event_type *pEvent);
+
+/* ************************************************** */
+/* Method name:        keypad_hasEvent                */
+/* Method description: Check if there are events      */
+/* Input params:       n/a                            */
+/* Output params:      1 if there are, 0 if not       */
+/* ************************************************** */
+unsigned char keypad_hasEvent(void);
+
+/* ************************************************** */
+/* Method name:        keypad_isPressed               */
+/* Method description: Debounced state of a button    */
+/* Input params:       ucKey: 1 to KEYPAD_KEYS        */
+/* Output params:      1 if pressed, 0 if not         */
+/* ************************************************** */
+unsigned char keypad_isPressed(unsigned char ucKey);
+
+/* ************************************************** */
+/* Method name:        keypad_isScanning              */
+/* Method description: Check if the PIT scan runs, a  */
+/*                     button is pressed or bouncing  */
+/* Input params:       n/a                            */
+/* Output params:      1 if scanning, 0 if waiting    */
+/*                     for a press                    */
+/* ************************************************** */
+unsigned char keypad_isScanning(void);
+
+#endif /* SOURCES_KEYPAD_H_ */
@@ -11,7 +11,8 @@
 
 #include "lcd.h"
 #include "board.h"
-#include "util.h"
+#include "delay.h"
+#include "lcdDma.h"
 
 /* system includes */
 #include "fsl_clock_manager.h"
@@ -26,6 +27,18 @@
 #define L1C0_BASE    0xC0 /* line 1, column 0 */
 #define MAX_COLUMN  15U
 
+/*
+ * execution times from the KS0066U/HD44780 datasheets, with the
+ * slowest oscillator (190 kHz instead of 270 kHz). There is no R/W
+ * line on the board, so the busy flag can't be read and each write
+ * waits the time of the previous one
+ */
+#define LCD_PULSE_US        1U      /* E high, 230 ns min */
+#define LCD_EXECUTE_US      53U     /* most commands and data, 37 us typ */
+#define LCD_CLEAR_US        2200U   /* clear and home, 1.52 ms typ */
+#define LCD_POWER_ON_US     15000U  /* after Vcc rises above 4.5 V */
+#define LCD_CMD_LONG_MAX    0x03U   /* commands up to home are the long ones */
+
 
 /* global */
 /*
@@ -34,6 +47,22 @@
  */
 char cLCDText[2][17];
 
+/* the LCD finishes the last write at this deadline */
+unsigned int uiLcdReadyDeadline = 0;
+
+
+/* ************************************************ */
+/* Method name:        lcd_waitReady                */
+/* Method description: Wait until the LCD finishes  */
+/*                     the last write               */
+/* Input params:       n/a                          */
+/* Output params:      n/a                          */
+/* ************************************************ */
+static void lcd_waitReady(void)
+{
+    delay_waitUs(uiLcdReadyDeadline);
+}
+
 
 /* ************************************************ */
 /* Method name:        lcd_initLcd                  */
@@ -77,6 +106,12 @@ void lcd_initLcd(void)
     GPIOC_PDDR |= 0x1 << LCD_DATA_DB6_PIN;
     GPIOC_PDDR |= 0x1 << LCD_DATA_DB7_PIN;
 
+    /* screen refresh by DMA */
+    lcdDma_init();
+
+    /* the first command waits the power on time, counted from the boot */
+    uiLcdReadyDeadline = delay_getBootDeadlineUs(LCD_POWER_ON_US);
+
     /* turn-on LCD, with no cursor and no blink */
     lcd_sendCommand(CMD_NO_CUR_NO_BLINK);
 
@@ -109,6 +144,12 @@ void lcd_initLcd(void)
 /* ************************************************* */
 void lcd_write2Lcd(unsigned char ucBuffer,  unsigned char ucDataType)
 {
+    /* the pins are driven by the DMA during a refresh */
+    lcdDma_wait();
+
+    /* the LCD ignores writes while it executes the last one */
+    lcd_waitReady();
+
     /* writing data or command */
     if(LCD_RS_CMD == ucDataType)
         /* will send a command */
@@ -123,10 +164,14 @@ void lcd_write2Lcd(unsigned char ucBuffer,  unsigned char ucDataType)
     /* enable, delay, disable LCD */
     /* this generates a pulse in the enable pin */
     GPIOC_PDOR |= 0x1 << LCD_ENABLE_PIN;
-    util_genDelay1ms();
+    delay_us(LCD_PULSE_US);
     GPIOC_PDOR &= ~(0x1 << LCD_ENABLE_PIN);
-    util_genDelay1ms();
-    util_genDelay1ms();
+
+    /* the LCD executes on the falling edge, the wait is left to the next write */
+    if(LCD_RS_CMD == ucDataType && LCD_CMD_LONG_MAX >= ucBuffer)
+        uiLcdReadyDeadline = delay_getDeadlineUs(LCD_CLEAR_US);
+    else
+        uiLcdReadyDeadline = delay_getDeadlineUs(LCD_EXECUTE_US);
 }
 
 
@@ -233,27 +278,15 @@ void lcd_dummyText(void)
 /* Output params:      n/a                                    */
 /* ********************************************************** */
 void lcd_writeText(unsigned char ucLine, char *cText){
-    /* clear LCD */
-    lcd_sendCommand(CMD_CLEAR);
-
     /* Save string */
     setGlobalString(cText, ucLine);
 
-    /* set the cursor */
-    lcd_setCursor(0,0);
-
-    /* Write text */
-    lcd_writeString(cLCDText[0]);
-
-    /* set the cursor */
-    lcd_setCursor(1,0);
-
-    /* Write text */
-    lcd_writeString(cLCDText[1]);
+    /* Write both lines by DMA, the CPU only builds the words */
+    lcdDma_refresh(cLCDText[0], cLCDText[1]);
 
     /*
      * obs: always writes the two lines (stored on the global strings)
-     *      so the method can clear the LCD before writing anything,
+     *      padded with spaces to the whole line,
      *      that way you can write only one line without erasing the other and
      *      don't get any residues from previous texts on the LCD
      *      (example: if you write "abcdefg" and then write "123" on the same line
@@ -0,0 +1,253 @@
+/* ***************************************************************** */
+/* File name:        lcdDma.c                                        */
+/* File description: LCD refresh by DMA. Each byte takes four words, */
+/*                   one period each: data with E low twice, E high, */
+/*                   E low. The LCD reads the byte on the falling    */
+/*                   edge and the next rising edge comes three       */
+/*                   periods later, after the 53 us it needs         */
+/* Author name:      Grupo 18 - Renato Pepe                          */
+/*                              Joao Victor Matoso                   */
+/* Creation date:    19oct2026                                       */
+/* Revision date:    19oct2026                                       */
+/* ***************************************************************** */
+
+#include "lcdDma.h"
+#include "board.h"
+#include "fsl_clock_manager.h"
+
+/* DDRAM address commands of the lines */
+#define LCD_DMA_LINE0_CMD       0x80U
+#define LCD_DMA_LINE1_CMD       0xC0U
+
+/* a cursor command and the characters of each line */
+#define LCD_DMA_BYTES           (2U * (1U + LCD_DMA_COLUMNS))
+#define LCD_DMA_WORDS_PER_BYTE  4U
+
+/* idle words at the end, so the last byte is executed when the DMA ends */
+#define LCD_DMA_TAIL_WORDS      3U
+#define LCD_DMA_WORDS           (LCD_DMA_BYTES * LCD_DMA_WORDS_PER_BYTE + LCD_DMA_TAIL_WORDS)
+
+/* pins written by the DMA, the low half of GPIOC_PDOR */
+#define LCD_DMA_PIN_MASK        ((0xFFU << LCD_DATA_DB0_PIN) | (1U << LCD_RS_PIN) | (1U << LCD_ENABLE_PIN))
+
+/* DMAMUX source of the TPM2 overflow */
+#define LCD_DMA_MUX_TPM2_OVERFLOW   56U
+
+/* DMA transfer size of 16 bits */
+#define LCD_DMA_SIZE_16BITS     2U
+
+/* words of the screen, written to the low half of GPIOC_PDOR */
+unsigned short usLcdDmaBuffer[LCD_DMA_WORDS];
+
+/* 1 while a refresh runs */
+volatile unsigned char ucLcdDmaBusy = 0;
+
+/* refresh asked while another was running */
+unsigned char ucLcdDmaPending = 0;
+const char *cLcdDmaLine0;
+const char *cLcdDmaLine1;
+
+/* ************************************************** */
+/* Method name:        lcdDma_putByte                 */
+/* Method description: Write the words of a byte      */
+/* Input params:       pusWord: where to write        */
+/*                     usPins: RS and the other pins  */
+/*                     ucByte: command or character   */
+/* Output params:      next word                      */
+/* ************************************************** */
+static unsigned short *lcdDma_putByte(unsigned short *pusWord, unsigned short usPins, unsigned char ucByte)
+{
+    unsigned short usWord = usPins | ((unsigned short)ucByte << LCD_DATA_DB0_PIN);
+
+    *pusWord++ = usWord;
+    *pusWord++ = usWord;
+    *pusWord++ = usWord | (1U << LCD_ENABLE_PIN);
+    *pusWord++ = usWord;
+    return pusWord;
+}
+
+/* ************************************************** */
+/* Method name:        lcdDma_putLine                 */
+/* Method description: Write the words of a line, the */
+/*                     cursor command and the text    */
+/*                     padded with spaces             */
+/* Input params:       pusWord: where to write        */
+/*                     usPins: the other GPIOC pins   */
+/*                     ucCmd: cursor command          */
+/*                     cText: text of the line        */
+/* Output params:      next word                      */
+/* ************************************************** */
+static unsigned short *lcdDma_putLine(unsigned short *pusWord, unsigned short usPins, unsigned char ucCmd, const char *cText)
+{
+    unsigned char ucColumn;
+
+    pusWord = lcdDma_putByte(pusWord, usPins, ucCmd);
+    usPins |= 1U << LCD_RS_PIN;
+    for(ucColumn = 0; ucColumn < LCD_DMA_COLUMNS; ucColumn++){
+        pusWord = lcdDma_putByte(pusWord, usPins, *cText ? (unsigned char)*cText++ : ' ');
+    }
+    return pusWord;
+}
+
+/* ************************************************** */
+/* Method name:        lcdDma_start                   */
+/* Method description: Build the words of the screen  */
+/*                     and start the transfer         */
+/* Input params:       cLine0: text of the line 0     */
+/*                     cLine1: text of the line 1     */
+/* Output params:      n/a                            */
+/* ************************************************** */
+static void lcdDma_start(const char *cLine0, const char *cLine1)
+{
+    /* the other pins of the low half keep their value */
+    unsigned short usPins = (unsigned short)(GPIOC_PDOR & 0xFFFFU & ~LCD_DMA_PIN_MASK);
+    unsigned short *pusWord = usLcdDmaBuffer;
+    unsigned char ucTail;
+
+    pusWord = lcdDma_putLine(pusWord, usPins, LCD_DMA_LINE0_CMD, cLine0);
+    pusWord = lcdDma_putLine(pusWord, usPins, LCD_DMA_LINE1_CMD, cLine1);
+    for(ucTail = 0; ucTail < LCD_DMA_TAIL_WORDS; ucTail++){
+        *pusWord = pusWord[-1];
+        pusWord++;
+    }
+
+    ucLcdDmaBusy = 1;
+
+    /* DMA: buffer to GPIOC_PDOR, 16 bits per request, request disabled at the end */
+    DMA_DSR_BCR0 = DMA_DSR_BCR_DONE_MASK;
+    DMA_SAR0 = (unsigned int)usLcdDmaBuffer;
+    DMA_DAR0 = (unsigned int)&GPIOC_PDOR;
+    DMA_DSR_BCR0 = DMA_DSR_BCR_BCR(sizeof(usLcdDmaBuffer));
+    DMA_DCR0 = DMA_DCR_EINT_MASK | DMA_DCR_ERQ_MASK | DMA_DCR_CS_MASK | DMA_DCR_SINC_MASK |
+               DMA_DCR_SSIZE(LCD_DMA_SIZE_16BITS) | DMA_DCR_DSIZE(LCD_DMA_SIZE_16BITS) | DMA_DCR_D_REQ_MASK;
+
+    /* TPM2 overflows each period and asks a transfer, the TPM clock is MCGFLLCLK in RUN and MCGIRCLK in VLPR */
+    TPM2_SC = 0;
+    TPM2_CNT = 0;
+    TPM2_MOD = (CLOCK_SYS_GetTpmFreq(2U) / 1000000U) * LCD_DMA_PERIOD_US - 1U;
+    TPM2_STATUS = TPM_STATUS_TOF_MASK;
+    TPM2_SC = TPM_SC_DMA_MASK | TPM_SC_CMOD(1) | TPM_SC_PS(0);
+}
+
+/* ************************************************** */
+/* Method name:        lcdDma_complete                */
+/* Method description: End a transfer and start the   */
+/*                     one waiting. Called with the   */
+/*                     interruptions masked           */
+/* Input params:       n/a                            */
+/* Output params:      n/a                            */
+/* ************************************************** */
+static void lcdDma_complete(void)
+{
+    TPM2_SC = 0;
+    DMA_DSR_BCR0 = DMA_DSR_BCR_DONE_MASK;
+
+    if(ucLcdDmaPending){
+        ucLcdDmaPending = 0;
+        lcdDma_start(cLcdDmaLine0, cLcdDmaLine1);
+    }else{
+        ucLcdDmaBusy = 0;
+    }
+}
+
+/* ************************************************** */
+/* Method name:        lcdDma_init                    */
+/* Method description: Configure the DMA channel and  */
+/*                     the TPM2 that paces it. The    */
+/*                     LCD pins must be outputs       */
+/* Input params:       n/a                            */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void lcdDma_init(void)
+{
+    /* release clock to the DMA, the DMAMUX and the TPM2 */
+    SIM_SCGC7 |= SIM_SCGC7_DMA_MASK;
+    SIM_SCGC6 |= SIM_SCGC6_DMAMUX_MASK | SIM_SCGC6_TPM2_MASK;
+
+    /* set the TPM clock source to MCGFLLCLK, shared with the PWM and the tachometer */
+    SIM_SOPT2 = (SIM_SOPT2 & ~SIM_SOPT2_TPMSRC_MASK) | SIM_SOPT2_TPMSRC(1);
+
+    TPM2_SC = 0;
+    DMA_DCR0 = 0;
+    DMA_DSR_BCR0 = DMA_DSR_BCR_DONE_MASK;
+
+    /* channel 0 requested by the TPM2 overflow */
+    DMAMUX0_CHCFG0 = 0;
+    DMAMUX0_CHCFG0 = DMAMUX_CHCFG_ENBL_MASK | DMAMUX_CHCFG_SOURCE(LCD_DMA_MUX_TPM2_OVERFLOW);
+
+    NVIC_EnableIRQ(DMA0_IRQn);
+}
+
+/* ************************************************** */
+/* Method name:        lcdDma_refresh                 */
+/* Method description: Write both lines. If a refresh */
+/*                     is running, this one starts    */
+/*                     when it ends, reading the      */
+/*                     strings then                   */
+/* Input params:       cLine0: text of the line 0     */
+/*                     cLine1: text of the line 1,    */
+/*                     both kept until written        */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void lcdDma_refresh(const char *cLine0, const char *cLine1)
+{
+    unsigned int uiPrimask = __get_PRIMASK();
+    __disable_irq();
+
+    if(ucLcdDmaBusy){
+        cLcdDmaLine0 = cLine0;
+        cLcdDmaLine1 = cLine1;
+        ucLcdDmaPending = 1;
+    }else{
+        lcdDma_start(cLine0, cLine1);
+    }
+
+    __set_PRIMASK(uiPrimask);
+}
+
+/* ************************************************** */
+/* Method name:        lcdDma_isBusy                  */
+/* Method description: Check if a refresh is running  */
+/*                     or waiting                     */
+/* Input params:       n/a                            */
+/* Output params:      1 if busy, 0 if not            */
+/* ************************************************** */
+unsigned char lcdDma_isBusy(void)
+{
+    return ucLcdDmaBusy;
+}
+
+/* ************************************************** */
+/* Method name:        lcdDma_wait                    */
+/* Method description: Wait until the refreshes end,  */
+/*                     before the CPU writes the LCD  */
+/*                     pins. Works with the           */
+/*                     interruptions masked           */
+/* Input params:       n/a                            */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void lcdDma_wait(void)
+{
+    unsigned int uiPrimask;
+
+    while(ucLcdDmaBusy){
+        /* the end of the transfer is taken here if the interruption can't run */
+        uiPrimask = __get_PRIMASK();
+        __disable_irq();
+        if(ucLcdDmaBusy && (DMA_DSR_BCR0 & DMA_DSR_BCR_DONE_MASK))
+            lcdDma_complete();
+        __set_PRIMASK(uiPrimask);
+    }
+}
+
+/* ************************************************** */
+/* Method name:        DMA0_IRQHandler                */
+/* Method description: End of a refresh               */
+/* Input params:       n/a                            */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void DMA0_IRQHandler(void)
+{
+    if(DMA_DSR_BCR0 & DMA_DSR_BCR_DONE_MASK)
+        lcdDma_complete();
+}
@@ -0,0 +1,65 @@
+/* ***************************************************************** */
+/* File name:        lcdDma.h                                        */
+/* File description: LCD refresh written by the DMA. The CPU builds  */
+/*                   the GPIOC_PDOR words of the whole screen (data, */
+/*                   RS and the E strobes) and the DMA channel 0,    */
+/*                   paced by the TPM2 overflow, writes them out     */
+/* Author name:      Grupo 18 - Renato Pepe                          */
+/*                              Joao Victor Matoso                   */
+/* Creation date:    19oct2026                                       */
+/* Revision date:    19oct2026                                       */
+/* ***************************************************************** */
+
+#ifndef SOURCES_LCDDMA_H_
+#define SOURCES_LCDDMA_H_
+
+/* characters of a line, shorter lines are padded with spaces */
+#define LCD_DMA_COLUMNS         16U
+
+/* time between two words, the LCD needs 53 us between writes */
+#define LCD_DMA_PERIOD_US       18U
+
+/* ************************************************** */
+/* Method name:        lcdDma_init                    */
+/* Method description: Configure the DMA channel and  */
+/*                     the TPM2 that paces it. The    */
+/*                     LCD pins must be outputs       */
+/* Input params:       n/a                            */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void lcdDma_init(void);
+
+/* ************************************************** */
+/* Method name:        lcdDma_refresh                 */
+/* Method description: Write both lines. If a refresh */
+/*                     is running, this one starts    */
+/*                     when it ends, reading the      */
+/*                     strings then                   */
+/* Input params:       cLine0: text of the line 0     */
+/*                     cLine1: text of the line 1,    */
+/*                     both kept until written        */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void lcdDma_refresh(const char *cLine0, const char *cLine1);
+
+/* ************************************************** */
+/* Method name:        lcdDma_isBusy                  */
+/* Method description: Check if a refresh is running  */
+/*                     or waiting                     */
+/* Input params:       n/a                            */
+/* Output params:      1 if busy, 0 if not            */
+/* ************************************************** */
+unsigned char lcdDma_isBusy(void);
+
+/* ************************************************** */
+/* Method name:        lcdDma_wait                    */
+/* Method description: Wait until the refreshes end,  */
+/*                     before the CPU writes the LCD  */
+/*                     pins. Works with the           */
+/*                     interruptions masked           */
+/* Input params:       n/a                            */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void lcdDma_wait(void);
+
+#endif /* SOURCES_LCDDMA_H_ */
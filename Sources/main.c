@@ -26,10 +26,19 @@
 #include "tacometro.h"
 #include "interfacelocal.h"
 #include "timer.h"
+#include "fanControl.h"
+#include "schedule.h"
+#include "paramRegistry.h"
+#include "publish.h"
+#include "modbus.h"
+#include "node.h"
+#include "telemetry.h"
+#include "eventlog.h"
+#include "keypad.h"
+#include "power.h"
+#include "boot.h"
 
 /* global variables */
-// counter to divide the frequency of the interruption to make tachometer to read its sensor every 300ms
-unsigned int uiTachometerTimer = 0;
 // counter to divide the frequency of the interruption to make local interface update every 500ms
 unsigned int uiInterfaceTimer = 0;
 // current measured temperature after the filter is applied
@@ -37,17 +46,22 @@ unsigned int fFilteredTemperature;
 
 /* ************************************************ */
 /* Method name:        boardInit                    */
-/* Method description: main board all needed        */
-/*                     initializations              */
+/* Method description: initializations of the       */
+/*                     control path, up to the first*/
+/*                     control tick                 */
 /* Input params:       n/a                          */
 /* Output params:      n/a                          */
 /* ************************************************ */
 void boardInit(void)
 {
+    /* boot time from here, the cycle counter is also used by the delays */
+    boot_start();
+
     /* clock configuration and initialization */
     mcg_clockInit();
+    boot_clockChanged();
 
-    /* initialize the PWM signal to control the heater and cooler */
+    /* initialize the PWM signal to control the heater and cooler, both at 0% */
     PWM_init();
 
     /* initialize the cooler */
@@ -59,36 +73,83 @@ void boardInit(void)
     /* initialize the adc converter */
     adc_initADCModule();
 
-    /* start RGB LED */
-    ledrgb_init();
-    ledrgb_write(0);
-
-    /* init keyboard with buttons 2, 3 and 4 */
-	keyboard kbKeyboardOn[4] = {NOTSET, NOTSET, NOTSET, BUTTON};
-	initKeyboard(kbKeyboardOn);
-
-	/* Configure the UART module */
-	UART0_init();
-	
-	/* Enable UART interruptions */
-	UART0_enableIRQ();
-
-    /* initialize the lcd display */
-    lcd_initLcd();
-
     /* initialize the tachometer */
     tachometer_init();
 
     /* initialize PID */
     pid_init();
+
+    /* initialize the fan speed controller (off until a target RPM is set) */
+    fanControl_init();
     
     /* initialize filter with current temperature */
     filter_init(adc_getTemperature());
 
     /* initialize timer module with period of 100 ms*/
     timer_init(100);
+
+    /* start the RTC wall clock with an empty daily program */
+    schedule_init();
+
+    /* no parameter is pushed until the host subscribes */
+    publish_init();
+
+    /* events are kept from here on, sent when the host enables the log */
+    eventlog_init();
+}
+
+/* ************************************************ */
+/* Method name:        boardInitSerial              */
+/* Method description: deferred initialization of   */
+/*                     the serial commands          */
+/* Input params:       n/a                          */
+/* Output params:      n/a                          */
+/* ************************************************ */
+static void boardInitSerial(void)
+{
+	/* index the parameters of the serial commands */
+	param_init();
+
+	/* Configure the UART module */
+	UART0_init();
+	
+	/* Enable UART interruptions */
+	UART0_enableIRQ();
+
+	/* node ID saved in flash, 0 talks point to point */
+	node_init();
+}
+
+/* ************************************************ */
+/* Method name:        boardInitLocalInterface      */
+/* Method description: deferred initialization of   */
+/*                     the LED, buttons and LCD     */
+/* Input params:       n/a                          */
+/* Output params:      n/a                          */
+/* ************************************************ */
+static void boardInitLocalInterface(void)
+{
+    /* start RGB LED */
+    ledrgb_init();
+    ledrgb_write(0);
+
+    /* init keyboard with buttons 2, 3 and 4 */
+	keyboard kbKeyboardOn[4] = {NOTSET, NOTSET, NOTSET, BUTTON};
+	initKeyboard(kbKeyboardOn);
+
+	/* button events by interruption, debounced on the PIT */
+	keypad_init();
+
+    /* initialize the lcd display */
+    lcd_initLcd();
 }
 
+/* run by the main loop after the first control tick, in this order */
+const boot_task_t bootTasks[] = {
+    boardInitSerial,
+    boardInitLocalInterface,
+};
+
 /* ************************************************* */
 /* Method name:        periodic_temperatureControl   */
 /* Method description: periodic task for temperature */
@@ -101,11 +162,19 @@ void periodic_temperatureControl(void){
     float fCurrentTemperature = adc_getTemperature();
     
     /* Filters data using a Exponential Moving Average filter */
-    fFilteredTemperature = filter_dema(fCurrentTemperature);
+    float fFilteredValue = filter_dema(fCurrentTemperature);
+    fFilteredTemperature = fFilteredValue;
+    telemetry_sample(fFilteredValue);
 
     /* Compute heater duty cycle with PID control and update it if PID is on */
     if(pid_isOn()){
-    	heater_PWMDuty(pidUpdateData(fFilteredTemperature)/100);
+        float fEffort = pidUpdateData(fFilteredTemperature);
+
+        /* cascade: a negative effort becomes the target speed of the fan inner loop */
+        if(pid_isCoolerCascadeOn())
+            fanControl_applyCascade(fEffort);
+        else
+            heater_PWMDuty(fEffort/100);
     }
 
     /* print temp and heater DC on the UART constantly for PID tuning */
@@ -127,16 +196,17 @@ void periodic_temperatureControl(void){
 /* ************************************************** */
 /* Method name:        periodic_tachometerReadData    */
 /* Method description: periodic task for updating the */
-/*                     tachometer speed data          */
+/*                     tachometer speed data and the  */
+/*                     fan speed inner loop           */
 /* Input params:       n/a                            */
 /* Output params:      n/a                            */
 /* ************************************************** */
 void periodic_tachometerReadData(void){
-    /* updates the tachometer data each 1000 miliseconds */
-    if(9 == uiTachometerTimer++){
-        tachometer_readSensor(1000);
-        uiTachometerTimer = 0;
-    }
+    /* updates the tachometer data from the captured edges every 100ms */
+    tachometer_update();
+
+    /* closes the fan speed loop on each new speed, FAN_CONTROL_PERIOD_MS, if RPM control is on */
+    fanControl_update(tachometer_getSpeed());
 }
 
 /* ************************************************** */
@@ -147,8 +217,12 @@ void periodic_tachometerReadData(void){
 /* Output params:      n/a                            */
 /* ************************************************** */
 void periodic_localInterface(){
-	/* read the buttons and update the LCD each 500ms */
-	if(4 == uiInterfaceTimer++){
+	/* the LCD and the buttons are initialized by the main loop */
+	if(!boot_isDone())
+		return;
+
+	/* apply the button events at once, update the LCD each 500ms */
+	if(keypad_hasEvent() || 4 <= uiInterfaceTimer++){
 		localInterfaceHandler();
 
 		/* changes LED color according to temperature */
@@ -185,8 +259,11 @@ void periodic_interruption(void){
     /* Routine to update local interface information */
     periodic_localInterface();
 
-    /* ticks the timer every 100 ms */
+    /* ticks the timer every 100 ms, the daily program entries run from its one-shot timer */
     timer_tick();
+
+    /* the main loop has new samples and events to send */
+    power_tick();
 }
 
 /* ************************************************ */
@@ -197,14 +274,41 @@ void periodic_interruption(void){
 /* ************************************************ */
 int main(void)
 {
-    /* board initializations */
+    /* control path initializations */
     boardInit();
 
+    /* the first control tick runs at once, the LCD and the serial port come up later */
+    periodic_interruption();
+    boot_setControlStarted(bootTasks, sizeof(bootTasks) / sizeof(bootTasks[0]));
+
     /* set timer to 100ms and it triggers the periodic methods */
     tc_installLptmr0(100000, periodic_interruption);
 
-    /* do nothing while the interruption handles everything*/
+    /* the periodic tasks run in the interruption, the serial commands are parsed here between the sleeps */
     while (1){
+        /* the deferred initializations, one per pass, before anything uses the UART */
+        if(!boot_isDone()){
+            boot_runNext();
+            continue;
+        }
+
+        /* RUN or VLPR, by the work waiting */
+        power_update();
+
+        /* the commands may write the flash or change the baud rate, which VLPR can't */
+        if(!power_isVlpr())
+            UART0_processReceived();
+
+        /* the pushes would break the Modbus frames and collide on a shared bus */
+        if(modbus_isEnabled())
+            modbus_update();
+        else if(0 == node_getId()){
+            publish_update();
+            telemetry_update();
+            eventlog_update();
+        }
 
+        /* sleep until the next interruption */
+        power_idle();
     }
 }
@@ -69,6 +69,12 @@
 #define CLOCK_VLPR                   1U /* very low power run mode */
 #define CLOCK_RUN                    2U /* run mode */
 
+/* SMC_PMCTRL RUNM and SMC_PMSTAT values */
+#define MCG_RUNM_RUN                 0U
+#define MCG_RUNM_VLPR                2U
+#define MCG_PMSTAT_RUN               0x01U
+#define MCG_PMSTAT_VLPR              0x04U
+
 #ifndef CLOCK_INIT_CONFIG
 #define CLOCK_INIT_CONFIG CLOCK_RUN
 #endif
@@ -81,7 +87,7 @@ const clock_manager_user_config_t g_defaultClockConfigVlpr =
     {
         .mcg_mode           = kMcgModeBLPI,       // Work in BLPI mode
         .irclkEnable        = true,               // MCGIRCLK enable
-        .irclkEnableInStop  = false,              // MCGIRCLK disable in STOP mode
+        .irclkEnableInStop  = true,               // MCGIRCLK enable in STOP mode, clocks the UART0 and TPMs in VLPS
         .ircs               = kMcgIrcFast,        // Select IRC4M
         .fcrdiv             = 0U,                 // FCRDIV is 0
 
@@ -136,8 +142,8 @@ const clock_manager_user_config_t g_defaultClockConfigRun =
 
         /* ------------------ MCGIRCCLK settings ---------------------- */
         .irclkEnable        = true,              // MCGIRCLK enable
-        .irclkEnableInStop  = false,             // MCGIRCLK disable in STOP mode
-        .ircs               = kMcgIrcSlow,       // Select IRC 32kHz
+        .irclkEnableInStop  = true,              // MCGIRCLK enable in STOP mode, clocks the UART0 in VLPS
+        .ircs               = kMcgIrcFast,       // Select IRC4M, the UART0 baud rates need it
         .fcrdiv             = 0U,                // FCRDIV is 0
 
         /* -------------------- MCG FLL settings ---------------------- */
@@ -282,3 +288,41 @@ void mcg_clockInit(void)
     /* setup system clock */
     mcg_initSystemClock();
 }
+
+
+
+/* ************************************************ */
+/* Method name:        mcg_enterVlpr                */
+/* Method description: Change to BLPI (core 4 MHz,  */
+/*                     bus 800 kHz) and enter VLPR. */
+/*                     Nothing may use the FLL      */
+/* Input params:       n/a                          */
+/* Output params:      n/a                          */
+/* ************************************************ */
+void mcg_enterVlpr(void)
+{
+    /* VLPR only accepts the clock of the BLPI configuration */
+    CLOCK_SYS_SetConfiguration(&g_defaultClockConfigVlpr);
+
+    SMC_PMCTRL = (SMC_PMCTRL & ~SMC_PMCTRL_RUNM_MASK) | SMC_PMCTRL_RUNM(MCG_RUNM_VLPR);
+    while(MCG_PMSTAT_VLPR != SMC_PMSTAT);
+}
+
+
+
+/* ************************************************ */
+/* Method name:        mcg_exitVlpr                 */
+/* Method description: Go back to RUN and to FEE    */
+/*                     (40 MHz). The FLL takes up   */
+/*                     to 1 ms to lock              */
+/* Input params:       n/a                          */
+/* Output params:      n/a                          */
+/* ************************************************ */
+void mcg_exitVlpr(void)
+{
+    /* the FLL can only be engaged in RUN */
+    SMC_PMCTRL = (SMC_PMCTRL & ~SMC_PMCTRL_RUNM_MASK) | SMC_PMCTRL_RUNM(MCG_RUNM_RUN);
+    while(MCG_PMSTAT_RUN != SMC_PMSTAT);
+
+    CLOCK_SYS_SetConfiguration(&g_defaultClockConfigRun);
+}
@@ -20,4 +20,24 @@
 /* ************************************************ */
 void mcg_clockInit(void);
 
+/* ************************************************ */
+/* Method name:        mcg_enterVlpr                */
+/* Method description: Change to BLPI (core 4 MHz,  */
+/*                     bus 800 kHz) and enter VLPR. */
+/*                     Nothing may use the FLL      */
+/* Input params:       n/a                          */
+/* Output params:      n/a                          */
+/* ************************************************ */
+void mcg_enterVlpr(void);
+
+/* ************************************************ */
+/* Method name:        mcg_exitVlpr                 */
+/* Method description: Go back to RUN and to FEE    */
+/*                     (40 MHz). The FLL takes up   */
+/*                     to 1 ms to lock              */
+/* Input params:       n/a                          */
+/* Output params:      n/a                          */
+/* ************************************************ */
+void mcg_exitVlpr(void);
+
 #endif /* SOURCES_MCG_H_ */
@@ -0,0 +1,353 @@
+/* ***************************************************************** */
+/* File name:        modbus.c                                        */
+/* File description: Modbus RTU slave. The UART interruption stores  */
+/*                   the bytes and restarts a PIT channel; when the  */
+/*                   line stays silent for 3.5 characters the frame  */
+/*                   is complete and the main loop answers it        */
+/* Author name:      Grupo 18 - Renato Pepe                          */
+/*                              Joao Victor Matoso                   */
+/* Creation date:    19oct2026                                       */
+/* Revision date:    19oct2026                                       */
+/* ***************************************************************** */
+
+#include "modbus.h"
+#include "pit.h"
+#include "crc16.h"
+#include "UART.h"
+#include "paramRegistry.h"
+#include "console.h"
+#include "node.h"
+#include "eventlog.h"
+
+/* PIT channel that measures the silence between frames */
+#define MODBUS_PIT_CHANNEL          0U
+
+/* 3.5 characters of 11 bits in us is 38500000 / baud; above 19200 bps the standard fixes it */
+#define MODBUS_SILENCE_BIT_US       38500000U
+#define MODBUS_FIXED_SILENCE_BAUD   19200U
+#define MODBUS_FIXED_SILENCE_US     1750U
+
+/* shortest request: address, function, 2 words and the CRC */
+#define MODBUS_REQUEST_SIZE         8U
+
+/* address used to write to every slave, never answered */
+#define MODBUS_BROADCAST            0U
+
+typedef struct modbus_register_type {
+    unsigned char ucGetLetter;      // parameter read
+    unsigned char ucSetLetter;      // parameter written, 0 if read only
+    float fScale;                   // register = value * scale
+} modbus_register_type;
+
+/* holding registers, addresses start at 0 */
+static const modbus_register_type modbusHolding[] = {
+    {'g', 't', 100.0f},             // setpoint
+    {'p', 'p', 100.0f},             // Kp
+    {'i', 'i', 1000.0f},            // Ki
+    {'d', 'd', 100.0f},             // Kd
+    {'a', 'a', 1000.0f},            // heater duty
+    {'c', 'c', 1000.0f},            // cooler duty
+    {'s', 's', 1.0f},               // PID on/off
+    {'f', 'f', 1.0f},               // cooler cascade
+    {'v', 'v', 1.0f},               // target RPM
+    {'x', 'x', 1.0f},               // Modbus mode
+};
+
+/* input registers, addresses start at 0 */
+static const modbus_register_type modbusInput[] = {
+    {'t', 0, 100.0f},               // temperature
+    {'r', 0, 10.0f},                // cooler RPM
+    {'e', 0, 1.0f},                 // RPM error
+    {'m', 0, 1.0f},                 // timer left
+};
+
+#define MODBUS_HOLDING_SIZE     (sizeof(modbusHolding) / sizeof(modbusHolding[0]))
+#define MODBUS_INPUT_SIZE       (sizeof(modbusInput) / sizeof(modbusInput[0]))
+
+/* frame being received, written by the interruptions until it is ready */
+volatile unsigned char ucModbusFrame[MODBUS_FRAME_SIZE];
+volatile unsigned char ucModbusLength = 0;
+volatile unsigned char ucModbusOverflow = 0;
+volatile unsigned char ucModbusFrameReady = 0;
+
+unsigned char ucModbusEnabled = 0;
+
+/* ************************************************** */
+/* Method name:        modbus_receiveByte             */
+/* Method description: UART receive callback, store   */
+/*                     the byte and restart the       */
+/*                     silence timer                  */
+/* Input params:       ucByte: received byte          */
+/* Output params:      n/a                            */
+/* ************************************************** */
+static void modbus_receiveByte(unsigned char ucByte)
+{
+    /* the master waits for the answer, bytes before it are noise */
+    if(ucModbusFrameReady)
+        return;
+
+    if(MODBUS_FRAME_SIZE > ucModbusLength)
+        ucModbusFrame[ucModbusLength++] = ucByte;
+    else
+        ucModbusOverflow = 1;
+
+    pit_start(MODBUS_PIT_CHANNEL);
+}
+
+/* ************************************************** */
+/* Method name:        modbus_frameEnd                */
+/* Method description: PIT callback, the line was     */
+/*                     silent for 3.5 characters      */
+/* Input params:       n/a                            */
+/* Output params:      n/a                            */
+/* ************************************************** */
+static void modbus_frameEnd(void)
+{
+    pit_stop(MODBUS_PIT_CHANNEL);
+    if(ucModbusLength)
+        ucModbusFrameReady = 1;
+}
+
+/* ************************************************** */
+/* Method name:        modbus_readRegister            */
+/* Method description: Read a parameter as a 16 bit   */
+/*                     register, rounded and clamped  */
+/* Input params:       pRegister: register map entry  */
+/* Output params:      register value                 */
+/* ************************************************** */
+static unsigned short modbus_readRegister(const modbus_register_type *pRegister)
+{
+    const param_descriptor_type *pParam = param_findGet(pRegister->ucGetLetter);
+    float fValue = pParam->fGet() * pRegister->fScale;
+    int iValue = (int)(fValue + ((0.0f > fValue) ? -0.5f : 0.5f));
+
+    if(PARAM_FORMAT_INT == pParam->ucFormat){
+        if(-32768 > iValue)
+            iValue = -32768;
+        else if(32767 < iValue)
+            iValue = 32767;
+    }else{
+        if(0 > iValue)
+            iValue = 0;
+        else if(65535 < iValue)
+            iValue = 65535;
+    }
+    return (unsigned short)iValue;
+}
+
+/* ************************************************** */
+/* Method name:        modbus_writeRegister           */
+/* Method description: Write a parameter from a 16    */
+/*                     bit register                   */
+/* Input params:       pRegister: register map entry  */
+/*                     usValue: register value        */
+/* Output params:      0 or a Modbus exception code   */
+/* ************************************************** */
+static unsigned char modbus_writeRegister(const modbus_register_type *pRegister, unsigned short usValue)
+{
+    const param_descriptor_type *pParam = param_findSet(pRegister->ucSetLetter);
+
+    if(!pParam)
+        return MODBUS_ILLEGAL_ADDRESS;
+
+    switch(param_set(pParam, (float)usValue / pRegister->fScale)){
+    case PARAM_OK:
+        return 0;
+    case PARAM_ERROR_RANGE:
+        return MODBUS_ILLEGAL_VALUE;
+    default:
+        return MODBUS_SLAVE_FAILURE;
+    }
+}
+
+/* ************************************************** */
+/* Method name:        modbus_execute                 */
+/* Method description: Run the request of a frame     */
+/*                     with a valid CRC and answer it */
+/* Input params:       pucFrame: request              */
+/*                     ucLength: bytes with the CRC   */
+/* Output params:      n/a                            */
+/* ************************************************** */
+static void modbus_execute(const unsigned char *pucFrame, unsigned char ucLength)
+{
+    unsigned char ucResponse[MODBUS_FRAME_SIZE];
+    unsigned char ucFunction = pucFrame[1];
+    unsigned short usAddress = ((unsigned short)pucFrame[2] << 8) | pucFrame[3];
+    unsigned short usCount = ((unsigned short)pucFrame[4] << 8) | pucFrame[5];
+    const modbus_register_type *pTable = modbusHolding;
+    unsigned short usTableSize = MODBUS_HOLDING_SIZE;
+    unsigned char ucResponseLength = 0;
+    unsigned char ucException = 0;
+    unsigned char ucIndex;
+    unsigned short usValue, usCrc;
+
+    ucResponse[0] = pucFrame[0];
+    ucResponse[1] = ucFunction;
+
+    switch(ucFunction){
+    case MODBUS_READ_INPUT:
+        pTable = modbusInput;
+        usTableSize = MODBUS_INPUT_SIZE;
+        /* fall through */
+    case MODBUS_READ_HOLDING:
+        if(MODBUS_REQUEST_SIZE != ucLength || 0 == usCount || MODBUS_MAX_REGISTERS < usCount){
+            ucException = MODBUS_ILLEGAL_VALUE;
+        }else if(usTableSize < usAddress + usCount){
+            ucException = MODBUS_ILLEGAL_ADDRESS;
+        }else{
+            ucResponse[2] = (unsigned char)(usCount * 2);
+            for(ucIndex = 0; ucIndex < usCount; ucIndex++){
+                usValue = modbus_readRegister(&pTable[usAddress + ucIndex]);
+                ucResponse[3 + 2 * ucIndex] = (unsigned char)(usValue >> 8);
+                ucResponse[4 + 2 * ucIndex] = (unsigned char)usValue;
+            }
+            ucResponseLength = 3 + 2 * usCount;
+        }
+        break;
+
+    case MODBUS_WRITE_SINGLE:
+        /* the second word is the value */
+        if(MODBUS_REQUEST_SIZE != ucLength)
+            ucException = MODBUS_ILLEGAL_VALUE;
+        else if(MODBUS_HOLDING_SIZE <= usAddress)
+            ucException = MODBUS_ILLEGAL_ADDRESS;
+        else
+            ucException = modbus_writeRegister(&modbusHolding[usAddress], usCount);
+        break;
+
+    case MODBUS_WRITE_MULTIPLE:
+        /* address, function, start, count, byte count, values, CRC */
+        if(0 == usCount || MODBUS_MAX_REGISTERS < usCount || pucFrame[6] != usCount * 2 || ucLength != 9 + usCount * 2){
+            ucException = MODBUS_ILLEGAL_VALUE;
+        }else if(MODBUS_HOLDING_SIZE < usAddress + usCount){
+            ucException = MODBUS_ILLEGAL_ADDRESS;
+        }else{
+            for(ucIndex = 0; ucIndex < usCount && !ucException; ucIndex++){
+                usValue = ((unsigned short)pucFrame[7 + 2 * ucIndex] << 8) | pucFrame[8 + 2 * ucIndex];
+                ucException = modbus_writeRegister(&modbusHolding[usAddress + ucIndex], usValue);
+            }
+        }
+        break;
+
+    default:
+        ucException = MODBUS_ILLEGAL_FUNCTION;
+    }
+
+    if(MODBUS_BROADCAST == pucFrame[0])
+        return;
+
+    if(ucException){
+        ucResponse[1] = ucFunction | 0x80U;
+        ucResponse[2] = ucException;
+        ucResponseLength = 3;
+    }else if(0 == ucResponseLength){
+        /* the writes echo the start address and the value or count */
+        for(ucIndex = 2; ucIndex < 6; ucIndex++)
+            ucResponse[ucIndex] = pucFrame[ucIndex];
+        ucResponseLength = 6;
+    }
+
+    usCrc = crc16_compute(ucResponse, ucResponseLength);
+    ucResponse[ucResponseLength++] = (unsigned char)usCrc;
+    ucResponse[ucResponseLength++] = (unsigned char)(usCrc >> 8);
+
+    UART0_transmitBegin();
+    for(ucIndex = 0; ucIndex < ucResponseLength; ucIndex++)
+        console_putChar(ucResponse[ucIndex]);
+    UART0_transmitEnd();
+}
+
+/* ************************************************** */
+/* Method name:        modbus_enable                  */
+/* Method description: Take the UART from the ASCII   */
+/*                     commands and serve Modbus RTU  */
+/*                     at the current baud rate       */
+/* Input params:       n/a                            */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void modbus_enable(void)
+{
+    unsigned int uiBaudRate = UART0_getBaudRate();
+    unsigned int uiSilenceUs = MODBUS_FIXED_SILENCE_US;
+
+    if(MODBUS_FIXED_SILENCE_BAUD >= uiBaudRate)
+        uiSilenceUs = MODBUS_SILENCE_BIT_US / uiBaudRate;
+
+    ucModbusLength = 0;
+    ucModbusOverflow = 0;
+    ucModbusFrameReady = 0;
+    pit_setPeriod(MODBUS_PIT_CHANNEL, uiSilenceUs, modbus_frameEnd);
+
+    ucModbusEnabled = 1;
+    UART0_setReceiveCallback(modbus_receiveByte);
+    eventlog_write(EVENTLOG_PROTOCOL, 1, 0);
+}
+
+/* ************************************************** */
+/* Method name:        modbus_disable                 */
+/* Method description: Give the UART back to the      */
+/*                     ASCII commands                 */
+/* Input params:       n/a                            */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void modbus_disable(void)
+{
+    UART0_setReceiveCallback(0);
+    pit_stop(MODBUS_PIT_CHANNEL);
+    ucModbusEnabled = 0;
+    eventlog_write(EVENTLOG_PROTOCOL, 0, 0);
+}
+
+/* ************************************************** */
+/* Method name:        modbus_isEnabled               */
+/* Method description: Check the protocol in use      */
+/* Input params:       n/a                            */
+/* Output params:      1 if Modbus RTU, 0 if ASCII    */
+/* ************************************************** */
+unsigned char modbus_isEnabled(void)
+{
+    return ucModbusEnabled;
+}
+
+/* ************************************************** */
+/* Method name:        modbus_hasFrame                */
+/* Method description: Check if a complete frame      */
+/*                     waits for modbus_update        */
+/* Input params:       n/a                            */
+/* Output params:      1 if there is one, 0 if not    */
+/* ************************************************** */
+unsigned char modbus_hasFrame(void)
+{
+    return ucModbusFrameReady;
+}
+
+/* ************************************************** */
+/* Method name:        modbus_update                  */
+/* Method description: Answer a complete frame, if    */
+/*                     one was received. Called from  */
+/*                     the main loop                  */
+/* Input params:       n/a                            */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void modbus_update(void)
+{
+    const unsigned char *pucFrame = (const unsigned char *)ucModbusFrame;
+    unsigned char ucAddress = node_getId();
+
+    if(!ucModbusFrameReady)
+        return;
+
+    /* the node ID is the slave address on a shared bus */
+    if(0 == ucAddress)
+        ucAddress = MODBUS_DEFAULT_ADDRESS;
+
+    /* the CRC of a frame with its own CRC appended is 0 */
+    if(!ucModbusOverflow && MODBUS_REQUEST_SIZE <= ucModbusLength && 0 == crc16_compute(pucFrame, ucModbusLength)
+            && (ucAddress == pucFrame[0] || MODBUS_BROADCAST == pucFrame[0]))
+        modbus_execute(pucFrame, ucModbusLength);
+
+    /* the interruption takes bytes again once the frame is released */
+    ucModbusLength = 0;
+    ucModbusOverflow = 0;
+    ucModbusFrameReady = 0;
+}
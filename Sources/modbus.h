@@ -0,0 +1,94 @@
+/* ***************************************************************** */
+/* File name:        modbus.h                                        */
+/* File description: Modbus RTU slave on UART0, used instead of the  */
+/*                   ASCII commands when enabled (#sx1;). Registers: */
+/*                                                                   */
+/*   holding (03 read, 06/16 write)   input (04 read)                */
+/*   0 setpoint      0.01 C           0 temperature   0.01 C         */
+/*   1 Kp            0.01             1 cooler RPM    0.1 RPM        */
+/*   2 Ki            0.001            2 RPM error     RPM (signed)   */
+/*   3 Kd            0.01             3 timer left    s              */
+/*   4 heater duty   0.1 %                                           */
+/*   5 cooler duty   0.1 %                                           */
+/*   6 PID on/off                                                    */
+/*   7 cooler cascade on/off                                         */
+/*   8 target RPM    RPM                                             */
+/*   9 Modbus mode, writing 0 goes back to the ASCII commands        */
+/*                                                                   */
+/*                   Writes go through the parameter registry, so a  */
+/*                   value out of its range gets exception 03        */
+/* Author name:      Grupo 18 - Renato Pepe                          */
+/*                              Joao Victor Matoso                   */
+/* Creation date:    19oct2026                                       */
+/* Revision date:    19oct2026                                       */
+/* ***************************************************************** */
+
+#ifndef SOURCES_MODBUS_H_
+#define SOURCES_MODBUS_H_
+
+/* slave address of the board when it has no node ID */
+#define MODBUS_DEFAULT_ADDRESS      1U
+
+/* longest frame accepted, enough for 16 registers */
+#define MODBUS_FRAME_SIZE           64U
+#define MODBUS_MAX_REGISTERS        16U
+
+/* function codes */
+#define MODBUS_READ_HOLDING         0x03U
+#define MODBUS_READ_INPUT           0x04U
+#define MODBUS_WRITE_SINGLE         0x06U
+#define MODBUS_WRITE_MULTIPLE       0x10U
+
+/* exception codes */
+#define MODBUS_ILLEGAL_FUNCTION     0x01U
+#define MODBUS_ILLEGAL_ADDRESS      0x02U
+#define MODBUS_ILLEGAL_VALUE        0x03U
+#define MODBUS_SLAVE_FAILURE        0x04U
+
+/* ************************************************** */
+/* Method name:        modbus_enable                  */
+/* Method description: Take the UART from the ASCII   */
+/*                     commands and serve Modbus RTU  */
+/*                     at the current baud rate       */
+/* Input params:       n/a                            */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void modbus_enable(void);
+
+/* ************************************************** */
+/* Method name:        modbus_disable                 */
+/* Method description: Give the UART back to the      */
+/*                     ASCII commands                 */
+/* Input params:       n/a                            */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void modbus_disable(void);
+
+/* ************************************************** */
+/* Method name:        modbus_isEnabled               */
+/* Method description: Check the protocol in use      */
+/* Input params:       n/a                            */
+/* Output params:      1 if Modbus RTU, 0 if ASCII    */
+/* ************************************************** */
+unsigned char modbus_isEnabled(void);
+
+/* ************************************************** */
+/* Method name:        modbus_hasFrame                */
+/* Method description: Check if a complete frame      */
+/*                     waits for modbus_update        */
+/* Input params:       n/a                            */
+/* Output params:      1 if there is one, 0 if not    */
+/* ************************************************** */
+unsigned char modbus_hasFrame(void);
+
+/* ************************************************** */
+/* Method name:        modbus_update                  */
+/* Method description: Answer a complete frame, if    */
+/*                     one was received. Called from  */
+/*                     the main loop                  */
+/* Input params:       n/a                            */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void modbus_update(void);
+
+#endif /* SOURCES_MODBUS_H_ */
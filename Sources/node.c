@@ -0,0 +1,161 @@
+/* ***************************************************************** */
+/* File name:        node.c                                          */
+/* File description: Node address and the selection filter. A board  */
+/*                   that is not selected only looks for the next    */
+/*                   '@', the commands for the others are not parsed.*/
+/*                   The binary frames on the bus are skipped whole, */
+/*                   so an '@' in their bytes does not select it     */
+/* Author name:      Grupo 18 - Renato Pepe                          */
+/*                              Joao Victor Matoso                   */
+/* Creation date:    19oct2026                                       */
+/* Revision date:    19oct2026                                       */
+/* ***************************************************************** */
+
+#include "node.h"
+#include "nvm.h"
+#include "UART.h"
+#include "binaryProtocol.h"
+
+/* states of the selection filter */
+#define NODE_IDLE               0U      // another board is selected
+#define NODE_ADDRESS            1U      // reading the digits after '@'
+#define NODE_SELECTED           2U
+#define NODE_FRAME_LENGTH       3U      // binary frame to another board, LEN is next
+#define NODE_FRAME              4U      // skipping the rest of that frame
+
+/* bytes of a binary frame after LEN: SEQ, CMD and the CRC */
+#define NODE_FRAME_OVERHEAD     4U
+
+/* record saved in flash */
+typedef struct node_settings_type {
+    unsigned char ucId;
+} node_settings_type;
+
+node_settings_type nodeSettings = {0};
+
+unsigned char ucNodeState = NODE_IDLE;
+unsigned int uiNodeAddress;
+
+/* bytes left of the binary frame being skipped */
+unsigned int uiNodeFrameLeft;
+
+/* ************************************************** */
+/* Method name:        node_init                      */
+/* Method description: Load the node ID saved in      */
+/*                     flash                          */
+/* Input params:       n/a                            */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void node_init(void)
+{
+    if(!nvm_load(&nodeSettings, sizeof(nodeSettings)) || NODE_MAX_ID < nodeSettings.ucId)
+        nodeSettings.ucId = 0;
+
+    ucNodeState = NODE_IDLE;
+    UART0_setSharedBus(0 != nodeSettings.ucId);
+}
+
+/* ************************************************** */
+/* Method name:        node_getId                     */
+/* Method description: Node ID in use                 */
+/* Input params:       n/a                            */
+/* Output params:      0 point to point, or 1 to      */
+/*                     NODE_MAX_ID                    */
+/* ************************************************** */
+unsigned char node_getId(void)
+{
+    return nodeSettings.ucId;
+}
+
+/* ************************************************** */
+/* Method name:        node_setId                     */
+/* Method description: Change the node ID and save it */
+/*                     in flash. The board stays      */
+/*                     selected until the next '@'    */
+/* Input params:       ucId: 0 to NODE_MAX_ID         */
+/* Output params:      1 if saved, 0 on error         */
+/* ************************************************** */
+unsigned char node_setId(unsigned char ucId)
+{
+    node_settings_type newSettings = nodeSettings;
+
+    if(NODE_MAX_ID < ucId)
+        return 0;
+
+    newSettings.ucId = ucId;
+    if(!nvm_save(&newSettings, sizeof(newSettings)))
+        return 0;
+
+    /* the answer to this command still goes out, in the old bus mode */
+    nodeSettings = newSettings;
+    ucNodeState = NODE_SELECTED;
+    UART0_requestSharedBus(0 != ucId);
+    return 1;
+}
+
+/* ************************************************** */
+/* Method name:        node_acceptByte                */
+/* Method description: Address filter for the ASCII   */
+/*                     and binary commands. The       */
+/*                     selection prefix is consumed   */
+/*                     here                           */
+/* Input params:       ucByte: byte received          */
+/* Output params:      1 if the byte is for this      */
+/*                     board, 0 if it is dropped      */
+/* ************************************************** */
+unsigned char node_acceptByte(unsigned char ucByte)
+{
+    if(0 == nodeSettings.ucId)
+        return 1;
+
+    /* an '@' inside a binary frame to this board is data */
+    if(NODE_SELECTED == ucNodeState && binaryProtocol_isReceiving())
+        return 1;
+
+    /* a frame to another board, or its response, is not looked into */
+    switch(ucNodeState){
+    case NODE_FRAME_LENGTH:
+        uiNodeFrameLeft = ucByte + NODE_FRAME_OVERHEAD;
+        ucNodeState = (BINPROTO_MAX_PAYLOAD >= ucByte) ? NODE_FRAME : NODE_IDLE;
+        return 0;
+
+    case NODE_FRAME:
+        if(0 == --uiNodeFrameLeft)
+            ucNodeState = NODE_IDLE;
+        return 0;
+
+    case NODE_IDLE:
+        if(BINPROTO_SOF == ucByte){
+            ucNodeState = NODE_FRAME_LENGTH;
+            return 0;
+        }
+        break;
+
+    default:
+        break;
+    }
+
+    if(NODE_SELECT == ucByte){
+        uiNodeAddress = 0;
+        ucNodeState = NODE_ADDRESS;
+        return 0;
+    }
+
+    switch(ucNodeState){
+    case NODE_ADDRESS:
+        if('0' <= ucByte && '9' >= ucByte && NODE_MAX_ID >= uiNodeAddress){
+            uiNodeAddress = uiNodeAddress * 10 + (ucByte - '0');
+        }else if(NODE_SELECT_END == ucByte && nodeSettings.ucId == uiNodeAddress){
+            ucNodeState = NODE_SELECTED;
+        }else{
+            ucNodeState = NODE_IDLE;
+        }
+        return 0;
+
+    case NODE_SELECTED:
+        return 1;
+
+    default:
+        return 0;
+    }
+}
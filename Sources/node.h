@@ -0,0 +1,70 @@
+/* ***************************************************************** */
+/* File name:        node.h                                          */
+/* File description: Node address for many boards on one serial bus. */
+/*                   With node ID 0 (the default) the board talks    */
+/*                   point to point as before. With an ID from 1 to  */
+/*                   NODE_MAX_ID it only listens after the host      */
+/*                   selects it with "@<id>:", and stays selected    */
+/*                   until the next '@':                             */
+/*                                                                   */
+/*                      @3:#gt;   @12:#sa0,3;                        */
+/*                                                                   */
+/*                   The ID is saved in flash and is also the Modbus */
+/*                   RTU slave address                               */
+/* Author name:      Grupo 18 - Renato Pepe                          */
+/*                              Joao Victor Matoso                   */
+/* Creation date:    19oct2026                                       */
+/* Revision date:    19oct2026                                       */
+/* ***************************************************************** */
+
+#ifndef SOURCES_NODE_H_
+#define SOURCES_NODE_H_
+
+/* highest node ID, the Modbus limit */
+#define NODE_MAX_ID             247U
+
+/* selection prefix "@<id>:" */
+#define NODE_SELECT             '@'
+#define NODE_SELECT_END         ':'
+
+/* ************************************************** */
+/* Method name:        node_init                      */
+/* Method description: Load the node ID saved in      */
+/*                     flash                          */
+/* Input params:       n/a                            */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void node_init(void);
+
+/* ************************************************** */
+/* Method name:        node_getId                     */
+/* Method description: Node ID in use                 */
+/* Input params:       n/a                            */
+/* Output params:      0 point to point, or 1 to      */
+/*                     NODE_MAX_ID                    */
+/* ************************************************** */
+unsigned char node_getId(void);
+
+/* ************************************************** */
+/* Method name:        node_setId                     */
+/* Method description: Change the node ID and save it */
+/*                     in flash. The board stays      */
+/*                     selected until the next '@'    */
+/* Input params:       ucId: 0 to NODE_MAX_ID         */
+/* Output params:      1 if saved, 0 on error         */
+/* ************************************************** */
+unsigned char node_setId(unsigned char ucId);
+
+/* ************************************************** */
+/* Method name:        node_acceptByte                */
+/* Method description: Address filter for the ASCII   */
+/*                     and binary commands. The       */
+/*                     selection prefix is consumed   */
+/*                     here                           */
+/* Input params:       ucByte: byte received          */
+/* Output params:      1 if the byte is for this      */
+/*                     board, 0 if it is dropped      */
+/* ************************************************** */
+unsigned char node_acceptByte(unsigned char ucByte);
+
+#endif /* SOURCES_NODE_H_ */
@@ -0,0 +1,321 @@
+/* ***************************************************************** */
+/* File name:        numconv.c                                       */
+/* File description: Integer and fixed-point conversion. The         */
+/*                   Cortex-M0+ has no divide instruction and only a */
+/*                   32 bit multiply: digits are taken two at a time */
+/*                   from a table, the division by 100 is a 32 bit   */
+/*                   multiply by its reciprocal and the parsers      */
+/*                   check the range without dividing                */
+/* Author name:      Grupo 18 - Renato Pepe                          */
+/*                              Joao Victor Matoso                   */
+/* Creation date:    19oct2026                                       */
+/* Revision date:    19oct2026                                       */
+/* ***************************************************************** */
+
+#include "numconv.h"
+
+/* digits of an unsigned int */
+#define NUMCONV_DIGITS          10U
+
+/* ceil(2^19 / 100), x * it >> 19 is x / 100 up to NUMCONV_DIV100_LIMIT - 1, in 32 bits */
+#define NUMCONV_DIV100_MUL      5243U
+#define NUMCONV_DIV100_SHIFT    19U
+#define NUMCONV_DIV100_LIMIT    43699U
+
+/* INT_MAX / 10, and the magnitude of INT_MIN / 10 */
+#define NUMCONV_LIMIT_TENTH     214748364U
+
+/* "00" to "99" */
+static const char cNumconvPairs[200] = {
+    '0','0','0','1','0','2','0','3','0','4','0','5','0','6','0','7','0','8','0','9',
+    '1','0','1','1','1','2','1','3','1','4','1','5','1','6','1','7','1','8','1','9',
+    '2','0','2','1','2','2','2','3','2','4','2','5','2','6','2','7','2','8','2','9',
+    '3','0','3','1','3','2','3','3','3','4','3','5','3','6','3','7','3','8','3','9',
+    '4','0','4','1','4','2','4','3','4','4','4','5','4','6','4','7','4','8','4','9',
+    '5','0','5','1','5','2','5','3','5','4','5','5','5','6','5','7','5','8','5','9',
+    '6','0','6','1','6','2','6','3','6','4','6','5','6','6','6','7','6','8','6','9',
+    '7','0','7','1','7','2','7','3','7','4','7','5','7','6','7','7','7','8','7','9',
+    '8','0','8','1','8','2','8','3','8','4','8','5','8','6','8','7','8','8','8','9',
+    '9','0','9','1','9','2','9','3','9','4','9','5','9','6','9','7','9','8','9','9'
+};
+
+static const unsigned int uiNumconvPowers[NUMCONV_DIGITS] = {
+    1U, 10U, 100U, 1000U, 10000U, 100000U, 1000000U, 10000000U, 100000000U, 1000000000U
+};
+
+/* ************************************************** */
+/* Method name:        numconv_writeDigits            */
+/* Method description: Write the digits of a value    */
+/*                     from the end of a buffer       */
+/* Input params:       uiValue: value                 */
+/*                     ucWidth: least digits          */
+/*                     cEnd: one past the last digit  */
+/* Output params:      digits written                 */
+/* ************************************************** */
+static unsigned char numconv_writeDigits(unsigned int uiValue, unsigned char ucWidth, char *cEnd)
+{
+    char *cDigit = cEnd;
+
+    while(100U <= uiValue){
+        /* a 64 bit product is a library call on the M0+, the divide is only for 6+ digits */
+        unsigned int uiQuotient = (NUMCONV_DIV100_LIMIT > uiValue) ? (uiValue * NUMCONV_DIV100_MUL) >> NUMCONV_DIV100_SHIFT
+                                                                   : uiValue / 100U;
+        const char *cPair = &cNumconvPairs[2U * (uiValue - uiQuotient * 100U)];
+
+        *--cDigit = cPair[1];
+        *--cDigit = cPair[0];
+        uiValue = uiQuotient;
+    }
+
+    if(10U <= uiValue){
+        *--cDigit = cNumconvPairs[2U * uiValue + 1U];
+        *--cDigit = cNumconvPairs[2U * uiValue];
+    }else{
+        *--cDigit = (char)('0' + uiValue);
+    }
+
+    while(cEnd - cDigit < ucWidth)
+        *--cDigit = '0';
+
+    return (unsigned char)(cEnd - cDigit);
+}
+
+/* ************************************************** */
+/* Method name:        numconv_copy                   */
+/* Method description: Copy the digits to the start   */
+/*                     of the output and end it       */
+/* Input params:       cText: output                  */
+/*                     cDigits: first digit           */
+/*                     ucLength: digits               */
+/* Output params:      n/a                            */
+/* ************************************************** */
+static void numconv_copy(char *cText, const char *cDigits, unsigned char ucLength)
+{
+    unsigned char ucIndex;
+
+    for(ucIndex = 0; ucIndex < ucLength; ucIndex++)
+        cText[ucIndex] = cDigits[ucIndex];
+    cText[ucLength] = '\0';
+}
+
+/* ************************************************** */
+/* Method name:        numconv_formatUnsigned         */
+/* Method description: Write an integer without the   */
+/*                     leading zeros                  */
+/* Input params:       uiValue: value                 */
+/*                     cText: output, takes up to     */
+/*                     NUMCONV_STRING_SIZE chars      */
+/* Output params:      length, without the '\0'       */
+/* ************************************************** */
+unsigned char numconv_formatUnsigned(unsigned int uiValue, char *cText)
+{
+    return numconv_formatUnsignedWidth(uiValue, 1, cText);
+}
+
+/* ************************************************** */
+/* Method name:        numconv_formatUnsignedWidth    */
+/* Method description: Write an integer with leading  */
+/*                     zeros up to a width            */
+/* Input params:       uiValue: value                 */
+/*                     ucWidth: least digits, up to   */
+/*                     10                             */
+/*                     cText: output, takes up to     */
+/*                     NUMCONV_STRING_SIZE chars      */
+/* Output params:      length, without the '\0'       */
+/* ************************************************** */
+unsigned char numconv_formatUnsignedWidth(unsigned int uiValue, unsigned char ucWidth, char *cText)
+{
+    char cDigits[NUMCONV_DIGITS];
+    unsigned char ucLength = numconv_writeDigits(uiValue, ucWidth, &cDigits[NUMCONV_DIGITS]);
+
+    numconv_copy(cText, &cDigits[NUMCONV_DIGITS - ucLength], ucLength);
+    return ucLength;
+}
+
+/* ************************************************** */
+/* Method name:        numconv_formatInt              */
+/* Method description: Write a signed integer         */
+/* Input params:       iValue: value                  */
+/*                     cText: output, takes up to     */
+/*                     NUMCONV_STRING_SIZE chars      */
+/* Output params:      length, without the '\0'       */
+/* ************************************************** */
+unsigned char numconv_formatInt(int iValue, char *cText)
+{
+    return numconv_formatFixed(iValue, 0, cText);
+}
+
+/* ************************************************** */
+/* Method name:        numconv_formatFixed            */
+/* Method description: Write a fixed-point value, e.g.*/
+/*                     (-1234, 2) is "-12,34"         */
+/* Input params:       iValue: value in units of      */
+/*                     10^-ucDecimals                 */
+/*                     ucDecimals: up to              */
+/*                     NUMCONV_MAX_DECIMALS           */
+/*                     cText: output, takes up to     */
+/*                     NUMCONV_STRING_SIZE chars      */
+/* Output params:      length, without the '\0'       */
+/* ************************************************** */
+unsigned char numconv_formatFixed(int iValue, unsigned char ucDecimals, char *cText)
+{
+    /* the magnitude of INT_MIN only fits unsigned */
+    unsigned int uiValue = (0 > iValue) ? 0U - (unsigned int)iValue : (unsigned int)iValue;
+    char cDigits[NUMCONV_STRING_SIZE];
+    char *cEnd = &cDigits[NUMCONV_STRING_SIZE];
+    char *cFirst = cEnd - numconv_writeDigits(uiValue, ucDecimals + 1U, cEnd);
+    char *cDigit;
+
+    /* the digits are written once, the integer ones move left of the separator */
+    if(ucDecimals){
+        for(cDigit = cFirst; cDigit < cEnd - ucDecimals; cDigit++)
+            cDigit[-1] = cDigit[0];
+        cFirst--;
+        cEnd[-(int)ucDecimals - 1] = NUMCONV_DECIMAL_SEPARATOR;
+    }
+
+    if(0 > iValue)
+        *--cFirst = '-';
+
+    numconv_copy(cText, cFirst, (unsigned char)(cEnd - cFirst));
+    return (unsigned char)(cEnd - cFirst);
+}
+
+/* ************************************************** */
+/* Method name:        numconv_parseUnsigned          */
+/* Method description: Read an unsigned integer       */
+/* Input params:       ucText: digits, '\0' ended     */
+/*                     uiMax: largest value accepted  */
+/*                     puiValue: value read           */
+/* Output params:      NUMCONV_OK or NUMCONV_ERROR_*  */
+/* ************************************************** */
+unsigned char numconv_parseUnsigned(const unsigned char *ucText, unsigned int uiMax, unsigned int *puiValue)
+{
+    unsigned int uiValue = 0;
+    /* one divide for the call instead of one for each digit */
+    unsigned int uiMaxTenth = uiMax / 10U;
+    unsigned int uiMaxLast = uiMax - uiMaxTenth * 10U;
+
+    if('\0' == *ucText)
+        return NUMCONV_ERROR_SYNTAX;
+
+    for(; '\0' != *ucText; ucText++){
+        unsigned int uiDigit = (unsigned int)(*ucText - '0');
+
+        if(9U < uiDigit)
+            return NUMCONV_ERROR_SYNTAX;
+        /* uiValue * 10 + uiDigit > uiMax */
+        if(uiValue > uiMaxTenth || (uiValue == uiMaxTenth && uiDigit > uiMaxLast))
+            return NUMCONV_ERROR_RANGE;
+        uiValue = uiValue * 10U + uiDigit;
+    }
+
+    *puiValue = uiValue;
+    return NUMCONV_OK;
+}
+
+/* ************************************************** */
+/* Method name:        numconv_parseDecimal           */
+/* Method description: Read a decimal number as a     */
+/*                     mantissa and a number of       */
+/*                     decimals. Decimals that do not */
+/*                     fit the mantissa are dropped   */
+/* Input params:       ucText: [-]digits[,digits]     */
+/*                     piMantissa: digits read        */
+/*                     pucDecimals: digits of the     */
+/*                     mantissa after the separator   */
+/* Output params:      NUMCONV_OK or NUMCONV_ERROR_*  */
+/* ************************************************** */
+unsigned char numconv_parseDecimal(const unsigned char *ucText, int *piMantissa, unsigned char *pucDecimals)
+{
+    unsigned int uiMantissa = 0;
+    unsigned int uiLimit = 0x7FFFFFFFU;
+    /* last digit of the limit, the rest is 214748364 for both signs */
+    unsigned int uiLimitLast = 7U;
+    unsigned char ucDecimals = 0;
+    unsigned char ucFraction = 0;
+    unsigned char ucFull = 0;
+    unsigned char ucDigits = 0;
+
+    if('-' == *ucText){
+        uiLimit = 0x80000000U;
+        uiLimitLast = 8U;
+        ucText++;
+    }
+
+    /* one pass: digits, then at most one separator */
+    for(; '\0' != *ucText; ucText++){
+        unsigned int uiDigit = (unsigned int)(*ucText - '0');
+
+        if(NUMCONV_DECIMAL_SEPARATOR == *ucText && !ucFraction){
+            ucFraction = 1;
+            continue;
+        }
+        if(9U < uiDigit)
+            return NUMCONV_ERROR_SYNTAX;
+        ucDigits++;
+
+        if(ucFull || (ucFraction && NUMCONV_MAX_DECIMALS == ucDecimals))
+            continue;
+        if(uiMantissa > NUMCONV_LIMIT_TENTH || (NUMCONV_LIMIT_TENTH == uiMantissa && uiDigit > uiLimitLast)){
+            /* the integer part must fit, the decimals are only precision */
+            if(!ucFraction)
+                return NUMCONV_ERROR_RANGE;
+            ucFull = 1;
+            continue;
+        }
+        uiMantissa = uiMantissa * 10U + uiDigit;
+        if(ucFraction)
+            ucDecimals++;
+    }
+
+    if(0 == ucDigits)
+        return NUMCONV_ERROR_SYNTAX;
+
+    *piMantissa = (0x80000000U == uiLimit) ? (int)(0U - uiMantissa) : (int)uiMantissa;
+    *pucDecimals = ucDecimals;
+    return NUMCONV_OK;
+}
+
+/* ************************************************** */
+/* Method name:        numconv_parseFixed             */
+/* Method description: Read a fixed-point value, the  */
+/*                     extra decimals are rounded     */
+/* Input params:       ucText: [-]digits[,digits]     */
+/*                     ucDecimals: decimals of the    */
+/*                     result                         */
+/*                     iMin, iMax: limits accepted,   */
+/*                     in units of 10^-ucDecimals     */
+/*                     piValue: value read            */
+/* Output params:      NUMCONV_OK or NUMCONV_ERROR_*  */
+/* ************************************************** */
+unsigned char numconv_parseFixed(const unsigned char *ucText, unsigned char ucDecimals, int iMin, int iMax, int *piValue)
+{
+    int iMantissa;
+    unsigned char ucRead;
+    unsigned char ucResult = numconv_parseDecimal(ucText, &iMantissa, &ucRead);
+
+    if(NUMCONV_OK != ucResult)
+        return ucResult;
+
+    if(ucRead > ucDecimals){
+        /* round half away from zero */
+        int iScale = (int)uiNumconvPowers[ucRead - ucDecimals];
+        int iHalf = (0 > iMantissa) ? -(iScale / 2) : iScale / 2;
+
+        iMantissa = iMantissa / iScale + (iMantissa % iScale + iHalf) / iScale;
+    }else{
+        while(ucRead < ucDecimals){
+            if(214748364 < iMantissa || -214748364 > iMantissa)
+                return NUMCONV_ERROR_RANGE;
+            iMantissa *= 10;
+            ucRead++;
+        }
+    }
+
+    if(iMin > iMantissa || iMax < iMantissa)
+        return NUMCONV_ERROR_RANGE;
+
+    *piValue = iMantissa;
+    return NUMCONV_OK;
+}
@@ -0,0 +1,115 @@
+/* ***************************************************************** */
+/* File name:        numconv.h                                       */
+/* File description: Integer and fixed-point conversion to and from  */
+/*                   decimal text, without floating point. The       */
+/*                   decimal separator is ',' as in the ASCII        */
+/*                   protocol                                        */
+/* Author name:      Grupo 18 - Renato Pepe                          */
+/*                              Joao Victor Matoso                   */
+/* Creation date:    19oct2026                                       */
+/* Revision date:    19oct2026                                       */
+/* ***************************************************************** */
+
+#ifndef SOURCES_NUMCONV_H_
+#define SOURCES_NUMCONV_H_
+
+#define NUMCONV_DECIMAL_SEPARATOR   ','
+
+/* most digits after the separator */
+#define NUMCONV_MAX_DECIMALS        9U
+
+/* longest text written, "-2147483648" plus the separator and '\0' */
+#define NUMCONV_STRING_SIZE         13U
+
+/* result of the parsers */
+#define NUMCONV_OK                  0U
+#define NUMCONV_ERROR_SYNTAX        1U      // empty, or not [-]digits[,digits]
+#define NUMCONV_ERROR_RANGE         2U      // does not fit, or outside the limits
+
+/* ************************************************** */
+/* Method name:        numconv_formatUnsigned         */
+/* Method description: Write an integer without the   */
+/*                     leading zeros                  */
+/* Input params:       uiValue: value                 */
+/*                     cText: output, takes up to     */
+/*                     NUMCONV_STRING_SIZE chars      */
+/* Output params:      length, without the '\0'       */
+/* ************************************************** */
+unsigned char numconv_formatUnsigned(unsigned int uiValue, char *cText);
+
+/* ************************************************** */
+/* Method name:        numconv_formatUnsignedWidth    */
+/* Method description: Write an integer with leading  */
+/*                     zeros up to a width            */
+/* Input params:       uiValue: value                 */
+/*                     ucWidth: least digits, up to   */
+/*                     10                             */
+/*                     cText: output, takes up to     */
+/*                     NUMCONV_STRING_SIZE chars      */
+/* Output params:      length, without the '\0'       */
+/* ************************************************** */
+unsigned char numconv_formatUnsignedWidth(unsigned int uiValue, unsigned char ucWidth, char *cText);
+
+/* ************************************************** */
+/* Method name:        numconv_formatInt              */
+/* Method description: Write a signed integer         */
+/* Input params:       iValue: value                  */
+/*                     cText: output, takes up to     */
+/*                     NUMCONV_STRING_SIZE chars      */
+/* Output params:      length, without the '\0'       */
+/* ************************************************** */
+unsigned char numconv_formatInt(int iValue, char *cText);
+
+/* ************************************************** */
+/* Method name:        numconv_formatFixed            */
+/* Method description: Write a fixed-point value, e.g.*/
+/*                     (-1234, 2) is "-12,34"         */
+/* Input params:       iValue: value in units of      */
+/*                     10^-ucDecimals                 */
+/*                     ucDecimals: up to              */
+/*                     NUMCONV_MAX_DECIMALS           */
+/*                     cText: output, takes up to     */
+/*                     NUMCONV_STRING_SIZE chars      */
+/* Output params:      length, without the '\0'       */
+/* ************************************************** */
+unsigned char numconv_formatFixed(int iValue, unsigned char ucDecimals, char *cText);
+
+/* ************************************************** */
+/* Method name:        numconv_parseUnsigned          */
+/* Method description: Read an unsigned integer       */
+/* Input params:       ucText: digits, '\0' ended     */
+/*                     uiMax: largest value accepted  */
+/*                     puiValue: value read           */
+/* Output params:      NUMCONV_OK or NUMCONV_ERROR_*  */
+/* ************************************************** */
+unsigned char numconv_parseUnsigned(const unsigned char *ucText, unsigned int uiMax, unsigned int *puiValue);
+
+/* ************************************************** */
+/* Method name:        numconv_parseDecimal           */
+/* Method description: Read a decimal number as a     */
+/*                     mantissa and a number of       */
+/*                     decimals. Decimals that do not */
+/*                     fit the mantissa are dropped   */
+/* Input params:       ucText: [-]digits[,digits]     */
+/*                     piMantissa: digits read        */
+/*                     pucDecimals: digits of the     */
+/*                     mantissa after the separator   */
+/* Output params:      NUMCONV_OK or NUMCONV_ERROR_*  */
+/* ************************************************** */
+unsigned char numconv_parseDecimal(const unsigned char *ucText, int *piMantissa, unsigned char *pucDecimals);
+
+/* ************************************************** */
+/* Method name:        numconv_parseFixed             */
+/* Method description: Read a fixed-point value, the  */
+/*                     extra decimals are rounded     */
+/* Input params:       ucText: [-]digits[,digits]     */
+/*                     ucDecimals: decimals of the    */
+/*                     result                         */
+/*                     iMin, iMax: limits accepted,   */
+/*                     in units of 10^-ucDecimals     */
+/*                     piValue: value read            */
+/* Output params:      NUMCONV_OK or NUMCONV_ERROR_*  */
+/* ************************************************** */
+unsigned char numconv_parseFixed(const unsigned char *ucText, unsigned char ucDecimals, int iMin, int iMax, int *piValue);
+
+#endif /* SOURCES_NUMCONV_H_ */
@@ -0,0 +1,154 @@
+/* ***************************************************************** */
+/* File name:        nvm.c                                           */
+/* File description: Settings record in flash, written with the FTFA */
+/*                   commands. The flash cannot be read while it is  */
+/*                   being written, so the command is launched by a  */
+/*                   function copied to RAM with the .data section   */
+/* Author name:      Grupo 18 - Renato Pepe                          */
+/*                              Joao Victor Matoso                   */
+/* Creation date:    19oct2026                                       */
+/* Revision date:    19oct2026                                       */
+/* ***************************************************************** */
+
+#include "nvm.h"
+#include "crc16.h"
+#include "board.h"
+
+/* FTFA commands */
+#define NVM_CMD_PROGRAM_LONGWORD    0x06U
+#define NVM_CMD_ERASE_SECTOR        0x09U
+
+/* first half-word of a valid record */
+#define NVM_MAGIC                   0x5AE1U
+
+/* record header, followed by the data and its CRC */
+typedef struct nvm_header_type {
+    unsigned short usMagic;
+    unsigned short usSize;
+} nvm_header_type;
+
+/* ************************************************** */
+/* Method name:        nvm_launch                     */
+/* Method description: Launch the command loaded in   */
+/*                     FCCOB and wait for it. Runs    */
+/*                     from RAM                       */
+/* Input params:       n/a                            */
+/* Output params:      n/a                            */
+/* ************************************************** */
+__attribute__((section(".data.ramfunc"), long_call, noinline))
+static void nvm_launch(void)
+{
+    FTFA_FSTAT = FTFA_FSTAT_CCIF_MASK;
+    while(!(FTFA_FSTAT & FTFA_FSTAT_CCIF_MASK));
+}
+
+/* ************************************************** */
+/* Method name:        nvm_command                    */
+/* Method description: Run a flash command with the   */
+/*                     interruptions off, their       */
+/*                     vectors and code are in flash  */
+/* Input params:       ucCommand: FTFA command        */
+/*                     uiAddress: flash address       */
+/*                     uiData: longword to program    */
+/* Output params:      1 if done, 0 on error          */
+/* ************************************************** */
+static unsigned char nvm_command(unsigned char ucCommand, unsigned int uiAddress, unsigned int uiData)
+{
+    unsigned int uiPrimask;
+
+    while(!(FTFA_FSTAT & FTFA_FSTAT_CCIF_MASK));
+
+    /* clear the errors of the last command */
+    FTFA_FSTAT = FTFA_FSTAT_ACCERR_MASK | FTFA_FSTAT_FPVIOL_MASK;
+
+    FTFA_FCCOB0 = ucCommand;
+    FTFA_FCCOB1 = (unsigned char)(uiAddress >> 16);
+    FTFA_FCCOB2 = (unsigned char)(uiAddress >> 8);
+    FTFA_FCCOB3 = (unsigned char)uiAddress;
+
+    /* FCCOB4 holds the byte of the highest address */
+    FTFA_FCCOB4 = (unsigned char)(uiData >> 24);
+    FTFA_FCCOB5 = (unsigned char)(uiData >> 16);
+    FTFA_FCCOB6 = (unsigned char)(uiData >> 8);
+    FTFA_FCCOB7 = (unsigned char)uiData;
+
+    uiPrimask = __get_PRIMASK();
+    __disable_irq();
+    nvm_launch();
+    __set_PRIMASK(uiPrimask);
+
+    return !(FTFA_FSTAT & (FTFA_FSTAT_ACCERR_MASK | FTFA_FSTAT_FPVIOL_MASK | FTFA_FSTAT_MGSTAT0_MASK));
+}
+
+/* ************************************************** */
+/* Method name:        nvm_load                       */
+/* Method description: Read the record saved in flash */
+/* Input params:       pvData: destination            */
+/*                     uiSize: size of the record     */
+/* Output params:      1 if a valid record of this    */
+/*                     size was read, 0 if not        */
+/*                     (pvData is left untouched)     */
+/* ************************************************** */
+unsigned char nvm_load(void *pvData, unsigned int uiSize)
+{
+    const nvm_header_type *pHeader = (const nvm_header_type *)NVM_SECTOR_ADDRESS;
+    const unsigned char *pucStored = (const unsigned char *)(pHeader + 1);
+    unsigned char *pucData = (unsigned char *)pvData;
+    unsigned short usCrc;
+    unsigned int uiIndex;
+
+    if(NVM_MAGIC != pHeader->usMagic || uiSize != pHeader->usSize)
+        return 0;
+
+    /* the CRC is stored right after the data, low byte first */
+    usCrc = crc16_compute(pucStored, uiSize);
+    if((unsigned char)usCrc != pucStored[uiSize] || (unsigned char)(usCrc >> 8) != pucStored[uiSize + 1])
+        return 0;
+
+    for(uiIndex = 0; uiIndex < uiSize; uiIndex++)
+        pucData[uiIndex] = pucStored[uiIndex];
+    return 1;
+}
+
+/* ************************************************** */
+/* Method name:        nvm_save                       */
+/* Method description: Erase the sector and write the */
+/*                     record. The interruptions are  */
+/*                     off up to about 15 ms          */
+/* Input params:       pvData: record                 */
+/*                     uiSize: up to NVM_MAX_RECORD   */
+/* Output params:      1 if written, 0 on error       */
+/* ************************************************** */
+unsigned char nvm_save(const void *pvData, unsigned int uiSize)
+{
+    /* header, data and CRC, padded to longwords */
+    unsigned int uiImage[(sizeof(nvm_header_type) + NVM_MAX_RECORD + 2 + 3) / 4];
+    nvm_header_type *pHeader = (nvm_header_type *)uiImage;
+    unsigned char *pucImage = (unsigned char *)(pHeader + 1);
+    const unsigned char *pucData = (const unsigned char *)pvData;
+    unsigned short usCrc = crc16_compute(pucData, uiSize);
+    unsigned int uiIndex, uiWords;
+
+    if(NVM_MAX_RECORD < uiSize)
+        return 0;
+
+    for(uiIndex = 0; uiIndex < sizeof(uiImage) / 4; uiIndex++)
+        uiImage[uiIndex] = 0xFFFFFFFFU;
+
+    pHeader->usMagic = NVM_MAGIC;
+    pHeader->usSize = (unsigned short)uiSize;
+    for(uiIndex = 0; uiIndex < uiSize; uiIndex++)
+        pucImage[uiIndex] = pucData[uiIndex];
+    pucImage[uiSize] = (unsigned char)usCrc;
+    pucImage[uiSize + 1] = (unsigned char)(usCrc >> 8);
+
+    if(!nvm_command(NVM_CMD_ERASE_SECTOR, NVM_SECTOR_ADDRESS, 0))
+        return 0;
+
+    uiWords = (sizeof(nvm_header_type) + uiSize + 2 + 3) / 4;
+    for(uiIndex = 0; uiIndex < uiWords; uiIndex++){
+        if(!nvm_command(NVM_CMD_PROGRAM_LONGWORD, NVM_SECTOR_ADDRESS + 4 * uiIndex, uiImage[uiIndex]))
+            return 0;
+    }
+    return 1;
+}
@@ -0,0 +1,44 @@
+/* ***************************************************************** */
+/* File name:        nvm.h                                           */
+/* File description: Settings kept across resets in the last sector  */
+/*                   of the flash (the linker file leaves it out of  */
+/*                   m_text). One record, checked with a CRC-16      */
+/* Author name:      Grupo 18 - Renato Pepe                          */
+/*                              Joao Victor Matoso                   */
+/* Creation date:    19oct2026                                       */
+/* Revision date:    19oct2026                                       */
+/* ***************************************************************** */
+
+#ifndef SOURCES_NVM_H_
+#define SOURCES_NVM_H_
+
+/* sector reserved in MKL25Z128xxx4_flash.ld */
+#define NVM_SECTOR_ADDRESS      0x0001FC00U
+#define NVM_SECTOR_SIZE         0x400U
+
+/* largest record, the header and the CRC also go in the sector */
+#define NVM_MAX_RECORD          64U
+
+/* ************************************************** */
+/* Method name:        nvm_load                       */
+/* Method description: Read the record saved in flash */
+/* Input params:       pvData: destination            */
+/*                     uiSize: size of the record     */
+/* Output params:      1 if a valid record of this    */
+/*                     size was read, 0 if not        */
+/*                     (pvData is left untouched)     */
+/* ************************************************** */
+unsigned char nvm_load(void *pvData, unsigned int uiSize);
+
+/* ************************************************** */
+/* Method name:        nvm_save                       */
+/* Method description: Erase the sector and write the */
+/*                     record. The interruptions are  */
+/*                     off up to about 15 ms          */
+/* Input params:       pvData: record                 */
+/*                     uiSize: up to NVM_MAX_RECORD   */
+/* Output params:      1 if written, 0 on error       */
+/* ************************************************** */
+unsigned char nvm_save(const void *pvData, unsigned int uiSize);
+
+#endif /* SOURCES_NVM_H_ */
@@ -0,0 +1,585 @@
+/* ***************************************************************** */
+/* File name:        paramRegistry.c                                 */
+/* File description: The parameter table, its letter index and the   */
+/*                   adapters between the table and the modules.     */
+/*                   Adding a parameter means adding one row to      */
+/*                   paramTable                                      */
+/* Author name:      Grupo 18 - Renato Pepe                          */
+/*                              Joao Victor Matoso                   */
+/* Creation date:    19oct2026                                       */
+/* Revision date:    19oct2026                                       */
+/* ***************************************************************** */
+
+#include "paramRegistry.h"
+#include "util.h"
+#include "console.h"
+#include "ledSwi.h"
+#include "keypad.h"
+#include "aquecedorECooler.h"
+#include "adc.h"
+#include "pid.h"
+#include "tacometro.h"
+#include "fanControl.h"
+#include "schedule.h"
+#include "communicationStateMachine.h"
+#include "UART.h"
+#include "modbus.h"
+#include "node.h"
+#include "telemetry.h"
+#include "eventlog.h"
+#include "numconv.h"
+#include "interfacelocal.h"
+#include "cyclecounter.h"
+#include "power.h"
+#include "boot.h"
+
+/* letters are 'a' to 'z', then 'A' to 'Z' */
+#define PARAM_LETTERS       52U
+#define PARAM_NO_LETTER     0xFFU
+
+/* values timed by #gN */
+#define PARAM_NUMCONV_SAMPLES   6U
+#define PARAM_NUMCONV_FIELD     6U
+
+extern unsigned int uiTimerConfigTimeSeconds;
+extern unsigned int uiTimerConfigPIDStatus;
+
+/* setpoint used by the next schedule entry written with #sw */
+float fScheduleConfigSetpoint = 0.0f;
+
+/* ************************************************** */
+/* Method name:        param_printTimeOfDay           */
+/* Method description: Print a time of day as hh:mm   */
+/* Input params:       uiSeconds: since midnight      */
+/* Output params:      n/a                            */
+/* ************************************************** */
+static void param_printTimeOfDay(unsigned int uiSeconds)
+{
+    char cField[3];
+
+    unsignedIntToString(cField, uiSeconds / 3600, 2);
+    console_putString(cField);
+    console_putString(":");
+    unsignedIntToString(cField, (uiSeconds / 60) % 60, 2);
+    console_putString(cField);
+}
+
+/* **** getters that are not a float function of a module **** */
+static float param_getPidOn(void)          { return (float)pid_isOn(); }
+static float param_getCascadeOn(void)      { return (float)pid_isCoolerCascadeOn(); }
+static float param_getRpm(void)            { return (float)tachometer_getSpeedDeciRpm() / 10.0f; }
+static float param_getTimerLeft(void)      { return (float)(pid_getTimerTimeLeft() / 1000); }
+static float param_getTargetRpm(void)      { return (float)fanControl_getTargetRpm(); }
+static float param_getTrackingError(void)  { return (float)fanControl_getTrackingError(); }
+static float param_getTimerAction(void)    { return (float)uiTimerConfigPIDStatus; }
+static float param_getTimerTime(void)      { return (float)uiTimerConfigTimeSeconds; }
+static float param_getScheduleSetpoint(void) { return fScheduleConfigSetpoint; }
+static float param_getBaudRate(void)        { return (float)UART0_getBaudRate(); }
+static float param_getModbus(void)          { return (float)modbus_isEnabled(); }
+static float param_getNodeId(void)          { return (float)node_getId(); }
+static float param_getTelemetry(void)       { return (float)telemetry_getMode(); }
+static float param_getEventlog(void)        { return (float)eventlog_isEnabled(); }
+static float param_getPower(void)           { return (float)power_getPolicy(); }
+static float param_getBootTime(void)        { return (float)boot_getControlUs(); }
+
+static float param_getClock(void)
+{
+    unsigned int uiClock = schedule_getClock();
+    return (float)((uiClock / 3600) * 10000 + ((uiClock / 60) % 60) * 100 + uiClock % 60);
+}
+
+/* **** setters, the range was already checked **** */
+static unsigned char param_setSetpoint(float fValue)   { pid_setTemperatureSetpoint(fValue); return 1; }
+static unsigned char param_setHeater(float fValue)     { heater_PWMDuty(fValue); return 1; }
+static unsigned char param_setKp(float fValue)         { pid_setKp(fValue); return 1; }
+static unsigned char param_setKi(float fValue)         { pid_setKi(fValue); return 1; }
+static unsigned char param_setKd(float fValue)         { pid_setKd(fValue); return 1; }
+static unsigned char param_setPidOn(float fValue)      { pid_turnOnOff(1.0f == fValue); return 1; }
+static unsigned char param_setCascadeOn(float fValue)  { pid_setCoolerCascade(1.0f == fValue); return 1; }
+static unsigned char param_setTargetRpm(float fValue)  { fanControl_setTargetRpm((unsigned int)fValue); return 1; }
+static unsigned char param_setTimerAction(float fValue){ uiTimerConfigPIDStatus = (1.0f == fValue); return 1; }
+static unsigned char param_setTimerTime(float fValue)  { uiTimerConfigTimeSeconds = (unsigned int)fValue; return 1; }
+static unsigned char param_setScheduleSetpoint(float fValue) { fScheduleConfigSetpoint = fValue; return 1; }
+static unsigned char param_resetStatistics(float fValue) { (void)fValue; resetParserStatistics(); return 1; }
+static unsigned char param_setBaudRate(float fValue)  { return UART0_requestBaudRate((unsigned int)fValue); }
+static unsigned char param_setTelemetry(float fValue) { return telemetry_setMode((unsigned char)fValue); }
+static unsigned char param_setEventlog(float fValue)  { eventlog_setEnabled(1.0f == fValue); return 1; }
+static unsigned char param_setNodeId(float fValue)    { return node_setId((unsigned char)fValue); }
+static unsigned char param_resetRefresh(float fValue) { (void)fValue; localInterface_resetRefreshMax(); return 1; }
+static unsigned char param_setPower(float fValue)     { power_setPolicy((unsigned char)fValue); return 1; }
+
+/* the ASCII commands stop while Modbus RTU is on, a Modbus write of 0 brings them back */
+static unsigned char param_setModbus(float fValue)
+{
+    if(1.0f == fValue)
+        modbus_enable();
+    else
+        modbus_disable();
+    return 1;
+}
+
+/* cooler duty cycle leaves the RPM control mode */
+static unsigned char param_setCooler(float fValue)
+{
+    fanControl_turnOff();
+    coolerfan_PWMDuty(fValue);
+    return 1;
+}
+
+/*
+ * Switches keyboard on
+ * obs: can't switch it off since keyboard and UART share some common pins on PORT A,
+ *      this means that UART can switch it on but after that switch the UART is deactivated
+ *      If user try to give UART command while keyboard is activated it may press the button 2
+ */
+static unsigned char param_setKeyboard(float fValue)
+{
+    if(1.0f == fValue){
+        keyboard kbConfig[4] = {NOTSET, BUTTON, BUTTON, BUTTON};
+        initKeyboard(kbConfig);
+        keypad_configure();
+    }
+    return 1;
+}
+
+/* turn timer on or off */
+static unsigned char param_setTimerOn(float fValue)
+{
+    if(1.0f == fValue)
+        pid_startTimer(uiTimerConfigTimeSeconds, uiTimerConfigPIDStatus);
+    else
+        pid_abortTimer();
+    return 1;
+}
+
+/* wall clock: hhmmss */
+static unsigned char param_setClock(float fValue)
+{
+    unsigned int uiClock = (unsigned int)fValue;
+
+    if(60 <= (uiClock / 100) % 100 || 60 <= uiClock % 100)
+        return 0;
+    schedule_setClock((uiClock / 10000) * 3600 + ((uiClock / 100) % 100) * 60 + uiClock % 100);
+    return 1;
+}
+
+/*
+ * schedule entry: <slot><hhmm><action>, action 0 clears the slot, 1 turns PID off,
+ * 2 turns PID on and 3 changes the setpoint to the one given by #sy
+ */
+static unsigned char param_setScheduleEntry(float fValue)
+{
+    unsigned int uiEntry = (unsigned int)fValue;
+    unsigned int uiEntryTime = (uiEntry / 10) % 10000;
+
+    if(24 <= uiEntryTime / 100 || 60 <= uiEntryTime % 100)
+        return 0;
+    return schedule_setEntry(uiEntry / 100000, (uiEntryTime / 100) * 3600 + (uiEntryTime % 100) * 60,
+                             uiEntry % 10, fScheduleConfigSetpoint);
+}
+
+/* **** custom #g responses **** */
+
+/* cooler RPM with one decimal, flags a fan driven but not rotating */
+static void param_printRpm(void)
+{
+    char cValue[PARAM_VALUE_SIZE];
+
+    console_putString("Cooler RPM = ");
+    unsignedIntToString(cValue, tachometer_getSpeed(), 5);
+    console_putString(cValue);
+    console_putString(",");
+    unsignedIntToString(cValue, tachometer_getSpeedDeciRpm() % 10, 1);
+    console_putString(cValue);
+    if(tachometer_isStalled() && 0 < getDutyCycleCooler()){
+        console_putString(" STALLED");
+    }
+    console_putString("\n \r");
+}
+
+/* baud rate with the error of the dividers against the 40 MHz clock */
+static void param_printBaudRate(void)
+{
+    console_putString("Baud rate = ");
+    console_putUnsigned(UART0_getBaudRate());
+    console_putString(" bps, error ");
+    console_putFixed(UART0_getBaudError(), 2);
+    console_putString(" %\n \r");
+}
+
+/* mode and the size of the stream against the raw int32 encoding */
+static void param_printTelemetry(void)
+{
+    static const char *cModes[] = {"OFF", "raw", "delta"};
+    unsigned int uiSamples, uiBytes, uiRawBytes, uiDropped;
+
+    telemetry_getStatistics(&uiSamples, &uiBytes, &uiRawBytes, &uiDropped);
+
+    console_putString("Telemetry = ");
+    console_putString(cModes[telemetry_getMode()]);
+    console_putString(", samples ");
+    console_putUnsigned(uiSamples);
+    console_putString(", bytes ");
+    console_putUnsigned(uiBytes);
+    console_putString(" of ");
+    console_putUnsigned(uiRawBytes);
+    console_putString(" raw, dropped ");
+    console_putUnsigned(uiDropped);
+    console_putString("\n \r");
+}
+
+/* CPU cost of the last LCD refresh and the maximum */
+static void param_printRefresh(void)
+{
+    unsigned int uiLast, uiMax;
+
+    localInterface_getRefreshCycles(&uiLast, &uiMax);
+
+    console_putString("LCD refresh = ");
+    console_putUnsigned(cyclecounter_cyclesToUs(uiLast));
+    console_putString(" us, max ");
+    console_putUnsigned(cyclecounter_cyclesToUs(uiMax));
+    console_putString(" us\n \r");
+}
+
+/* cycles of the float conversions on LCD and command values, the M0+ does them in software */
+static void param_printNumconv(void)
+{
+    static const float fSamples[PARAM_NUMCONV_SAMPLES] = {0.0f, 4.8f, 23.5f, 74.0f, 104.25f, 9999.0f};
+    static unsigned char * const ucSamples[PARAM_NUMCONV_SAMPLES] = {
+        (unsigned char *)"0", (unsigned char *)"4,8", (unsigned char *)"23,5",
+        (unsigned char *)"74", (unsigned char *)"104,25", (unsigned char *)"9999"
+    };
+    char cText[PARAM_VALUE_SIZE];
+    unsigned int uiFormat, uiParse;
+    unsigned char ucSample;
+
+    uiFormat = cyclecounter_get();
+    for(ucSample = 0; ucSample < PARAM_NUMCONV_SAMPLES; ucSample++)
+        convertFloatToString(fSamples[ucSample], cText, PARAM_NUMCONV_FIELD);
+    uiFormat = cyclecounter_get() - uiFormat;
+
+    uiParse = cyclecounter_get();
+    for(ucSample = 0; ucSample < PARAM_NUMCONV_SAMPLES; ucSample++)
+        convertStringToFloat(ucSamples[ucSample]);
+    uiParse = cyclecounter_get() - uiParse;
+
+    console_putString("Number conversion = ");
+    console_putUnsigned(uiFormat / PARAM_NUMCONV_SAMPLES);
+    console_putString(" cycles to format, ");
+    console_putUnsigned(uiParse / PARAM_NUMCONV_SAMPLES);
+    console_putString(" cycles to parse\n \r");
+}
+
+/* a time in ms and its share of the total */
+static void param_printPowerMode(const char *cMode, unsigned int uiMs, unsigned int uiTotalMs)
+{
+    console_putString(cMode);
+    console_putUnsigned(uiMs);
+    console_putString(" ms (");
+    console_putUnsigned((100U <= uiTotalMs) ? uiMs / (uiTotalMs / 100U) : 0U);
+    console_putString(" %)");
+}
+
+/* time in each power mode since the counters were cleared */
+static void param_printPower(void)
+{
+    power_statistics_type xStatistics;
+    unsigned int uiTotalMs;
+
+    power_getStatistics(&xStatistics);
+    uiTotalMs = xStatistics.uiRunMs + xStatistics.uiWaitMs + xStatistics.uiStopMs;
+
+    console_putString("Power policy = ");
+    console_putUnsigned(power_getPolicy());
+    param_printPowerMode(": run ", xStatistics.uiRunMs, uiTotalMs);
+    param_printPowerMode(", wait ", xStatistics.uiWaitMs, uiTotalMs);
+    param_printPowerMode(", VLPS ", xStatistics.uiStopMs, uiTotalMs);
+    param_printPowerMode(", at 4 MHz ", xStatistics.uiVlprMs, uiTotalMs);
+    console_putString(", ");
+    console_putUnsigned(xStatistics.uiWakeups);
+    console_putString(" wakeups, ");
+    console_putUnsigned(xStatistics.uiSwitches);
+    console_putString(" VLPR entries\n \r");
+}
+
+/* main to the first control tick, and to the end of the deferred initializations */
+static void param_printBoot(void)
+{
+    console_putString("Boot time = ");
+    console_putUnsigned(boot_getControlUs());
+    console_putString(" us to the first control tick, ");
+    console_putUnsigned(boot_getDoneUs());
+    console_putString(" us to the LCD and UART\n \r");
+}
+
+/* daily program, one entry per line */
+static void param_printSchedule(void)
+{
+    char cValue[PARAM_VALUE_SIZE];
+    unsigned char ucEntry;
+
+    for(ucEntry = 0; ucEntry < SCHEDULE_SIZE; ucEntry++){
+        const schedule_entry_type *pEntry = schedule_getEntry(ucEntry);
+
+        unsignedIntToString(cValue, ucEntry, 1);
+        console_putString(cValue);
+        console_putString(" ");
+        if(SCHEDULE_ACTION_NONE == pEntry->ucAction){
+            console_putString("--:-- empty");
+        }else{
+            param_printTimeOfDay(pEntry->uiTimeOfDayS);
+            if(SCHEDULE_ACTION_PID_OFF == pEntry->ucAction){
+                console_putString(" PID OFF");
+            }else if(SCHEDULE_ACTION_PID_ON == pEntry->ucAction){
+                console_putString(" PID ON");
+            }else{
+                console_putString(" setPoint ");
+                convertFloatToString(pEntry->fSetpoint, cValue, 7);
+                console_putString(cValue);
+            }
+        }
+        console_putString("\n \r");
+    }
+}
+
+/*
+ * the registry, one row per parameter. A letter may have one row to read and another to write
+ * (#gt reads the temperature, #st writes the setpoint)
+ */
+static const param_descriptor_type paramTable[] = {
+    /* letter, access,                        format,             label,                  unit,  min,   max,      getter,                     setter,                     custom print */
+    {'t', PARAM_FLAG_GET,                   PARAM_FORMAT_FLOAT, "Current Temperature",  "C",   0.0f,  0.0f,     adc_getTemperature,         0,                          0},
+    {'t', PARAM_FLAG_SET,                   PARAM_FORMAT_FLOAT, "Temperature setPoint", "C",   23.0f, 74.0f,    0,                          param_setSetpoint,          0},
+    {'g', PARAM_FLAG_GET,                   PARAM_FORMAT_FLOAT, "Temp setPoint",        "C",   0.0f,  0.0f,     pid_getTemperatureSetpoint, 0,                          0},
+    {'c', PARAM_FLAG_GET | PARAM_FLAG_SET,  PARAM_FORMAT_FLOAT, "Cooler DC",            "",    0.0f,  1.0f,     getDutyCycleCooler,         param_setCooler,            0},
+    {'a', PARAM_FLAG_GET | PARAM_FLAG_SET,  PARAM_FORMAT_FLOAT, "Heater DC",            "",    0.0f,  0.5f,     getDutyCycleHeater,         param_setHeater,            0},
+    {'p', PARAM_FLAG_GET | PARAM_FLAG_SET,  PARAM_FORMAT_FLOAT, "Kp",                   "",    0.0f,  9999.0f,  pid_getKp,                  param_setKp,                0},
+    {'i', PARAM_FLAG_GET | PARAM_FLAG_SET,  PARAM_FORMAT_FLOAT, "Ki",                   "",    0.0f,  9999.0f,  pid_getKi,                  param_setKi,                0},
+    {'d', PARAM_FLAG_GET | PARAM_FLAG_SET,  PARAM_FORMAT_FLOAT, "Kd",                   "",    0.0f,  9999.0f,  pid_getKd,                  param_setKd,                0},
+    {'s', PARAM_FLAG_GET | PARAM_FLAG_SET,  PARAM_FORMAT_ONOFF, "PID",                  "",    0.0f,  1.0f,     param_getPidOn,             param_setPidOn,             0},
+    {'f', PARAM_FLAG_GET | PARAM_FLAG_SET,  PARAM_FORMAT_ONOFF, "Cooler cascade",       "",    0.0f,  1.0f,     param_getCascadeOn,         param_setCascadeOn,         0},
+    {'r', PARAM_FLAG_GET,                   PARAM_FORMAT_FLOAT, "Cooler RPM",           "RPM", 0.0f,  0.0f,     param_getRpm,               0,                          param_printRpm},
+    {'v', PARAM_FLAG_GET | PARAM_FLAG_SET,  PARAM_FORMAT_UINT,  "Cooler target RPM",    "RPM", 0.0f,  (float)FAN_CONTROL_MAX_RPM, param_getTargetRpm, param_setTargetRpm,   0},
+    {'e', PARAM_FLAG_GET,                   PARAM_FORMAT_INT,   "Cooler RPM error",     "RPM", 0.0f,  0.0f,     param_getTrackingError,     0,                          0},
+    {'b', PARAM_FLAG_GET | PARAM_FLAG_SET,  PARAM_FORMAT_ONOFF, "Timer turns PID",      "",    0.0f,  1.0f,     param_getTimerAction,       param_setTimerAction,       0},
+    {'n', PARAM_FLAG_GET | PARAM_FLAG_SET,  PARAM_FORMAT_UINT,  "Timer time",           "s",   0.0f,  599940.0f,param_getTimerTime,         param_setTimerTime,         0},
+    {'m', PARAM_FLAG_GET,                   PARAM_FORMAT_UINT,  "Timer left",           "s",   0.0f,  0.0f,     param_getTimerLeft,         0,                          0},
+    {'m', PARAM_FLAG_SET,                   PARAM_FORMAT_ONOFF, "Timer",                "",    0.0f,  1.0f,     0,                          param_setTimerOn,           0},
+    {'h', PARAM_FLAG_GET | PARAM_FLAG_SET,  PARAM_FORMAT_TIME,  "Clock",                "",    0.0f,  235959.0f,param_getClock,             param_setClock,             0},
+    {'y', PARAM_FLAG_GET | PARAM_FLAG_SET,  PARAM_FORMAT_FLOAT, "Schedule setPoint",    "C",   23.0f, 74.0f,    param_getScheduleSetpoint,  param_setScheduleSetpoint,  0},
+    {'w', PARAM_FLAG_GET | PARAM_FLAG_SET,  PARAM_FORMAT_UINT,  "Schedule entry",       "",    0.0f,  723593.0f,0,                          param_setScheduleEntry,     param_printSchedule},
+    {'k', PARAM_FLAG_SET,                   PARAM_FORMAT_ONOFF, "Keyboard (UART off)",  "",    0.0f,  1.0f,     0,                          param_setKeyboard,          0},
+    {'u', PARAM_FLAG_GET | PARAM_FLAG_SET,  PARAM_FORMAT_UINT,  "Baud rate",            "bps", (float)UART0_MIN_BAUD, (float)UART0_MAX_BAUD, param_getBaudRate, param_setBaudRate, param_printBaudRate},
+    {'l', PARAM_FLAG_GET | PARAM_FLAG_SET,  PARAM_FORMAT_UINT,  "Node ID",              "",    0.0f,  (float)NODE_MAX_ID, param_getNodeId, param_setNodeId,          0},
+    {'x', PARAM_FLAG_GET | PARAM_FLAG_SET,  PARAM_FORMAT_ONOFF, "Modbus RTU",           "",    0.0f,  1.0f,     param_getModbus,            param_setModbus,            0},
+    {'j', PARAM_FLAG_GET | PARAM_FLAG_SET,  PARAM_FORMAT_UINT,  "Telemetry mode",       "",    0.0f,  (float)TELEMETRY_MODE_DELTA, param_getTelemetry, param_setTelemetry, param_printTelemetry},
+    {'z', PARAM_FLAG_GET | PARAM_FLAG_SET,  PARAM_FORMAT_ONOFF, "Event log",            "",    0.0f,  1.0f,     param_getEventlog,          param_setEventlog,          0},
+    {'q', PARAM_FLAG_GET | PARAM_FLAG_SET,  PARAM_FORMAT_UINT,  "Parser statistics",    "",    0.0f,  0.0f,     0,                          param_resetStatistics,      printParserStatistics},
+    {'o', PARAM_FLAG_GET | PARAM_FLAG_SET,  PARAM_FORMAT_UINT,  "LCD refresh",          "us",  0.0f,  0.0f,     0,                          param_resetRefresh,         param_printRefresh},
+    {'P', PARAM_FLAG_GET | PARAM_FLAG_SET,  PARAM_FORMAT_UINT,  "Power policy",         "",    0.0f,  (float)POWER_POLICY_VLPR, param_getPower, param_setPower,           param_printPower},
+    {'B', PARAM_FLAG_GET,                   PARAM_FORMAT_UINT,  "Boot time",            "us",  0.0f,  0.0f,     param_getBootTime,          0,                          param_printBoot},
+    {'N', PARAM_FLAG_GET,                   PARAM_FORMAT_UINT,  "Number conversion",    "",    0.0f,  0.0f,     0,                          0,                          param_printNumconv},
+};
+
+#define PARAM_TABLE_SIZE    (sizeof(paramTable) / sizeof(paramTable[0]))
+
+/* row + 1 of each letter, 0 if there is none */
+unsigned char ucParamGetIndex[PARAM_LETTERS];
+unsigned char ucParamSetIndex[PARAM_LETTERS];
+
+/* ************************************************** */
+/* Method name:        param_letterIndex              */
+/* Method description: Position of a letter in the    */
+/*                     index tables                   */
+/* Input params:       ucLetter: parameter letter     */
+/* Output params:      0 to PARAM_LETTERS-1, or       */
+/*                     PARAM_NO_LETTER                */
+/* ************************************************** */
+static unsigned char param_letterIndex(unsigned char ucLetter)
+{
+    if('a' <= ucLetter && 'z' >= ucLetter)
+        return ucLetter - 'a';
+    if('A' <= ucLetter && 'Z' >= ucLetter)
+        return ucLetter - 'A' + 26U;
+    return PARAM_NO_LETTER;
+}
+
+/* ************************************************** */
+/* Method name:        param_init                     */
+/* Method description: Build the letter index of the  */
+/*                     registry                       */
+/* Input params:       n/a                            */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void param_init(void)
+{
+    unsigned char ucIndex;
+
+    for(ucIndex = 0; ucIndex < PARAM_LETTERS; ucIndex++){
+        ucParamGetIndex[ucIndex] = 0;
+        ucParamSetIndex[ucIndex] = 0;
+    }
+
+    for(ucIndex = 0; ucIndex < PARAM_TABLE_SIZE; ucIndex++){
+        unsigned char ucLetter = param_letterIndex(paramTable[ucIndex].ucLetter);
+
+        if(paramTable[ucIndex].ucFlags & PARAM_FLAG_GET)
+            ucParamGetIndex[ucLetter] = ucIndex + 1;
+        if(paramTable[ucIndex].ucFlags & PARAM_FLAG_SET)
+            ucParamSetIndex[ucLetter] = ucIndex + 1;
+    }
+}
+
+/* ************************************************** */
+/* Method name:        param_findGet                  */
+/* Method description: Find the parameter read by a   */
+/*                     letter, in constant time       */
+/* Input params:       ucLetter: parameter letter     */
+/* Output params:      descriptor, 0 if there is none */
+/* ************************************************** */
+const param_descriptor_type *param_findGet(unsigned char ucLetter)
+{
+    unsigned char ucIndex = param_letterIndex(ucLetter);
+
+    if(PARAM_NO_LETTER == ucIndex || 0 == ucParamGetIndex[ucIndex])
+        return 0;
+    return &paramTable[ucParamGetIndex[ucIndex] - 1];
+}
+
+/* ************************************************** */
+/* Method name:        param_findSet                  */
+/* Method description: Find the parameter written by  */
+/*                     a letter, in constant time     */
+/* Input params:       ucLetter: parameter letter     */
+/* Output params:      descriptor, 0 if there is none */
+/* ************************************************** */
+const param_descriptor_type *param_findSet(unsigned char ucLetter)
+{
+    unsigned char ucIndex = param_letterIndex(ucLetter);
+
+    if(PARAM_NO_LETTER == ucIndex || 0 == ucParamSetIndex[ucIndex])
+        return 0;
+    return &paramTable[ucParamSetIndex[ucIndex] - 1];
+}
+
+/* ************************************************** */
+/* Method name:        param_getCount                 */
+/* Method description: Number of rows of the registry */
+/* Input params:       n/a                            */
+/* Output params:      number of rows                 */
+/* ************************************************** */
+unsigned char param_getCount(void)
+{
+    return PARAM_TABLE_SIZE;
+}
+
+/* ************************************************** */
+/* Method name:        param_getByIndex               */
+/* Method description: Row of the registry, to list   */
+/*                     all the parameters             */
+/* Input params:       ucIndex: 0 to count-1          */
+/* Output params:      descriptor                     */
+/* ************************************************** */
+const param_descriptor_type *param_getByIndex(unsigned char ucIndex)
+{
+    return &paramTable[ucIndex];
+}
+
+/* ************************************************** */
+/* Method name:        param_set                      */
+/* Method description: Check the range and write a    */
+/*                     parameter                      */
+/* Input params:       pParam: descriptor             */
+/*                     fValue: new value              */
+/* Output params:      PARAM_OK or PARAM_ERROR_*      */
+/* ************************************************** */
+unsigned char param_set(const param_descriptor_type *pParam, float fValue)
+{
+    /* written this way a NaN (from a binary frame) is out of range too */
+    if(!(pParam->fMin <= fValue && pParam->fMax >= fValue)){
+        eventlog_write(EVENTLOG_PARAM_RANGE, pParam->ucLetter, (int)(fValue * 1000.0f));
+        return PARAM_ERROR_RANGE;
+    }
+
+    if(!pParam->fSet(fValue)){
+        eventlog_write(EVENTLOG_PARAM_INVALID, pParam->ucLetter, (int)(fValue * 1000.0f));
+        return PARAM_ERROR_INVALID;
+    }
+
+    eventlog_write(EVENTLOG_PARAM_SET, pParam->ucLetter, (int)(fValue * 1000.0f));
+    return PARAM_OK;
+}
+
+/* ************************************************** */
+/* Method name:        param_formatUnsigned           */
+/* Method description: Write an integer without the   */
+/*                     leading zeros                  */
+/* Input params:       uiValue: value                 */
+/*                     cValue: output string, at      */
+/*                     least PARAM_VALUE_SIZE chars   */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void param_formatUnsigned(unsigned int uiValue, char *cValue)
+{
+    numconv_formatUnsigned(uiValue, cValue);
+}
+
+/* ************************************************** */
+/* Method name:        param_formatNumber             */
+/* Method description: Write a value in a format      */
+/* Input params:       ucFormat: PARAM_FORMAT_*       */
+/*                     fValue: value                  */
+/*                     cValue: output string, at      */
+/*                     least PARAM_VALUE_SIZE chars   */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void param_formatNumber(unsigned char ucFormat, float fValue, char *cValue)
+{
+    unsigned int uiValue;
+
+    switch(ucFormat){
+    case PARAM_FORMAT_FLOAT:
+        convertFloatToString(fValue, cValue, 7);
+        return;
+
+    case PARAM_FORMAT_ONOFF:
+        cValue[0] = '\0';
+        append_string(cValue, PARAM_VALUE_SIZE, (1.0f == fValue) ? "ON" : "OFF");
+        return;
+
+    case PARAM_FORMAT_TIME:
+        uiValue = (unsigned int)fValue;
+        unsignedIntToString(cValue, uiValue / 10000, 2);
+        cValue[2] = ':';
+        unsignedIntToString(&cValue[3], (uiValue / 100) % 100, 2);
+        cValue[5] = ':';
+        unsignedIntToString(&cValue[6], uiValue % 100, 2);
+        return;
+
+    case PARAM_FORMAT_INT:
+        numconv_formatInt((int)fValue, cValue);
+        return;
+    }
+
+    param_formatUnsigned((unsigned int)fValue, cValue);
+}
+
+/* ************************************************** */
+/* Method name:        param_formatValue              */
+/* Method description: Read a parameter and write its */
+/*                     value in its format            */
+/* Input params:       pParam: descriptor             */
+/*                     cValue: output string, at      */
+/*                     least PARAM_VALUE_SIZE chars   */
+/* Output params:      1 if written, 0 if the         */
+/*                     parameter has no getter        */
+/* ************************************************** */
+unsigned char param_formatValue(const param_descriptor_type *pParam, char *cValue)
+{
+    if(!pParam->fGet)
+        return 0;
+
+    param_formatNumber(pParam->ucFormat, pParam->fGet(), cValue);
+    return 1;
+}
@@ -0,0 +1,137 @@
+/* ***************************************************************** */
+/* File name:        paramRegistry.h                                 */
+/* File description: Registry of the parameters that can be read and */
+/*                   written through the serial protocols. A const   */
+/*                   table (kept in flash) describes each parameter, */
+/*                   and validation, formatting and the help listing */
+/*                   are generated from it                           */
+/* Author name:      Grupo 18 - Renato Pepe                          */
+/*                              Joao Victor Matoso                   */
+/* Creation date:    19oct2026                                       */
+/* Revision date:    19oct2026                                       */
+/* ***************************************************************** */
+
+#ifndef SOURCES_PARAMREGISTRY_H_
+#define SOURCES_PARAMREGISTRY_H_
+
+/* access of a parameter, #g reads it and #s writes it */
+#define PARAM_FLAG_GET          0x01U
+#define PARAM_FLAG_SET          0x02U
+
+/* how the value is formatted */
+#define PARAM_FORMAT_FLOAT      0U      // ',' as decimal separator
+#define PARAM_FORMAT_UINT       1U
+#define PARAM_FORMAT_INT        2U
+#define PARAM_FORMAT_ONOFF      3U      // 1 is ON, anything else is OFF
+#define PARAM_FORMAT_TIME       4U      // value is hhmmss, printed as hh:mm:ss
+
+/* result of param_set */
+#define PARAM_OK                0U
+#define PARAM_ERROR_RANGE       1U      // outside fMin..fMax
+#define PARAM_ERROR_INVALID     2U      // refused by the setter
+
+/* size of the string written by param_formatValue */
+#define PARAM_VALUE_SIZE        12U
+
+typedef struct param_descriptor_type {
+    unsigned char ucLetter;
+    unsigned char ucFlags;              // PARAM_FLAG_*
+    unsigned char ucFormat;             // PARAM_FORMAT_*
+    const char *cLabel;
+    const char *cUnit;
+    float fMin;                         // range accepted by the setter
+    float fMax;
+    float (*fGet)(void);                // 0 if the value is not a number
+    unsigned char (*fSet)(float fValue);// returns 0 to refuse the value
+    void (*fPrint)(void);               // custom #g response, 0 for "<label> = <value> <unit>"
+} param_descriptor_type;
+
+/* ************************************************** */
+/* Method name:        param_init                     */
+/* Method description: Build the letter index of the  */
+/*                     registry                       */
+/* Input params:       n/a                            */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void param_init(void);
+
+/* ************************************************** */
+/* Method name:        param_findGet                  */
+/* Method description: Find the parameter read by a   */
+/*                     letter, in constant time       */
+/* Input params:       ucLetter: parameter letter     */
+/* Output params:      descriptor, 0 if there is none */
+/* ************************************************** */
+const param_descriptor_type *param_findGet(unsigned char ucLetter);
+
+/* ************************************************** */
+/* Method name:        param_findSet                  */
+/* Method description: Find the parameter written by  */
+/*                     a letter, in constant time     */
+/* Input params:       ucLetter: parameter letter     */
+/* Output params:      descriptor, 0 if there is none */
+/* ************************************************** */
+const param_descriptor_type *param_findSet(unsigned char ucLetter);
+
+/* ************************************************** */
+/* Method name:        param_getCount                 */
+/* Method description: Number of rows of the registry */
+/* Input params:       n/a                            */
+/* Output params:      number of rows                 */
+/* ************************************************** */
+unsigned char param_getCount(void);
+
+/* ************************************************** */
+/* Method name:        param_getByIndex               */
+/* Method description: Row of the registry, to list   */
+/*                     all the parameters             */
+/* Input params:       ucIndex: 0 to count-1          */
+/* Output params:      descriptor                     */
+/* ************************************************** */
+const param_descriptor_type *param_getByIndex(unsigned char ucIndex);
+
+/* ************************************************** */
+/* Method name:        param_set                      */
+/* Method description: Check the range and write a    */
+/*                     parameter                      */
+/* Input params:       pParam: descriptor             */
+/*                     fValue: new value              */
+/* Output params:      PARAM_OK or PARAM_ERROR_*      */
+/* ************************************************** */
+unsigned char param_set(const param_descriptor_type *pParam, float fValue);
+
+/* ************************************************** */
+/* Method name:        param_formatUnsigned           */
+/* Method description: Write an integer without the   */
+/*                     leading zeros                  */
+/* Input params:       uiValue: value                 */
+/*                     cValue: output string, at      */
+/*                     least PARAM_VALUE_SIZE chars   */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void param_formatUnsigned(unsigned int uiValue, char *cValue);
+
+/* ************************************************** */
+/* Method name:        param_formatNumber             */
+/* Method description: Write a value in a format      */
+/* Input params:       ucFormat: PARAM_FORMAT_*       */
+/*                     fValue: value                  */
+/*                     cValue: output string, at      */
+/*                     least PARAM_VALUE_SIZE chars   */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void param_formatNumber(unsigned char ucFormat, float fValue, char *cValue);
+
+/* ************************************************** */
+/* Method name:        param_formatValue              */
+/* Method description: Read a parameter and write its */
+/*                     value in its format            */
+/* Input params:       pParam: descriptor             */
+/*                     cValue: output string, at      */
+/*                     least PARAM_VALUE_SIZE chars   */
+/* Output params:      1 if written, 0 if the         */
+/*                     parameter has no getter        */
+/* ************************************************** */
+unsigned char param_formatValue(const param_descriptor_type *pParam, char *cValue);
+
+#endif /* SOURCES_PARAMREGISTRY_H_ */
@@ -9,9 +9,32 @@
 
 #include "pid.h"
 #include "aquecedorECooler.h"
+#include "fanControl.h"
+#include "timer.h"
 
 pid_data_type pidConfig;
 
+/* software timer that turns the PID on/off */
+timer_entry_t pidTimer;
+/* action of the timer: 0 turns PID off, 1 turns it on */
+unsigned char ucPidTimerTurnOnOff = 0;
+
+/* ************************************************** */
+/* Method name:        pid_timerExpired               */
+/* Method description: Timer callback, turns the PID  */
+/*                     on or off                      */
+/* Input params:       pvArg: not used                */
+/* Output params:      n/a                            */
+/* ************************************************** */
+static void pid_timerExpired(void *pvArg) {
+	(void)pvArg;
+
+	/* check if PID is already on before turn it on again. Avoid reseting pid integral sum */
+	if(!ucPidTimerTurnOnOff || !pid_isOn()){
+		pid_turnOnOff(ucPidTimerTurnOnOff);
+	}
+}
+
 /* ************************************************ */
 /* Method name:        pid_init                     */
 /* Method description: Initialize the PID controller*/
@@ -29,6 +52,7 @@ void pid_init(void)
 	pidConfig.fPreviousFOut = 0.0;
 	pidConfig.fTemperatureSetpoint = 0.0;
 	pidConfig.ucPidOn = 0;
+	pidConfig.ucCoolerCascadeOn = 0;
 }
 
 /* ************************************************** */
@@ -49,10 +73,44 @@ void pid_turnOnOff(unsigned char ucOnOff) {
 	/* Turn PID off */
 	else {
 		heater_PWMDuty(0);
+		if(pidConfig.ucCoolerCascadeOn){
+			fanControl_setTargetRpm(0);
+		}
 		pidConfig.ucPidOn = 0;
 	}
 }
 
+/* ************************************************** */
+/* Method name:        pid_setCoolerCascade           */
+/* Method description: Let the cooler take part in    */
+/*                     the control. When on, the PID  */
+/*                     output ranges from -100 to 100 */
+/*                     and negative values become a   */
+/*                     target RPM for the fan loop    */
+/* Input params:       ucOnOff: 0 to turn off,        */
+/*                              1 to turn on          */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void pid_setCoolerCascade(unsigned char ucOnOff) {
+	/* the cooler leaves the control: stop the inner loop */
+	if(0 == ucOnOff && pidConfig.ucCoolerCascadeOn){
+		fanControl_setTargetRpm(0);
+	}
+	pidConfig.fError_sum = 0.0;
+	pidConfig.ucCoolerCascadeOn = (0 < ucOnOff);
+}
+
+/* ************************************************** */
+/* Method name:        pid_isCoolerCascadeOn          */
+/* Method description: Get status of the cooler       */
+/*                     cascade                        */
+/* Input params:       n/a                            */
+/* Output params:      1 if turned on, 0 if off       */
+/* ************************************************** */
+unsigned char pid_isCoolerCascadeOn() {
+	return pidConfig.ucCoolerCascadeOn;
+}
+
 /* ************************************************** */
 /* Method name:        pid_isOn                       */
 /* Method description: Get status of the PID on/off   */
@@ -63,6 +121,52 @@ unsigned char pid_isOn() {
 	return pidConfig.ucPidOn;
 }
 
+/* ************************************************** */
+/* Method name:        pid_startTimer                 */
+/* Method description: Turn PID control on/off after  */
+/*                     some time                      */
+/* Input params:       uiTimeS: time in seconds       */
+/*                     ucTurnOnOff: 0 to turn off,    */
+/*                                  1 to turn on      */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void pid_startTimer(unsigned int uiTimeS, unsigned char ucTurnOnOff) {
+	ucPidTimerTurnOnOff = ucTurnOnOff;
+	timer_startOneShot(&pidTimer, uiTimeS * 1000, pid_timerExpired, 0);
+}
+
+/* ************************************************** */
+/* Method name:        pid_abortTimer                 */
+/* Method description: Turn the PID timer off without */
+/*                     triggering it                  */
+/* Input params:       n/a                            */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void pid_abortTimer() {
+	timer_stop(&pidTimer);
+}
+
+/* ************************************************** */
+/* Method name:        pid_isTimerOn                  */
+/* Method description: Get status of the PID timer    */
+/* Input params:       n/a                            */
+/* Output params:      1 if running, 0 if off         */
+/* ************************************************** */
+unsigned char pid_isTimerOn() {
+	return timer_isRunning(&pidTimer);
+}
+
+/* ************************************************** */
+/* Method name:        pid_getTimerTimeLeft           */
+/* Method description: Get the time left in the PID   */
+/*                     timer                          */
+/* Input params:       n/a                            */
+/* Output params:      Time left in milisseconds      */
+/* ************************************************** */
+unsigned int pid_getTimerTimeLeft() {
+	return timer_getTimeLeft(&pidTimer);
+}
+
 /* ************************************************** */
 /* Method name:        pid_setTemperatureSetpoint     */
 /* Method description: Set a new value for the PID    */
@@ -176,11 +280,15 @@ float pid_getKd(void)
 /*                     the sensor                     */
 /*                     fReferenceValue: Value used as */
 /*                     control reference              */
-/* Output params:      float: New Control effort     */
+/* Output params:      float: New Control effort,     */
+/*                     0 to 100 (heater), or -100 to  */
+/*                     100 with the cooler cascade on */
 /* ************************************************** */
 float pidUpdateData(float fSensorValue)
 {
 	float fError, fDifference, fOut;
+	/* with the cooler cascade the negative effort is used too */
+	float fOutMin = pidConfig.ucCoolerCascadeOn ? -100.0f : 0.0f;
 
 	/* Check if PID is on */
 	if(0 == pidConfig.ucPidOn){
@@ -190,7 +298,7 @@ float pidUpdateData(float fSensorValue)
 	fError = pidConfig.fTemperatureSetpoint - fSensorValue;
 
 	/* Anti-windup */
-	if(100 > pidConfig.fPreviousFOut && 0 <= pidConfig.fPreviousFOut){
+	if(100 > pidConfig.fPreviousFOut && fOutMin <= pidConfig.fPreviousFOut){
 		pidConfig.fError_sum += fError;
 	}
 
@@ -206,8 +314,8 @@ float pidUpdateData(float fSensorValue)
 	if (fOut>100.0)
 		fOut = 100.0;
 
-	else if (fOut<0.0)
-		fOut = 0.0;
+	else if (fOut<fOutMin)
+		fOut = fOutMin;
 
 	return fOut;
 }
@@ -18,6 +18,7 @@ typedef struct pid_data_type {
 	float fPreviousFOut;
 	float fTemperatureSetpoint;
 	unsigned char ucPidOn;
+	unsigned char ucCoolerCascadeOn; // cooler takes part in control (negative output)
 } pid_data_type;
 
 
@@ -46,6 +47,65 @@ void pid_turnOnOff(unsigned char ucOnOff);
 /* ************************************************** */
 unsigned char pid_isOn();
 
+/* ************************************************** */
+/* Method name:        pid_setCoolerCascade           */
+/* Method description: Let the cooler take part in    */
+/*                     the control. When on, the PID  */
+/*                     output ranges from -100 to 100 */
+/*                     and negative values become a   */
+/*                     target RPM for the fan loop    */
+/* Input params:       ucOnOff: 0 to turn off,        */
+/*                              1 to turn on          */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void pid_setCoolerCascade(unsigned char ucOnOff);
+
+/* ************************************************** */
+/* Method name:        pid_isCoolerCascadeOn          */
+/* Method description: Get status of the cooler       */
+/*                     cascade                        */
+/* Input params:       n/a                            */
+/* Output params:      1 if turned on, 0 if off       */
+/* ************************************************** */
+unsigned char pid_isCoolerCascadeOn();
+
+/* ************************************************** */
+/* Method name:        pid_startTimer                 */
+/* Method description: Turn PID control on/off after  */
+/*                     some time                      */
+/* Input params:       uiTimeS: time in seconds       */
+/*                     ucTurnOnOff: 0 to turn off,    */
+/*                                  1 to turn on      */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void pid_startTimer(unsigned int uiTimeS, unsigned char ucTurnOnOff);
+
+/* ************************************************** */
+/* Method name:        pid_abortTimer                 */
+/* Method description: Turn the PID timer off without */
+/*                     triggering it                  */
+/* Input params:       n/a                            */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void pid_abortTimer();
+
+/* ************************************************** */
+/* Method name:        pid_isTimerOn                  */
+/* Method description: Get status of the PID timer    */
+/* Input params:       n/a                            */
+/* Output params:      1 if running, 0 if off         */
+/* ************************************************** */
+unsigned char pid_isTimerOn();
+
+/* ************************************************** */
+/* Method name:        pid_getTimerTimeLeft           */
+/* Method description: Get the time left in the PID   */
+/*                     timer                          */
+/* Input params:       n/a                            */
+/* Output params:      Time left in milisseconds      */
+/* ************************************************** */
+unsigned int pid_getTimerTimeLeft();
+
 /* ************************************************** */
 /* Method name:        pid_setTemperatureSetpoint     */
 /* Method description: Set a new value for the PID    */
@@ -131,7 +191,9 @@ float pid_getKd(void);
 /*                     value                          */
 /* Input params:       fSensorValue: Value read from  */
 /*                     the sensor                     */
-/* Output params:      float: New Control effort     */
+/* Output params:      float: New Control effort,     */
+/*                     0 to 100 (heater), or -100 to  */
+/*                     100 with the cooler cascade on */
 /* ************************************************** */
 float pidUpdateData(float fSensorValue);
 
@@ -0,0 +1,135 @@
+/* ***************************************************************** */
+/* File name:        pit.c                                           */
+/* File description: Periodic interrupt timer driver                 */
+/* Author name:      Grupo 18 - Renato Pepe                          */
+/*                              Joao Victor Matoso                   */
+/* Creation date:    19oct2026                                       */
+/* Revision date:    19oct2026                                       */
+/* ***************************************************************** */
+
+#include "pit.h"
+#include "board.h"
+#include "fsl_clock_manager.h"
+
+pit_callback_t fPitCallback[PIT_CHANNELS] = {0, 0};
+
+/* period of each channel, kept to follow a bus clock change */
+unsigned int uiPitPeriodUs[PIT_CHANNELS] = {0, 0};
+
+/* ************************************************** */
+/* Method name:        pit_usToTicks                  */
+/* Method description: Convert a time to bus clock    */
+/*                     ticks without overflowing 32   */
+/*                     bits, the bus may be under     */
+/*                     1 MHz in VLPR                  */
+/* Input params:       uiTimeUs: time in us           */
+/* Output params:      ticks                          */
+/* ************************************************** */
+static unsigned int pit_usToTicks(unsigned int uiTimeUs)
+{
+    unsigned int uiTicksPerMs = CLOCK_SYS_GetBusClockFreq() / 1000U;
+
+    return (uiTimeUs / 1000U) * uiTicksPerMs + (uiTimeUs % 1000U) * uiTicksPerMs / 1000U;
+}
+
+/* ************************************************** */
+/* Method name:        pit_setPeriod                  */
+/* Method description: Configure a channel, stopped.  */
+/*                     The callback runs in the PIT   */
+/*                     interruption                   */
+/* Input params:       ucChannel: 0 to PIT_CHANNELS-1 */
+/*                     uiPeriodUs: period in us       */
+/*                     fCallback: function called at  */
+/*                     the end of each period         */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void pit_setPeriod(unsigned char ucChannel, unsigned int uiPeriodUs, pit_callback_t fCallback)
+{
+    /* release clock to the PIT and leave the module enabled, frozen while debugging */
+    SIM_SCGC6 |= SIM_SCGC6_PIT_MASK;
+    PIT_MCR = PIT_MCR_FRZ_MASK;
+
+    PIT_TCTRL(ucChannel) = 0;
+    PIT_TFLG(ucChannel) = PIT_TFLG_TIF_MASK;
+    PIT_LDVAL(ucChannel) = pit_usToTicks(uiPeriodUs) - 1;
+    uiPitPeriodUs[ucChannel] = uiPeriodUs;
+    fPitCallback[ucChannel] = fCallback;
+
+    NVIC_EnableIRQ(PIT_IRQn);
+}
+
+/* ************************************************** */
+/* Method name:        pit_start                      */
+/* Method description: Start a channel, or restart it */
+/*                     from the full period if it is  */
+/*                     running                        */
+/* Input params:       ucChannel: 0 to PIT_CHANNELS-1 */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void pit_start(unsigned char ucChannel)
+{
+    /* disabling the channel makes it reload LDVAL when enabled again */
+    PIT_TCTRL(ucChannel) = 0;
+    PIT_TCTRL(ucChannel) = PIT_TCTRL_TIE_MASK | PIT_TCTRL_TEN_MASK;
+}
+
+/* ************************************************** */
+/* Method name:        pit_stop                       */
+/* Method description: Stop a channel                 */
+/* Input params:       ucChannel: 0 to PIT_CHANNELS-1 */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void pit_stop(unsigned char ucChannel)
+{
+    PIT_TCTRL(ucChannel) = 0;
+    PIT_TFLG(ucChannel) = PIT_TFLG_TIF_MASK;
+}
+
+/* ************************************************** */
+/* Method name:        pit_isRunning                  */
+/* Method description: Check if a channel is counting */
+/* Input params:       ucChannel: 0 to PIT_CHANNELS-1 */
+/* Output params:      1 if running, 0 if stopped     */
+/* ************************************************** */
+unsigned char pit_isRunning(unsigned char ucChannel)
+{
+    return 0 != (PIT_TCTRL(ucChannel) & PIT_TCTRL_TEN_MASK);
+}
+
+/* ************************************************** */
+/* Method name:        pit_updateClock                */
+/* Method description: Convert the periods again after*/
+/*                     a bus clock change. A running  */
+/*                     channel takes the new period at*/
+/*                     its next reload                */
+/* Input params:       n/a                            */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void pit_updateClock(void)
+{
+    unsigned char ucChannel;
+
+    for(ucChannel = 0; ucChannel < PIT_CHANNELS; ucChannel++)
+        if(uiPitPeriodUs[ucChannel])
+            PIT_LDVAL(ucChannel) = pit_usToTicks(uiPitPeriodUs[ucChannel]) - 1;
+}
+
+/* ************************************************** */
+/* Method name:        PIT_IRQHandler                 */
+/* Method description: PIT interruption, shared by    */
+/*                     the channels                   */
+/* Input params:       n/a                            */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void PIT_IRQHandler(void)
+{
+    unsigned char ucChannel;
+
+    for(ucChannel = 0; ucChannel < PIT_CHANNELS; ucChannel++){
+        if(PIT_TFLG(ucChannel) & PIT_TFLG_TIF_MASK){
+            PIT_TFLG(ucChannel) = PIT_TFLG_TIF_MASK;
+            if(fPitCallback[ucChannel])
+                fPitCallback[ucChannel]();
+        }
+    }
+}
@@ -0,0 +1,79 @@
+/* ***************************************************************** */
+/* File name:        pit.h                                           */
+/* File description: Periodic interrupt timer driver. Each channel   */
+/*                   counts down from its period on the bus clock    */
+/*                   and calls its callback when it reaches zero     */
+/* Author name:      Grupo 18 - Renato Pepe                          */
+/*                              Joao Victor Matoso                   */
+/* Creation date:    19oct2026                                       */
+/* Revision date:    19oct2026                                       */
+/* ***************************************************************** */
+
+#ifndef SOURCES_PIT_H_
+#define SOURCES_PIT_H_
+
+/* channels of the PIT */
+#define PIT_CHANNELS        2U
+
+typedef void (*pit_callback_t)(void);
+
+/* ************************************************** */
+/* Method name:        pit_setPeriod                  */
+/* Method description: Configure a channel, stopped.  */
+/*                     The callback runs in the PIT   */
+/*                     interruption                   */
+/* Input params:       ucChannel: 0 to PIT_CHANNELS-1 */
+/*                     uiPeriodUs: period in us       */
+/*                     fCallback: function called at  */
+/*                     the end of each period         */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void pit_setPeriod(unsigned char ucChannel, unsigned int uiPeriodUs, pit_callback_t fCallback);
+
+/* ************************************************** */
+/* Method name:        pit_start                      */
+/* Method description: Start a channel, or restart it */
+/*                     from the full period if it is  */
+/*                     running                        */
+/* Input params:       ucChannel: 0 to PIT_CHANNELS-1 */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void pit_start(unsigned char ucChannel);
+
+/* ************************************************** */
+/* Method name:        pit_stop                       */
+/* Method description: Stop a channel                 */
+/* Input params:       ucChannel: 0 to PIT_CHANNELS-1 */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void pit_stop(unsigned char ucChannel);
+
+/* ************************************************** */
+/* Method name:        pit_isRunning                  */
+/* Method description: Check if a channel is counting */
+/* Input params:       ucChannel: 0 to PIT_CHANNELS-1 */
+/* Output params:      1 if running, 0 if stopped     */
+/* ************************************************** */
+unsigned char pit_isRunning(unsigned char ucChannel);
+
+/* ************************************************** */
+/* Method name:        pit_updateClock                */
+/* Method description: Convert the periods again after*/
+/*                     a bus clock change. A running  */
+/*                     channel takes the new period at*/
+/*                     its next reload                */
+/* Input params:       n/a                            */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void pit_updateClock(void);
+
+/* ************************************************** */
+/* Method name:        PIT_IRQHandler                 */
+/* Method description: PIT interruption, shared by    */
+/*                     the channels                   */
+/* Input params:       n/a                            */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void PIT_IRQHandler(void);
+
+#endif /* SOURCES_PIT_H_ */
@@ -0,0 +1,348 @@
+/* ***************************************************************** */
+/* File name:        power.c                                         */
+/* File description: Power manager. The sleep times are measured on  */
+/*                   the RTC uptime, which counts the LPO in every   */
+/*                   mode and is not changed by setting the clock,   */
+/*                   and the total time on the periodic ticks.       */
+/*                   In VLPR the TPMs and the UART0 run on MCGIRCLK  */
+/*                   and every module that derives a time from a     */
+/*                   clock is told about each change                 */
+/* Author name:      Grupo 18 - Renato Pepe                          */
+/*                              Joao Victor Matoso                   */
+/* Creation date:    19oct2026                                       */
+/* Revision date:    19oct2026                                       */
+/* ***************************************************************** */
+
+#include "power.h"
+#include "fsl_device_registers.h"
+#include "delay.h"
+#include "UART.h"
+#include "keypad.h"
+#include "lcdDma.h"
+#include "modbus.h"
+#include "aquecedorECooler.h"
+#include "tacometro.h"
+#include "mcg.h"
+#include "pit.h"
+#include "adc.h"
+#include "cyclecounter.h"
+
+/* SMC_PMCTRL STOPM value of VLPS */
+#define POWER_STOPM_VLPS        2U
+
+/* SIM_SOPT2 TPMSRC values */
+#define POWER_TPM_CLOCK_FLL     1U
+#define POWER_TPM_CLOCK_IRC     3U
+
+unsigned char ucPowerPolicy = POWER_POLICY_DEFAULT;
+
+/* 1 while the core runs at 4 MHz */
+unsigned char ucPowerVlpr = 0;
+
+/* ticks since the last demand for RUN, counted up to POWER_VLPR_IDLE_TICKS */
+volatile unsigned char ucPowerIdleTicks = 0;
+
+/* set by the tick, the main loop has new work */
+volatile unsigned char ucPowerTickPending = 0;
+
+/* time since the counters were cleared */
+volatile unsigned int uiPowerTotalMs = 0;
+unsigned int uiPowerWaitMs = 0;
+unsigned int uiPowerStopMs = 0;
+volatile unsigned int uiPowerVlprMs = 0;
+unsigned int uiPowerWakeups = 0;
+unsigned int uiPowerSwitches = 0;
+
+/* deadline for the FLL to lock, after a VLPS or VLPR */
+unsigned int uiPowerFllSettledMs = 0;
+
+/* ************************************************** */
+/* Method name:        power_canStop                  */
+/* Method description: Check that no peripheral needs */
+/*                     the FLL or the bus clock, which*/
+/*                     stop in VLPS                   */
+/* Input params:       n/a                            */
+/* Output params:      1 if VLPS is safe, 0 if not    */
+/* ************************************************** */
+static unsigned char power_canStop(void)
+{
+    /* on the FLL the TPM1 would freeze the heater and cooler outputs at their level, MCGIRCLK keeps running */
+    if(!ucPowerVlpr && (0.0f != getDutyCycleHeater() || 0.0f != getDutyCycleCooler()))
+        return 0;
+
+    /* the LCD DMA is paced by TPM2, the keypad scan and the Modbus timings by the PIT */
+    if(lcdDma_isBusy() || keypad_isScanning() || modbus_isEnabled())
+        return 0;
+
+    return 1;
+}
+
+/* ************************************************** */
+/* Method name:        power_isFllSettled             */
+/* Method description: Check that the crystal runs    */
+/*                     and the FLL had the time to    */
+/*                     lock after the last VLPS       */
+/* Input params:       n/a                            */
+/* Output params:      1 if settled, 0 if not         */
+/* ************************************************** */
+static unsigned char power_isFllSettled(void)
+{
+    return (MCG_S & MCG_S_OSCINIT0_MASK) && delay_isExpiredMs(uiPowerFllSettledMs);
+}
+
+/* ************************************************** */
+/* Method name:        power_needsRun                 */
+/* Method description: Check the work that needs the  */
+/*                     40 MHz clock                   */
+/* Input params:       n/a                            */
+/* Output params:      1 if RUN is needed, 0 if not   */
+/* ************************************************** */
+static unsigned char power_needsRun(void)
+{
+    /* commands may write the flash or change the baud rate, both need RUN */
+    if(UART0_hasReceived() || !UART0_isIdle())
+        return 1;
+
+    /* the menu answers at once, Modbus keeps its frame timings */
+    if(keypad_isScanning() || keypad_hasEvent() || modbus_isEnabled())
+        return 1;
+
+    /* the tachometer counts at MCGFLLCLK/32, a rate the 4 MHz IRC can't give */
+    if(0.0f != getDutyCycleCooler() || !tachometer_isStalled())
+        return 1;
+
+    return 0;
+}
+
+/* ************************************************** */
+/* Method name:        power_updateClocks             */
+/* Method description: Tell the modules that derive a */
+/*                     time from a clock that it      */
+/*                     changed                        */
+/* Input params:       n/a                            */
+/* Output params:      n/a                            */
+/* ************************************************** */
+static void power_updateClocks(void)
+{
+    PWM_updateClock();
+    pit_updateClock();
+    adc_updateClock();
+    cyclecounter_updateClock();
+}
+
+/* ************************************************** */
+/* Method name:        power_enterVlpr                */
+/* Method description: Move the TPMs and the UART0 to */
+/*                     MCGIRCLK and drop to VLPR      */
+/* Input params:       n/a                            */
+/* Output params:      n/a                            */
+/* ************************************************** */
+static void power_enterVlpr(void)
+{
+    unsigned int uiPrimask = __get_PRIMASK();
+    __disable_irq();
+
+    /* the LCD transfer is paced by the TPM2 */
+    lcdDma_wait();
+    if(!UART0_enterStopClock()){
+        __set_PRIMASK(uiPrimask);
+        return;
+    }
+
+    SIM_SOPT2 = (SIM_SOPT2 & ~SIM_SOPT2_TPMSRC_MASK) | SIM_SOPT2_TPMSRC(POWER_TPM_CLOCK_IRC);
+    mcg_enterVlpr();
+    power_updateClocks();
+
+    ucPowerVlpr = 1;
+    uiPowerSwitches++;
+
+    __set_PRIMASK(uiPrimask);
+}
+
+/* ************************************************** */
+/* Method name:        power_exitVlpr                 */
+/* Method description: Go back to RUN and move the    */
+/*                     TPMs to the FLL. The UART0     */
+/*                     follows when the FLL is locked */
+/* Input params:       n/a                            */
+/* Output params:      n/a                            */
+/* ************************************************** */
+static void power_exitVlpr(void)
+{
+    unsigned int uiPrimask = __get_PRIMASK();
+    __disable_irq();
+
+    lcdDma_wait();
+    mcg_exitVlpr();
+    uiPowerFllSettledMs = delay_getDeadlineMs(POWER_FLL_SETTLE_MS);
+
+    SIM_SOPT2 = (SIM_SOPT2 & ~SIM_SOPT2_TPMSRC_MASK) | SIM_SOPT2_TPMSRC(POWER_TPM_CLOCK_FLL);
+    power_updateClocks();
+
+    ucPowerVlpr = 0;
+
+    __set_PRIMASK(uiPrimask);
+}
+
+/* ************************************************** */
+/* Method name:        power_update                   */
+/* Method description: Choose between RUN and VLPR.   */
+/*                     Called at the start of the     */
+/*                     main loop                      */
+/* Input params:       n/a                            */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void power_update(void)
+{
+    if(power_needsRun() || POWER_POLICY_VLPR != ucPowerPolicy){
+        ucPowerIdleTicks = 0;
+        if(ucPowerVlpr)
+            power_exitVlpr();
+    }else if(!ucPowerVlpr && POWER_VLPR_IDLE_TICKS <= ucPowerIdleTicks){
+        power_enterVlpr();
+    }
+}
+
+/* ************************************************** */
+/* Method name:        power_isVlpr                   */
+/* Method description: Check the run mode. The flash  */
+/*                     can't be written and the FLL   */
+/*                     is off in VLPR                 */
+/* Input params:       n/a                            */
+/* Output params:      1 in VLPR, 0 in RUN            */
+/* ************************************************** */
+unsigned char power_isVlpr(void)
+{
+    return ucPowerVlpr;
+}
+
+/* ************************************************** */
+/* Method name:        power_idle                     */
+/* Method description: Sleep until an interruption.   */
+/*                     Returns at once if work came   */
+/*                     in after the main loop looked  */
+/*                     for it. Called at the end of   */
+/*                     the main loop                  */
+/* Input params:       n/a                            */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void power_idle(void)
+{
+    unsigned char ucStop;
+    unsigned int uiSleepMs;
+    unsigned int uiPrimask = __get_PRIMASK();
+
+    /* WFI still wakes on a pending interruption, it is served after __set_PRIMASK */
+    __disable_irq();
+
+    if(ucPowerTickPending || UART0_hasReceived() || modbus_hasFrame()){
+        ucPowerTickPending = 0;
+        __set_PRIMASK(uiPrimask);
+        return;
+    }
+
+    /* the UART0 stays on MCGIRCLK between stops and goes back to the FLL when the MCU stays awake in RUN */
+    ucStop = POWER_POLICY_WAIT != ucPowerPolicy && power_canStop();
+    if(ucStop)
+        ucStop = UART0_enterStopClock();
+    else if(!ucPowerVlpr && UART0_isOnStopClock() && power_isFllSettled())
+        UART0_exitStopClock();
+
+    uiSleepMs = delay_getMs();
+    if(ucStop){
+        SMC_PMCTRL = (SMC_PMCTRL & ~SMC_PMCTRL_STOPM_MASK) | SMC_PMCTRL_STOPM(POWER_STOPM_VLPS);
+        (void)SMC_PMCTRL;       // the write must complete before the WFI
+        SCB->SCR |= SCB_SCR_SLEEPDEEP_Msk;
+        __WFI();
+        SCB->SCR &= ~SCB_SCR_SLEEPDEEP_Msk;
+
+        if(!ucPowerVlpr)
+            uiPowerFllSettledMs = delay_getDeadlineMs(POWER_FLL_SETTLE_MS);
+        uiPowerStopMs += delay_getMs() - uiSleepMs;
+    }else{
+        __WFI();
+        uiPowerWaitMs += delay_getMs() - uiSleepMs;
+    }
+    uiPowerWakeups++;
+
+    __set_PRIMASK(uiPrimask);
+}
+
+/* ************************************************** */
+/* Method name:        power_tick                     */
+/* Method description: Count the time and make the    */
+/*                     main loop run once more. Called*/
+/*                     by the periodic interruption   */
+/*                     every POWER_TICK_MS            */
+/* Input params:       n/a                            */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void power_tick(void)
+{
+    uiPowerTotalMs += POWER_TICK_MS;
+    if(ucPowerVlpr)
+        uiPowerVlprMs += POWER_TICK_MS;
+    if(POWER_VLPR_IDLE_TICKS > ucPowerIdleTicks)
+        ucPowerIdleTicks++;
+    ucPowerTickPending = 1;
+}
+
+/* ************************************************** */
+/* Method name:        power_setPolicy                */
+/* Method description: Choose the low power modes     */
+/*                     allowed and clear the counters */
+/* Input params:       ucPolicy: POWER_POLICY_*       */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void power_setPolicy(unsigned char ucPolicy)
+{
+    unsigned int uiPrimask = __get_PRIMASK();
+    __disable_irq();
+
+    ucPowerPolicy = ucPolicy;
+    uiPowerTotalMs = 0;
+    uiPowerWaitMs = 0;
+    uiPowerStopMs = 0;
+    uiPowerVlprMs = 0;
+    uiPowerWakeups = 0;
+    uiPowerSwitches = 0;
+
+    __set_PRIMASK(uiPrimask);
+}
+
+/* ************************************************** */
+/* Method name:        power_getPolicy                */
+/* Method description: Low power modes allowed        */
+/* Input params:       n/a                            */
+/* Output params:      POWER_POLICY_*                 */
+/* ************************************************** */
+unsigned char power_getPolicy(void)
+{
+    return ucPowerPolicy;
+}
+
+/* ************************************************** */
+/* Method name:        power_getStatistics            */
+/* Method description: Read the time in each mode     */
+/*                     since the counters were cleared*/
+/* Input params:       pStatistics: where to write    */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void power_getStatistics(power_statistics_type *pStatistics)
+{
+    unsigned int uiSleepMs;
+    unsigned int uiPrimask = __get_PRIMASK();
+    __disable_irq();
+
+    pStatistics->uiWaitMs = uiPowerWaitMs;
+    pStatistics->uiStopMs = uiPowerStopMs;
+    pStatistics->uiVlprMs = uiPowerVlprMs;
+    pStatistics->uiWakeups = uiPowerWakeups;
+    pStatistics->uiSwitches = uiPowerSwitches;
+
+    /* the total moves in steps of a tick, the sleep times in ms */
+    uiSleepMs = uiPowerWaitMs + uiPowerStopMs;
+    pStatistics->uiRunMs = (uiPowerTotalMs > uiSleepMs) ? uiPowerTotalMs - uiSleepMs : 0;
+
+    __set_PRIMASK(uiPrimask);
+}
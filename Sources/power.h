@@ -0,0 +1,116 @@
+/* ***************************************************************** */
+/* File name:        power.h                                         */
+/* File description: Power manager. The main loop sleeps between     */
+/*                   the interruptions: in VLPS when nothing needs   */
+/*                   the FLL clock, or in WAIT otherwise. LPTMR and  */
+/*                   RTC (LPO), UART0 (MCGIRCLK) and the keypad      */
+/*                   (PORTA) wake the MCU from VLPS, and the MCG     */
+/*                   returns to FEE on its own. After a steady idle  */
+/*                   time the core also drops from RUN (FEE, 40 MHz) */
+/*                   to VLPR (BLPI, 4 MHz), and goes back to RUN as  */
+/*                   soon as the UART, the keypad, the fan or Modbus */
+/*                   need throughput. The time spent in each mode is */
+/*                   counted                                         */
+/* Author name:      Grupo 18 - Renato Pepe                          */
+/*                              Joao Victor Matoso                   */
+/* Creation date:    19oct2026                                       */
+/* Revision date:    19oct2026                                       */
+/* ***************************************************************** */
+
+#ifndef SOURCES_POWER_H_
+#define SOURCES_POWER_H_
+
+/* period of the calls to power_tick */
+#define POWER_TICK_MS           100U
+
+/* low power modes allowed */
+#define POWER_POLICY_WAIT       0U      // WAIT only
+#define POWER_POLICY_VLPS       1U      // WAIT and VLPS
+#define POWER_POLICY_VLPR       2U      // WAIT and VLPS, VLPR when idle
+#define POWER_POLICY_DEFAULT    POWER_POLICY_VLPR
+
+/* ticks without work before dropping to VLPR */
+#define POWER_VLPR_IDLE_TICKS   10U
+
+/* FLL acquisition time after a wake from VLPS (1 ms max in the datasheet) */
+#define POWER_FLL_SETTLE_MS     2U
+
+typedef struct power_statistics_type {
+    unsigned int uiRunMs;               // awake
+    unsigned int uiWaitMs;              // WAIT, the bus clock runs
+    unsigned int uiStopMs;              // VLPS, only the LPO and MCGIRCLK run
+    unsigned int uiVlprMs;              // at 4 MHz, part of the three above
+    unsigned int uiWakeups;
+    unsigned int uiSwitches;            // RUN to VLPR changes
+} power_statistics_type;
+
+/* ************************************************** */
+/* Method name:        power_idle                     */
+/* Method description: Sleep until an interruption.   */
+/*                     Returns at once if work came   */
+/*                     in after the main loop looked  */
+/*                     for it. Called at the end of   */
+/*                     the main loop                  */
+/* Input params:       n/a                            */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void power_idle(void);
+
+/* ************************************************** */
+/* Method name:        power_update                   */
+/* Method description: Choose between RUN and VLPR.   */
+/*                     Called at the start of the     */
+/*                     main loop                      */
+/* Input params:       n/a                            */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void power_update(void);
+
+/* ************************************************** */
+/* Method name:        power_isVlpr                   */
+/* Method description: Check the run mode. The flash  */
+/*                     can't be written and the FLL   */
+/*                     is off in VLPR                 */
+/* Input params:       n/a                            */
+/* Output params:      1 in VLPR, 0 in RUN            */
+/* ************************************************** */
+unsigned char power_isVlpr(void);
+
+/* ************************************************** */
+/* Method name:        power_tick                     */
+/* Method description: Count the time and make the    */
+/*                     main loop run once more. Called*/
+/*                     by the periodic interruption   */
+/*                     every POWER_TICK_MS            */
+/* Input params:       n/a                            */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void power_tick(void);
+
+/* ************************************************** */
+/* Method name:        power_setPolicy                */
+/* Method description: Choose the low power modes     */
+/*                     allowed and clear the counters */
+/* Input params:       ucPolicy: POWER_POLICY_*       */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void power_setPolicy(unsigned char ucPolicy);
+
+/* ************************************************** */
+/* Method name:        power_getPolicy                */
+/* Method description: Low power modes allowed        */
+/* Input params:       n/a                            */
+/* Output params:      POWER_POLICY_*                 */
+/* ************************************************** */
+unsigned char power_getPolicy(void);
+
+/* ************************************************** */
+/* Method name:        power_getStatistics            */
+/* Method description: Read the time in each mode     */
+/*                     since the counters were cleared*/
+/* Input params:       pStatistics: where to write    */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void power_getStatistics(power_statistics_type *pStatistics);
+
+#endif /* SOURCES_POWER_H_ */
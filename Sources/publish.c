@@ -0,0 +1,220 @@
+/* ***************************************************************** */
+/* File name:        publish.c                                       */
+/* File description: Parameter subscriptions. A software timer       */
+/*                   counts the ticks in the interruption, the main  */
+/*                   loop reads the values and pushes the due ones   */
+/*                   in one "!<letter>=<value>;..." line             */
+/* Author name:      Grupo 18 - Renato Pepe                          */
+/*                              Joao Victor Matoso                   */
+/* Creation date:    19oct2026                                       */
+/* Revision date:    19oct2026                                       */
+/* ***************************************************************** */
+
+#include "publish.h"
+#include "timer.h"
+#include "paramRegistry.h"
+#include "communicationStateMachine.h"
+
+typedef struct publish_entry_type {
+    unsigned char ucLetter;         // 0 if the entry is free
+    unsigned int uiPeriodTicks;     // 0 if not pushed periodically
+    unsigned int uiTicksLeft;
+    float fThreshold;               // 0 if not pushed on change
+    float fLastValue;               // last value pushed
+} publish_entry_type;
+
+/* ticks checked at once, a longer backlog is dropped */
+#define PUBLISH_MAX_BACKLOG     10U
+
+/* subscriptions */
+publish_entry_type publishTable[PUBLISH_SIZE];
+
+/* ticks counted by the timer and ticks already checked by the main loop */
+timer_entry_t publishTimer;
+volatile unsigned int uiPublishTicks = 0;
+unsigned int uiPublishTicksDone = 0;
+
+/* ************************************************** */
+/* Method name:        publish_tick                   */
+/* Method description: Timer callback, count a tick   */
+/* Input params:       pvArg: not used                */
+/* Output params:      n/a                            */
+/* ************************************************** */
+static void publish_tick(void *pvArg)
+{
+    (void)pvArg;
+    uiPublishTicks++;
+}
+
+/* ************************************************** */
+/* Method name:        publish_getEntry               */
+/* Method description: Find the entry of a parameter, */
+/*                     taking a free one if it has    */
+/*                     none                           */
+/* Input params:       ucLetter: parameter letter     */
+/* Output params:      entry, 0 if the parameter has  */
+/*                     no value or the table is full  */
+/* ************************************************** */
+static publish_entry_type *publish_getEntry(unsigned char ucLetter)
+{
+    const param_descriptor_type *pParam = param_findGet(ucLetter);
+    publish_entry_type *pFree = 0;
+    unsigned char ucIndex;
+
+    if(!pParam || !pParam->fGet)
+        return 0;
+
+    for(ucIndex = 0; ucIndex < PUBLISH_SIZE; ucIndex++){
+        if(ucLetter == publishTable[ucIndex].ucLetter)
+            return &publishTable[ucIndex];
+        if(!pFree && 0 == publishTable[ucIndex].ucLetter)
+            pFree = &publishTable[ucIndex];
+    }
+
+    if(pFree){
+        pFree->ucLetter = ucLetter;
+        pFree->uiPeriodTicks = 0;
+        pFree->fThreshold = 0.0f;
+        pFree->fLastValue = pParam->fGet();
+    }
+    return pFree;
+}
+
+/* ************************************************** */
+/* Method name:        publish_releaseEntry           */
+/* Method description: Free an entry with neither a   */
+/*                     period nor a threshold         */
+/* Input params:       pEntry: entry                  */
+/* Output params:      n/a                            */
+/* ************************************************** */
+static void publish_releaseEntry(publish_entry_type *pEntry)
+{
+    if(0 == pEntry->uiPeriodTicks && 0.0f == pEntry->fThreshold)
+        pEntry->ucLetter = 0;
+}
+
+/* ************************************************** */
+/* Method name:        publish_init                   */
+/* Method description: Clear the subscriptions and    */
+/*                     start the check timer          */
+/* Input params:       n/a                            */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void publish_init(void)
+{
+    unsigned char ucIndex;
+
+    for(ucIndex = 0; ucIndex < PUBLISH_SIZE; ucIndex++)
+        publishTable[ucIndex].ucLetter = 0;
+
+    timer_startPeriodic(&publishTimer, PUBLISH_TICK_MS, publish_tick, 0);
+}
+
+/* ************************************************** */
+/* Method name:        publish_setPeriod              */
+/* Method description: Push a parameter periodically  */
+/* Input params:       ucLetter: parameter letter     */
+/*                     uiPeriodMs: push period, 0     */
+/*                     stops the periodic push        */
+/* Output params:      1 if subscribed, 0 if the      */
+/*                     parameter has no value or the  */
+/*                     table is full                  */
+/* ************************************************** */
+unsigned char publish_setPeriod(unsigned char ucLetter, unsigned int uiPeriodMs)
+{
+    publish_entry_type *pEntry = publish_getEntry(ucLetter);
+
+    if(!pEntry)
+        return 0;
+
+    /* rounded to the tick, at least one tick */
+    pEntry->uiPeriodTicks = (uiPeriodMs + PUBLISH_TICK_MS / 2) / PUBLISH_TICK_MS;
+    if(0 < uiPeriodMs && 0 == pEntry->uiPeriodTicks)
+        pEntry->uiPeriodTicks = 1;
+    pEntry->uiTicksLeft = pEntry->uiPeriodTicks;
+
+    publish_releaseEntry(pEntry);
+    return 1;
+}
+
+/* ************************************************** */
+/* Method name:        publish_setThreshold           */
+/* Method description: Push a parameter when it moves */
+/*                     at least a threshold from the  */
+/*                     last value pushed              */
+/* Input params:       ucLetter: parameter letter     */
+/*                     fThreshold: change to push, 0  */
+/*                     stops the push on change       */
+/* Output params:      1 if subscribed, 0 if the      */
+/*                     parameter has no value or the  */
+/*                     table is full                  */
+/* ************************************************** */
+unsigned char publish_setThreshold(unsigned char ucLetter, float fThreshold)
+{
+    publish_entry_type *pEntry = publish_getEntry(ucLetter);
+
+    if(!pEntry)
+        return 0;
+
+    pEntry->fThreshold = fThreshold;
+
+    publish_releaseEntry(pEntry);
+    return 1;
+}
+
+/* ************************************************** */
+/* Method name:        publish_update                 */
+/* Method description: Push the values that are due,  */
+/*                     in one line. Called from the   */
+/*                     main loop                      */
+/* Input params:       n/a                            */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void publish_update(void)
+{
+    unsigned char ucLetters[PUBLISH_SIZE + 1];
+    unsigned char ucCount;
+    unsigned char ucIndex;
+    float fValue, fChange;
+
+    /* after a long stop (Modbus RTU mode) only the last tick is checked */
+    if(PUBLISH_MAX_BACKLOG < uiPublishTicks - uiPublishTicksDone)
+        uiPublishTicksDone = uiPublishTicks - 1;
+
+    /* ticks missed while the main loop was busy are checked one by one */
+    while(uiPublishTicksDone != uiPublishTicks){
+        uiPublishTicksDone++;
+        ucCount = 0;
+
+        for(ucIndex = 0; ucIndex < PUBLISH_SIZE; ucIndex++){
+            publish_entry_type *pEntry = &publishTable[ucIndex];
+            unsigned char ucDue = 0;
+
+            if(0 == pEntry->ucLetter)
+                continue;
+
+            fValue = param_findGet(pEntry->ucLetter)->fGet();
+
+            if(pEntry->uiPeriodTicks && 0 == --pEntry->uiTicksLeft){
+                pEntry->uiTicksLeft = pEntry->uiPeriodTicks;
+                ucDue = 1;
+            }
+
+            if(0.0f < pEntry->fThreshold){
+                fChange = fValue - pEntry->fLastValue;
+                if(fChange >= pEntry->fThreshold || -fChange >= pEntry->fThreshold)
+                    ucDue = 1;
+            }
+
+            if(ucDue){
+                pEntry->fLastValue = fValue;
+                ucLetters[ucCount++] = pEntry->ucLetter;
+            }
+        }
+
+        if(ucCount){
+            ucLetters[ucCount] = '\0';
+            pushParamList(ucLetters);
+        }
+    }
+}
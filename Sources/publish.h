@@ -0,0 +1,70 @@
+/* ***************************************************************** */
+/* File name:        publish.h                                       */
+/* File description: Parameter subscriptions: the values subscribed  */
+/*                   by the host are pushed on the UART every period */
+/*                   or when they change more than a threshold, so   */
+/*                   the host does not have to poll them             */
+/* Author name:      Grupo 18 - Renato Pepe                          */
+/*                              Joao Victor Matoso                   */
+/* Creation date:    19oct2026                                       */
+/* Revision date:    19oct2026                                       */
+/* ***************************************************************** */
+
+#ifndef SOURCES_PUBLISH_H_
+#define SOURCES_PUBLISH_H_
+
+/* number of parameters that can be subscribed at the same time */
+#define PUBLISH_SIZE            8U
+
+/* the subscriptions are checked at this period */
+#define PUBLISH_TICK_MS         100U
+
+/* longest push period */
+#define PUBLISH_MAX_PERIOD_MS   3600000U
+
+/* ************************************************** */
+/* Method name:        publish_init                   */
+/* Method description: Clear the subscriptions and    */
+/*                     start the check timer          */
+/* Input params:       n/a                            */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void publish_init(void);
+
+/* ************************************************** */
+/* Method name:        publish_setPeriod              */
+/* Method description: Push a parameter periodically  */
+/* Input params:       ucLetter: parameter letter     */
+/*                     uiPeriodMs: push period, 0     */
+/*                     stops the periodic push        */
+/* Output params:      1 if subscribed, 0 if the      */
+/*                     parameter has no value or the  */
+/*                     table is full                  */
+/* ************************************************** */
+unsigned char publish_setPeriod(unsigned char ucLetter, unsigned int uiPeriodMs);
+
+/* ************************************************** */
+/* Method name:        publish_setThreshold           */
+/* Method description: Push a parameter when it moves */
+/*                     at least a threshold from the  */
+/*                     last value pushed              */
+/* Input params:       ucLetter: parameter letter     */
+/*                     fThreshold: change to push, 0  */
+/*                     stops the push on change       */
+/* Output params:      1 if subscribed, 0 if the      */
+/*                     parameter has no value or the  */
+/*                     table is full                  */
+/* ************************************************** */
+unsigned char publish_setThreshold(unsigned char ucLetter, float fThreshold);
+
+/* ************************************************** */
+/* Method name:        publish_update                 */
+/* Method description: Push the values that are due,  */
+/*                     in one line. Called from the   */
+/*                     main loop                      */
+/* Input params:       n/a                            */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void publish_update(void);
+
+#endif /* SOURCES_PUBLISH_H_ */
@@ -0,0 +1,207 @@
+/* ***************************************************************** */
+/* File name:        rtc.c                                           */
+/* File description: Real time clock driver. The board has no 32kHz  */
+/*                   crystal, so the RTC counts the 1kHz LPO: the    */
+/*                   prescaler (TPR, 15 low bits) holds the          */
+/*                   milliseconds and the seconds register (TSR)     */
+/*                   increments every 32768ms.                       */
+/*                   The counter is never rewritten: it is the       */
+/*                   uptime, and the wall-clock is an offset over it */
+/* Author name:      Grupo 18 - Renato Pepe                          */
+/*                              Joao Victor Matoso                   */
+/* Creation date:    19oct2026                                       */
+/* Revision date:    19oct2026                                       */
+/* ***************************************************************** */
+
+#include "rtc.h"
+#include "board.h"
+
+/* RTC prescaler counts per TSR increment */
+#define RTC_TPR_COUNTS          RTC_ALARM_STEP_MS
+
+/* TPR is 16 bits but TSR increments when bit 14 falls, so the
+ * prescaler reads 32768..65535 in every other period */
+#define RTC_TPR_MASK            (RTC_TPR_COUNTS - 1U)
+
+/* 32 days are exactly 84375 TSR increments, the counter is reduced modulo this before converting to ms */
+#define RTC_TSR_PERIOD          84375U
+
+rtc_alarm_callback_t fRtcAlarmCallback = 0;
+
+/* wall-clock time when the counter was at 0, below RTC_DAY_MS */
+unsigned int uiRtcOffsetMs = 0;
+
+/* ************************************************ */
+/* Method name:        rtc_readCounter              */
+/* Method description: Read TSR and TPR coherently, */
+/*                     TPR may carry into TSR       */
+/*                     between the reads. The       */
+/*                     prescaler is returned as the */
+/*                     ms inside the TSR period     */
+/* Input params:       puiSeconds, puiPrescaler:    */
+/*                     where to store the values    */
+/* Output params:      n/a                          */
+/* ************************************************ */
+static void rtc_readCounter(unsigned int *puiSeconds, unsigned int *puiPrescaler)
+{
+    do {
+        *puiSeconds = RTC_TSR;
+        *puiPrescaler = RTC_TPR & RTC_TPR_MASK;
+    } while(*puiSeconds != RTC_TSR);
+}
+
+/* ************************************************ */
+/* Method name:        rtc_getCounterMs             */
+/* Method description: Counter in ms, reduced to a  */
+/*                     whole number of days so the  */
+/*                     wall-clock has no jump when  */
+/*                     TSR * 32768 wraps            */
+/* Input params:       uiSeconds, uiPrescaler:      */
+/*                     rtc_readCounter values       */
+/* Output params:      milliseconds                 */
+/* ************************************************ */
+static unsigned int rtc_getCounterMs(unsigned int uiSeconds, unsigned int uiPrescaler)
+{
+    return (uiSeconds % RTC_TSR_PERIOD) * RTC_TPR_COUNTS + uiPrescaler;
+}
+
+/* ************************************************ */
+/* Method name:        rtc_init                     */
+/* Method description: Start the RTC counting the   */
+/*                     1kHz LPO, which keeps running*/
+/*                     in the low power modes, and  */
+/*                     enable the alarm interruption*/
+/* Input params:       fAlarmCallback: function     */
+/*                     called when the alarm fires  */
+/* Output params:      n/a                          */
+/* ************************************************ */
+void rtc_init(rtc_alarm_callback_t fAlarmCallback)
+{
+    fRtcAlarmCallback = fAlarmCallback;
+
+    /* release clock to the RTC registers */
+    SIM_SCGC6 |= SIM_SCGC6_RTC_MASK;
+
+    /* ERCLK32K (RTC clock) from the LPO 1kHz */
+    SIM_SOPT1 = (SIM_SOPT1 & ~SIM_SOPT1_OSC32KSEL_MASK) | SIM_SOPT1_OSC32KSEL(3);
+
+    /* stop the counter, writing TSR clears the invalid/overflow flags after a reset */
+    RTC_SR = 0;
+    RTC_TPR = 0;
+    RTC_TSR = 0;
+    RTC_TAR = 0xFFFFFFFF;
+
+    /* only the alarm interrupts (TIIE is set out of reset) */
+    RTC_IER = RTC_IER_TAIE_MASK;
+    NVIC_EnableIRQ(RTC_IRQn);
+
+    /* start counting */
+    RTC_SR = RTC_SR_TCE_MASK;
+}
+
+/* ************************************************ */
+/* Method name:        rtc_setTimeOfDay             */
+/* Method description: Set the wall-clock time      */
+/* Input params:       uiSeconds: seconds since     */
+/*                     midnight                     */
+/* Output params:      n/a                          */
+/* ************************************************ */
+void rtc_setTimeOfDay(unsigned int uiSeconds)
+{
+    unsigned int uiMs = (uiSeconds % (RTC_DAY_MS/1000)) * 1000;
+    unsigned int uiCounterSeconds, uiPrescaler;
+
+    /* the counter keeps running, the uptime and the deadlines on it are not disturbed */
+    rtc_readCounter(&uiCounterSeconds, &uiPrescaler);
+    uiRtcOffsetMs = (uiMs + RTC_DAY_MS - rtc_getCounterMs(uiCounterSeconds, uiPrescaler) % RTC_DAY_MS) % RTC_DAY_MS;
+}
+
+/* ************************************************ */
+/* Method name:        rtc_getTimeOfDayMs           */
+/* Method description: Get the wall-clock time      */
+/* Input params:       n/a                          */
+/* Output params:      milliseconds since midnight  */
+/* ************************************************ */
+unsigned int rtc_getTimeOfDayMs(void)
+{
+    unsigned int uiSeconds, uiPrescaler;
+
+    rtc_readCounter(&uiSeconds, &uiPrescaler);
+    return (rtc_getCounterMs(uiSeconds, uiPrescaler) + uiRtcOffsetMs) % RTC_DAY_MS;
+}
+
+/* ************************************************ */
+/* Method name:        rtc_getUptimeMs              */
+/* Method description: Time since rtc_init, not     */
+/*                     changed by rtc_setTimeOfDay  */
+/* Input params:       n/a                          */
+/* Output params:      milliseconds, wraps at 32    */
+/*                     bits (49 days)               */
+/* ************************************************ */
+unsigned int rtc_getUptimeMs(void)
+{
+    unsigned int uiSeconds, uiPrescaler;
+
+    rtc_readCounter(&uiSeconds, &uiPrescaler);
+    return uiSeconds * RTC_TPR_COUNTS + uiPrescaler;
+}
+
+/* ************************************************ */
+/* Method name:        rtc_setAlarm                 */
+/* Method description: Program the alarm to wake    */
+/*                     the CPU before a time of day.*/
+/*                     The alarm fires on the last  */
+/*                     RTC_ALARM_STEP_MS step before*/
+/*                     it, the rest is left to a    */
+/*                     timer. It must be at least   */
+/*                     RTC_ALARM_STEP_MS ahead      */
+/* Input params:       uiTimeOfDayMs: ms since      */
+/*                     midnight                     */
+/* Output params:      n/a                          */
+/* ************************************************ */
+void rtc_setAlarm(unsigned int uiTimeOfDayMs)
+{
+    unsigned int uiSeconds, uiPrescaler, uiNow, uiDelta, uiTarget;
+
+    rtc_readCounter(&uiSeconds, &uiPrescaler);
+    uiNow = (rtc_getCounterMs(uiSeconds, uiPrescaler) + uiRtcOffsetMs) % RTC_DAY_MS;
+    uiDelta = (uiTimeOfDayMs + RTC_DAY_MS - uiNow) % RTC_DAY_MS;
+
+    /* TSR value of the period that holds the alarm time, at least the next one when uiDelta >= RTC_TPR_COUNTS */
+    uiTarget = uiSeconds + (uiPrescaler + uiDelta) / RTC_TPR_COUNTS;
+    if(uiTarget == uiSeconds)
+        uiTarget++;
+
+    /* the alarm flag is set when TSR increments from TAR, i.e. at the start of the target period */
+    RTC_TAR = uiTarget - 1;
+}
+
+/* ************************************************ */
+/* Method name:        rtc_disableAlarm             */
+/* Method description: Disarm the alarm             */
+/* Input params:       n/a                          */
+/* Output params:      n/a                          */
+/* ************************************************ */
+void rtc_disableAlarm(void)
+{
+    /* TSR never reaches this value, writing TAR also clears a pending flag */
+    RTC_TAR = 0xFFFFFFFF;
+}
+
+/* ************************************************ */
+/* Method name:        RTC_IRQHandler               */
+/* Method description: Alarm interruption, disarms  */
+/*                     the alarm and calls the      */
+/*                     installed callback, which    */
+/*                     arms the next one            */
+/* Input params:       n/a                          */
+/* Output params:      n/a                          */
+/* ************************************************ */
+void RTC_IRQHandler(void)
+{
+    /* writing TAR clears the alarm flag; disarm until the callback sets the next one */
+    rtc_disableAlarm();
+
+    if(fRtcAlarmCallback)
+        fRtcAlarmCallback();
+}
@@ -0,0 +1,97 @@
+/* ***************************************************************** */
+/* File name:        rtc.h                                           */
+/* File description: Header file containing the functions/methods    */
+/*                   interfaces for the real time clock, used as the */
+/*                   wall-clock time of day                          */
+/* Author name:      Grupo 18 - Renato Pepe                          */
+/*                              Joao Victor Matoso                   */
+/* Creation date:    19oct2026                                       */
+/* Revision date:    19oct2026                                       */
+/* ***************************************************************** */
+
+#ifndef SOURCES_RTC_H_
+#define SOURCES_RTC_H_
+
+/* milliseconds in a day */
+#define RTC_DAY_MS              86400000U
+
+/* step of the seconds register with the LPO, the resolution of the alarm */
+#define RTC_ALARM_STEP_MS       32768U
+
+/* function called by the alarm interruption */
+typedef void (*rtc_alarm_callback_t)(void);
+
+/* ************************************************ */
+/* Method name:        rtc_init                     */
+/* Method description: Start the RTC counting the   */
+/*                     1kHz LPO, which keeps running*/
+/*                     in the low power modes, and  */
+/*                     enable the alarm interruption*/
+/* Input params:       fAlarmCallback: function     */
+/*                     called when the alarm fires  */
+/* Output params:      n/a                          */
+/* ************************************************ */
+void rtc_init(rtc_alarm_callback_t fAlarmCallback);
+
+/* ************************************************ */
+/* Method name:        rtc_setTimeOfDay             */
+/* Method description: Set the wall-clock time      */
+/* Input params:       uiSeconds: seconds since     */
+/*                     midnight                     */
+/* Output params:      n/a                          */
+/* ************************************************ */
+void rtc_setTimeOfDay(unsigned int uiSeconds);
+
+/* ************************************************ */
+/* Method name:        rtc_getTimeOfDayMs           */
+/* Method description: Get the wall-clock time      */
+/* Input params:       n/a                          */
+/* Output params:      milliseconds since midnight  */
+/* ************************************************ */
+unsigned int rtc_getTimeOfDayMs(void);
+
+/* ************************************************ */
+/* Method name:        rtc_getUptimeMs              */
+/* Method description: Time since rtc_init, not     */
+/*                     changed by rtc_setTimeOfDay  */
+/* Input params:       n/a                          */
+/* Output params:      milliseconds, wraps at 32    */
+/*                     bits (49 days)               */
+/* ************************************************ */
+unsigned int rtc_getUptimeMs(void);
+
+/* ************************************************ */
+/* Method name:        rtc_setAlarm                 */
+/* Method description: Program the alarm to wake    */
+/*                     the CPU before a time of day.*/
+/*                     The alarm fires on the last  */
+/*                     RTC_ALARM_STEP_MS step before*/
+/*                     it, the rest is left to a    */
+/*                     timer. It must be at least   */
+/*                     RTC_ALARM_STEP_MS ahead      */
+/* Input params:       uiTimeOfDayMs: ms since      */
+/*                     midnight                     */
+/* Output params:      n/a                          */
+/* ************************************************ */
+void rtc_setAlarm(unsigned int uiTimeOfDayMs);
+
+/* ************************************************ */
+/* Method name:        rtc_disableAlarm             */
+/* Method description: Disarm the alarm             */
+/* Input params:       n/a                          */
+/* Output params:      n/a                          */
+/* ************************************************ */
+void rtc_disableAlarm(void);
+
+/* ************************************************ */
+/* Method name:        RTC_IRQHandler               */
+/* Method description: Alarm interruption, disarms  */
+/*                     the alarm and calls the      */
+/*                     installed callback, which    */
+/*                     arms the next one            */
+/* Input params:       n/a                          */
+/* Output params:      n/a                          */
+/* ************************************************ */
+void RTC_IRQHandler(void);
+
+#endif /* SOURCES_RTC_H_ */
@@ -0,0 +1,287 @@
+/* ***************************************************************** */
+/* File name:        schedule.c                                      */
+/* File description: Daily temperature program. The RTC gives the    */
+/*                   time of day and its alarm wakes the CPU up to   */
+/*                   one RTC step (32.768s) before the next entry; a */
+/*                   one-shot timer waits the rest, so the entries   */
+/*                   run on time without polling the clock           */
+/* Author name:      Grupo 18 - Renato Pepe                          */
+/*                              Joao Victor Matoso                   */
+/* Creation date:    19oct2026                                       */
+/* Revision date:    19oct2026                                       */
+/* ***************************************************************** */
+
+#include "schedule.h"
+#include "rtc.h"
+#include "timer.h"
+#include "pid.h"
+#include "board.h"
+
+/* seconds in a day */
+#define SCHEDULE_DAY_S      (RTC_DAY_MS/1000U)
+
+/* daily program */
+schedule_entry_type scheduleTable[SCHEDULE_SIZE];
+
+/* time of day of the last check, entries in (last, now] are due */
+unsigned int uiScheduleLastCheckS = 0;
+
+/* waits the last RTC step before an entry */
+timer_entry_t scheduleTimer;
+
+/* ************************************************** */
+/* Method name:        schedule_isDue                 */
+/* Method description: Check if a time of day is in   */
+/*                     the interval (last, now],      */
+/*                     handling midnight              */
+/* Input params:       uiTimeS, uiLastS, uiNowS: s    */
+/* Output params:      1 if due, 0 if not             */
+/* ************************************************** */
+static unsigned char schedule_isDue(unsigned int uiTimeS, unsigned int uiLastS, unsigned int uiNowS)
+{
+    if(uiLastS <= uiNowS)
+        return (uiLastS < uiTimeS && uiTimeS <= uiNowS);
+
+    /* midnight passed since the last check */
+    return (uiLastS < uiTimeS || uiTimeS <= uiNowS);
+}
+
+/* ************************************************** */
+/* Method name:        schedule_run                   */
+/* Method description: Execute the action of an entry */
+/* Input params:       pEntry: entry to execute       */
+/* Output params:      n/a                            */
+/* ************************************************** */
+static void schedule_run(const schedule_entry_type *pEntry)
+{
+    switch(pEntry->ucAction){
+    case SCHEDULE_ACTION_PID_OFF:
+        pid_turnOnOff(0);
+        break;
+
+    case SCHEDULE_ACTION_PID_ON:
+        /* avoid reseting pid integral sum if it is already on */
+        if(!pid_isOn())
+            pid_turnOnOff(1);
+        break;
+
+    case SCHEDULE_ACTION_SETPOINT:
+        pid_setTemperatureSetpoint(pEntry->fSetpoint);
+        break;
+    }
+}
+
+/* ************************************************** */
+/* Method name:        schedule_timerCallback         */
+/* Method description: The one-shot timer reached the */
+/*                     next entry                     */
+/* Input params:       pvArg: not used                */
+/* Output params:      n/a                            */
+/* ************************************************** */
+static void schedule_timerCallback(void *pvArg)
+{
+    (void)pvArg;
+    schedule_update();
+}
+
+/* ************************************************** */
+/* Method name:        schedule_programAlarm          */
+/* Method description: Wake the CPU for the next entry*/
+/*                     after the given time: the RTC  */
+/*                     alarm if it is more than one   */
+/*                     RTC step away, the one-shot    */
+/*                     timer if not                   */
+/* Input params:       uiNowS: current time of day    */
+/* Output params:      n/a                            */
+/* ************************************************** */
+static void schedule_programAlarm(unsigned int uiNowS)
+{
+    unsigned int uiDeltaMs;
+    unsigned int uiNextDelta = SCHEDULE_DAY_S + 1;
+    unsigned int uiNextTimeS = 0;
+    unsigned char ucIndex;
+
+    for(ucIndex = 0; ucIndex < SCHEDULE_SIZE; ucIndex++){
+        if(SCHEDULE_ACTION_NONE != scheduleTable[ucIndex].ucAction){
+            unsigned int uiDelta = (scheduleTable[ucIndex].uiTimeOfDayS + SCHEDULE_DAY_S - uiNowS) % SCHEDULE_DAY_S;
+
+            /* an entry at the current second already ran, the next occurrence is tomorrow */
+            if(0 == uiDelta)
+                uiDelta = SCHEDULE_DAY_S;
+
+            if(uiDelta <= uiNextDelta){
+                uiNextDelta = uiDelta;
+                uiNextTimeS = scheduleTable[ucIndex].uiTimeOfDayS;
+            }
+        }
+    }
+
+    rtc_disableAlarm();
+    timer_stop(&scheduleTimer);
+
+    /* empty program: nothing is armed */
+    if(SCHEDULE_DAY_S < uiNextDelta)
+        return;
+
+    /* the entry at the current second already ran, the next occurrence is tomorrow */
+    uiDeltaMs = (uiNextTimeS * 1000U + RTC_DAY_MS - rtc_getTimeOfDayMs()) % RTC_DAY_MS;
+    if(0 == uiDeltaMs)
+        uiDeltaMs = RTC_DAY_MS;
+
+    if(RTC_ALARM_STEP_MS < uiDeltaMs)
+        rtc_setAlarm(uiNextTimeS * 1000U);
+    else
+        timer_startOneShot(&scheduleTimer, uiDeltaMs, schedule_timerCallback, 0);
+}
+
+/* ************************************************** */
+/* Method name:        schedule_check                 */
+/* Method description: Run the entries in (last check,*/
+/*                     now] and arm the wake-up for   */
+/*                     the next one (interruptions    */
+/*                     must be disabled)              */
+/* Input params:       n/a                            */
+/* Output params:      n/a                            */
+/* ************************************************** */
+static void schedule_check(void)
+{
+    unsigned int uiNowS = schedule_getClock();
+    unsigned char ucIndex;
+
+    if(uiNowS != uiScheduleLastCheckS){
+        for(ucIndex = 0; ucIndex < SCHEDULE_SIZE; ucIndex++){
+            if(SCHEDULE_ACTION_NONE != scheduleTable[ucIndex].ucAction
+                    && schedule_isDue(scheduleTable[ucIndex].uiTimeOfDayS, uiScheduleLastCheckS, uiNowS)){
+                schedule_run(&scheduleTable[ucIndex]);
+            }
+        }
+        uiScheduleLastCheckS = uiNowS;
+    }
+
+    /* always armed again: the alarm disarms itself and fires up to one RTC step early */
+    schedule_programAlarm(uiNowS);
+}
+
+/* ************************************************** */
+/* Method name:        schedule_init                  */
+/* Method description: Start the RTC and clear the    */
+/*                     daily program                  */
+/* Input params:       n/a                            */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void schedule_init(void)
+{
+    unsigned char ucIndex;
+
+    for(ucIndex = 0; ucIndex < SCHEDULE_SIZE; ucIndex++){
+        scheduleTable[ucIndex].ucAction = SCHEDULE_ACTION_NONE;
+        scheduleTable[ucIndex].uiTimeOfDayS = 0;
+        scheduleTable[ucIndex].fSetpoint = 0.0f;
+    }
+    uiScheduleLastCheckS = 0;
+
+    /* the clock starts at 00:00:00 until it is set */
+    rtc_init(schedule_update);
+}
+
+/* ************************************************** */
+/* Method name:        schedule_setClock              */
+/* Method description: Set the wall-clock time. The   */
+/*                     entries between the old and the*/
+/*                     new time are not triggered     */
+/* Input params:       uiTimeOfDayS: seconds since    */
+/*                     midnight                       */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void schedule_setClock(unsigned int uiTimeOfDayS)
+{
+    unsigned int uiPrimask = __get_PRIMASK();
+    __disable_irq();
+
+    uiTimeOfDayS %= SCHEDULE_DAY_S;
+    rtc_setTimeOfDay(uiTimeOfDayS);
+    uiScheduleLastCheckS = uiTimeOfDayS;
+    schedule_programAlarm(uiTimeOfDayS);
+
+    __set_PRIMASK(uiPrimask);
+}
+
+/* ************************************************** */
+/* Method name:        schedule_getClock              */
+/* Method description: Get the wall-clock time        */
+/* Input params:       n/a                            */
+/* Output params:      seconds since midnight         */
+/* ************************************************** */
+unsigned int schedule_getClock(void)
+{
+    return rtc_getTimeOfDayMs() / 1000;
+}
+
+/* ************************************************** */
+/* Method name:        schedule_setEntry              */
+/* Method description: Write an entry of the daily    */
+/*                     program                        */
+/* Input params:       ucIndex: 0 to SCHEDULE_SIZE-1  */
+/*                     uiTimeOfDayS: seconds since    */
+/*                     midnight                       */
+/*                     ucAction: SCHEDULE_ACTION_*,   */
+/*                     NONE clears the entry          */
+/*                     fSetpoint: new setpoint        */
+/* Output params:      1 if written, 0 if invalid     */
+/* ************************************************** */
+unsigned char schedule_setEntry(unsigned char ucIndex, unsigned int uiTimeOfDayS, unsigned char ucAction, float fSetpoint)
+{
+    unsigned int uiPrimask;
+
+    if(SCHEDULE_SIZE <= ucIndex || SCHEDULE_DAY_S <= uiTimeOfDayS || SCHEDULE_ACTION_SETPOINT < ucAction)
+        return 0;
+
+    uiPrimask = __get_PRIMASK();
+    __disable_irq();
+
+    /* the entries already due run first, a new entry at a past time waits for tomorrow */
+    schedule_check();
+
+    scheduleTable[ucIndex].uiTimeOfDayS = uiTimeOfDayS;
+    scheduleTable[ucIndex].fSetpoint = fSetpoint;
+    scheduleTable[ucIndex].ucAction = ucAction;
+    schedule_programAlarm(uiScheduleLastCheckS);
+
+    __set_PRIMASK(uiPrimask);
+    return 1;
+}
+
+/* ************************************************** */
+/* Method name:        schedule_getEntry              */
+/* Method description: Read an entry of the daily     */
+/*                     program                        */
+/* Input params:       ucIndex: 0 to SCHEDULE_SIZE-1  */
+/* Output params:      pointer to the entry, 0 if the */
+/*                     index is invalid               */
+/* ************************************************** */
+const schedule_entry_type *schedule_getEntry(unsigned char ucIndex)
+{
+    if(SCHEDULE_SIZE <= ucIndex)
+        return 0;
+    return &scheduleTable[ucIndex];
+}
+
+/* ************************************************** */
+/* Method name:        schedule_update                */
+/* Method description: Run the entries whose time was */
+/*                     reached since the last call    */
+/*                     and arm the wake-up for the    */
+/*                     next one. Called by the RTC    */
+/*                     alarm and the one-shot timer   */
+/* Input params:       n/a                            */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void schedule_update(void)
+{
+    unsigned int uiPrimask = __get_PRIMASK();
+    __disable_irq();
+
+    schedule_check();
+
+    __set_PRIMASK(uiPrimask);
+}
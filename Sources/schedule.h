@@ -0,0 +1,93 @@
+/* ***************************************************************** */
+/* File name:        schedule.h                                      */
+/* File description: Daily temperature program: a table of setpoint  */
+/*                   changes and PID on/off at wall-clock times      */
+/* Author name:      Grupo 18 - Renato Pepe                          */
+/*                              Joao Victor Matoso                   */
+/* Creation date:    19oct2026                                       */
+/* Revision date:    19oct2026                                       */
+/* ***************************************************************** */
+
+#ifndef SOURCES_SCHEDULE_H_
+#define SOURCES_SCHEDULE_H_
+
+/* number of entries in the daily program */
+#define SCHEDULE_SIZE               8U
+
+/* actions of a schedule entry */
+#define SCHEDULE_ACTION_NONE        0U  // empty entry
+#define SCHEDULE_ACTION_PID_OFF     1U
+#define SCHEDULE_ACTION_PID_ON      2U
+#define SCHEDULE_ACTION_SETPOINT    3U
+
+typedef struct schedule_entry_type {
+    unsigned int uiTimeOfDayS;      // seconds since midnight
+    float fSetpoint;                // used by SCHEDULE_ACTION_SETPOINT
+    unsigned char ucAction;
+} schedule_entry_type;
+
+/* ************************************************** */
+/* Method name:        schedule_init                  */
+/* Method description: Start the RTC and clear the    */
+/*                     daily program                  */
+/* Input params:       n/a                            */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void schedule_init(void);
+
+/* ************************************************** */
+/* Method name:        schedule_setClock              */
+/* Method description: Set the wall-clock time. The   */
+/*                     entries between the old and the*/
+/*                     new time are not triggered     */
+/* Input params:       uiTimeOfDayS: seconds since    */
+/*                     midnight                       */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void schedule_setClock(unsigned int uiTimeOfDayS);
+
+/* ************************************************** */
+/* Method name:        schedule_getClock              */
+/* Method description: Get the wall-clock time        */
+/* Input params:       n/a                            */
+/* Output params:      seconds since midnight         */
+/* ************************************************** */
+unsigned int schedule_getClock(void);
+
+/* ************************************************** */
+/* Method name:        schedule_setEntry              */
+/* Method description: Write an entry of the daily    */
+/*                     program                        */
+/* Input params:       ucIndex: 0 to SCHEDULE_SIZE-1  */
+/*                     uiTimeOfDayS: seconds since    */
+/*                     midnight                       */
+/*                     ucAction: SCHEDULE_ACTION_*,   */
+/*                     NONE clears the entry          */
+/*                     fSetpoint: new setpoint        */
+/* Output params:      1 if written, 0 if invalid     */
+/* ************************************************** */
+unsigned char schedule_setEntry(unsigned char ucIndex, unsigned int uiTimeOfDayS, unsigned char ucAction, float fSetpoint);
+
+/* ************************************************** */
+/* Method name:        schedule_getEntry              */
+/* Method description: Read an entry of the daily     */
+/*                     program                        */
+/* Input params:       ucIndex: 0 to SCHEDULE_SIZE-1  */
+/* Output params:      pointer to the entry, 0 if the */
+/*                     index is invalid               */
+/* ************************************************** */
+const schedule_entry_type *schedule_getEntry(unsigned char ucIndex);
+
+/* ************************************************** */
+/* Method name:        schedule_update                */
+/* Method description: Run the entries whose time was */
+/*                     reached since the last call    */
+/*                     and arm the wake-up for the    */
+/*                     next one. Called by the RTC    */
+/*                     alarm and the one-shot timer   */
+/* Input params:       n/a                            */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void schedule_update(void);
+
+#endif /* SOURCES_SCHEDULE_H_ */
@@ -9,68 +9,151 @@
 
 #include "tacometro.h"
 #include "board.h"
-#include "util.h"
+
+/* edge timestamp buffer, must be a power of 2 and hold TACHOMETER_AVERAGE_REVS revolutions */
+#define TACHOMETER_EDGE_BUFFER_SIZE     32U
+#define TACHOMETER_EDGE_BUFFER_MASK     (TACHOMETER_EDGE_BUFFER_SIZE - 1U)
+
+/* speed[0.1 RPM] = TACHOMETER_DECIRPM_CONSTANT * revolutions / counts (fits 32 bits up to 5 revolutions) */
+#define TACHOMETER_DECIRPM_CONSTANT     (60U*10U*TACHOMETER_TPM_CLOCK_HZ)
+
+/* stall timeout converted to TPM0 counts */
+#define TACHOMETER_STALL_COUNTS         (TACHOMETER_STALL_TIMEOUT_MS*(TACHOMETER_TPM_CLOCK_HZ/1000U))
 
 /* global variables */
 /* stores the current RPM data from the tachometer */
 unsigned int uiTachometerData = 0;
+/* stores the current speed in tenths of RPM */
+unsigned int uiTachometerDeciRpm = 0;
+/* 1 while no edge is seen for TACHOMETER_STALL_TIMEOUT_MS */
+unsigned char ucTachometerStalled = 1;
+
+/* edge timestamps (TPM0 counts extended to 32 bits), written by the capture interruption */
+volatile unsigned int uiTachometerEdges[TACHOMETER_EDGE_BUFFER_SIZE];
+/* total of edges captured, the next one is stored at uiTachometerEdgeCount & MASK */
+volatile unsigned int uiTachometerEdgeCount = 0;
+/* value of uiTachometerEdgeCount when the fan started rotating (edges before it are discarded) */
+unsigned int uiTachometerFirstEdge = 0;
+/* TPM0 overflows, the upper 16 bits of the timestamps */
+volatile unsigned int uiTachometerOverflows = 0;
 
 /* **************************************************** */
 /* Method name:        tachometer_init                  */
 /* Method description: Initialize the Mclab2 tachometer */
+/*                     in input capture mode (TPM0 CH2  */
+/*                     timestamps every tachometer edge)*/
 /* Input params:       n/a                              */
 /* Output params:      n/a                              */
 /* **************************************************** */
 void tachometer_init(void){
     /* release clock to TPM0 */
-    SIM_SCGC6 |= 1<<24;
+    SIM_SCGC6 |= SIM_SCGC6_TPM0_MASK;
 
-    /* set clock division factor to 1 */
-    TPM0_SC &= ~(1<<0);
-    TPM0_SC &= ~(1<<1);
-    TPM0_SC &= ~(1<<2);
+    /* set the TPM clock source to MCGFLLCLK (40MHz), shared with the PWM module */
+    SIM_SOPT2 = (SIM_SOPT2 & ~SIM_SOPT2_TPMSRC_MASK) | SIM_SOPT2_TPMSRC(1);
 
     /* release PORT E clock */
-    SIM_SCGC5 |= 1<<13;
+    SIM_SCGC5 |= SIM_SCGC5_PORTE_MASK;
 
-    /* set the PTE29 MUX to FTM_CLKIN0 (alt4 = 100) */
-    PORTE_PCR29 &= ~(1<<8);
-    PORTE_PCR29 &= ~(1<<9);
-    PORTE_PCR29 |= 1<<10;
+    /* set the PTE29 MUX to TPM0_CH2 (alt3 = 011) */
+    PORTE_PCR29 = (PORTE_PCR29 & ~PORT_PCR_MUX_MASK) | PORT_PCR_MUX(3);
 
-    /* select which external pin should be used as input (TPM0 - TPM_CLKIN0) */
-    SIM_SOPT4 &= ~(1<<24);
+    /* stop the counter while it is configured */
+    TPM0_SC = 0;
+    TPM0_CNT = 0;
+    TPM0_MOD = 0xFFFF;
 
-    /* set count mode to up-counting */
-    TPM0_SC &= ~(1<<5);
+    /* channel 2 in input capture mode on rising edges, with interruption */
+    TPM0_C2SC = TPM_CnSC_ELSA_MASK | TPM_CnSC_CHIE_MASK;
+
+    /* clear pending flags and enable the interruption in the NVIC */
+    TPM0_STATUS = TPM_STATUS_CH2F_MASK | TPM_STATUS_TOF_MASK;
+    NVIC_EnableIRQ(TPM0_IRQn);
+
+    /* up-counting on the internal clock divided by 32, with overflow interruption */
+    TPM0_SC = TPM_SC_CMOD(1) | TPM_SC_PS(5) | TPM_SC_TOIE_MASK;
+}
 
-    /* set CMOD to external counter */
-    TPM0_SC |= 1<<4;
-    TPM0_SC &= ~(1<<3);
+/* ************************************************************ */
+/* Method name:        TPM0_IRQHandler                          */
+/* Method description: Timestamps each tachometer edge (CH2     */
+/*                     capture) and extends the counter to 32   */
+/*                     bits (overflow)                          */
+/* Input params:       n/a                                      */
+/* Output params:      n/a                                      */
+/* ************************************************************ */
+void TPM0_IRQHandler(void){
+    if(TPM0_STATUS & TPM_STATUS_CH2F_MASK){
+        unsigned int uiCapture = TPM0_C2V;
+        unsigned int uiOverflows = uiTachometerOverflows;
+
+        /* an overflow still pending with a low capture value happened before this edge */
+        if((TPM0_STATUS & TPM_STATUS_TOF_MASK) && 0x8000 > uiCapture){
+            uiOverflows++;
+        }
+        TPM0_STATUS = TPM_STATUS_CH2F_MASK;
+
+        uiTachometerEdges[uiTachometerEdgeCount & TACHOMETER_EDGE_BUFFER_MASK] = (uiOverflows << 16) | uiCapture;
+        uiTachometerEdgeCount++;
+    }
+
+    if(TPM0_STATUS & TPM_STATUS_TOF_MASK){
+        TPM0_STATUS = TPM_STATUS_TOF_MASK;
+        uiTachometerOverflows++;
+    }
 }
 
 /* *************************************************************************************** */
-/* Method name:        tachometer_readSensor                                               */
-/* Method description: Reads the data from the tachometer and                              */
-/*                     return its value converted to RPMs                                  */
-/* Input params:       uiPeriod -> period of the window in ms (to convert pulses into RPM) */
-/* Output params:      unsigned int -> return the read value in RPMs                       */
+/* Method name:        tachometer_update                                                   */
+/* Method description: Computes the speed from the averaged period of the last captured    */
+/*                     revolutions and checks for a stall. To be called periodically       */
+/* Input params:       n/a                                                                 */
+/* Output params:      unsigned int -> return the speed in RPMs                            */
 /* *************************************************************************************** */
-unsigned int tachometer_readSensor(unsigned int uiPeriod){
-
-    /* Access counter data */
-    unsigned int uiCounterAux = TPM0_CNT;
-
-    /* Compute rotational speed in RPM to the given period */
-    unsigned int uiRPMValue = (uiCounterAux*1000*60)/(7*uiPeriod);
-
-    /* reset TPM0 counter */
-    TPM0_CNT = 0x0;
+unsigned int tachometer_update(void){
+    unsigned int uiNow, uiEdgeCount, uiNewest, uiOldest = 0, uiRevolutions = 0;
+
+    /* take a consistent snapshot of the timestamps written by the interruption */
+    unsigned int uiPrimask = __get_PRIMASK();
+    __disable_irq();
+
+    uiNow = TPM0_CNT;
+    if((TPM0_STATUS & TPM_STATUS_TOF_MASK) && 0x8000 > uiNow){
+        uiNow |= (uiTachometerOverflows + 1) << 16;
+    }else{
+        uiNow |= uiTachometerOverflows << 16;
+    }
+
+    uiEdgeCount = uiTachometerEdgeCount - uiTachometerFirstEdge;
+    uiNewest = uiTachometerEdges[(uiTachometerEdgeCount - 1) & TACHOMETER_EDGE_BUFFER_MASK];
+
+    /* whole revolutions captured (periods between the stored edges), averaging up to TACHOMETER_AVERAGE_REVS */
+    if(0 < uiEdgeCount){
+        uiRevolutions = (uiEdgeCount - 1) / TACHOMETER_PULSES_PER_REV;
+        if(TACHOMETER_AVERAGE_REVS < uiRevolutions){
+            uiRevolutions = TACHOMETER_AVERAGE_REVS;
+        }
+        uiOldest = uiTachometerEdges[(uiTachometerEdgeCount - 1 - uiRevolutions*TACHOMETER_PULSES_PER_REV) & TACHOMETER_EDGE_BUFFER_MASK];
+    }
+
+    __set_PRIMASK(uiPrimask);
+
+    if(0 == uiEdgeCount || TACHOMETER_STALL_COUNTS < uiNow - uiNewest){
+        /* no edge for too long: fan is stopped, discard the old edges */
+        uiTachometerFirstEdge += uiEdgeCount;
+        ucTachometerStalled = 1;
+        uiTachometerDeciRpm = 0;
+    }else if(0 < uiRevolutions){
+        /* integer only: one division over the averaged revolution period */
+        uiTachometerDeciRpm = (TACHOMETER_DECIRPM_CONSTANT * uiRevolutions) / (uiNewest - uiOldest);
+        ucTachometerStalled = 0;
+    }
+    /* else: keeps the previous value until a whole revolution is captured */
 
     /* update value in the global variable */
-    uiTachometerData = uiRPMValue;
+    uiTachometerData = uiTachometerDeciRpm / 10;
 
-    return uiRPMValue;
+    return uiTachometerData;
 }
 
 /* ************************************************************ */
@@ -84,3 +167,24 @@ unsigned int tachometer_getSpeed() {
     return uiTachometerData;
 }
 
+/* ************************************************************ */
+/* Method name:        tachometer_getSpeedDeciRpm               */
+/* Method description: Return the last computed value for the   */
+/*                     tachometer speed in tenths of RPM        */
+/* Input params:       n/a                                      */
+/* Output params:      unsigned int -> speed in 0.1 RPM         */
+/* ************************************************************ */
+unsigned int tachometer_getSpeedDeciRpm() {
+    return uiTachometerDeciRpm;
+}
+
+/* ************************************************************ */
+/* Method name:        tachometer_isStalled                     */
+/* Method description: Return if no tachometer edge was seen in */
+/*                     the last TACHOMETER_STALL_TIMEOUT_MS     */
+/* Input params:       n/a                                      */
+/* Output params:      1 if stopped/stalled, 0 if rotating      */
+/* ************************************************************ */
+unsigned char tachometer_isStalled() {
+    return ucTachometerStalled;
+}
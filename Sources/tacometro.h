@@ -11,9 +11,23 @@
 #ifndef SOURCES_TACOMETRO_H_
 #define SOURCES_TACOMETRO_H_
 
+/* tachometer pulses for each fan revolution */
+#define TACHOMETER_PULSES_PER_REV       7U
+
+/* TPM0 counter clock: MCGFLLCLK (40MHz) / 32 = 1.25MHz (0.8us per count) */
+#define TACHOMETER_TPM_CLOCK_HZ         1250000U
+
+/* max number of revolutions averaged in each speed computation */
+#define TACHOMETER_AVERAGE_REVS         4U
+
+/* no edge for this long means the fan is stopped or stalled */
+#define TACHOMETER_STALL_TIMEOUT_MS     500U
+
 /* **************************************************** */
 /* Method name:        tachometer_init                  */
 /* Method description: Initialize the Mclab2 tachometer */
+/*                     in input capture mode (TPM0 CH2  */
+/*                     timestamps every tachometer edge)*/
 /* Input params:       n/a                              */
 /* Output params:      n/a                              */
 /* **************************************************** */
@@ -21,13 +35,13 @@ void tachometer_init(void);
 
 
 /* *************************************************************************************** */
-/* Method name:        tachometer_readSensor                                               */
-/* Method description: Reads the data from the tachometer and                              */
-/*                     return its value converted to RPMs                                  */
-/* Input params:       uiPeriod -> period of the window in ms (to convert pulses into RPM) */
-/* Output params:      unsigned int -> return the read value in RPMs                       */
+/* Method name:        tachometer_update                                                   */
+/* Method description: Computes the speed from the averaged period of the last captured    */
+/*                     revolutions and checks for a stall. To be called periodically       */
+/* Input params:       n/a                                                                 */
+/* Output params:      unsigned int -> return the speed in RPMs                            */
 /* *************************************************************************************** */
-unsigned int tachometer_readSensor(unsigned int uiPeriod);
+unsigned int tachometer_update(void);
 
 
 /* ************************************************************ */
@@ -39,4 +53,35 @@ unsigned int tachometer_readSensor(unsigned int uiPeriod);
 /* ************************************************************ */
 unsigned int tachometer_getSpeed();
 
+
+/* ************************************************************ */
+/* Method name:        tachometer_getSpeedDeciRpm               */
+/* Method description: Return the last computed value for the   */
+/*                     tachometer speed in tenths of RPM        */
+/* Input params:       n/a                                      */
+/* Output params:      unsigned int -> speed in 0.1 RPM         */
+/* ************************************************************ */
+unsigned int tachometer_getSpeedDeciRpm();
+
+
+/* ************************************************************ */
+/* Method name:        tachometer_isStalled                     */
+/* Method description: Return if no tachometer edge was seen in */
+/*                     the last TACHOMETER_STALL_TIMEOUT_MS     */
+/* Input params:       n/a                                      */
+/* Output params:      1 if stopped/stalled, 0 if rotating      */
+/* ************************************************************ */
+unsigned char tachometer_isStalled();
+
+
+/* ************************************************************ */
+/* Method name:        TPM0_IRQHandler                          */
+/* Method description: Timestamps each tachometer edge (CH2     */
+/*                     capture) and extends the counter to 32   */
+/*                     bits (overflow)                          */
+/* Input params:       n/a                                      */
+/* Output params:      n/a                                      */
+/* ************************************************************ */
+void TPM0_IRQHandler(void);
+
 #endif /* SOURCES_TACOMETRO_H_ */
@@ -0,0 +1,266 @@
+/* ***************************************************************** */
+/* File name:        telemetry.c                                     */
+/* File description: Compressed telemetry stream. The interruption   */
+/*                   puts integer samples in a ring, the main loop   */
+/*                   encodes them as deltas in zig-zag varints, so a */
+/*                   slow changing channel costs one byte per sample */
+/*                   instead of four                                 */
+/* Author name:      Grupo 18 - Renato Pepe                          */
+/*                              Joao Victor Matoso                   */
+/* Creation date:    19oct2026                                       */
+/* Revision date:    19oct2026                                       */
+/* ***************************************************************** */
+
+#include "telemetry.h"
+#include "binaryProtocol.h"
+#include "board.h"
+#include "pid.h"
+#include "aquecedorECooler.h"
+#include "tacometro.h"
+
+/* samples kept until the main loop sends them, power of 2 */
+#define TELEMETRY_BUFFER_SIZE       16U
+
+/* FLAGS and COUNT */
+#define TELEMETRY_HEADER_SIZE       2U
+
+/* longest varint of a 32 bit value */
+#define TELEMETRY_VARINT_MAX        5U
+
+/* most samples in one frame, the COUNT of a frame of small deltas */
+#define TELEMETRY_MAX_FRAME_SAMPLES 16U
+
+typedef struct telemetry_sample_type {
+    int iValue[TELEMETRY_CHANNELS];
+} telemetry_sample_type;
+
+/* ring written by the interruption, read by the main loop */
+telemetry_sample_type telemetryBuffer[TELEMETRY_BUFFER_SIZE];
+volatile unsigned char ucTelemetryHead = 0;
+volatile unsigned char ucTelemetryTail = 0;
+volatile unsigned char ucTelemetryGap = 0;     // samples were dropped, the next frame is a keyframe
+
+volatile unsigned char ucTelemetryMode = TELEMETRY_MODE_OFF;
+
+/* last sample sent, base of the deltas */
+telemetry_sample_type telemetryLast;
+unsigned char ucTelemetrySeq = 0;
+unsigned char ucTelemetryFramesToKey = 0;
+
+/* statistics */
+unsigned int uiTelemetrySamples = 0;
+unsigned int uiTelemetryBytes = 0;
+unsigned int uiTelemetryRawBytes = 0;
+volatile unsigned int uiTelemetryDropped = 0;
+
+/* ************************************************** */
+/* Method name:        telemetry_scale                */
+/* Method description: Round a scaled value to int    */
+/* Input params:       fValue: value                  */
+/*                     fScale: units per integer step */
+/* Output params:      rounded value                  */
+/* ************************************************** */
+static int telemetry_scale(float fValue, float fScale)
+{
+    fValue *= fScale;
+    return (int)(fValue + ((0.0f > fValue) ? -0.5f : 0.5f));
+}
+
+/* ************************************************** */
+/* Method name:        telemetry_putVarint            */
+/* Method description: Write a signed value as a      */
+/*                     zig-zag varint                 */
+/* Input params:       pucOut: destination, room for  */
+/*                     TELEMETRY_VARINT_MAX bytes     */
+/*                     iValue: value                  */
+/* Output params:      bytes written                  */
+/* ************************************************** */
+static unsigned char telemetry_putVarint(unsigned char *pucOut, int iValue)
+{
+    /* small magnitudes of both signs become small unsigned values */
+    unsigned int uiValue = ((unsigned int)iValue << 1) ^ (unsigned int)(iValue >> 31);
+    unsigned char ucLength = 0;
+
+    while(0x80U <= uiValue){
+        pucOut[ucLength++] = (unsigned char)(uiValue | 0x80U);
+        uiValue >>= 7;
+    }
+    pucOut[ucLength++] = (unsigned char)uiValue;
+    return ucLength;
+}
+
+/* ************************************************** */
+/* Method name:        telemetry_putRaw               */
+/* Method description: Write a value as int32 little  */
+/*                     endian                         */
+/* Input params:       pucOut: destination            */
+/*                     iValue: value                  */
+/* Output params:      bytes written                  */
+/* ************************************************** */
+static unsigned char telemetry_putRaw(unsigned char *pucOut, int iValue)
+{
+    unsigned int uiValue = (unsigned int)iValue;
+
+    pucOut[0] = (unsigned char)uiValue;
+    pucOut[1] = (unsigned char)(uiValue >> 8);
+    pucOut[2] = (unsigned char)(uiValue >> 16);
+    pucOut[3] = (unsigned char)(uiValue >> 24);
+    return 4;
+}
+
+/* ************************************************** */
+/* Method name:        telemetry_setMode              */
+/* Method description: Start or stop the stream, the  */
+/*                     next frame is a keyframe       */
+/* Input params:       ucMode: TELEMETRY_MODE_*       */
+/* Output params:      1 if set, 0 if unknown mode    */
+/* ************************************************** */
+unsigned char telemetry_setMode(unsigned char ucMode)
+{
+    unsigned int uiPrimask;
+
+    if(TELEMETRY_MODE_DELTA < ucMode)
+        return 0;
+
+    uiPrimask = __get_PRIMASK();
+    __disable_irq();
+    ucTelemetryMode = ucMode;
+    ucTelemetryTail = ucTelemetryHead;
+    ucTelemetryGap = 0;
+    __set_PRIMASK(uiPrimask);
+
+    ucTelemetryFramesToKey = 0;
+    return 1;
+}
+
+/* ************************************************** */
+/* Method name:        telemetry_getMode              */
+/* Method description: Current mode                   */
+/* Input params:       n/a                            */
+/* Output params:      TELEMETRY_MODE_*               */
+/* ************************************************** */
+unsigned char telemetry_getMode(void)
+{
+    return ucTelemetryMode;
+}
+
+/* ************************************************** */
+/* Method name:        telemetry_sample               */
+/* Method description: Store a sample of the channels.*/
+/*                     Called from the control loop   */
+/*                     interruption                   */
+/* Input params:       fFilteredTemperature: filtered */
+/*                     temperature of this period     */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void telemetry_sample(float fFilteredTemperature)
+{
+    unsigned char ucNext = (ucTelemetryHead + 1) & (TELEMETRY_BUFFER_SIZE - 1);
+    telemetry_sample_type *pSample;
+
+    if(TELEMETRY_MODE_OFF == ucTelemetryMode)
+        return;
+
+    /* the main loop is late, the deltas lose their base */
+    if(ucNext == ucTelemetryTail){
+        uiTelemetryDropped++;
+        ucTelemetryGap = 1;
+        return;
+    }
+
+    pSample = &telemetryBuffer[ucTelemetryHead];
+    pSample->iValue[0] = telemetry_scale(fFilteredTemperature, 100.0f);
+    pSample->iValue[1] = telemetry_scale(pid_getTemperatureSetpoint(), 100.0f);
+    pSample->iValue[2] = telemetry_scale(getDutyCycleHeater(), 1000.0f);
+    pSample->iValue[3] = telemetry_scale(getDutyCycleCooler(), 1000.0f);
+    pSample->iValue[4] = (int)tachometer_getSpeedDeciRpm();
+    ucTelemetryHead = ucNext;
+}
+
+/* ************************************************** */
+/* Method name:        telemetry_update               */
+/* Method description: Send the waiting samples when  */
+/*                     there are enough for a frame.  */
+/*                     Called from the main loop      */
+/* Input params:       n/a                            */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void telemetry_update(void)
+{
+    unsigned char ucPayload[BINPROTO_MAX_PAYLOAD];
+    unsigned char ucRaw = (TELEMETRY_MODE_RAW == ucTelemetryMode);
+    unsigned char ucSampleMax = ucRaw ? 4U * TELEMETRY_CHANNELS : TELEMETRY_VARINT_MAX * TELEMETRY_CHANNELS;
+    unsigned char ucWaiting = (ucTelemetryHead - ucTelemetryTail) & (TELEMETRY_BUFFER_SIZE - 1);
+    unsigned char ucLength = TELEMETRY_HEADER_SIZE;
+    unsigned char ucCount = 0;
+    unsigned char ucChannel;
+    unsigned int uiPrimask;
+
+    if(TELEMETRY_MODE_OFF == ucTelemetryMode || TELEMETRY_FRAME_SAMPLES > ucWaiting)
+        return;
+
+    uiPrimask = __get_PRIMASK();
+    __disable_irq();
+    if(ucTelemetryGap){
+        ucTelemetryGap = 0;
+        ucTelemetryFramesToKey = 0;
+    }
+    __set_PRIMASK(uiPrimask);
+
+    ucPayload[0] = 0;
+    if(ucRaw)
+        ucPayload[0] |= TELEMETRY_FLAG_RAW;
+    if(0 == ucTelemetryFramesToKey){
+        ucPayload[0] |= TELEMETRY_FLAG_KEYFRAME;
+        ucTelemetryFramesToKey = TELEMETRY_KEYFRAME_PERIOD;
+    }
+    ucTelemetryFramesToKey--;
+
+    /* as many samples as fit even if every value takes its longest encoding */
+    while(ucWaiting && TELEMETRY_MAX_FRAME_SAMPLES > ucCount && BINPROTO_MAX_PAYLOAD - ucLength >= ucSampleMax){
+        const telemetry_sample_type *pSample = &telemetryBuffer[ucTelemetryTail];
+
+        for(ucChannel = 0; ucChannel < TELEMETRY_CHANNELS; ucChannel++){
+            int iValue = pSample->iValue[ucChannel];
+
+            if(ucRaw)
+                ucLength += telemetry_putRaw(&ucPayload[ucLength], iValue);
+            else if(0 == ucCount && (ucPayload[0] & TELEMETRY_FLAG_KEYFRAME))
+                ucLength += telemetry_putVarint(&ucPayload[ucLength], iValue);
+            else
+                ucLength += telemetry_putVarint(&ucPayload[ucLength], iValue - telemetryLast.iValue[ucChannel]);
+            telemetryLast.iValue[ucChannel] = iValue;
+        }
+
+        ucTelemetryTail = (ucTelemetryTail + 1) & (TELEMETRY_BUFFER_SIZE - 1);
+        ucWaiting--;
+        ucCount++;
+    }
+    ucPayload[1] = ucCount;
+
+    binaryProtocol_sendFrame(BINPROTO_CMD_TELEMETRY, ucTelemetrySeq++, ucPayload, ucLength);
+
+    uiTelemetrySamples += ucCount;
+    uiTelemetryBytes += ucLength;
+    uiTelemetryRawBytes += TELEMETRY_HEADER_SIZE + 4U * TELEMETRY_CHANNELS * ucCount;
+}
+
+/* ************************************************** */
+/* Method name:        telemetry_getStatistics        */
+/* Method description: Read the stream counters       */
+/* Input params:       puiSamples: samples sent       */
+/*                     puiBytes: payload bytes sent   */
+/*                     puiRawBytes: payload bytes the */
+/*                     same samples take in raw mode  */
+/*                     puiDropped: samples lost while */
+/*                     the buffer was full            */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void telemetry_getStatistics(unsigned int *puiSamples, unsigned int *puiBytes,
+                             unsigned int *puiRawBytes, unsigned int *puiDropped)
+{
+    *puiSamples = uiTelemetrySamples;
+    *puiBytes = uiTelemetryBytes;
+    *puiRawBytes = uiTelemetryRawBytes;
+    *puiDropped = uiTelemetryDropped;
+}
@@ -0,0 +1,104 @@
+/* ***************************************************************** */
+/* File name:        telemetry.h                                     */
+/* File description: Compressed telemetry stream. The control loop   */
+/*                   samples the channels every 100 ms and the main  */
+/*                   loop sends them in unsolicited binary frames    */
+/*                   (CMD BINPROTO_CMD_TELEMETRY, SEQ counts the     */
+/*                   telemetry frames so the host sees a lost one).  */
+/*                   Payload:                                        */
+/*                                                                   */
+/*   FLAGS | COUNT | COUNT samples of TELEMETRY_CHANNELS values      */
+/*                                                                   */
+/*                   FLAGS bit 0: keyframe, bit 1: raw. Raw values   */
+/*                   are int32 little endian. Otherwise each value   */
+/*                   is a zig-zag varint (7 bits per byte, low bits  */
+/*                   first, bit 7 set when more bytes follow) of the */
+/*                   difference to the same channel in the previous  */
+/*                   sample; the first sample of a keyframe is the   */
+/*                   absolute value. A host decodes a frame after a  */
+/*                   gap only from the next keyframe. Channels:      */
+/*                                                                   */
+/*   0 filtered temperature 0.01 C    3 cooler duty   0.1 %          */
+/*   1 setpoint             0.01 C    4 cooler speed  0.1 RPM        */
+/*   2 heater duty          0.1 %                                    */
+/*                                                                   */
+/* Author name:      Grupo 18 - Renato Pepe                          */
+/*                              Joao Victor Matoso                   */
+/* Creation date:    19oct2026                                       */
+/* Revision date:    19oct2026                                       */
+/* ***************************************************************** */
+
+#ifndef SOURCES_TELEMETRY_H_
+#define SOURCES_TELEMETRY_H_
+
+/* values in each sample */
+#define TELEMETRY_CHANNELS          5U
+
+/* modes, set with #sj<mode>; */
+#define TELEMETRY_MODE_OFF          0U
+#define TELEMETRY_MODE_RAW          1U
+#define TELEMETRY_MODE_DELTA        2U
+
+/* FLAGS of the payload */
+#define TELEMETRY_FLAG_KEYFRAME     0x01U
+#define TELEMETRY_FLAG_RAW          0x02U
+
+/* a frame is sent once this many samples are waiting */
+#define TELEMETRY_FRAME_SAMPLES     5U
+
+/* every this many frames one is a keyframe */
+#define TELEMETRY_KEYFRAME_PERIOD   10U
+
+/* ************************************************** */
+/* Method name:        telemetry_setMode              */
+/* Method description: Start or stop the stream, the  */
+/*                     next frame is a keyframe       */
+/* Input params:       ucMode: TELEMETRY_MODE_*       */
+/* Output params:      1 if set, 0 if unknown mode    */
+/* ************************************************** */
+unsigned char telemetry_setMode(unsigned char ucMode);
+
+/* ************************************************** */
+/* Method name:        telemetry_getMode              */
+/* Method description: Current mode                   */
+/* Input params:       n/a                            */
+/* Output params:      TELEMETRY_MODE_*               */
+/* ************************************************** */
+unsigned char telemetry_getMode(void);
+
+/* ************************************************** */
+/* Method name:        telemetry_sample               */
+/* Method description: Store a sample of the channels.*/
+/*                     Called from the control loop   */
+/*                     interruption                   */
+/* Input params:       fFilteredTemperature: filtered */
+/*                     temperature of this period     */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void telemetry_sample(float fFilteredTemperature);
+
+/* ************************************************** */
+/* Method name:        telemetry_update               */
+/* Method description: Send the waiting samples when  */
+/*                     there are enough for a frame.  */
+/*                     Called from the main loop      */
+/* Input params:       n/a                            */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void telemetry_update(void);
+
+/* ************************************************** */
+/* Method name:        telemetry_getStatistics        */
+/* Method description: Read the stream counters       */
+/* Input params:       puiSamples: samples sent       */
+/*                     puiBytes: payload bytes sent   */
+/*                     puiRawBytes: payload bytes the */
+/*                     same samples take in raw mode  */
+/*                     puiDropped: samples lost while */
+/*                     the buffer was full            */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void telemetry_getStatistics(unsigned int *puiSamples, unsigned int *puiBytes,
+                             unsigned int *puiRawBytes, unsigned int *puiDropped);
+
+#endif /* SOURCES_TELEMETRY_H_ */
@@ -1,100 +1,240 @@
 /* ***************************************************************** */
 /* File name:        timer.c                                         */
-/* File description: Implements methods for a timer to trigger the   */
-/*                   PID control on/off                              */
+/* File description: Implements the software timer service. Running  */
+/*                   timers are kept in a list sorted by expiration, */
+/*                   each one storing only the ticks after the       */
+/*                   previous one, so a tick just decrements the head*/
 /* Author name:      Grupo 18 - Renato Pepe                          */
 /*                              Joao Victor Matoso                   */
 /* Creation date:    18jun2021                                       */
-/* Revision date:    18jun2021                                       */
+/* Revision date:    19oct2026                                       */
 /* ***************************************************************** */
 
 #include "timer.h"
-#include "pid.h"
+#include "board.h"
 
-timer_t timer;
+/* period of the tick in ms */
+unsigned int uiTimerPeriodMs;
+
+/* running timers sorted by expiration (delta list) */
+timer_entry_t *pTimerList = 0;
+
+/* **************************************************************** */
+/* Method name:        timer_msToTicks                              */
+/* Method description: Convert a time to ticks, rounding up. The    */
+/*                     tick running at the start is already partly  */
+/*                     elapsed, so N ticks take (N-1..N) periods    */
+/* Input params:       uiTimeMs: time in ms                         */
+/* Output params:      ticks, at least 1                            */
+/* **************************************************************** */
+static unsigned int timer_msToTicks(unsigned int uiTimeMs) {
+    unsigned int uiTicks = (uiTimeMs + uiTimerPeriodMs - 1) / uiTimerPeriodMs;
+
+    if(0 == uiTicks)
+        return 1;
+    return uiTicks;
+}
+
+/* **************************************************************** */
+/* Method name:        timer_insert                                 */
+/* Method description: Insert a timer in the delta list             */
+/*                     (interruptions must be disabled)             */
+/* Input params:       pTimer: timer storage                        */
+/*                     uiTicks: ticks from now until expiration     */
+/* Output params:      n/a                                          */
+/* **************************************************************** */
+static void timer_insert(timer_entry_t *pTimer, unsigned int uiTicks) {
+    timer_entry_t **ppNode = &pTimerList;
+
+    /* walk the list consuming the deltas of the timers that expire before this one */
+    while(*ppNode && (*ppNode)->uiDeltaTicks <= uiTicks) {
+        uiTicks -= (*ppNode)->uiDeltaTicks;
+        ppNode = &(*ppNode)->pNext;
+    }
+
+    /* the next timer now expires relative to this one */
+    if(*ppNode)
+        (*ppNode)->uiDeltaTicks -= uiTicks;
+
+    pTimer->uiDeltaTicks = uiTicks;
+    pTimer->pNext = *ppNode;
+    pTimer->ucRunning = 1;
+    *ppNode = pTimer;
+}
+
+/* **************************************************************** */
+/* Method name:        timer_remove                                 */
+/* Method description: Remove a timer from the delta list, if there */
+/*                     (interruptions must be disabled)             */
+/* Input params:       pTimer: timer storage                        */
+/* Output params:      n/a                                          */
+/* **************************************************************** */
+static void timer_remove(timer_entry_t *pTimer) {
+    timer_entry_t **ppNode = &pTimerList;
+
+    while(*ppNode && *ppNode != pTimer)
+        ppNode = &(*ppNode)->pNext;
+
+    if(*ppNode) {
+        /* give the remaining ticks to the next timer */
+        if(pTimer->pNext)
+            pTimer->pNext->uiDeltaTicks += pTimer->uiDeltaTicks;
+        *ppNode = pTimer->pNext;
+    }
+    pTimer->ucRunning = 0;
+}
+
+/* **************************************************************** */
+/* Method name:        timer_start                                  */
+/* Method description: Common part of one-shot and periodic starts  */
+/* Input params:       pTimer: timer storage                        */
+/*                     uiTimeMs: time until the first expiration    */
+/*                     uiPeriodTicks: reload, 0 for one-shot        */
+/*                     fCallback, pvArg: expiration callback        */
+/* Output params:      n/a                                          */
+/* **************************************************************** */
+static void timer_start(timer_entry_t *pTimer, unsigned int uiTimeMs, unsigned int uiPeriodTicks,
+                        timer_callback_t fCallback, void *pvArg) {
+    unsigned int uiPrimask = __get_PRIMASK();
+    __disable_irq();
+
+    if(pTimer->ucRunning)
+        timer_remove(pTimer);
+
+    pTimer->uiPeriodTicks = uiPeriodTicks;
+    pTimer->fCallback = fCallback;
+    pTimer->pvArg = pvArg;
+    timer_insert(pTimer, timer_msToTicks(uiTimeMs));
+
+    __set_PRIMASK(uiPrimask);
+}
 
 /* **************************************************************** */
 /* Method name:        timer_init                                   */
-/* Method description: Initialize timer to trigger the PID on/off   */
+/* Method description: Initialize the timer service                 */
 /* Input params:       uiPeriodMs: period of the interruption in ms */
 /* Output params:      n/a                                          */
 /* **************************************************************** */
 void timer_init(unsigned int uiPeriodMs) {
-    timer.uiPeriodMs = uiPeriodMs;
-    timer.uiTriggerTimeMs = 0;
-    timer.ucEnabled = 0;
-    timer.ucTurnOnOff = 0;
+    uiTimerPeriodMs = uiPeriodMs;
+    pTimerList = 0;
 }
 
 /* **************************************************************** */
-/* Method name:        timer_start                                  */
-/* Method description: Start the timer                              */
-/* Input params:       uiTriggerTimeS: time in seconds              */
-/*                     ucTurnOnOff: 0 to turn PID off on trigger,   */
-/*                                  1 to turn PID on on trigger     */
+/* Method name:        timer_startOneShot                           */
+/* Method description: Start (or restart) a timer that calls        */
+/*                     fCallback once after uiTimeMs                */
+/* Input params:       pTimer: timer storage                        */
+/*                     uiTimeMs: time in ms, rounded up to ticks.   */
+/*                     The timer may expire up to one tick early,   */
+/*                     callers that need a minimum check the clock  */
+/*                     fCallback: function called on expiration     */
+/*                     pvArg: argument passed to fCallback          */
 /* Output params:      n/a                                          */
 /* **************************************************************** */
-void timer_start(unsigned int uiTriggerTimeS, unsigned char ucTurnOnOff) {
-    timer.uiTriggerTimeMs = uiTriggerTimeS * 1000;
-    timer.ucTurnOnOff = ucTurnOnOff;
-    timer.ucEnabled = 1;
+void timer_startOneShot(timer_entry_t *pTimer, unsigned int uiTimeMs, timer_callback_t fCallback, void *pvArg) {
+    timer_start(pTimer, uiTimeMs, 0, fCallback, pvArg);
 }
 
 /* **************************************************************** */
-/* Method name:        timer_getTimeLeft                            */
-/* Method description: Return the time left in the timer if enabled */
-/* Input params:       n/a                                          */
-/* Output params:      Time left in milisseconds                    */
+/* Method name:        timer_startPeriodic                          */
+/* Method description: Start (or restart) a timer that calls        */
+/*                     fCallback every uiPeriodMs until stopped     */
+/* Input params:       pTimer: timer storage                        */
+/*                     uiPeriodMs: period in ms, rounded up to ticks*/
+/*                     (the first expiration may be one tick early) */
+/*                     fCallback: function called on expiration     */
+/*                     pvArg: argument passed to fCallback          */
+/* Output params:      n/a                                          */
 /* **************************************************************** */
-unsigned int timer_getTimeLeft() {
-    if(timer.ucEnabled)
-        return timer.uiTriggerTimeMs;
-    else
-        return 0;
+void timer_startPeriodic(timer_entry_t *pTimer, unsigned int uiPeriodMs, timer_callback_t fCallback, void *pvArg) {
+    timer_start(pTimer, uiPeriodMs, timer_msToTicks(uiPeriodMs), fCallback, pvArg);
 }
 
 /* **************************************************************** */
-/* Method name:        timer_isOn                                   */
+/* Method name:        timer_stop                                   */
+/* Method description: Stop the timer without calling its callback  */
+/* Input params:       pTimer: timer storage                        */
+/* Output params:      n/a                                          */
+/* **************************************************************** */
+void timer_stop(timer_entry_t *pTimer) {
+    unsigned int uiPrimask = __get_PRIMASK();
+    __disable_irq();
+
+    if(pTimer->ucRunning)
+        timer_remove(pTimer);
+
+    __set_PRIMASK(uiPrimask);
+}
+
+/* **************************************************************** */
+/* Method name:        timer_isRunning                              */
 /* Method description: Return the timer current status              */
-/* Input params:       n/a                                          */
-/* Output params:      1 if timer is on, 0 if it is off             */
+/* Input params:       pTimer: timer storage                        */
+/* Output params:      1 if timer is running, 0 if it is stopped    */
 /* **************************************************************** */
-unsigned char timer_isOn() {
-    return timer.ucEnabled;
+unsigned char timer_isRunning(timer_entry_t *pTimer) {
+    return pTimer->ucRunning;
 }
 
 /* **************************************************************** */
-/* Method name:        timer_abort                                  */
-/* Method description: Turn the timer off without triggering it     */
-/* Input params:       n/a                                          */
-/* Output params:      n/a                                          */
+/* Method name:        timer_getTimeLeft                            */
+/* Method description: Return the time left until the next          */
+/*                     expiration of the timer                      */
+/* Input params:       pTimer: timer storage                        */
+/* Output params:      Time left in milisseconds, 0 if stopped      */
 /* **************************************************************** */
-void timer_abort() {
-    timer.ucEnabled = 0;
+unsigned int timer_getTimeLeft(timer_entry_t *pTimer) {
+    unsigned int uiTicks = 0;
+    timer_entry_t *pNode;
+    unsigned int uiPrimask = __get_PRIMASK();
+    __disable_irq();
+
+    /* sum the deltas up to this timer */
+    for(pNode = pTimerList; pNode; pNode = pNode->pNext) {
+        uiTicks += pNode->uiDeltaTicks;
+        if(pNode == pTimer)
+            break;
+    }
+
+    __set_PRIMASK(uiPrimask);
+
+    if(!pNode)
+        return 0;
+    return uiTicks * uiTimerPeriodMs;
 }
 
 /* **************************************************************** */
 /* Method name:        timer_tick                                   */
 /* Method description: To be called in the interruption with period */
-/*                     specified at initialization.                 */
+/*                     specified at initialization. Runs the        */
+/*                     callbacks of the expired timers              */
 /* Input params:       n/a                                          */
 /* Output params:      n/a                                          */
 /* **************************************************************** */
 void timer_tick() {
-    /* if timer is enabled, update current time left */
-    if(timer.ucEnabled) {
-        timer.uiTriggerTimeMs -= timer.uiPeriodMs;
-        
-        /* trigger action if timer is over */
-        if(0 >= timer.uiTriggerTimeMs) {
-                /* turn PID on or off */
-                /* check if PID is already on before turn it on again. Avoid reseting pid integral sum */
-                if(!timer.ucTurnOnOff || !pid_isOn()){
-                    pid_turnOnOff(timer.ucTurnOnOff);
-                }
-
-                /* reset timer */
-                timer.ucEnabled = 0;
-        }
+    unsigned int uiPrimask = __get_PRIMASK();
+    __disable_irq();
+
+    /* only the first timer is counted down, the others are relative to it */
+    if(pTimerList)
+        pTimerList->uiDeltaTicks--;
+
+    /* pop every timer that expired in this tick */
+    while(pTimerList && 0 == pTimerList->uiDeltaTicks) {
+        timer_entry_t *pExpired = pTimerList;
+        pTimerList = pExpired->pNext;
+
+        /* periodic timers are scheduled again before the callback, so it can stop them */
+        if(pExpired->uiPeriodTicks)
+            timer_insert(pExpired, pExpired->uiPeriodTicks);
+        else
+            pExpired->ucRunning = 0;
+
+        __set_PRIMASK(uiPrimask);
+        pExpired->fCallback(pExpired->pvArg);
+        __disable_irq();
     }
-}
\ No newline at end of file
+
+    __set_PRIMASK(uiPrimask);
+}
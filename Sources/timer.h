@@ -1,67 +1,98 @@
 /* ***************************************************************** */
-/* File name:        timer.c                                         */
-/* File description: Implements methods for a timer trigger          */
+/* File name:        timer.h                                         */
+/* File description: Software timer service. Any number of one-shot  */
+/*                   and periodic timers with callbacks, kept in a   */
+/*                   sorted delta list so each tick costs O(1)       */
 /* Author name:      Grupo 18 - Renato Pepe                          */
 /*                              Joao Victor Matoso                   */
 /* Creation date:    18jun2021                                       */
-/* Revision date:    18jun2021                                       */
+/* Revision date:    19oct2026                                       */
 /* ***************************************************************** */
 
 #ifndef _SOURCE_TIMER_H_
 #define _SOURCE_TIMER_H_
 
-typedef struct {
-    unsigned int uiTriggerTimeMs;
-	unsigned int uiPeriodMs;
-    unsigned char ucEnabled;
-    unsigned char ucTurnOnOff;
-} timer_t;
+/* function called when a timer expires, in the tick (interruption) context */
+typedef void (*timer_callback_t)(void *pvArg);
+
+/*
+ * timer storage is owned by the caller (usually a global variable),
+ * the fields are handled by the service only
+ */
+typedef struct timer_entry_t {
+    struct timer_entry_t *pNext;   // next timer to expire
+    unsigned int uiDeltaTicks;     // ticks after the previous timer in the list expires
+    unsigned int uiPeriodTicks;    // reload value, 0 for one-shot timers
+    timer_callback_t fCallback;
+    void *pvArg;
+    unsigned char ucRunning;
+} timer_entry_t;
 
 /* **************************************************************** */
 /* Method name:        timer_init                                   */
-/* Method description: Initialize timer to trigger the PID on/off   */
+/* Method description: Initialize the timer service                 */
 /* Input params:       uiPeriodMs: period of the interruption in ms */
 /* Output params:      n/a                                          */
 /* **************************************************************** */
 void timer_init(unsigned int uiPeriodMs);
 
 /* **************************************************************** */
-/* Method name:        timer_start                                  */
-/* Method description: Start the timer                              */
-/* Input params:       uiTriggerTimeS: time in seconds              */
-/*                     ucTurnOnOff: 0 to turn PID off on trigger,   */
-/*                                  1 to turn PID on on trigger     */
+/* Method name:        timer_startOneShot                           */
+/* Method description: Start (or restart) a timer that calls        */
+/*                     fCallback once after uiTimeMs                */
+/* Input params:       pTimer: timer storage                        */
+/*                     uiTimeMs: time in ms, rounded up to ticks.   */
+/*                     The timer may expire up to one tick early,   */
+/*                     callers that need a minimum check the clock  */
+/*                     fCallback: function called on expiration     */
+/*                     pvArg: argument passed to fCallback          */
 /* Output params:      n/a                                          */
-void timer_start(unsigned int uiTriggerTimeS, unsigned char ucTurnOnOff);
+/* **************************************************************** */
+void timer_startOneShot(timer_entry_t *pTimer, unsigned int uiTimeMs, timer_callback_t fCallback, void *pvArg);
 
 /* **************************************************************** */
-/* Method name:        timer_getTimeLeft                            */
-/* Method description: Return the time left in the timer if enabled */
-/* Input params:       n/a                                          */
-/* Output params:      Time left in milisseconds                    */
+/* Method name:        timer_startPeriodic                          */
+/* Method description: Start (or restart) a timer that calls        */
+/*                     fCallback every uiPeriodMs until stopped     */
+/* Input params:       pTimer: timer storage                        */
+/*                     uiPeriodMs: period in ms, rounded up to ticks*/
+/*                     (the first expiration may be one tick early) */
+/*                     fCallback: function called on expiration     */
+/*                     pvArg: argument passed to fCallback          */
+/* Output params:      n/a                                          */
 /* **************************************************************** */
-unsigned int timer_getTimeLeft();
+void timer_startPeriodic(timer_entry_t *pTimer, unsigned int uiPeriodMs, timer_callback_t fCallback, void *pvArg);
 
 /* **************************************************************** */
-/* Method name:        timer_isOn                                   */
+/* Method name:        timer_stop                                   */
+/* Method description: Stop the timer without calling its callback  */
+/* Input params:       pTimer: timer storage                        */
+/* Output params:      n/a                                          */
+/* **************************************************************** */
+void timer_stop(timer_entry_t *pTimer);
+
+/* **************************************************************** */
+/* Method name:        timer_isRunning                              */
 /* Method description: Return the timer current status              */
-/* Input params:       n/a                                          */
-/* Output params:      1 if timer is on, 0 if it is off             */
+/* Input params:       pTimer: timer storage                        */
+/* Output params:      1 if timer is running, 0 if it is stopped    */
 /* **************************************************************** */
-unsigned char timer_isOn();
+unsigned char timer_isRunning(timer_entry_t *pTimer);
 
 /* **************************************************************** */
-/* Method name:        timer_abort                                  */
-/* Method description: Turn the timer off without triggering it     */
-/* Input params:       n/a                                          */
-/* Output params:      n/a                                          */
+/* Method name:        timer_getTimeLeft                            */
+/* Method description: Return the time left until the next          */
+/*                     expiration of the timer                      */
+/* Input params:       pTimer: timer storage                        */
+/* Output params:      Time left in milisseconds, 0 if stopped      */
 /* **************************************************************** */
-void timer_abort();
+unsigned int timer_getTimeLeft(timer_entry_t *pTimer);
 
 /* **************************************************************** */
 /* Method name:        timer_tick                                   */
 /* Method description: To be called in the interruption with period */
-/*                     specified at initialization.                 */
+/*                     specified at initialization. Runs the        */
+/*                     callbacks of the expired timers              */
 /* Input params:       n/a                                          */
 /* Output params:      n/a                                          */
 /* **************************************************************** */
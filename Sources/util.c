@@ -2,149 +2,18 @@
 /* File name:        util.c                                          */
 /* File description: This file has a couple of useful functions to   */
 /*                   make programming more productive                */
-/*                                                                   */
-/*                   Remarks: The soft delays consider               */
-/*                   core clock @ 40MHz                              */
-/*                   bus clock @ 20MHz                               */
-/*                                                                   */
+/*                   (delays and timeouts are in delay.h)            */
 /* Author name:      dloubach, Jo�o Victor Matoso, Renato Pepe       */
 /* Creation date:    09jan2015                                       */
 /* Revision date:    18jun2021                                       */
 /* ***************************************************************** */
 
 #include "util.h"
+#include "numconv.h"
+#include <math.h>
 
-/* ************************************************ */
-/* Method name:        util_genDelay088us           */
-/* Method description: generates ~ 088 micro sec    */
-/* Input params:       n/a                          */
-/* Output params:      n/a                          */
-/* ************************************************ */
-void util_genDelay088us(void)
-{
-    char i;
-    for(i=0; i<120; i++)
-    {
-        __asm("NOP");
-        __asm("NOP");
-        __asm("NOP");
-        __asm("NOP");
-        __asm("NOP");
-        __asm("NOP");
-        __asm("NOP");
-        __asm("NOP");
-        __asm("NOP");
-        __asm("NOP");
-        __asm("NOP");
-        __asm("NOP");
-        __asm("NOP");
-        __asm("NOP");
-        __asm("NOP");
-    }
-}
-
-
-
-/* ************************************************ */
-/* Method name:        util_genDelay250us           */
-/* Method description: generates ~   250 micro sec  */
-/* Input params:       n/a                          */
-/* Output params:      n/a                          */
-/* ************************************************ */
-void util_genDelay250us(void)
-{
-    char i;
-    for(i=0; i<120; i++)
-    {
-        __asm("NOP");
-        __asm("NOP");
-        __asm("NOP");
-        __asm("NOP");
-        __asm("NOP");
-        __asm("NOP");
-        __asm("NOP");
-        __asm("NOP");
-        __asm("NOP");
-        __asm("NOP");
-    }
-    util_genDelay088us();
-    util_genDelay088us();
-}
-
-
-
-/* ************************************************ */
-/* Method name:        util_genDelay1ms             */
-/* Method description: generates ~   1 mili sec     */
-/* Input params:       n/a                          */
-/* Output params:      n/a                          */
-/* ************************************************ */
-void util_genDelay1ms(void)
-{
-    util_genDelay250us();
-    util_genDelay250us();
-    util_genDelay250us();
-    util_genDelay250us();
-}
-
-
-/* ************************************************ */
-/* Method name:        util_genDelay10ms            */
-/* Method description: generates ~   10 mili sec    */
-/* Input params:       n/a                          */
-/* Output params:      n/a                          */
-/* ************************************************ */
-void util_genDelay10ms(void)
-{
-    util_genDelay1ms();
-    util_genDelay1ms();
-    util_genDelay1ms();
-    util_genDelay1ms();
-    util_genDelay1ms();
-    util_genDelay1ms();
-    util_genDelay1ms();
-    util_genDelay1ms();
-    util_genDelay1ms();
-    util_genDelay1ms();
-}
-
-
-
-/* ************************************************ */
-/* Method name:        util_genDelay100ms           */
-/* Method description: generates ~   100 mili sec   */
-/* Input params:       n/a                          */
-/* Output params:      n/a                          */
-/* ************************************************ */
-void util_genDelay100ms(void)
-{
-    util_genDelay10ms();
-    util_genDelay10ms();
-    util_genDelay10ms();
-    util_genDelay10ms();
-    util_genDelay10ms();
-    util_genDelay10ms();
-    util_genDelay10ms();
-    util_genDelay10ms();
-    util_genDelay10ms();
-    util_genDelay10ms();
-}
-
-
-/* ************************************************ */
-/* Method name:        util_genDelay500ms           */
-/* Method description: generates ~   500 mili sec   */
-/* Input params:       n/a                          */
-/* Output params:      n/a                          */
-/* ************************************************ */
-void util_genDelay500ms(void)
-{
-    util_genDelay100ms();
-    util_genDelay100ms();
-    util_genDelay100ms();
-    util_genDelay100ms();
-    util_genDelay100ms();
-}
+/* digits of the values converted exactly through an unsigned int */
+#define UTIL_EXACT_DIGITS   9
 
 /* *********************************************************** */
 /* Method name:        stringToUnsignedInt                     */
@@ -154,85 +23,74 @@ void util_genDelay500ms(void)
 /* Output params:      number converted                        */
 /* *********************************************************** */
 unsigned int stringToUnsignedInt(unsigned char *ucString){
-    int i = 0;
-    unsigned int d = 1;
-    unsigned int number = 0;
-
-    /* go to the end of the string '\0' */
-    while(ucString[i]){
-        i++;
-    }
+    unsigned int uiNumber;
 
-    /* go to the first digit on the right */
-    i--;
+    /* anything but digits (or a number too big) gives 0 */
+    if(NUMCONV_OK != numconv_parseUnsigned(ucString, 0xFFFFFFFFU, &uiNumber))
+        return 0;
 
-    /* loop the string from right to left, converting the number */
-    while(i >= 0) {
-        if(ucString[i] >= '0' && ucString[i] <= '9'){
-            number += d * (ucString[i]-'0');
-            d *= 10;
-            i--;
-        }
-        else
-            return 0;
-    }
-
-    return number;
+    return uiNumber;
 }
 
 /* ******************************************************************************************************* */
 /* Method name:        convertFloatToString                                                                */
 /* Method description: Convert a float number into a string of size uiSize. The algorithm will fit the     */
-/*                     integer part, and the remaining free space will be filled up with the decimal part  */
+/*                     sign and integer part, and the remaining free space will be filled up with the      */
+/*                     decimal part, rounded                                                               */
 /* Input params:       fNumber - number that will be converted into string                                 */
 /*                     cText   - char array where fNumber will be written                                  */
 /*                     uiSize  - size of cText array                                                       */
 /* Output params:      n/a                                                                                 */
 /* ******************************************************************************************************* */
 void convertFloatToString(float fNumber, char* cText, unsigned int uiSize) {
-    int iPos;
+    /* powers of ten up to the most digits an unsigned int keeps exactly */
+    static const float fPowers[UTIL_EXACT_DIGITS + 1] = {1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f};
+    int iChars = (int)uiSize - 1;
+    int iSign = (0.0f > fNumber) ? 1 : 0;
+    float fMagnitude = iSign ? -fNumber : fNumber;
     int iDigits = 1;
+    int iDecimals;
+    unsigned int uiScaled;
+    int iPos;
 
-    /* counts how many digits are in the integer part */
-    while(fNumber >= 10){
-        fNumber /= 10;
+    /* counts how many digits are in the integer part, comparing instead of dividing */
+    while(iDigits <= UTIL_EXACT_DIGITS && fMagnitude >= fPowers[iDigits])
         iDigits++;
-    }
 
-    /* if the number doesn't fit inside the string, return string of '9's */
-    if (iDigits >= uiSize) {
-        for(iPos = 0; iPos < uiSize-1; iPos++){
+    /* if the number doesn't fit inside the string (or is not a number), return string of '9's */
+    if(iDigits + iSign > iChars || UTIL_EXACT_DIGITS < iDigits || fMagnitude != fMagnitude){
+        for(iPos = 0; iPos < iChars; iPos++){
             cText[iPos] = '9';
         }
         cText[iPos] = '\0';
         return;
     }
 
-    /* obs: at this point, fNumber is always x.xxxxx */
-    for(iPos = 0; iPos < uiSize-1; iPos++){
-        /* if the loop reaches the comma position */
-        if(0 == iDigits){
-            cText[iPos] = ',';
+    /* the remaining space after the ',' is filled with decimals */
+    iDecimals = iChars - iSign - iDigits - 1;
+    if(UTIL_EXACT_DIGITS - iDigits < iDecimals)
+        iDecimals = UTIL_EXACT_DIGITS - iDigits;
+    if(0 > iDecimals)
+        iDecimals = 0;
+
+    /* one multiply and the rest in integers; a rounding carry (9,99 -> 10,0) costs a decimal */
+    uiScaled = (unsigned int)(fMagnitude * fPowers[iDecimals] + 0.5f);
+    if(uiScaled >= (unsigned int)fPowers[iDigits + iDecimals]){
+        if(0 < iDecimals){
+            iDecimals--;
+            uiScaled = (unsigned int)(fMagnitude * fPowers[iDecimals] + 0.5f);
+        }else if(iDigits + iSign == iChars || UTIL_EXACT_DIGITS == iDigits){
+            /* no room for the carry digit, '9's as for a number too big */
+            uiScaled--;
         }
-
-        /* everywhere else, extracts the most left digit and save it in the string */
-        else {
-            int iIntPart = (int) fNumber;
-            fNumber -= iIntPart;
-            cText[iPos] = iIntPart + '0';
-            fNumber *= 10;
-        }
-
-        /* decrement integer digits counter */
-        iDigits--;
     }
 
-    /* remove the ',' in some cases where it would appear X, */
-    if (',' == cText[iPos - 1]) {
-           cText[iPos - 1] = ' ';
-       }
+    iPos = numconv_formatFixed(iSign ? -(int)uiScaled : (int)uiScaled, (unsigned char)iDecimals, cText);
 
-    /* end of string */
+    /* pad so the field keeps its width, e.g. where a ',' would be the last char */
+    while(iPos < iChars){
+        cText[iPos++] = ' ';
+    }
     cText[iPos] = '\0';
 }
 
@@ -240,33 +98,21 @@ void convertFloatToString(float fNumber, char* cText, unsigned int uiSize) {
 /* ******************************************************************************************************* */
 /* Method name:        convertStringToFloat                                                                */
 /* Method description: Convert a string into a float number, ',' marks the decimal point and               */
-/*                      '\0' marks the end of the string                                                   */
-/*                      (obs: if string has more than one ',' then the second one will work as a '\0')     */
+/*                      '\0' marks the end of the string, a leading '-' makes it negative                  */
+/*                      (obs: anything else, e.g. a second ',', gives NaN, refused by every range check)   */
 /* Input params:       cText   - start of the string                                                       */
 /* Output params:      float   - converted number                                                          */
 /* ******************************************************************************************************* */
 float convertStringToFloat(unsigned char *ucText) {
-    float fValue = 0;
-    int iCount = 0;
-
-    /* convert integer part */
-    while (',' != ucText[iCount] && '\0' != ucText[iCount]) {
-        fValue *= 10;
-        fValue += ucText[iCount++] - '0';
-    }
+    static const float fPowers[NUMCONV_MAX_DECIMALS + 1] = {1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f};
+    int iMantissa;
+    unsigned char ucDecimals;
 
-    /* convert decimal part */
-    if (',' == ucText[iCount]) {
-        int d = 10;
-        iCount++;
-        while ('\0' != ucText[iCount] && '0' <= ucText[iCount] && '9' >= ucText[iCount]) {
-            float fAux = ucText[iCount++] - '0';
-            fValue += fAux / d;
-            d *= 10;
-        }
-    }
+    /* NaN is out of every range, so a bad number is refused by the range checks */
+    if(NUMCONV_OK != numconv_parseDecimal(ucText, &iMantissa, &ucDecimals))
+        return NAN;
 
-    return fValue;
+    return (float)iMantissa / fPowers[ucDecimals];
 }
 
 /* ******************************************************************************************************* */
@@ -309,13 +155,10 @@ void append_string(char *cStringBase, unsigned int uiSizeBase, char *cStringRigh
 /* Output params:      n/a                                     */
 /* *********************************************************** */
 void unsignedIntToString(char* cString, unsigned int uiData, int iStringSize) {
+    /* 10^iStringSize does not fit: every value fits the width */
+    static const unsigned int uiLimits[UTIL_EXACT_DIGITS + 1] = {1U, 10U, 100U, 1000U, 10000U, 100000U, 1000000U, 10000000U, 100000000U, 1000000000U};
 
-    int iMaxSize = 1;
-    for (int j = 0; j < iStringSize; j++) {
-        iMaxSize *= 10;
-    }
-
-    if (iMaxSize < uiData) {
+    if(UTIL_EXACT_DIGITS >= iStringSize && uiLimits[iStringSize] <= uiData) {
         cString[0] = 'X';
         cString[1] = 'X';
         cString[2] = 'X';
@@ -323,33 +166,8 @@ void unsignedIntToString(char* cString, unsigned int uiData, int iStringSize) {
         return;
     }
 
-    /*
-     * cString array must have a size of at least 12 chars
-     * the number will be written from right to left, from position 10 to 0 due to camera visibility
-     */
-    int i = iStringSize;
-
-    /* insert '\0' at the end of string */
-    cString[i] = '\0';
-    i--;
-
-    /* if the number to be written is zero, print just one zero */
-    if (0 == uiData) {
-        cString[i] = '0';
-        i--;
-    }
-
-    /* isolate last digit and save it from right to left */
-    while (0 < uiData && 0 <= i) {
-        cString[i] = (char)(uiData % 10 + '0');
-        uiData /= 10;
-        i--;
-    }
-    /* complete with spaces */
-    while (0 <= i) {
-        cString[i] = '0';
-        i--;
-    }
+    /* zero padded to iStringSize digits */
+    numconv_formatUnsignedWidth(uiData, (unsigned char)iStringSize, cString);
 }
 
 
@@ -2,9 +2,6 @@
 /* File name:        util.h                                          */
 /* File description: Header file containing the function/methods     */
 /*                   prototypes of util.c                            */
-/*                   Those delays were tested under the following:   */
-/*                   core clock @ 40MHz                              */
-/*                   bus clock @ 20MHz                               */
 /* Author name:      dloubach, Jo�o Victor Matoso, Renato Pepe       */
 /* Creation date:    09jan2015                                       */
 /* Revision date:    18jun2021                                       */
@@ -13,57 +10,6 @@
 #ifndef UTIL_H
 #define UTIL_H
 
-/* ************************************************ */
-/* Method name:        util_genDelay088us           */
-/* Method description: generates ~ 088 micro sec    */
-/* Input params:       n/a                          */
-/* Output params:      n/a                          */
-/* ************************************************ */
-void util_genDelay088us(void);
-
-
-/* ************************************************ */
-/* Method name:        util_genDelay250us           */
-/* Method description: generates ~   250 micro sec  */
-/* Input params:       n/a                          */
-/* Output params:      n/a                          */
-/* ************************************************ */
-void util_genDelay250us(void);
-
-
-/* ************************************************ */
-/* Method name:        util_genDelay1ms             */
-/* Method description: generates ~   1 mili sec     */
-/* Input params:       n/a                          */
-/* Output params:      n/a                          */
-/* ************************************************ */
-void util_genDelay1ms(void);
-
-
-/* ************************************************ */
-/* Method name:        util_genDelay10ms            */
-/* Method description: generates ~   10 mili sec    */
-/* Input params:       n/a                          */
-/* Output params:      n/a                          */
-/* ************************************************ */
-void util_genDelay10ms(void);
-
-/* ************************************************ */
-/* Method name:        util_genDelay10ms            */
-/* Method description: generates ~   100 mili sec    */
-/* Input params:       n/a                          */
-/* Output params:      n/a                          */
-/* ************************************************ */
-void util_genDelay100ms(void);
-
-/* ************************************************ */
-/* Method name:        util_genDelay500ms           */
-/* Method description: generates ~   500 mili sec   */
-/* Input params:       n/a                          */
-/* Output params:      n/a                          */
-/* ************************************************ */
-void util_genDelay500ms(void);
-
 /* *********************************************************** */
 /* Method name:        stringToUnsignedInt                     */
 /* Method description: Convert a string with numbers in ASCII  */
@@ -87,7 +33,8 @@ void unsignedIntToString(char* cString, unsigned int uiData, int iStringSize);
 /* ******************************************************************************************************* */
 /* Method name:        convertFloatToString                                                                */
 /* Method description: Convert a float number into a string of size uiSize. The algorithm will fit the     */
-/*                     integer part, and the remaining free space will be filled up with the decimal part  */
+/*                     sign and integer part, and the remaining free space will be filled up with the      */
+/*                     decimal part, rounded                                                               */
 /* Input params:       fNumber - number that will be converted into string                                 */
 /*                     cText   - char array where fNumber will be written                                  */
 /*                     uiSize  - size of text (obs: string size needs to be (size of text)+1               */
@@ -98,8 +45,8 @@ void convertFloatToString(float fNumber, char* cText, unsigned int uiSize);
 /* ******************************************************************************************************* */
 /* Method name:        convertStringToFloat                                                                */
 /* Method description: Convert a string into a float number, ',' marks the decimal point and               */
-/*                      '\0' marks the end of the string                                                   */
-/*                      (obs: if string has more than one ',' then the second one will work as a '\0')     */
+/*                      '\0' marks the end of the string, a leading '-' makes it negative                  */
+/*                      (obs: anything else, e.g. a second ',', gives NaN, refused by every range check)   */
 /* Input params:       cText   - start of the string                                                       */
 /* Output params:      float   - converted number                                                          */
 /* ******************************************************************************************************* */
@@ -0,0 +1,162 @@
+/* ***************************************************************** */
+/* File name:        binframe.c                                      */
+/* File description: Host side of the binary protocol: frame builder */
+/*                   and parser                                      */
+/* Author name:      Grupo 18 - Renato Pepe                          */
+/*                              Joao Victor Matoso                   */
+/* Creation date:    19oct2026                                       */
+/* Revision date:    19oct2026                                       */
+/* ***************************************************************** */
+
+#include "binframe.h"
+#include "crc16.h"
+
+/* states of the parser */
+#define BINFRAME_WAIT_SOF       0U
+#define BINFRAME_LEN            1U
+#define BINFRAME_SEQ            2U
+#define BINFRAME_CMD            3U
+#define BINFRAME_PAYLOAD        4U
+#define BINFRAME_CRC_LOW        5U
+#define BINFRAME_CRC_HIGH       6U
+
+/* ************************************************** */
+/* Method name:        binframe_build                 */
+/* Method description: Build a frame with its CRC     */
+/* Input params:       ucCmd, ucSeq: frame header     */
+/*                     pucPayload, ucLength: payload, */
+/*                     up to BINPROTO_MAX_PAYLOAD     */
+/*                     pucFrame: BINFRAME_MAX_SIZE    */
+/*                     bytes                          */
+/* Output params:      frame size                     */
+/* ************************************************** */
+unsigned char binframe_build(unsigned char ucCmd, unsigned char ucSeq, const unsigned char *pucPayload, unsigned char ucLength, unsigned char *pucFrame)
+{
+    unsigned short usCrc;
+    unsigned char ucIndex;
+
+    pucFrame[0] = BINPROTO_SOF;
+    pucFrame[1] = ucLength;
+    pucFrame[2] = ucSeq;
+    pucFrame[3] = ucCmd;
+    for(ucIndex = 0; ucIndex < ucLength; ucIndex++)
+        pucFrame[4 + ucIndex] = pucPayload[ucIndex];
+
+    /* LEN to the end of the payload */
+    usCrc = crc16_compute(&pucFrame[1], 3U + ucLength);
+    pucFrame[4 + ucLength] = (unsigned char)usCrc;
+    pucFrame[5 + ucLength] = (unsigned char)(usCrc >> 8);
+    return ucLength + BINFRAME_OVERHEAD;
+}
+
+/* ************************************************** */
+/* Method name:        binframe_init                  */
+/* Method description: Start a parser hunting for SOF */
+/* Input params:       pParser: parser                */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void binframe_init(binframe_parser_type *pParser)
+{
+    pParser->ucState = BINFRAME_WAIT_SOF;
+    pParser->uiFrames = 0;
+    pParser->uiErrors = 0;
+}
+
+/* ************************************************** */
+/* Method name:        binframe_resync                */
+/* Method description: Drop a frame stopped in the    */
+/*                     middle, as the board does after*/
+/*                     a silence, BINPROTO_GAP_MIN_MS*/
+/* Input params:       pParser: parser                */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void binframe_resync(binframe_parser_type *pParser)
+{
+    if(BINFRAME_WAIT_SOF != pParser->ucState){
+        pParser->ucState = BINFRAME_WAIT_SOF;
+        pParser->uiErrors++;
+    }
+}
+
+/* ************************************************** */
+/* Method name:        binframe_parse                 */
+/* Method description: Feed a byte sent by the board  */
+/* Input params:       pParser: parser                */
+/*                     ucByte: byte                   */
+/* Output params:      1 when a frame with a good CRC */
+/*                     ended, it is in the parser     */
+/* ************************************************** */
+unsigned char binframe_parse(binframe_parser_type *pParser, unsigned char ucByte)
+{
+    switch(pParser->ucState){
+    case BINFRAME_WAIT_SOF:
+        if(BINPROTO_SOF == ucByte){
+            pParser->usCrc = CRC16_INIT;
+            pParser->ucState = BINFRAME_LEN;
+        }
+        break;
+
+    case BINFRAME_LEN:
+        if(BINPROTO_MAX_PAYLOAD < ucByte){
+            pParser->uiErrors++;
+            pParser->ucState = BINFRAME_WAIT_SOF;
+            break;
+        }
+        pParser->ucLength = ucByte;
+        pParser->usCrc = crc16_update(pParser->usCrc, ucByte);
+        pParser->ucState = BINFRAME_SEQ;
+        break;
+
+    case BINFRAME_SEQ:
+        pParser->ucSeq = ucByte;
+        pParser->usCrc = crc16_update(pParser->usCrc, ucByte);
+        pParser->ucState = BINFRAME_CMD;
+        break;
+
+    case BINFRAME_CMD:
+        pParser->ucCmd = ucByte;
+        pParser->usCrc = crc16_update(pParser->usCrc, ucByte);
+        pParser->ucCount = 0;
+        pParser->ucState = (0 < pParser->ucLength) ? BINFRAME_PAYLOAD : BINFRAME_CRC_LOW;
+        break;
+
+    case BINFRAME_PAYLOAD:
+        pParser->ucPayload[pParser->ucCount++] = ucByte;
+        pParser->usCrc = crc16_update(pParser->usCrc, ucByte);
+        if(pParser->ucCount == pParser->ucLength)
+            pParser->ucState = BINFRAME_CRC_LOW;
+        break;
+
+    case BINFRAME_CRC_LOW:
+        pParser->usReceivedCrc = ucByte;
+        pParser->ucState = BINFRAME_CRC_HIGH;
+        break;
+
+    case BINFRAME_CRC_HIGH:
+        pParser->usReceivedCrc |= (unsigned short)ucByte << 8;
+        pParser->ucState = BINFRAME_WAIT_SOF;
+        if(pParser->usReceivedCrc != pParser->usCrc){
+            pParser->uiErrors++;
+            break;
+        }
+        pParser->uiFrames++;
+        return 1;
+    }
+    return 0;
+}
+
+/* ************************************************** */
+/* Method name:        binframe_getUnsigned           */
+/* Method description: Little endian value            */
+/* Input params:       pucData: first byte            */
+/*                     ucBytes: 1 to 4                */
+/* Output params:      value                          */
+/* ************************************************** */
+unsigned int binframe_getUnsigned(const unsigned char *pucData, unsigned char ucBytes)
+{
+    unsigned int uiValue = 0;
+
+    while(ucBytes--)
+        uiValue = (uiValue << 8) | pucData[ucBytes];
+    return uiValue;
+}
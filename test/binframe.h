@@ -0,0 +1,88 @@
+/* ***************************************************************** */
+/* File name:        binframe.h                                      */
+/* File description: Host side of the binary protocol (see           */
+/*                   binaryProtocol.h): builds request frames and    */
+/*                   finds the frames in what the board sent, ASCII  */
+/*                   lines around them are skipped                   */
+/* Author name:      Grupo 18 - Renato Pepe                          */
+/*                              Joao Victor Matoso                   */
+/* Creation date:    19oct2026                                       */
+/* Revision date:    19oct2026                                       */
+/* ***************************************************************** */
+
+#ifndef TEST_BINFRAME_H_
+#define TEST_BINFRAME_H_
+
+#include "binaryProtocol.h"
+
+/* SOF, LEN, SEQ, CMD and the 2 CRC bytes */
+#define BINFRAME_OVERHEAD       6U
+
+/* largest frame */
+#define BINFRAME_MAX_SIZE       (BINPROTO_MAX_PAYLOAD + BINFRAME_OVERHEAD)
+
+typedef struct binframe_parser_type {
+    unsigned char ucState;
+    unsigned char ucCount;
+    unsigned short usCrc;
+    unsigned short usReceivedCrc;
+    /* last frame found */
+    unsigned char ucLength;
+    unsigned char ucSeq;
+    unsigned char ucCmd;
+    unsigned char ucPayload[BINPROTO_MAX_PAYLOAD];
+    /* statistics */
+    unsigned int uiFrames;
+    unsigned int uiErrors;
+} binframe_parser_type;
+
+/* ************************************************** */
+/* Method name:        binframe_build                 */
+/* Method description: Build a frame with its CRC     */
+/* Input params:       ucCmd, ucSeq: frame header     */
+/*                     pucPayload, ucLength: payload, */
+/*                     up to BINPROTO_MAX_PAYLOAD     */
+/*                     pucFrame: BINFRAME_MAX_SIZE    */
+/*                     bytes                          */
+/* Output params:      frame size                     */
+/* ************************************************** */
+unsigned char binframe_build(unsigned char ucCmd, unsigned char ucSeq, const unsigned char *pucPayload, unsigned char ucLength, unsigned char *pucFrame);
+
+/* ************************************************** */
+/* Method name:        binframe_init                  */
+/* Method description: Start a parser hunting for SOF */
+/* Input params:       pParser: parser                */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void binframe_init(binframe_parser_type *pParser);
+
+/* ************************************************** */
+/* Method name:        binframe_resync                */
+/* Method description: Drop a frame stopped in the    */
+/*                     middle, as the board does after*/
+/*                     a silence, BINPROTO_GAP_MIN_MS*/
+/* Input params:       pParser: parser                */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void binframe_resync(binframe_parser_type *pParser);
+
+/* ************************************************** */
+/* Method name:        binframe_parse                 */
+/* Method description: Feed a byte sent by the board  */
+/* Input params:       pParser: parser                */
+/*                     ucByte: byte                   */
+/* Output params:      1 when a frame with a good CRC */
+/*                     ended, it is in the parser     */
+/* ************************************************** */
+unsigned char binframe_parse(binframe_parser_type *pParser, unsigned char ucByte);
+
+/* ************************************************** */
+/* Method name:        binframe_getUnsigned           */
+/* Method description: Little endian value            */
+/* Input params:       pucData: first byte            */
+/*                     ucBytes: 1 to 4                */
+/* Output params:      value                          */
+/* ************************************************** */
+unsigned int binframe_getUnsigned(const unsigned char *pucData, unsigned char ucBytes);
+
+#endif /* TEST_BINFRAME_H_ */
@@ -0,0 +1,275 @@
+/* ***************************************************************** */
+/* File name:        binproto_host.c                                 */
+/* File description: Host library of the binary protocol: requests   */
+/*                   in flight, answers matched by SEQ, retries      */
+/* Author name:      Grupo 18 - Renato Pepe                          */
+/*                              Joao Victor Matoso                   */
+/* Creation date:    19oct2026                                       */
+/* Revision date:    19oct2026                                       */
+/* ***************************************************************** */
+
+#include <string.h>
+#include "binproto_host.h"
+
+/* bytes of an entry in the GET answer and in the SET request */
+#define BINPROTO_HOST_GET_ENTRY     6U
+#define BINPROTO_HOST_SET_ENTRY     5U
+
+typedef union {
+    float fValue;
+    unsigned int uiValue;
+    int iValue;
+} binproto_host_value_type;
+
+/* ************************************************** */
+/* Method name:        binprotoHost_init              */
+/* Method description: Start a link with no request   */
+/* Input params:       pHost: link                    */
+/*                     fWrite, pvContext: the line    */
+/*                     uiTimeoutMs: wait for an answer*/
+/*                     before sending again           */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void binprotoHost_init(binproto_host_type *pHost, binproto_host_write_t fWrite, void *pvContext, unsigned int uiTimeoutMs)
+{
+    memset(pHost, 0, sizeof(*pHost));
+    binframe_init(&pHost->parser);
+    pHost->fWrite = fWrite;
+    pHost->pvContext = pvContext;
+    pHost->uiTimeoutMs = uiTimeoutMs;
+}
+
+/* ************************************************** */
+/* Method name:        binprotoHost_isSeqInUse        */
+/* Method description: Check if a SEQ belongs to a    */
+/*                     request not yet released       */
+/* Input params:       pHost: link                    */
+/*                     ucSeq: sequence number         */
+/* Output params:      1 if in use, 0 if not          */
+/* ************************************************** */
+static unsigned char binprotoHost_isSeqInUse(const binproto_host_type *pHost, unsigned char ucSeq)
+{
+    unsigned char ucSlot;
+
+    for(ucSlot = 0; ucSlot < BINPROTO_HOST_SLOTS; ucSlot++)
+        if(BINPROTO_HOST_FREE != pHost->requests[ucSlot].ucState && ucSeq == pHost->requests[ucSlot].ucSeq)
+            return 1;
+    return 0;
+}
+
+/* ************************************************** */
+/* Method name:        binprotoHost_send              */
+/* Method description: Send a request in a free slot  */
+/* Input params:       pHost: link                    */
+/*                     ucCmd: BINPROTO_CMD_*          */
+/*                     pucPayload, ucLength: payload  */
+/*                     uiNowMs: current time          */
+/* Output params:      slot, -1 if all are in use     */
+/* ************************************************** */
+int binprotoHost_send(binproto_host_type *pHost, unsigned char ucCmd, const unsigned char *pucPayload,
+                      unsigned char ucLength, unsigned int uiNowMs)
+{
+    binproto_host_request_type *pRequest;
+    unsigned char ucSlot;
+
+    if(BINPROTO_MAX_PAYLOAD < ucLength)
+        return -1;
+    for(ucSlot = 0; ucSlot < BINPROTO_HOST_SLOTS; ucSlot++)
+        if(BINPROTO_HOST_FREE == pHost->requests[ucSlot].ucState)
+            break;
+    if(BINPROTO_HOST_SLOTS == ucSlot)
+        return -1;
+
+    /* a SEQ still in flight would match the wrong answer */
+    while(binprotoHost_isSeqInUse(pHost, pHost->ucNextSeq))
+        pHost->ucNextSeq++;
+
+    pRequest = &pHost->requests[ucSlot];
+    pRequest->ucState = BINPROTO_HOST_WAITING;
+    pRequest->ucSeq = pHost->ucNextSeq++;
+    pRequest->ucCmd = ucCmd;
+    pRequest->ucSends = 1;
+    pRequest->uiSentMs = uiNowMs;
+    pRequest->ucStatus = BINPROTO_STATUS_OK;
+    pRequest->ucResponseLength = 0;
+    pRequest->ucFrameLength = binframe_build(ucCmd, pRequest->ucSeq, pucPayload, ucLength, pRequest->ucFrame);
+
+    pHost->uiSent++;
+    pHost->fWrite(pRequest->ucFrame, pRequest->ucFrameLength, pHost->pvContext);
+    return ucSlot;
+}
+
+/* ************************************************** */
+/* Method name:        binprotoHost_get               */
+/* Method description: Send a GET of some parameters  */
+/* Input params:       pHost: link                    */
+/*                     cLetters: parameter letters    */
+/*                     uiNowMs: current time          */
+/* Output params:      slot, -1 if all are in use     */
+/* ************************************************** */
+int binprotoHost_get(binproto_host_type *pHost, const char *cLetters, unsigned int uiNowMs)
+{
+    size_t length = strlen(cLetters);
+
+    if(BINPROTO_MAX_PAYLOAD < length)
+        return -1;
+    return binprotoHost_send(pHost, BINPROTO_CMD_GET, (const unsigned char *)cLetters, (unsigned char)length, uiNowMs);
+}
+
+/* ************************************************** */
+/* Method name:        binprotoHost_set               */
+/* Method description: Send a SET of a parameter      */
+/* Input params:       pHost: link                    */
+/*                     cLetter: parameter letter      */
+/*                     fValue: new value              */
+/*                     uiNowMs: current time          */
+/* Output params:      slot, -1 if all are in use     */
+/* ************************************************** */
+int binprotoHost_set(binproto_host_type *pHost, char cLetter, float fValue, unsigned int uiNowMs)
+{
+    unsigned char ucPayload[BINPROTO_HOST_SET_ENTRY];
+    binproto_host_value_type value;
+
+    value.fValue = fValue;
+    ucPayload[0] = (unsigned char)cLetter;
+    ucPayload[1] = (unsigned char)value.uiValue;
+    ucPayload[2] = (unsigned char)(value.uiValue >> 8);
+    ucPayload[3] = (unsigned char)(value.uiValue >> 16);
+    ucPayload[4] = (unsigned char)(value.uiValue >> 24);
+    return binprotoHost_send(pHost, BINPROTO_CMD_SET, ucPayload, sizeof(ucPayload), uiNowMs);
+}
+
+/* ************************************************** */
+/* Method name:        binprotoHost_receive           */
+/* Method description: Feed a byte from the board     */
+/* Input params:       pHost: link                    */
+/*                     ucByte: byte                   */
+/* Output params:      slot answered by this byte, -1 */
+/*                     if none                        */
+/* ************************************************** */
+int binprotoHost_receive(binproto_host_type *pHost, unsigned char ucByte)
+{
+    const binframe_parser_type *pFrame = &pHost->parser;
+    binproto_host_request_type *pRequest = 0;
+    unsigned char ucSlot, ucNak;
+
+    if(!binframe_parse(&pHost->parser, ucByte))
+        return -1;
+
+    if(!(pFrame->ucCmd & BINPROTO_RESPONSE_MASK) || BINPROTO_CMD_TELEMETRY == pFrame->ucCmd || BINPROTO_CMD_LOG == pFrame->ucCmd){
+        pHost->uiUnsolicited++;
+        return -1;
+    }
+    ucNak = (BINPROTO_CMD_NAK == pFrame->ucCmd);
+
+    for(ucSlot = 0; ucSlot < BINPROTO_HOST_SLOTS; ucSlot++){
+        binproto_host_request_type *pSlot = &pHost->requests[ucSlot];
+
+        if(BINPROTO_HOST_WAITING == pSlot->ucState && pFrame->ucSeq == pSlot->ucSeq
+                && (ucNak || pFrame->ucCmd == (pSlot->ucCmd | BINPROTO_RESPONSE_MASK))){
+            pRequest = pSlot;
+            break;
+        }
+    }
+    if(!pRequest){
+        pHost->uiUnmatched++;
+        return -1;
+    }
+
+    /* the board got the frame damaged, the SEQ may be too: the timeout sends it again */
+    if(ucNak && (1U != pFrame->ucLength || BINPROTO_STATUS_CRC == pFrame->ucPayload[0])){
+        pHost->uiBadFrames++;
+        return -1;
+    }
+
+    pRequest->ucState = BINPROTO_HOST_DONE;
+    pRequest->ucResponseLength = pFrame->ucLength;
+    memcpy(pRequest->ucResponse, pFrame->ucPayload, pFrame->ucLength);
+    if(ucNak || (BINPROTO_CMD_SET == pRequest->ucCmd && pFrame->ucLength))
+        pRequest->ucStatus = pFrame->ucPayload[0];
+    pHost->uiAnswered++;
+    return ucSlot;
+}
+
+/* ************************************************** */
+/* Method name:        binprotoHost_poll              */
+/* Method description: Send again the requests not    */
+/*                     answered in time, fail the     */
+/*                     ones out of sends              */
+/* Input params:       pHost: link                    */
+/*                     uiNowMs: current time          */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void binprotoHost_poll(binproto_host_type *pHost, unsigned int uiNowMs)
+{
+    unsigned char ucSlot;
+
+    for(ucSlot = 0; ucSlot < BINPROTO_HOST_SLOTS; ucSlot++){
+        binproto_host_request_type *pRequest = &pHost->requests[ucSlot];
+
+        if(BINPROTO_HOST_WAITING != pRequest->ucState || uiNowMs - pRequest->uiSentMs < pHost->uiTimeoutMs)
+            continue;
+        if(BINPROTO_HOST_MAX_SENDS <= pRequest->ucSends){
+            pRequest->ucState = BINPROTO_HOST_FAILED;
+            pHost->uiFailed++;
+            continue;
+        }
+
+        /* an answer cut on the line would swallow the next one */
+        binframe_resync(&pHost->parser);
+
+        /* the same bytes: same SEQ and CRC, so the board can answer from its cache */
+        pRequest->ucSends++;
+        pRequest->uiSentMs = uiNowMs;
+        pHost->uiRetries++;
+        pHost->fWrite(pRequest->ucFrame, pRequest->ucFrameLength, pHost->pvContext);
+    }
+}
+
+/* ************************************************** */
+/* Method name:        binprotoHost_getValue          */
+/* Method description: Value of a parameter in the    */
+/*                     answer to a GET                */
+/* Input params:       pRequest: answered GET         */
+/*                     cLetter: parameter letter      */
+/*                     pfValue: value, the integer    */
+/*                     types converted to float       */
+/* Output params:      1 if found, 0 if not           */
+/* ************************************************** */
+unsigned char binprotoHost_getValue(const binproto_host_request_type *pRequest, char cLetter, float *pfValue)
+{
+    unsigned char ucIndex;
+
+    if(BINPROTO_HOST_DONE != pRequest->ucState || BINPROTO_CMD_GET != pRequest->ucCmd || BINPROTO_STATUS_OK != pRequest->ucStatus)
+        return 0;
+
+    for(ucIndex = 0; ucIndex + BINPROTO_HOST_GET_ENTRY <= pRequest->ucResponseLength; ucIndex += BINPROTO_HOST_GET_ENTRY){
+        binproto_host_value_type value;
+
+        if((unsigned char)cLetter != pRequest->ucResponse[ucIndex])
+            continue;
+        value.uiValue = binframe_getUnsigned(&pRequest->ucResponse[ucIndex + 2], 4);
+        if(BINPROTO_TYPE_FLOAT == pRequest->ucResponse[ucIndex + 1])
+            *pfValue = value.fValue;
+        else if(BINPROTO_TYPE_INT == pRequest->ucResponse[ucIndex + 1])
+            *pfValue = (float)value.iValue;
+        else
+            *pfValue = (float)value.uiValue;
+        return 1;
+    }
+    return 0;
+}
+
+/* ************************************************** */
+/* Method name:        binprotoHost_release           */
+/* Method description: Free a slot after reading its  */
+/*                     answer                         */
+/* Input params:       pHost: link                    */
+/*                     iSlot: slot                    */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void binprotoHost_release(binproto_host_type *pHost, int iSlot)
+{
+    if(0 <= iSlot && BINPROTO_HOST_SLOTS > (unsigned int)iSlot)
+        pHost->requests[iSlot].ucState = BINPROTO_HOST_FREE;
+}
@@ -0,0 +1,156 @@
+/* ***************************************************************** */
+/* File name:        binproto_host.h                                 */
+/* File description: Host library of the binary protocol (see        */
+/*                   binaryProtocol.h) for a supervisor: up to       */
+/*                   BINPROTO_HOST_SLOTS requests in flight, each    */
+/*                   with its own SEQ, answers matched by SEQ and    */
+/*                   CMD, and the same frame sent again when no      */
+/*                   answer comes in time. The board answers a       */
+/*                   repeated last frame from its cache; an older    */
+/*                   one runs again, harmless as GET reads and SET   */
+/*                   writes absolute values                          */
+/* Author name:      Grupo 18 - Renato Pepe                          */
+/*                              Joao Victor Matoso                   */
+/* Creation date:    19oct2026                                       */
+/* Revision date:    19oct2026                                       */
+/* ***************************************************************** */
+
+#ifndef TEST_BINPROTO_HOST_H_
+#define TEST_BINPROTO_HOST_H_
+
+#include "binframe.h"
+
+/* requests in flight */
+#define BINPROTO_HOST_SLOTS         16U
+
+/* sends of a request, the first one included */
+#define BINPROTO_HOST_MAX_SENDS     5U
+
+/* states of a slot */
+#define BINPROTO_HOST_FREE          0U
+#define BINPROTO_HOST_WAITING       1U
+#define BINPROTO_HOST_DONE          2U  // answered, see ucStatus
+#define BINPROTO_HOST_FAILED        3U  // no answer after BINPROTO_HOST_MAX_SENDS
+
+/* writes bytes on the line */
+typedef void (*binproto_host_write_t)(const unsigned char *pucData, unsigned int uiLength, void *pvContext);
+
+typedef struct binproto_host_request_type {
+    unsigned char ucState;
+    unsigned char ucSeq;
+    unsigned char ucCmd;
+    unsigned char ucSends;
+    unsigned int uiSentMs;              // time of the last send
+    unsigned char ucFrame[BINFRAME_MAX_SIZE];
+    unsigned char ucFrameLength;
+    /* answer */
+    unsigned char ucStatus;             // BINPROTO_STATUS_*
+    unsigned char ucResponse[BINPROTO_MAX_PAYLOAD];
+    unsigned char ucResponseLength;
+} binproto_host_request_type;
+
+typedef struct binproto_host_type {
+    binframe_parser_type parser;
+    binproto_host_request_type requests[BINPROTO_HOST_SLOTS];
+    unsigned char ucNextSeq;
+    unsigned int uiTimeoutMs;
+    binproto_host_write_t fWrite;
+    void *pvContext;
+    /* statistics */
+    unsigned int uiSent;                // requests, without the retries
+    unsigned int uiRetries;
+    unsigned int uiAnswered;
+    unsigned int uiFailed;
+    unsigned int uiBadFrames;           // NAK of a frame the board got damaged
+    unsigned int uiUnmatched;           // answers to no request in flight, late duplicates
+    unsigned int uiUnsolicited;         // telemetry and log frames
+} binproto_host_type;
+
+/* ************************************************** */
+/* Method name:        binprotoHost_init              */
+/* Method description: Start a link with no request   */
+/* Input params:       pHost: link                    */
+/*                     fWrite, pvContext: the line    */
+/*                     uiTimeoutMs: wait for an answer*/
+/*                     before sending again           */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void binprotoHost_init(binproto_host_type *pHost, binproto_host_write_t fWrite, void *pvContext, unsigned int uiTimeoutMs);
+
+/* ************************************************** */
+/* Method name:        binprotoHost_send              */
+/* Method description: Send a request in a free slot  */
+/* Input params:       pHost: link                    */
+/*                     ucCmd: BINPROTO_CMD_*          */
+/*                     pucPayload, ucLength: payload  */
+/*                     uiNowMs: current time          */
+/* Output params:      slot, -1 if all are in use     */
+/* ************************************************** */
+int binprotoHost_send(binproto_host_type *pHost, unsigned char ucCmd, const unsigned char *pucPayload,
+                      unsigned char ucLength, unsigned int uiNowMs);
+
+/* ************************************************** */
+/* Method name:        binprotoHost_get               */
+/* Method description: Send a GET of some parameters  */
+/* Input params:       pHost: link                    */
+/*                     cLetters: parameter letters    */
+/*                     uiNowMs: current time          */
+/* Output params:      slot, -1 if all are in use     */
+/* ************************************************** */
+int binprotoHost_get(binproto_host_type *pHost, const char *cLetters, unsigned int uiNowMs);
+
+/* ************************************************** */
+/* Method name:        binprotoHost_set               */
+/* Method description: Send a SET of a parameter      */
+/* Input params:       pHost: link                    */
+/*                     cLetter: parameter letter      */
+/*                     fValue: new value              */
+/*                     uiNowMs: current time          */
+/* Output params:      slot, -1 if all are in use     */
+/* ************************************************** */
+int binprotoHost_set(binproto_host_type *pHost, char cLetter, float fValue, unsigned int uiNowMs);
+
+/* ************************************************** */
+/* Method name:        binprotoHost_receive           */
+/* Method description: Feed a byte from the board     */
+/* Input params:       pHost: link                    */
+/*                     ucByte: byte                   */
+/* Output params:      slot answered by this byte, -1 */
+/*                     if none                        */
+/* ************************************************** */
+int binprotoHost_receive(binproto_host_type *pHost, unsigned char ucByte);
+
+/* ************************************************** */
+/* Method name:        binprotoHost_poll              */
+/* Method description: Send again the requests not    */
+/*                     answered in time, fail the     */
+/*                     ones out of sends              */
+/* Input params:       pHost: link                    */
+/*                     uiNowMs: current time          */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void binprotoHost_poll(binproto_host_type *pHost, unsigned int uiNowMs);
+
+/* ************************************************** */
+/* Method name:        binprotoHost_getValue          */
+/* Method description: Value of a parameter in the    */
+/*                     answer to a GET                */
+/* Input params:       pRequest: answered GET         */
+/*                     cLetter: parameter letter      */
+/*                     pfValue: value, the integer    */
+/*                     types converted to float       */
+/* Output params:      1 if found, 0 if not           */
+/* ************************************************** */
+unsigned char binprotoHost_getValue(const binproto_host_request_type *pRequest, char cLetter, float *pfValue);
+
+/* ************************************************** */
+/* Method name:        binprotoHost_release           */
+/* Method description: Free a slot after reading its  */
+/*                     answer                         */
+/* Input params:       pHost: link                    */
+/*                     iSlot: slot                    */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void binprotoHost_release(binproto_host_type *pHost, int iSlot);
+
+#endif /* TEST_BINPROTO_HOST_H_ */
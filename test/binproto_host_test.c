@@ -0,0 +1,398 @@
+/* ***************************************************************** */
+/* File name:        binproto_host_test.c                            */
+/* File description: The host library of the binary protocol against */
+/*                   the firmware (binaryProtocol.c through the UART */
+/*                   shim): many requests in flight, answers matched */
+/*                   to their request, a lost answer sent again from */
+/*                   the board cache without running the command     */
+/*                   twice, and a line that drops and flips bytes    */
+/* Author name:      Grupo 18 - Renato Pepe                          */
+/*                              Joao Victor Matoso                   */
+/* Creation date:    19oct2026                                       */
+/* Revision date:    19oct2026                                       */
+/* ***************************************************************** */
+
+#include <stdio.h>
+#include <string.h>
+#include "pid.h"
+#include "UART.h"
+#include "uart_shim.h"
+#include "hostboard.h"
+#include "hosttest.h"
+#include "binproto_host.h"
+#include "binframe.h"
+#include "binaryProtocol.h"
+
+/* time of a pass of the main loop, ms */
+#define BINPROTO_TEST_STEP_MS       10U
+
+/* longer than the silence that makes the board drop a stalled frame */
+#define BINPROTO_TEST_TIMEOUT_MS    300U
+
+/* bytes waiting on the line to the board */
+#define BINPROTO_TEST_LINE_SIZE     4096U
+
+/* slowest line, one character of 10 bits in us, and its frame gap */
+#define BINPROTO_TEST_SLOW_BAUD     UART0_MIN_BAUD
+#define BINPROTO_TEST_SLOW_CHAR_US  ((10U * 1000000U + BINPROTO_TEST_SLOW_BAUD - 1U) / BINPROTO_TEST_SLOW_BAUD)
+#define BINPROTO_TEST_SLOW_GAP_MS   ((BINFRAME_MAX_SIZE * 10U * 1000U + BINPROTO_TEST_SLOW_BAUD - 1U) / BINPROTO_TEST_SLOW_BAUD)
+
+/* SET entries of the longest frame, 5 bytes each */
+#define BINPROTO_TEST_SET_ENTRIES   (BINPROTO_MAX_PAYLOAD / 5U)
+
+/* requests of the lossy line test */
+#define BINPROTO_TEST_REQUESTS      3000U
+
+/* faults of a direction of the line, per million bytes */
+typedef struct binproto_test_line_type {
+    unsigned int uiDropPpm;
+    unsigned int uiFlipPpm;
+    unsigned char ucCut;                // drop everything
+    unsigned int uiFaults;
+} binproto_test_line_type;
+
+binproto_test_line_type binprotoTestToBoard, binprotoTestToHost;
+
+/* bytes written by the host, not yet received by the board */
+unsigned char ucBinprotoTestLine[BINPROTO_TEST_LINE_SIZE];
+unsigned int uiBinprotoTestLineLength;
+
+unsigned int uiBinprotoTestRandom = 0x6C078965U;
+
+/* ************************************************** */
+/* Method name:        binprotoTest_random            */
+/* Method description: xorshift32                     */
+/* Input params:       uiRange: values 0..uiRange-1   */
+/* Output params:      value                          */
+/* ************************************************** */
+static unsigned int binprotoTest_random(unsigned int uiRange)
+{
+    uiBinprotoTestRandom ^= uiBinprotoTestRandom << 13;
+    uiBinprotoTestRandom ^= uiBinprotoTestRandom >> 17;
+    uiBinprotoTestRandom ^= uiBinprotoTestRandom << 5;
+    return uiBinprotoTestRandom % uiRange;
+}
+
+/* ************************************************** */
+/* Method name:        binprotoTest_fault             */
+/* Method description: Pass a byte through a direction*/
+/*                     of the line                    */
+/* Input params:       pLine: faults                  */
+/*                     pucByte: byte, may be flipped  */
+/* Output params:      0 if the byte is lost          */
+/* ************************************************** */
+static unsigned char binprotoTest_fault(binproto_test_line_type *pLine, unsigned char *pucByte)
+{
+    unsigned int uiDraw = binprotoTest_random(1000000U);
+
+    if(pLine->ucCut || uiDraw < pLine->uiDropPpm){
+        pLine->uiFaults++;
+        return 0;
+    }
+    if(uiDraw < pLine->uiDropPpm + pLine->uiFlipPpm){
+        pLine->uiFaults++;
+        *pucByte ^= (unsigned char)(1U << binprotoTest_random(8));
+    }
+    return 1;
+}
+
+/* ************************************************** */
+/* Method name:        binprotoTest_write             */
+/* Method description: The host writes on the line    */
+/* Input params:       pucData, uiLength: bytes       */
+/*                     pvContext: not used            */
+/* Output params:      n/a                            */
+/* ************************************************** */
+static void binprotoTest_write(const unsigned char *pucData, unsigned int uiLength, void *pvContext)
+{
+    (void)pvContext;
+    while(uiLength--){
+        unsigned char ucByte = *pucData++;
+
+        if(binprotoTest_fault(&binprotoTestToBoard, &ucByte) && BINPROTO_TEST_LINE_SIZE > uiBinprotoTestLineLength)
+            ucBinprotoTestLine[uiBinprotoTestLineLength++] = ucByte;
+    }
+}
+
+/* ************************************************** */
+/* Method name:        binprotoTest_step              */
+/* Method description: A pass of the main loop: the   */
+/*                     board reads the line and       */
+/*                     answers, the host reads the    */
+/*                     answers and retries            */
+/* Input params:       pHost: link                    */
+/* Output params:      n/a                            */
+/* ************************************************** */
+static void binprotoTest_step(binproto_host_type *pHost)
+{
+    const unsigned char *pucTx;
+    unsigned int uiLength, uiIndex;
+
+    for(uiIndex = 0; uiIndex < uiBinprotoTestLineLength; uiIndex++)
+        uartShim_receive(ucBinprotoTestLine[uiIndex]);
+    uiBinprotoTestLineLength = 0;
+    UART0_processReceived();
+    hostBoard_advanceMs(BINPROTO_TEST_STEP_MS);
+
+    pucTx = uartShim_getCapture(&uiLength);
+    for(uiIndex = 0; uiIndex < uiLength; uiIndex++){
+        unsigned char ucByte = pucTx[uiIndex];
+
+        if(binprotoTest_fault(&binprotoTestToHost, &ucByte))
+            binprotoHost_receive(pHost, ucByte);
+    }
+    uartShim_reset();
+    binprotoHost_poll(pHost, hostBoard_getUptimeMs());
+}
+
+/* ************************************************** */
+/* Method name:        binprotoTest_wait              */
+/* Method description: Run until a request is answered*/
+/*                     or failed                      */
+/* Input params:       pHost: link                    */
+/*                     iSlot: request                 */
+/* Output params:      the request                    */
+/* ************************************************** */
+static const binproto_host_request_type *binprotoTest_wait(binproto_host_type *pHost, int iSlot)
+{
+    const binproto_host_request_type *pRequest = &pHost->requests[iSlot];
+
+    while(BINPROTO_HOST_WAITING == pRequest->ucState)
+        binprotoTest_step(pHost);
+    return pRequest;
+}
+
+/* ************************************************** */
+/* Method name:        binprotoTest_pipeline          */
+/* Method description: Every slot in flight at once on*/
+/*                     a clean line, the answers      */
+/*                     matched to their request       */
+/* Input params:       n/a                            */
+/* Output params:      n/a                            */
+/* ************************************************** */
+static void binprotoTest_pipeline(void)
+{
+    binproto_host_type host;
+    int iSlot[9];
+    float fValue;
+    unsigned int uiIndex;
+
+    binprotoHost_init(&host, binprotoTest_write, 0, BINPROTO_TEST_TIMEOUT_MS);
+    iSlot[0] = binprotoHost_set(&host, 'p', 1.5f, hostBoard_getUptimeMs());
+    iSlot[1] = binprotoHost_get(&host, "p", hostBoard_getUptimeMs());
+    iSlot[2] = binprotoHost_set(&host, 'i', 0.25f, hostBoard_getUptimeMs());
+    iSlot[3] = binprotoHost_get(&host, "pi", hostBoard_getUptimeMs());
+    iSlot[4] = binprotoHost_send(&host, BINPROTO_CMD_PING, 0, 0, hostBoard_getUptimeMs());
+    iSlot[5] = binprotoHost_get(&host, "Z", hostBoard_getUptimeMs());
+    iSlot[6] = binprotoHost_set(&host, 'p', 99999.0f, hostBoard_getUptimeMs());
+    iSlot[7] = binprotoHost_set(&host, 't', 30.0f, hostBoard_getUptimeMs());
+    iSlot[8] = binprotoHost_get(&host, "g", hostBoard_getUptimeMs());
+    for(uiIndex = 9; uiIndex < BINPROTO_HOST_SLOTS; uiIndex++)
+        binprotoHost_send(&host, BINPROTO_CMD_PING, 0, 0, hostBoard_getUptimeMs());
+    hostTest_expectInt(binprotoHost_send(&host, BINPROTO_CMD_PING, 0, 0, hostBoard_getUptimeMs()), -1, "no slot left");
+
+    for(uiIndex = 0; uiIndex < BINPROTO_HOST_SLOTS; uiIndex++)
+        binprotoTest_wait(&host, (int)uiIndex);
+
+    hostTest_expectInt(host.uiAnswered, BINPROTO_HOST_SLOTS, "requests answered");
+    hostTest_expectInt(host.uiRetries + host.uiUnmatched + host.uiBadFrames, 0, "retries on a clean line");
+    hostTest_expectInt(host.requests[iSlot[0]].ucStatus, BINPROTO_STATUS_OK, "SET p");
+    hostTest_expect(binprotoHost_getValue(&host.requests[iSlot[1]], 'p', &fValue) && 1.5f == fValue, "GET p after SET p");
+    hostTest_expect(binprotoHost_getValue(&host.requests[iSlot[3]], 'i', &fValue) && 0.25f == fValue, "GET pi after SET i");
+    hostTest_expect(binprotoHost_getValue(&host.requests[iSlot[3]], 'p', &fValue) && 1.5f == fValue, "GET pi, p");
+    hostTest_expectInt(host.requests[iSlot[4]].ucResponseLength, 0, "PING answer");
+    hostTest_expectInt(host.requests[iSlot[5]].ucStatus, BINPROTO_STATUS_UNKNOWN_PARAM, "GET of an unknown letter");
+    hostTest_expectInt(host.requests[iSlot[6]].ucStatus, BINPROTO_STATUS_RANGE, "SET out of range");
+    hostTest_expectInt(host.requests[iSlot[7]].ucStatus, BINPROTO_STATUS_OK, "SET t");
+    hostTest_expect(binprotoHost_getValue(&host.requests[iSlot[8]], 'g', &fValue) && 30.0f == fValue, "GET g after SET t");
+}
+
+/* ************************************************** */
+/* Method name:        binprotoTest_cachedRetry       */
+/* Method description: The answer to a SET is lost:   */
+/*                     the retry gets it from the     */
+/*                     board cache, the SET does not  */
+/*                     run again                      */
+/* Input params:       n/a                            */
+/* Output params:      n/a                            */
+/* ************************************************** */
+static void binprotoTest_cachedRetry(void)
+{
+    binproto_host_type host;
+    const binproto_host_request_type *pRequest;
+    int iSlot;
+
+    binprotoHost_init(&host, binprotoTest_write, 0, BINPROTO_TEST_TIMEOUT_MS);
+    iSlot = binprotoHost_set(&host, 'p', 12.5f, hostBoard_getUptimeMs());
+    binprotoTestToHost.ucCut = 1;
+    binprotoTest_step(&host);
+    binprotoTestToHost.ucCut = 0;
+    hostTest_expect(12.5f == pid_getKp(), "SET run");
+
+    /* changed on the board meanwhile: a second run would write 12.5 again */
+    pid_setKp(3.0f);
+    pRequest = binprotoTest_wait(&host, iSlot);
+    hostTest_expectInt(pRequest->ucState, BINPROTO_HOST_DONE, "SET answered after the retry");
+    hostTest_expectInt(pRequest->ucSends, 2, "sends of the SET");
+    hostTest_expectInt(pRequest->ucStatus, BINPROTO_STATUS_OK, "status from the cache");
+    hostTest_expect(3.0f == pid_getKp(), "SET not run twice");
+}
+
+/* ************************************************** */
+/* Method name:        binprotoTest_lossy             */
+/* Method description: SET and GET of Kp on a line    */
+/*                     that drops and flips bytes.    */
+/*                     With one request in flight the */
+/*                     retries are always answered    */
+/*                     from the cache, so every GET   */
+/*                     reads the last SET; with more, */
+/*                     every request is still answered*/
+/* Input params:       uiWindow: requests in flight   */
+/* Output params:      n/a                            */
+/* ************************************************** */
+static void binprotoTest_lossy(unsigned int uiWindow)
+{
+    binproto_host_type host;
+    unsigned int uiQueued = 0, uiDone = 0, uiWrongValue = 0, uiWrongStatus = 0, uiSlot;
+    unsigned int uiStart = hostBoard_getUptimeMs();
+    float fLastSet = 0.0f;
+
+    binprotoTestToBoard.uiDropPpm = binprotoTestToHost.uiDropPpm = 1500;
+    binprotoTestToBoard.uiFlipPpm = binprotoTestToHost.uiFlipPpm = 1500;
+    binprotoTestToBoard.uiFaults = binprotoTestToHost.uiFaults = 0;
+    binprotoHost_init(&host, binprotoTest_write, 0, BINPROTO_TEST_TIMEOUT_MS);
+
+    while(uiDone < BINPROTO_TEST_REQUESTS){
+        /* keep the window full, SET with an even count, GET with an odd one */
+        while(uiQueued < BINPROTO_TEST_REQUESTS && uiQueued - uiDone < uiWindow){
+            if(uiQueued & 1U){
+                binprotoHost_get(&host, "p", hostBoard_getUptimeMs());
+            }else{
+                fLastSet = (float)(uiQueued / 2U % 1000U) + 0.5f;
+                binprotoHost_set(&host, 'p', fLastSet, hostBoard_getUptimeMs());
+            }
+            uiQueued++;
+        }
+        binprotoTest_step(&host);
+
+        for(uiSlot = 0; uiSlot < BINPROTO_HOST_SLOTS; uiSlot++){
+            binproto_host_request_type *pRequest = &host.requests[uiSlot];
+            float fValue;
+
+            if(BINPROTO_HOST_DONE != pRequest->ucState && BINPROTO_HOST_FAILED != pRequest->ucState)
+                continue;
+            if(BINPROTO_HOST_DONE != pRequest->ucState || BINPROTO_STATUS_OK != pRequest->ucStatus)
+                uiWrongStatus++;
+            else if(BINPROTO_CMD_GET == pRequest->ucCmd){
+                /* a GET answered from the cache is older than the SET after it, only with a window */
+                if(!binprotoHost_getValue(pRequest, 'p', &fValue) || (1U == uiWindow && fValue != fLastSet))
+                    uiWrongValue++;
+            }
+            binprotoHost_release(&host, (int)uiSlot);
+            uiDone++;
+        }
+    }
+    binprotoTestToBoard.uiDropPpm = binprotoTestToHost.uiDropPpm = 0;
+    binprotoTestToBoard.uiFlipPpm = binprotoTestToHost.uiFlipPpm = 0;
+
+    printf("  window %2u: %u requests in %.1f s simulated, %u + %u bytes damaged, %u retries, %u NAK of damaged frames, %u late answers\n",
+           uiWindow, BINPROTO_TEST_REQUESTS, (hostBoard_getUptimeMs() - uiStart) / 1000.0, binprotoTestToBoard.uiFaults,
+           binprotoTestToHost.uiFaults, host.uiRetries, host.uiBadFrames, host.uiUnmatched);
+    hostTest_expect(0 < host.uiRetries, "the lossy line made retries");
+    hostTest_expectInt(host.uiFailed, 0, "requests failed");
+    hostTest_expectInt(uiWrongStatus, 0, "requests without an OK answer");
+    hostTest_expectInt(uiWrongValue, 0, (1U == uiWindow) ? "GET not reading the last SET" : "GET answers without p");
+}
+
+/* ************************************************** */
+/* Method name:        binprotoTest_slowFrame         */
+/* Method description: Send a frame to the board one  */
+/*                     character time apart, with a   */
+/*                     pause after a given byte       */
+/* Input params:       pucFrame, uiLength: frame      */
+/*                     uiPauseAfter: bytes before the */
+/*                     pause                          */
+/*                     uiPauseMs: pause               */
+/* Output params:      n/a                            */
+/* ************************************************** */
+static void binprotoTest_slowFrame(const unsigned char *pucFrame, unsigned int uiLength, unsigned int uiPauseAfter, unsigned int uiPauseMs)
+{
+    unsigned int uiIndex, uiUs = 0;
+
+    for(uiIndex = 0; uiIndex < uiLength; uiIndex++){
+        if(uiIndex == uiPauseAfter)
+            hostBoard_advanceMs(uiPauseMs);
+        for(uiUs += BINPROTO_TEST_SLOW_CHAR_US; 1000U <= uiUs; uiUs -= 1000U)
+            hostBoard_advanceMs(1);
+        uartShim_receive(pucFrame[uiIndex]);
+        UART0_processReceived();
+    }
+}
+
+/* ************************************************** */
+/* Method name:        binprotoTest_slowLine          */
+/* Method description: The longest frame at the       */
+/*                     lowest baud rate is taken, a   */
+/*                     frame is only dropped after a  */
+/*                     silence as long as a frame     */
+/* Input params:       n/a                            */
+/* Output params:      n/a                            */
+/* ************************************************** */
+static void binprotoTest_slowLine(void)
+{
+    unsigned char ucPayload[BINPROTO_MAX_PAYLOAD], ucFrame[BINFRAME_MAX_SIZE];
+    unsigned int uiEntry, uiFrames, uiErrors;
+    unsigned char ucLength;
+    float fSetpoint = 40.0f;
+    unsigned int uiValue;
+
+    memcpy(&uiValue, &fSetpoint, sizeof(uiValue));
+    for(uiEntry = 0; uiEntry < BINPROTO_TEST_SET_ENTRIES; uiEntry++){
+        ucPayload[5 * uiEntry] = 't';
+        ucPayload[5 * uiEntry + 1] = (unsigned char)uiValue;
+        ucPayload[5 * uiEntry + 2] = (unsigned char)(uiValue >> 8);
+        ucPayload[5 * uiEntry + 3] = (unsigned char)(uiValue >> 16);
+        ucPayload[5 * uiEntry + 4] = (unsigned char)(uiValue >> 24);
+    }
+    ucLength = binframe_build(BINPROTO_CMD_SET, 0x51, ucPayload, (unsigned char)(5 * BINPROTO_TEST_SET_ENTRIES), ucFrame);
+
+    UART0_requestBaudRate(BINPROTO_TEST_SLOW_BAUD);
+    binaryProtocol_resetStatistics();
+
+    /* about 105 ms on the line */
+    binprotoTest_slowFrame(ucFrame, ucLength, 0, 0);
+    binaryProtocol_getStatistics(&uiFrames, &uiErrors);
+    hostTest_expectInt(uiFrames, 1, "longest frame at the lowest baud rate");
+    hostTest_expectInt(uiErrors, 0, "errors of the longest frame");
+    hostTest_expect(fSetpoint == pid_getTemperatureSetpoint(), "SET of the longest frame run");
+
+    /* a pause just under the silence keeps the frame */
+    binprotoTest_slowFrame(ucFrame, ucLength, ucLength / 2U, BINPROTO_TEST_SLOW_GAP_MS - 2U);
+    binaryProtocol_getStatistics(&uiFrames, &uiErrors);
+    hostTest_expectInt(uiFrames, 2, "frame with a pause under the silence");
+    hostTest_expectInt(uiErrors, 0, "errors of a pause under the silence");
+
+    /* a longer one drops it, the next frame starts clean */
+    binprotoTest_slowFrame(ucFrame, ucLength / 2U, ucLength, 0);
+    hostBoard_advanceMs(BINPROTO_TEST_SLOW_GAP_MS + 1U);
+    binprotoTest_slowFrame(ucFrame, ucLength, 0, 0);
+    binaryProtocol_getStatistics(&uiFrames, &uiErrors);
+    hostTest_expectInt(uiFrames, 3, "frame after a stalled one");
+    hostTest_expectInt(uiErrors, 1, "stalled frame dropped");
+
+    UART0_requestBaudRate(115200U);
+    uartShim_reset();
+}
+
+int main(void)
+{
+    hostBoard_init();
+    uartShim_reset();
+
+    binprotoTest_pipeline();
+    binprotoTest_cachedRetry();
+    binprotoTest_lossy(1);
+    binprotoTest_lossy(8);
+    binprotoTest_slowLine();
+    return hostTest_report("binproto_host_test");
+}
@@ -0,0 +1,188 @@
+/* ***************************************************************** */
+/* File name:        cascade_test.c                                  */
+/* File description: The cooler cascade (pid.c outer loop, fan speed */
+/*                   inner loop of fanControl.c) on the host plant   */
+/*                   model, run as the 100 ms interruption does. A   */
+/*                   fan disturbance must be rejected by the inner   */
+/*                   loop before it reaches the temperature: the     */
+/*                   error is compared with the outer loop driving   */
+/*                   the cooler duty directly                        */
+/* Author name:      Grupo 18 - Renato Pepe                          */
+/*                              Joao Victor Matoso                   */
+/* Creation date:    19oct2026                                       */
+/* Revision date:    19oct2026                                       */
+/* ***************************************************************** */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include "pid.h"
+#include "filter.h"
+#include "fanControl.h"
+#include "aquecedorECooler.h"
+#include "tacometro.h"
+#include "hostboard.h"
+#include "hosttest.h"
+#include "plant.h"
+
+/* control period, s */
+#define CASCADE_TEST_PERIOD_S       0.1f
+
+/* hot room: 45 C with the fan off, the setpoint needs the fan */
+#define CASCADE_TEST_HEAT_LOAD      20.0f
+#define CASCADE_TEST_SETPOINT       38.0f
+
+/* the fan loses 40 % of its speed at this time, s */
+#define CASCADE_TEST_DISTURBANCE_S  600U
+#define CASCADE_TEST_FAN_GAIN       0.6f
+#define CASCADE_TEST_END_S          1200U
+
+/* the fan speed must be back well inside the 60 s thermal time constant */
+#define CASCADE_TEST_RECOVERY_S     10.0f
+
+typedef struct cascade_test_result_type {
+    float fSettledError;            // |error| just before the disturbance, C
+    float fPeakError;               // largest |error| after it, C
+    float fFinalError;              // |error| at the end, C
+    float fSpeedRecoveryS;          // fan back within 5 % of its target, s
+    unsigned int uiTargetChanges;
+    unsigned int uiShortestHold;    // periods between two target changes
+} cascade_test_result_type;
+
+/* ************************************************** */
+/* Method name:        cascadeTest_run                */
+/* Method description: Hold the setpoint through the  */
+/*                     fan disturbance                */
+/* Input params:       ucCascade: 1 for the inner     */
+/*                     loop, 0 for the outer loop on  */
+/*                     the cooler duty                */
+/*                     pResult: errors and timing     */
+/* Output params:      n/a                            */
+/* ************************************************** */
+static void cascadeTest_run(unsigned char ucCascade, cascade_test_result_type *pResult)
+{
+    plant_type plant;
+    unsigned int uiPeriod, uiPeriods = (unsigned int)(CASCADE_TEST_END_S / CASCADE_TEST_PERIOD_S + 0.5f);
+    unsigned int uiDisturbance = (unsigned int)(CASCADE_TEST_DISTURBANCE_S / CASCADE_TEST_PERIOD_S + 0.5f);
+    unsigned int uiLastTarget = 0, uiLastChange = 0, uiRecovered = 0;
+
+    pResult->fPeakError = 0.0f;
+    pResult->fSpeedRecoveryS = -1.0f;
+    pResult->uiTargetChanges = 0;
+    pResult->uiShortestHold = uiPeriods;
+
+    plant_init(&plant, PLANT_AMBIENT + CASCADE_TEST_HEAT_LOAD, CASCADE_TEST_HEAT_LOAD);
+    filter_init(plant.fTemperature);
+    fanControl_init();
+    heater_PWMDuty(0.0f);
+    coolerfan_PWMDuty(0.0f);
+    pid_setCoolerCascade(1);
+    pid_setTemperatureSetpoint(CASCADE_TEST_SETPOINT);
+    pid_turnOnOff(1);
+
+    for(uiPeriod = 1; uiPeriod <= uiPeriods; uiPeriod++){
+        float fEffort, fError;
+
+        if(uiDisturbance == uiPeriod)
+            plant.fFanGain = CASCADE_TEST_FAN_GAIN;
+
+        /* periodic_interruption: the fan loop on the new speed, then the temperature loop */
+        fanControl_update(tachometer_getSpeed());
+        fEffort = pidUpdateData(filter_dema(plant.fTemperature));
+        if(ucCascade){
+            fanControl_applyCascade(fEffort);
+        }else{
+            heater_PWMDuty((0.0f < fEffort) ? fEffort / 100.0f : 0.0f);
+            coolerfan_PWMDuty((0.0f > fEffort) ? -fEffort / 100.0f : 0.0f);
+        }
+        plant_run(&plant, CASCADE_TEST_PERIOD_S);
+
+        /* how often the outer loop moves the inner loop */
+        if(fanControl_getTargetRpm() != uiLastTarget){
+            if(pResult->uiTargetChanges && uiPeriod - uiLastChange < pResult->uiShortestHold)
+                pResult->uiShortestHold = uiPeriod - uiLastChange;
+            pResult->uiTargetChanges++;
+            uiLastTarget = fanControl_getTargetRpm();
+            uiLastChange = uiPeriod;
+        }
+
+        fError = fabsf(plant.fTemperature - CASCADE_TEST_SETPOINT);
+        if(uiDisturbance - 1U == uiPeriod)
+            pResult->fSettledError = fError;
+        if(uiDisturbance <= uiPeriod){
+            if(pResult->fPeakError < fError)
+                pResult->fPeakError = fError;
+
+            /* the fan speed back at its target, for good */
+            if(ucCascade && uiLastTarget && abs(fanControl_getTrackingError()) * 20U > uiLastTarget)
+                uiRecovered = 0;
+            else if(!uiRecovered)
+                uiRecovered = uiPeriod;
+        }
+    }
+    pResult->fFinalError = fabsf(plant.fTemperature - CASCADE_TEST_SETPOINT);
+    if(ucCascade && uiRecovered)
+        pResult->fSpeedRecoveryS = (uiRecovered - uiDisturbance) * CASCADE_TEST_PERIOD_S;
+
+    pid_turnOnOff(0);
+    pid_setCoolerCascade(0);
+}
+
+/* ************************************************** */
+/* Method name:        cascadeTest_transition         */
+/* Method description: From cooling to heating and    */
+/*                     back: the fan stops once, and  */
+/*                     the first cooling period sets  */
+/*                     a target at once               */
+/* Input params:       n/a                            */
+/* Output params:      n/a                            */
+/* ************************************************** */
+static void cascadeTest_transition(void)
+{
+    fanControl_init();
+    fanControl_applyCascade(-50.0f);
+    fanControl_applyCascade(-40.0f);
+    hostTest_expectInt(fanControl_getTargetRpm(), FAN_CONTROL_MAX_RPM / 2U, "target held between changes");
+
+    fanControl_applyCascade(10.0f);
+    hostTest_expect(0U == fanControl_getTargetRpm() && 0.0f == getDutyCycleCooler(), "fan stopped when heating");
+
+    /* the fan is left alone while heating goes on */
+    coolerfan_PWMDuty(0.3f);
+    fanControl_applyCascade(10.0f);
+    hostTest_expect(0.3f == getDutyCycleCooler(), "fan stopped once per transition");
+
+    fanControl_applyCascade(-20.0f);
+    hostTest_expectInt(fanControl_getTargetRpm(), FAN_CONTROL_MAX_RPM / 5U, "target set on the first cooling period");
+    heater_PWMDuty(0.0f);
+    coolerfan_PWMDuty(0.0f);
+    fanControl_init();
+}
+
+int main(void)
+{
+    cascade_test_result_type cascade, direct;
+
+    hostBoard_init();
+    cascadeTest_transition();
+    cascadeTest_run(1, &cascade);
+    cascadeTest_run(0, &direct);
+
+    printf("  fan speed -%.0f %% at %u s, setpoint %.1f C\n", 100.0f * (1.0f - CASCADE_TEST_FAN_GAIN),
+           CASCADE_TEST_DISTURBANCE_S, CASCADE_TEST_SETPOINT);
+    printf("  %-12s %10s %10s %10s %14s %12s\n", "outer loop", "settled C", "peak C", "final C", "target changes", "min hold");
+    printf("  %-12s %10.3f %10.3f %10.3f %14u %12u\n", "on fan RPM", cascade.fSettledError, cascade.fPeakError,
+           cascade.fFinalError, cascade.uiTargetChanges, cascade.uiShortestHold);
+    printf("  %-12s %10.3f %10.3f %10.3f\n", "on duty", direct.fSettledError, direct.fPeakError, direct.fFinalError);
+    printf("  fan speed back within 5 %% of the target in %.1f s\n", cascade.fSpeedRecoveryS);
+
+    hostTest_expect(0.2f > cascade.fSettledError, "cascade settled before the disturbance");
+    hostTest_expect(0.2f > direct.fSettledError, "direct duty settled before the disturbance");
+    hostTest_expect(0.2f > cascade.fFinalError, "cascade settled after the disturbance");
+    hostTest_expect(cascade.uiTargetChanges && FAN_CONTROL_CASCADE_RATIO <= cascade.uiShortestHold,
+                    "RPM target held for FAN_CONTROL_CASCADE_RATIO inner periods");
+    hostTest_expect(0.0f <= cascade.fSpeedRecoveryS && CASCADE_TEST_RECOVERY_S >= cascade.fSpeedRecoveryS,
+                    "fan disturbance rejected by the inner loop");
+    hostTest_expect(2.0f * cascade.fPeakError < direct.fPeakError, "cascade error under half the direct duty error");
+    return hostTest_report("cascade_test");
+}
@@ -0,0 +1,252 @@
+/* ***************************************************************** */
+/* File name:        console_bench.c                                 */
+/* File description: Time of the responses sent with console.c       */
+/*                   against the same responses through debug_printf */
+/*                   and _doprint (legacy_console.c), on the host.   */
+/*                   Both end in UART0_putChar, so only the          */
+/*                   formatting is timed; the bytes must be the same */
+/*                   Usage: console_bench [calls] [--check]          */
+/* Author name:      Grupo 18 - Renato Pepe                          */
+/*                              Joao Victor Matoso                   */
+/* Creation date:    19oct2026                                       */
+/* Revision date:    19oct2026                                       */
+/* ***************************************************************** */
+
+/* clock_gettime */
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "communicationStateMachine.h"
+#include "paramRegistry.h"
+#include "legacy_console.h"
+#include "uart_shim.h"
+#include "hostboard.h"
+
+#define CONSOLE_BENCH_CALLS     200000U
+
+/* longest response compared */
+#define CONSOLE_BENCH_RESPONSE  1024U
+
+/* parser statistics of communicationStateMachine.c */
+extern unsigned int uiStatRxBytes;
+extern unsigned int uiStatCommands;
+extern unsigned int uiStatDropped;
+extern unsigned int uiStatGarbageBytes;
+extern unsigned int uiStatMaxResync;
+
+typedef struct {
+    const char *cName;
+    void (*fLegacy)(void);
+    void (*fConsole)(void);
+} console_bench_case_type;
+
+/* parameters answered by "<label> = <value> <unit>" */
+unsigned char ucConsoleBenchLetters[64];
+unsigned int uiConsoleBenchLetters = 0;
+
+/* ************************************************** */
+/* Method name:        consoleBench_getSeconds        */
+/* Method description: Monotonic time                 */
+/* Input params:       n/a                            */
+/* Output params:      seconds                        */
+/* ************************************************** */
+static double consoleBench_getSeconds(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (double)now.tv_sec + (double)now.tv_nsec * 1e-9;
+}
+
+/* ************************************************** */
+/* Method name:        consoleBench_findLetters       */
+/* Method description: The get parameters without a   */
+/*                     printer of their own           */
+/* Input params:       n/a                            */
+/* Output params:      n/a                            */
+/* ************************************************** */
+static void consoleBench_findLetters(void)
+{
+    unsigned char ucIndex;
+
+    for(ucIndex = 0; ucIndex < param_getCount(); ucIndex++){
+        const param_descriptor_type *pParam = param_getByIndex(ucIndex);
+
+        if((PARAM_FLAG_GET & pParam->ucFlags) && !pParam->fPrint)
+            ucConsoleBenchLetters[uiConsoleBenchLetters++] = pParam->ucLetter;
+    }
+}
+
+/* ************************************************** */
+/* Method name:        consoleBench_legacyGet         */
+/* Method description: #g of every parameter, before  */
+/* Input params:       n/a                            */
+/* Output params:      n/a                            */
+/* ************************************************** */
+static void consoleBench_legacyGet(void)
+{
+    unsigned int uiIndex;
+
+    for(uiIndex = 0; uiIndex < uiConsoleBenchLetters; uiIndex++)
+        legacy_returnParam(ucConsoleBenchLetters[uiIndex]);
+}
+
+/* ************************************************** */
+/* Method name:        consoleBench_consoleGet        */
+/* Method description: #g of every parameter, now     */
+/* Input params:       n/a                            */
+/* Output params:      n/a                            */
+/* ************************************************** */
+static void consoleBench_consoleGet(void)
+{
+    unsigned int uiIndex;
+
+    for(uiIndex = 0; uiIndex < uiConsoleBenchLetters; uiIndex++)
+        returnParam(ucConsoleBenchLetters[uiIndex]);
+}
+
+/* ************************************************** */
+/* Method name:        consoleBench_legacyList        */
+/* Method description: #g* before                     */
+/* Input params:       n/a                            */
+/* Output params:      n/a                            */
+/* ************************************************** */
+static void consoleBench_legacyList(void)
+{
+    legacy_returnParamList((unsigned char *)"*");
+}
+
+/* ************************************************** */
+/* Method name:        consoleBench_consoleList       */
+/* Method description: #g* now                        */
+/* Input params:       n/a                            */
+/* Output params:      n/a                            */
+/* ************************************************** */
+static void consoleBench_consoleList(void)
+{
+    returnParamList((unsigned char *)"*");
+}
+
+/* ************************************************** */
+/* Method name:        consoleBench_consoleBaudRate   */
+/* Method description: #gu now                        */
+/* Input params:       n/a                            */
+/* Output params:      n/a                            */
+/* ************************************************** */
+static void consoleBench_consoleBaudRate(void)
+{
+    returnParam('u');
+}
+
+static const console_bench_case_type consoleBenchCases[] = {
+    {"#g<each>", consoleBench_legacyGet,       consoleBench_consoleGet},
+    {"#g*",      consoleBench_legacyList,      consoleBench_consoleList},
+    {"#gu",      legacy_printBaudRate,         consoleBench_consoleBaudRate},
+    {"#gq",      legacy_printParserStatistics, printParserStatistics},
+};
+
+#define CONSOLE_BENCH_CASES     (sizeof(consoleBenchCases) / sizeof(consoleBenchCases[0]))
+
+/* ************************************************** */
+/* Method name:        consoleBench_capture           */
+/* Method description: Send a response once and keep  */
+/*                     what reached the UART          */
+/* Input params:       fResponse: response            */
+/*                     ucText: copy of the bytes, at  */
+/*                     least CONSOLE_BENCH_RESPONSE   */
+/* Output params:      bytes sent                     */
+/* ************************************************** */
+static unsigned int consoleBench_capture(void (*fResponse)(void), unsigned char *ucText)
+{
+    const unsigned char *ucCapture;
+    unsigned int uiLength;
+
+    uartShim_reset();
+    fResponse();
+    ucCapture = uartShim_getCapture(&uiLength);
+    if(CONSOLE_BENCH_RESPONSE < uiLength)
+        uiLength = CONSOLE_BENCH_RESPONSE;
+    memcpy(ucText, ucCapture, uiLength);
+    uartShim_reset();
+    return uiLength;
+}
+
+/* ************************************************** */
+/* Method name:        consoleBench_time              */
+/* Method description: Time a response                */
+/* Input params:       fResponse: response            */
+/*                     uiCalls: calls to time         */
+/* Output params:      ns per call                    */
+/* ************************************************** */
+static double consoleBench_time(void (*fResponse)(void), unsigned int uiCalls)
+{
+    unsigned int uiIndex;
+    double dStart = consoleBench_getSeconds();
+
+    for(uiIndex = 0; uiIndex < uiCalls; uiIndex++){
+        uartShim_reset();
+        fResponse();
+    }
+    return (consoleBench_getSeconds() - dStart) * 1e9 / uiCalls;
+}
+
+int main(int argc, char **argv)
+{
+    unsigned int uiCalls = CONSOLE_BENCH_CALLS;
+    unsigned int uiIndex, uiDifferent = 0;
+    unsigned char ucCheck = 0;
+    int iArg;
+
+    for(iArg = 1; iArg < argc; iArg++){
+        if(!strcmp(argv[iArg], "--check"))
+            ucCheck = 1;
+        else
+            uiCalls = (unsigned int)strtoul(argv[iArg], 0, 10);
+    }
+
+    hostBoard_init();
+    consoleBench_findLetters();
+
+    /* statistics of a board that has been talking for a while */
+    uiStatRxBytes = 1234567U;
+    uiStatCommands = 45678U;
+    uiStatDropped = 12U;
+    uiStatGarbageBytes = 345U;
+    uiStatMaxResync = 9U;
+
+    printf("%u calls of each response, %u parameters in #g<each>\n", uiCalls, uiConsoleBenchLetters);
+    printf("  %-10s %6s %10s %10s %8s\n", "response", "bytes", "printf ns", "console ns", "speedup");
+
+    for(uiIndex = 0; uiIndex < CONSOLE_BENCH_CASES; uiIndex++){
+        const console_bench_case_type *pCase = &consoleBenchCases[uiIndex];
+        unsigned char ucLegacy[CONSOLE_BENCH_RESPONSE], ucConsole[CONSOLE_BENCH_RESPONSE];
+        unsigned int uiLegacy, uiConsole;
+        double dLegacy, dConsole;
+
+        /* the same bytes on the line */
+        uiLegacy = consoleBench_capture(pCase->fLegacy, ucLegacy);
+        uiConsole = consoleBench_capture(pCase->fConsole, ucConsole);
+        if(uiLegacy != uiConsole || memcmp(ucLegacy, ucConsole, uiLegacy)){
+            printf("  %-10s differs: \"%.*s\" against \"%.*s\"\n", pCase->cName,
+                   (int)uiLegacy, (char *)ucLegacy, (int)uiConsole, (char *)ucConsole);
+            uiDifferent++;
+            continue;
+        }
+
+        dLegacy = consoleBench_time(pCase->fLegacy, uiCalls);
+        dConsole = consoleBench_time(pCase->fConsole, uiCalls);
+        printf("  %-10s %6u %10.1f %10.1f %7.2fx\n", pCase->cName, uiConsole, dLegacy, dConsole, dLegacy / dConsole);
+    }
+
+    if(!ucCheck)
+        return 0;
+    if(uiDifferent){
+        printf("FAIL: %u responses differ from the debug_printf ones\n", uiDifferent);
+        return 1;
+    }
+    printf("console_bench: OK\n");
+    return 0;
+}
@@ -0,0 +1,60 @@
+/* ***************************************************************** */
+/* File name:        eventlog_decode.c                               */
+/* File description: Print the event log sent by the board (#sz1;)   */
+/*                   from a capture of the serial line, e.g.         */
+/*                     eventlog_decode capture.bin                   */
+/*                     eventlog_decode < /dev/ttyACM0                */
+/*                   The ASCII lines and other frames in the capture */
+/*                   are skipped                                     */
+/* Author name:      Grupo 18 - Renato Pepe                          */
+/*                              Joao Victor Matoso                   */
+/* Creation date:    19oct2026                                       */
+/* Revision date:    19oct2026                                       */
+/* ***************************************************************** */
+
+#include <stdio.h>
+#include "binframe.h"
+#include "eventlog_host.h"
+
+int main(int argc, char **argv)
+{
+    FILE *pInput = stdin;
+    binframe_parser_type parser;
+    eventlog_host_type log;
+    int iByte;
+
+    if(1 < argc && !(pInput = fopen(argv[1], "rb"))){
+        perror(argv[1]);
+        return 1;
+    }
+
+    binframe_init(&parser);
+    eventlogHost_init(&log);
+    while(EOF != (iByte = fgetc(pInput))){
+        eventlog_host_record_type records[EVENTLOG_HOST_MAX_RECORDS];
+        unsigned int uiMissing = log.uiMissingFrames;
+        unsigned char ucCount, ucIndex, ucLost;
+
+        if(!binframe_parse(&parser, (unsigned char)iByte))
+            continue;
+        ucCount = eventlogHost_decodeFrame(&log, &parser, records, &ucLost);
+
+        if(uiMissing != log.uiMissingFrames)
+            printf("-- %u log frames missing\n", log.uiMissingFrames - uiMissing);
+        if(ucLost)
+            printf("-- %u%s events overwritten on the board\n", ucLost, (255U == ucLost) ? " or more" : "");
+        for(ucIndex = 0; ucIndex < ucCount; ucIndex++){
+            char cText[EVENTLOG_HOST_TEXT_SIZE];
+
+            eventlogHost_format(&records[ucIndex], cText);
+            printf("%8u.%u s  %s\n", records[ucIndex].uiTime / 10U, records[ucIndex].uiTime % 10U, cText);
+        }
+        fflush(stdout);
+    }
+
+    fprintf(stderr, "%u frames, %u events, %u lost on the board, %u frames missing, %u bad frames, %u CRC errors\n",
+            log.uiFrames, log.uiRecords, log.uiLost, log.uiMissingFrames, log.uiBadFrames, parser.uiErrors);
+    if(stdin != pInput)
+        fclose(pInput);
+    return 0;
+}
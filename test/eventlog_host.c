@@ -0,0 +1,128 @@
+/* ***************************************************************** */
+/* File name:        eventlog_host.c                                 */
+/* File description: Host decoder of the event log frames            */
+/* Author name:      Grupo 18 - Renato Pepe                          */
+/*                              Joao Victor Matoso                   */
+/* Creation date:    19oct2026                                       */
+/* Revision date:    19oct2026                                       */
+/* ***************************************************************** */
+
+#include <stdio.h>
+#include "eventlog_host.h"
+
+/* the text of the events, built from EVENTLOG_MESSAGES */
+#define EVENTLOG_HOST_TABLE
+#include "eventlog.h"
+
+/* ************************************************** */
+/* Method name:        eventlogHost_init              */
+/* Method description: Clear the decoder state        */
+/* Input params:       pLog: decoder                  */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void eventlogHost_init(eventlog_host_type *pLog)
+{
+    pLog->ucStarted = 0;
+    pLog->ucNextSeq = 0;
+    pLog->uiFrames = 0;
+    pLog->uiRecords = 0;
+    pLog->uiLost = 0;
+    pLog->uiMissingFrames = 0;
+    pLog->uiBadFrames = 0;
+}
+
+/* ************************************************** */
+/* Method name:        eventlogHost_decodeFrame       */
+/* Method description: Read the records of a log frame*/
+/* Input params:       pLog: decoder                  */
+/*                     pFrame: frame found by         */
+/*                     binframe_parse                 */
+/*                     pRecords: room for             */
+/*                     EVENTLOG_HOST_MAX_RECORDS      */
+/*                     pucLost: LOST of the frame     */
+/* Output params:      records read, 0 also for a     */
+/*                     frame that is not a log frame  */
+/* ************************************************** */
+unsigned char eventlogHost_decodeFrame(eventlog_host_type *pLog, const binframe_parser_type *pFrame,
+                                       eventlog_host_record_type *pRecords, unsigned char *pucLost)
+{
+    const unsigned char *pucRecord = &pFrame->ucPayload[1];
+    unsigned char ucCount, ucIndex;
+
+    *pucLost = 0;
+    if(BINPROTO_CMD_LOG != pFrame->ucCmd)
+        return 0;
+    if(0 == pFrame->ucLength || 0 != (pFrame->ucLength - 1U) % EVENTLOG_RECORD_SIZE){
+        pLog->uiBadFrames++;
+        return 0;
+    }
+
+    /* SEQ counts the log frames, a jump is frames lost on the line */
+    if(pLog->ucStarted)
+        pLog->uiMissingFrames += (unsigned char)(pFrame->ucSeq - pLog->ucNextSeq);
+    pLog->ucStarted = 1;
+    pLog->ucNextSeq = pFrame->ucSeq + 1U;
+
+    *pucLost = pFrame->ucPayload[0];
+    ucCount = (pFrame->ucLength - 1U) / EVENTLOG_RECORD_SIZE;
+    for(ucIndex = 0; ucIndex < ucCount; ucIndex++, pucRecord += EVENTLOG_RECORD_SIZE){
+        pRecords[ucIndex].uiTime = binframe_getUnsigned(pucRecord, 4);
+        pRecords[ucIndex].ucId = pucRecord[4];
+        pRecords[ucIndex].ucArg = pucRecord[5];
+        pRecords[ucIndex].iValue = (int)binframe_getUnsigned(&pucRecord[6], 4);
+    }
+
+    pLog->uiFrames++;
+    pLog->uiRecords += ucCount;
+    pLog->uiLost += *pucLost;
+    return ucCount;
+}
+
+/* ************************************************** */
+/* Method name:        eventlogHost_format            */
+/* Method description: Text of an event: %c is ARG as */
+/*                     a character, %u ARG as a number*/
+/*                     and %d VALUE                   */
+/* Input params:       pRecord: event                 */
+/*                     cText: EVENTLOG_HOST_TEXT_SIZE */
+/*                     chars                          */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void eventlogHost_format(const eventlog_host_record_type *pRecord, char *cText)
+{
+    const char *cFormat;
+    unsigned int uiPos = 0;
+
+    /* an ID newer than this decoder */
+    if(EVENTLOG_COUNT <= pRecord->ucId){
+        snprintf(cText, EVENTLOG_HOST_TEXT_SIZE, "event %u (arg %u, value %d)", pRecord->ucId, pRecord->ucArg, pRecord->iValue);
+        return;
+    }
+
+    /* the table text is not given to printf, only the three conversions are known */
+    for(cFormat = eventlogText[pRecord->ucId]; *cFormat && uiPos < EVENTLOG_HOST_TEXT_SIZE - 1; cFormat++){
+        int iWritten = 1;
+
+        if('%' != cFormat[0] || !cFormat[1]){
+            cText[uiPos] = *cFormat;
+        }else{
+            switch(*++cFormat){
+            case 'c':
+                cText[uiPos] = (char)pRecord->ucArg;
+                break;
+            case 'u':
+                iWritten = snprintf(&cText[uiPos], EVENTLOG_HOST_TEXT_SIZE - uiPos, "%u", pRecord->ucArg);
+                break;
+            case 'd':
+                iWritten = snprintf(&cText[uiPos], EVENTLOG_HOST_TEXT_SIZE - uiPos, "%d", pRecord->iValue);
+                break;
+            default:
+                cText[uiPos] = *cFormat;
+            }
+        }
+        uiPos += (unsigned int)iWritten;
+        if(EVENTLOG_HOST_TEXT_SIZE - 1 < uiPos)
+            uiPos = EVENTLOG_HOST_TEXT_SIZE - 1;
+    }
+    cText[uiPos] = '\0';
+}
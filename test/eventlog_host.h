@@ -0,0 +1,78 @@
+/* ***************************************************************** */
+/* File name:        eventlog_host.h                                 */
+/* File description: Host decoder of the event log frames (CMD       */
+/*                   BINPROTO_CMD_LOG, see eventlog.h): the records, */
+/*                   the events lost on the board and the frames     */
+/*                   missing from the SEQ count, and the text of     */
+/*                   each event from EVENTLOG_MESSAGES               */
+/* Author name:      Grupo 18 - Renato Pepe                          */
+/*                              Joao Victor Matoso                   */
+/* Creation date:    19oct2026                                       */
+/* Revision date:    19oct2026                                       */
+/* ***************************************************************** */
+
+#ifndef TEST_EVENTLOG_HOST_H_
+#define TEST_EVENTLOG_HOST_H_
+
+#include "binframe.h"
+
+/* records of EVENTLOG_RECORD_SIZE (10) bytes in the largest frame */
+#define EVENTLOG_HOST_MAX_RECORDS   (BINPROTO_MAX_PAYLOAD / 10U)
+
+/* longest text of an event */
+#define EVENTLOG_HOST_TEXT_SIZE     96U
+
+typedef struct eventlog_host_record_type {
+    unsigned int uiTime;                // 100 ms ticks since the boot
+    unsigned char ucId;
+    unsigned char ucArg;
+    int iValue;
+} eventlog_host_record_type;
+
+typedef struct eventlog_host_type {
+    unsigned char ucStarted;
+    unsigned char ucNextSeq;
+    /* totals */
+    unsigned int uiFrames;
+    unsigned int uiRecords;
+    unsigned int uiLost;                // overwritten on the board (LOST)
+    unsigned int uiMissingFrames;       // SEQ gaps
+    unsigned int uiBadFrames;           // payload not LOST plus whole records
+} eventlog_host_type;
+
+/* ************************************************** */
+/* Method name:        eventlogHost_init              */
+/* Method description: Clear the decoder state        */
+/* Input params:       pLog: decoder                  */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void eventlogHost_init(eventlog_host_type *pLog);
+
+/* ************************************************** */
+/* Method name:        eventlogHost_decodeFrame       */
+/* Method description: Read the records of a log frame*/
+/* Input params:       pLog: decoder                  */
+/*                     pFrame: frame found by         */
+/*                     binframe_parse                 */
+/*                     pRecords: room for             */
+/*                     EVENTLOG_HOST_MAX_RECORDS      */
+/*                     pucLost: LOST of the frame     */
+/* Output params:      records read, 0 also for a     */
+/*                     frame that is not a log frame  */
+/* ************************************************** */
+unsigned char eventlogHost_decodeFrame(eventlog_host_type *pLog, const binframe_parser_type *pFrame,
+                                       eventlog_host_record_type *pRecords, unsigned char *pucLost);
+
+/* ************************************************** */
+/* Method name:        eventlogHost_format            */
+/* Method description: Text of an event: %c is ARG as */
+/*                     a character, %u ARG as a number*/
+/*                     and %d VALUE                   */
+/* Input params:       pRecord: event                 */
+/*                     cText: EVENTLOG_HOST_TEXT_SIZE */
+/*                     chars                          */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void eventlogHost_format(const eventlog_host_record_type *pRecord, char *cText);
+
+#endif /* TEST_EVENTLOG_HOST_H_ */
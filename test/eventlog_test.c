@@ -0,0 +1,241 @@
+/* ***************************************************************** */
+/* File name:        eventlog_test.c                                 */
+/* File description: Round trip of the event log: events written on  */
+/*                   the firmware side (eventlog.c, and the commands */
+/*                   that log) are sent by eventlog_update through   */
+/*                   the UART shim and read back with the host       */
+/*                   decoder, records and text                       */
+/* Author name:      Grupo 18 - Renato Pepe                          */
+/*                              Joao Victor Matoso                   */
+/* Creation date:    19oct2026                                       */
+/* Revision date:    19oct2026                                       */
+/* ***************************************************************** */
+
+#include <stdio.h>
+#include <string.h>
+#include "eventlog.h"
+#include "UART.h"
+#include "uart_shim.h"
+#include "hostboard.h"
+#include "hosttest.h"
+#include "binframe.h"
+#include "eventlog_host.h"
+
+/* events written in the overflow test, more than the ring keeps */
+#define EVENTLOG_TEST_BURST     40U
+
+/* most records collected from a capture */
+#define EVENTLOG_TEST_RECORDS   64U
+
+typedef struct eventlog_test_capture_type {
+    eventlog_host_type log;
+    eventlog_host_record_type records[EVENTLOG_TEST_RECORDS];
+    unsigned int uiRecords;
+    unsigned int uiLost;
+    unsigned int uiFirstLost;           // LOST of the first frame
+    unsigned int uiMaxPerFrame;
+} eventlog_test_capture_type;
+
+/* ************************************************** */
+/* Method name:        eventlogTest_command           */
+/* Method description: Receive an ASCII command and   */
+/*                     run it as the main loop does   */
+/* Input params:       cCommand: command text         */
+/* Output params:      n/a                            */
+/* ************************************************** */
+static void eventlogTest_command(const char *cCommand)
+{
+    while(*cCommand)
+        uartShim_receive((unsigned char)*cCommand++);
+    UART0_processReceived();
+}
+
+/* ************************************************** */
+/* Method name:        eventlogTest_flush             */
+/* Method description: Send every stored event and    */
+/*                     decode what went on the line   */
+/* Input params:       pCapture: decoded frames       */
+/* Output params:      n/a                            */
+/* ************************************************** */
+static void eventlogTest_flush(eventlog_test_capture_type *pCapture)
+{
+    binframe_parser_type parser;
+    const unsigned char *pucTx;
+    unsigned int uiLength, uiIndex, uiTxBytes;
+
+    memset(pCapture, 0, sizeof(*pCapture));
+    eventlogHost_init(&pCapture->log);
+    binframe_init(&parser);
+
+    /* one frame per call, like the main loop */
+    do {
+        uiTxBytes = uartShim_getTxBytes();
+        eventlog_update();
+    } while(uiTxBytes != uartShim_getTxBytes());
+
+    pucTx = uartShim_getCapture(&uiLength);
+    for(uiIndex = 0; uiIndex < uiLength; uiIndex++){
+        eventlog_host_record_type records[EVENTLOG_HOST_MAX_RECORDS];
+        unsigned char ucCount, ucLost;
+
+        if(!binframe_parse(&parser, pucTx[uiIndex]))
+            continue;
+        ucCount = eventlogHost_decodeFrame(&pCapture->log, &parser, records, &ucLost);
+        if(1 == pCapture->log.uiFrames)
+            pCapture->uiFirstLost = ucLost;
+        pCapture->uiLost += ucLost;
+        if(pCapture->uiMaxPerFrame < ucCount)
+            pCapture->uiMaxPerFrame = ucCount;
+        if(EVENTLOG_TEST_RECORDS - pCapture->uiRecords < ucCount)
+            ucCount = (unsigned char)(EVENTLOG_TEST_RECORDS - pCapture->uiRecords);
+        memcpy(&pCapture->records[pCapture->uiRecords], records, ucCount * sizeof(records[0]));
+        pCapture->uiRecords += ucCount;
+    }
+    hostTest_expectInt(parser.uiErrors, 0, "log frames with a bad CRC");
+    uartShim_reset();
+}
+
+/* ************************************************** */
+/* Method name:        eventlogTest_expectRecord      */
+/* Method description: Check a decoded event and its  */
+/*                     text                           */
+/* Input params:       pRecord: decoded event         */
+/*                     uiTime, eId, ucArg, iValue:    */
+/*                     event written                  */
+/*                     cText: expected text           */
+/* Output params:      n/a                            */
+/* ************************************************** */
+static void eventlogTest_expectRecord(const eventlog_host_record_type *pRecord, unsigned int uiTime, eventlog_id_type eId,
+                                      unsigned char ucArg, int iValue, const char *cText)
+{
+    char cDecoded[EVENTLOG_HOST_TEXT_SIZE];
+
+    hostTest_expectInt(pRecord->uiTime, uiTime, "event time");
+    hostTest_expectInt(pRecord->ucId, eId, "event ID");
+    hostTest_expectInt(pRecord->ucArg, ucArg, "event ARG");
+    hostTest_expectInt(pRecord->iValue, iValue, "event VALUE");
+    eventlogHost_format(pRecord, cDecoded);
+    hostTest_expectString(cDecoded, cText, "event text");
+}
+
+/* ************************************************** */
+/* Method name:        eventlogTest_roundTrip         */
+/* Method description: Every kind of event, from the  */
+/*                     commands and written directly  */
+/* Input params:       n/a                            */
+/* Output params:      n/a                            */
+/* ************************************************** */
+static void eventlogTest_roundTrip(void)
+{
+    eventlog_test_capture_type capture;
+
+    /* EVENTLOG_BOOT was written by eventlog_init at time 0 */
+    eventlog_setEnabled(1);
+    hostBoard_advanceMs(1500);
+    eventlogTest_command("#st30;");
+    eventlogTest_command("#st99;");
+    hostBoard_advanceMs(200);
+    eventlog_write(EVENTLOG_RX_OVERFLOW, 0, 3);
+    eventlog_write(EVENTLOG_BAUD_RATE, 0, 57600);
+    eventlog_write(EVENTLOG_PROTOCOL, 1, 0);
+    eventlog_write(EVENTLOG_PARAM_INVALID, 'h', -2500);
+    eventlogTest_flush(&capture);
+
+    if(!hostTest_expectInt(capture.uiRecords, 7, "events of the round trip"))
+        return;
+    hostTest_expectInt(capture.uiLost, 0, "events lost in the round trip");
+    eventlogTest_expectRecord(&capture.records[0], 0, EVENTLOG_BOOT, 0, 0, "boot");
+    eventlogTest_expectRecord(&capture.records[1], 15, EVENTLOG_PARAM_SET, 't', 30000, "parameter t set to 30000/1000");
+    eventlogTest_expectRecord(&capture.records[2], 15, EVENTLOG_PARAM_RANGE, 't', 99000, "parameter t refused 99000/1000, out of range");
+    eventlogTest_expectRecord(&capture.records[3], 17, EVENTLOG_RX_OVERFLOW, 0, 3, "UART receive overflow, 3 in total");
+    eventlogTest_expectRecord(&capture.records[4], 17, EVENTLOG_BAUD_RATE, 0, 57600, "baud rate changed to 57600");
+    eventlogTest_expectRecord(&capture.records[5], 17, EVENTLOG_PROTOCOL, 1, 0, "protocol 1 (0 ASCII, 1 Modbus RTU)");
+    eventlogTest_expectRecord(&capture.records[6], 17, EVENTLOG_PARAM_INVALID, 'h', -2500, "parameter h refused -2500/1000 by the setter");
+
+    /* nothing is sent while disabled, the events wait in the ring */
+    eventlog_setEnabled(0);
+    eventlog_write(EVENTLOG_BOOT, 0, 0);
+    eventlogTest_flush(&capture);
+    hostTest_expectInt(capture.uiRecords, 0, "events sent while disabled");
+    eventlog_setEnabled(1);
+    eventlogTest_flush(&capture);
+    hostTest_expectInt(capture.uiRecords, 1, "events kept while disabled");
+}
+
+/* ************************************************** */
+/* Method name:        eventlogTest_overflow          */
+/* Method description: More events than the ring: the */
+/*                     newest are kept and LOST counts*/
+/*                     the rest                       */
+/* Input params:       n/a                            */
+/* Output params:      n/a                            */
+/* ************************************************** */
+static void eventlogTest_overflow(void)
+{
+    eventlog_test_capture_type capture;
+    unsigned int uiIndex, uiKept = EVENTLOG_SIZE - 1U;
+
+    for(uiIndex = 0; uiIndex < EVENTLOG_TEST_BURST; uiIndex++)
+        eventlog_write(EVENTLOG_PARAM_SET, (unsigned char)('a' + uiIndex % 26U), (int)uiIndex);
+    eventlogTest_flush(&capture);
+
+    hostTest_expectInt(capture.uiRecords, uiKept, "events kept by the ring");
+    hostTest_expectInt(capture.uiFirstLost, EVENTLOG_TEST_BURST - uiKept, "LOST of the first frame");
+    hostTest_expectInt(capture.uiLost, EVENTLOG_TEST_BURST - uiKept, "LOST of all the frames");
+    hostTest_expectInt(capture.log.uiMissingFrames, 0, "SEQ gaps");
+    hostTest_expect(EVENTLOG_HOST_MAX_RECORDS >= capture.uiMaxPerFrame, "records per frame");
+    for(uiIndex = 0; uiIndex < capture.uiRecords; uiIndex++)
+        if(!hostTest_expectInt(capture.records[uiIndex].iValue, (int)(EVENTLOG_TEST_BURST - uiKept + uiIndex), "order of the kept events"))
+            break;
+}
+
+/* ************************************************** */
+/* Method name:        eventlogTest_decoder           */
+/* Method description: Frames the board does not send*/
+/*                     in the normal case: SEQ gaps,  */
+/*                     bad length, unknown IDs        */
+/* Input params:       n/a                            */
+/* Output params:      n/a                            */
+/* ************************************************** */
+static void eventlogTest_decoder(void)
+{
+    static const unsigned char ucRecord[1 + EVENTLOG_RECORD_SIZE] = {0, 10, 0, 0, 0, 200, 1, 2, 0, 0, 0};
+    eventlog_host_record_type records[EVENTLOG_HOST_MAX_RECORDS];
+    unsigned char ucFrame[BINFRAME_MAX_SIZE], ucLength, ucIndex, ucLost;
+    binframe_parser_type parser;
+    eventlog_host_type log;
+    char cText[EVENTLOG_HOST_TEXT_SIZE];
+
+    binframe_init(&parser);
+    eventlogHost_init(&log);
+
+    /* frames 5 and 7 */
+    ucLength = binframe_build(BINPROTO_CMD_LOG, 5, ucRecord, sizeof(ucRecord), ucFrame);
+    ucLength += binframe_build(BINPROTO_CMD_LOG, 7, ucRecord, sizeof(ucRecord), &ucFrame[ucLength]);
+    for(ucIndex = 0; ucIndex < ucLength; ucIndex++)
+        if(binframe_parse(&parser, ucFrame[ucIndex]))
+            eventlogHost_decodeFrame(&log, &parser, records, &ucLost);
+    hostTest_expectInt(log.uiMissingFrames, 1, "SEQ gap found");
+    hostTest_expectInt(log.uiRecords, 2, "records of the SEQ test");
+
+    eventlogHost_format(&records[0], cText);
+    hostTest_expectString(cText, "event 200 (arg 1, value 2)", "text of an unknown ID");
+
+    /* LOST and a partial record */
+    ucLength = binframe_build(BINPROTO_CMD_LOG, 8, ucRecord, sizeof(ucRecord) - 1, ucFrame);
+    for(ucIndex = 0; ucIndex < ucLength; ucIndex++)
+        if(binframe_parse(&parser, ucFrame[ucIndex]))
+            hostTest_expectInt(eventlogHost_decodeFrame(&log, &parser, records, &ucLost), 0, "records of a bad frame");
+    hostTest_expectInt(log.uiBadFrames, 1, "bad frame found");
+}
+
+int main(void)
+{
+    hostBoard_init();
+    uartShim_reset();
+
+    eventlogTest_roundTrip();
+    eventlogTest_overflow();
+    eventlogTest_decoder();
+    return hostTest_report("eventlog_test");
+}
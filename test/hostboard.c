@@ -0,0 +1,68 @@
+/* ***************************************************************** */
+/* File name:        hostboard.c                                     */
+/* File description: Firmware start and simulated time on the host   */
+/* Author name:      Grupo 18 - Renato Pepe                          */
+/*                              Joao Victor Matoso                   */
+/* Creation date:    19oct2026                                       */
+/* Revision date:    19oct2026                                       */
+/* ***************************************************************** */
+
+#include "hostboard.h"
+#include "rtc_shim.h"
+#include "pid.h"
+#include "fanControl.h"
+#include "timer.h"
+#include "schedule.h"
+#include "publish.h"
+#include "eventlog.h"
+#include "paramRegistry.h"
+#include "node.h"
+
+unsigned int uiHostBoardUptimeMs = 0;
+
+/* ************************************************** */
+/* Method name:        hostBoard_init                 */
+/* Method description: Start the firmware modules     */
+/* Input params:       n/a                            */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void hostBoard_init(void)
+{
+    pid_init();
+    fanControl_init();
+    timer_init(HOSTBOARD_TICK_MS);
+    schedule_init();
+    publish_init();
+    eventlog_init();
+    param_init();
+    node_init();
+}
+
+/* ************************************************** */
+/* Method name:        hostBoard_advanceMs            */
+/* Method description: Let the time pass: the RTC     */
+/*                     counts and timer_tick runs     */
+/*                     every HOSTBOARD_TICK_MS        */
+/* Input params:       uiMs: milliseconds             */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void hostBoard_advanceMs(unsigned int uiMs)
+{
+    while(uiMs--){
+        rtcShim_advanceMs(1);
+        if(0 == ++uiHostBoardUptimeMs % HOSTBOARD_TICK_MS)
+            timer_tick();
+    }
+}
+
+/* ************************************************** */
+/* Method name:        hostBoard_getUptimeMs          */
+/* Method description: Simulated time since           */
+/*                     hostBoard_init                 */
+/* Input params:       n/a                            */
+/* Output params:      milliseconds                   */
+/* ************************************************** */
+unsigned int hostBoard_getUptimeMs(void)
+{
+    return uiHostBoardUptimeMs;
+}
@@ -0,0 +1,46 @@
+/* ***************************************************************** */
+/* File name:        hostboard.h                                     */
+/* File description: The firmware modules started as boardInit and   */
+/*                   boardInitSerial do, on the host shims, and the  */
+/*                   simulated time: the RTC and the 100 ms timer    */
+/*                   tick of the LPTMR                               */
+/* Author name:      Grupo 18 - Renato Pepe                          */
+/*                              Joao Victor Matoso                   */
+/* Creation date:    19oct2026                                       */
+/* Revision date:    19oct2026                                       */
+/* ***************************************************************** */
+
+#ifndef TEST_HOSTBOARD_H_
+#define TEST_HOSTBOARD_H_
+
+/* period of periodic_interruption on the board */
+#define HOSTBOARD_TICK_MS       100U
+
+/* ************************************************** */
+/* Method name:        hostBoard_init                 */
+/* Method description: Start the firmware modules     */
+/* Input params:       n/a                            */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void hostBoard_init(void);
+
+/* ************************************************** */
+/* Method name:        hostBoard_advanceMs            */
+/* Method description: Let the time pass: the RTC     */
+/*                     counts and timer_tick runs     */
+/*                     every HOSTBOARD_TICK_MS        */
+/* Input params:       uiMs: milliseconds             */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void hostBoard_advanceMs(unsigned int uiMs);
+
+/* ************************************************** */
+/* Method name:        hostBoard_getUptimeMs          */
+/* Method description: Simulated time since           */
+/*                     hostBoard_init                 */
+/* Input params:       n/a                            */
+/* Output params:      milliseconds                   */
+/* ************************************************** */
+unsigned int hostBoard_getUptimeMs(void);
+
+#endif /* TEST_HOSTBOARD_H_ */
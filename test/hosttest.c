@@ -0,0 +1,74 @@
+/* ***************************************************************** */
+/* File name:        hosttest.c                                      */
+/* File description: Checks shared by the host tests                 */
+/* Author name:      Grupo 18 - Renato Pepe                          */
+/*                              Joao Victor Matoso                   */
+/* Creation date:    19oct2026                                       */
+/* Revision date:    19oct2026                                       */
+/* ***************************************************************** */
+
+#include <stdio.h>
+#include <string.h>
+#include "hosttest.h"
+
+unsigned int uiHostTestChecks = 0;
+unsigned int uiHostTestFailures = 0;
+
+/* ************************************************** */
+/* Method name:        hostTest_expect                */
+/* Method description: Check a condition              */
+/* Input params:       ucPassed: condition            */
+/*                     cWhat: what was checked        */
+/* Output params:      ucPassed                       */
+/* ************************************************** */
+unsigned char hostTest_expect(unsigned char ucPassed, const char *cWhat)
+{
+    uiHostTestChecks++;
+    if(!ucPassed){
+        uiHostTestFailures++;
+        printf("  FAIL: %s\n", cWhat);
+    }
+    return ucPassed;
+}
+
+/* ************************************************** */
+/* Method name:        hostTest_expectInt             */
+/* Method description: Check a value                  */
+/* Input params:       llGot, llExpected: values      */
+/*                     cWhat: what was checked        */
+/* Output params:      1 if equal                     */
+/* ************************************************** */
+unsigned char hostTest_expectInt(long long llGot, long long llExpected, const char *cWhat)
+{
+    if(!hostTest_expect(llGot == llExpected, cWhat))
+        printf("        got %lld, expected %lld\n", llGot, llExpected);
+    return llGot == llExpected;
+}
+
+/* ************************************************** */
+/* Method name:        hostTest_expectString          */
+/* Method description: Check a text                   */
+/* Input params:       cGot, cExpected: texts         */
+/*                     cWhat: what was checked        */
+/* Output params:      1 if equal                     */
+/* ************************************************** */
+unsigned char hostTest_expectString(const char *cGot, const char *cExpected, const char *cWhat)
+{
+    unsigned char ucEqual = !strcmp(cGot, cExpected);
+
+    if(!hostTest_expect(ucEqual, cWhat))
+        printf("        got \"%s\", expected \"%s\"\n", cGot, cExpected);
+    return ucEqual;
+}
+
+/* ************************************************** */
+/* Method name:        hostTest_report                */
+/* Method description: Print the totals               */
+/* Input params:       cTest: name of the test        */
+/* Output params:      exit code, 0 if all passed     */
+/* ************************************************** */
+int hostTest_report(const char *cTest)
+{
+    printf("%s: %u checks, %u failed\n", cTest, uiHostTestChecks, uiHostTestFailures);
+    return uiHostTestFailures ? 1 : 0;
+}
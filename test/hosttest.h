@@ -0,0 +1,50 @@
+/* ***************************************************************** */
+/* File name:        hosttest.h                                      */
+/* File description: Checks shared by the host tests: each failed    */
+/*                   check is printed, hostTest_report gives the     */
+/*                   exit code                                       */
+/* Author name:      Grupo 18 - Renato Pepe                          */
+/*                              Joao Victor Matoso                   */
+/* Creation date:    19oct2026                                       */
+/* Revision date:    19oct2026                                       */
+/* ***************************************************************** */
+
+#ifndef TEST_HOSTTEST_H_
+#define TEST_HOSTTEST_H_
+
+/* ************************************************** */
+/* Method name:        hostTest_expect                */
+/* Method description: Check a condition              */
+/* Input params:       ucPassed: condition            */
+/*                     cWhat: what was checked        */
+/* Output params:      ucPassed                       */
+/* ************************************************** */
+unsigned char hostTest_expect(unsigned char ucPassed, const char *cWhat);
+
+/* ************************************************** */
+/* Method name:        hostTest_expectInt             */
+/* Method description: Check a value                  */
+/* Input params:       llGot, llExpected: values      */
+/*                     cWhat: what was checked        */
+/* Output params:      1 if equal                     */
+/* ************************************************** */
+unsigned char hostTest_expectInt(long long llGot, long long llExpected, const char *cWhat);
+
+/* ************************************************** */
+/* Method name:        hostTest_expectString          */
+/* Method description: Check a text                   */
+/* Input params:       cGot, cExpected: texts         */
+/*                     cWhat: what was checked        */
+/* Output params:      1 if equal                     */
+/* ************************************************** */
+unsigned char hostTest_expectString(const char *cGot, const char *cExpected, const char *cWhat);
+
+/* ************************************************** */
+/* Method name:        hostTest_report                */
+/* Method description: Print the totals               */
+/* Input params:       cTest: name of the test        */
+/* Output params:      exit code, 0 if all passed     */
+/* ************************************************** */
+int hostTest_report(const char *cTest);
+
+#endif /* TEST_HOSTTEST_H_ */
@@ -0,0 +1,417 @@
+/* ***************************************************************** */
+/* File name:        interface_test.c                                */
+/* File description: The local interface of the menu table           */
+/*                   (interfacelocal.c) against the switch it        */
+/*                   replaced (legacy_interface.c). The same script  */
+/*                   of buttons, sensor values and time goes through */
+/*                   every menu with each handler, each in its own   */
+/*                   process from the same start; the LCD must show  */
+/*                   the same lines after every refresh. Then both   */
+/*                   are timed on each menu, with nothing changing   */
+/*                   and with the temperature changing every refresh */
+/*                   Usage: interface_test [calls]                   */
+/* Author name:      Grupo 18 - Renato Pepe                          */
+/*                              Joao Victor Matoso                   */
+/* Creation date:    19oct2026                                       */
+/* Revision date:    19oct2026                                       */
+/* ***************************************************************** */
+
+/* fork, pipe, clock_gettime */
+#define _POSIX_C_SOURCE 200112L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include "interfacelocal.h"
+#include "legacy_interface.h"
+#include "keypad_shim.h"
+#include "lcd_shim.h"
+#include "board_stubs.h"
+#include "hostboard.h"
+#include "hosttest.h"
+
+#define INTERFACE_TEST_CALLS        20000U
+
+/* refreshes recorded by the script */
+#define INTERFACE_TEST_MAX_SCREENS  4096U
+
+/* events queued before a refresh, under KEYPAD_QUEUE_SIZE */
+#define INTERFACE_TEST_BURST        8U
+
+/* the menus in the order button 4 steps through them, the UART one is the start */
+#define INTERFACE_TEST_MENUS        12U
+#define INTERFACE_TEST_TIMERSET     9U
+#define INTERFACE_TEST_TIMERSTATUS  10U
+
+/* timer set up before the timer status menu: 12 min, to show both formats */
+#define INTERFACE_TEST_TIMER_S      720U
+
+static const char *cInterfaceTestMenus[INTERFACE_TEST_MENUS] = {
+    "Aq= Co=", "T SP=", "COOLMAX", "PID is", "Kp", "Ki", "Kd", "C:DC R=", "Aq:DC", "P: t:", "is t:", "UART is"
+};
+
+typedef struct {
+    char cLine[LCD_SHIM_LINES][LCD_SHIM_COLUMNS + 1];
+} interface_test_screen_type;
+
+typedef struct {
+    double dIdleNs[INTERFACE_TEST_MENUS];       // per refresh, nothing changes
+    double dBusyNs[INTERFACE_TEST_MENUS];       // per refresh, the temperature changes
+    double dIdleWrites[INTERFACE_TEST_MENUS];   // lcd_writeText per refresh
+    double dBusyWrites[INTERFACE_TEST_MENUS];
+} interface_test_timing_type;
+
+/* set up of the timer, in interfacelocal.c */
+extern unsigned int uiTimerConfigTimeSeconds;
+
+void (*fInterfaceTestHandler)(void);
+interface_test_screen_type interfaceTestScreens[INTERFACE_TEST_MAX_SCREENS];
+unsigned int uiInterfaceTestScreens = 0;
+
+/* ************************************************** */
+/* Method name:        interfaceTest_getSeconds       */
+/* Method description: Monotonic time                 */
+/* Input params:       n/a                            */
+/* Output params:      seconds                        */
+/* ************************************************** */
+static double interfaceTest_getSeconds(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (double)now.tv_sec + (double)now.tv_nsec * 1e-9;
+}
+
+/* ************************************************** */
+/* Method name:        interfaceTest_refresh          */
+/* Method description: Run the handler, as main.c     */
+/*                     does every 500 ms, and keep    */
+/*                     the screen                     */
+/* Input params:       n/a                            */
+/* Output params:      n/a                            */
+/* ************************************************** */
+static void interfaceTest_refresh(void)
+{
+    unsigned char ucLine;
+
+    fInterfaceTestHandler();
+    if(INTERFACE_TEST_MAX_SCREENS <= uiInterfaceTestScreens)
+        return;
+    for(ucLine = 0; ucLine < LCD_SHIM_LINES; ucLine++)
+        strcpy(interfaceTestScreens[uiInterfaceTestScreens].cLine[ucLine], lcdShim_getLine(ucLine));
+    uiInterfaceTestScreens++;
+}
+
+/* ************************************************** */
+/* Method name:        interfaceTest_tap              */
+/* Method description: Press and release a button     */
+/* Input params:       ucKey: 2 to 4                  */
+/* Output params:      n/a                            */
+/* ************************************************** */
+static void interfaceTest_tap(unsigned char ucKey)
+{
+    keypadShim_press(ucKey);
+    keypadShim_release(ucKey);
+    interfaceTest_refresh();
+}
+
+/* ************************************************** */
+/* Method name:        interfaceTest_hold             */
+/* Method description: Hold a button while it repeats */
+/* Input params:       ucKey: 2 or 3                  */
+/*                     uiRepeats: repeat events       */
+/* Output params:      n/a                            */
+/* ************************************************** */
+static void interfaceTest_hold(unsigned char ucKey, unsigned int uiRepeats)
+{
+    unsigned int uiIndex;
+
+    keypadShim_press(ucKey);
+    for(uiIndex = 1; uiIndex <= uiRepeats; uiIndex++){
+        keypadShim_repeat(ucKey);
+        if(0 == uiIndex % INTERFACE_TEST_BURST)
+            interfaceTest_refresh();
+    }
+    keypadShim_release(ucKey);
+    interfaceTest_refresh();
+}
+
+/* ************************************************** */
+/* Method name:        interfaceTest_combo            */
+/* Method description: Press button 2 while button 3  */
+/*                     is held                        */
+/* Input params:       n/a                            */
+/* Output params:      n/a                            */
+/* ************************************************** */
+static void interfaceTest_combo(void)
+{
+    keypadShim_press(3);
+    interfaceTest_refresh();
+    keypadShim_press(2);
+    keypadShim_release(2);
+    keypadShim_release(3);
+    interfaceTest_refresh();
+}
+
+/* ************************************************** */
+/* Method name:        interfaceTest_menu             */
+/* Method description: Buttons and sensor changes on  */
+/*                     the menu shown                 */
+/* Input params:       ucMenu: menu shown             */
+/* Output params:      n/a                            */
+/* ************************************************** */
+static void interfaceTest_menu(unsigned char ucMenu)
+{
+    unsigned int uiIndex;
+
+    interfaceTest_refresh();
+
+    /* at the bottom of the timer ranges before the generic presses */
+    if(INTERFACE_TEST_TIMERSET == ucMenu){
+        interfaceTest_tap(2);
+        interfaceTest_hold(3, 70);
+        interfaceTest_hold(3, 70);
+        interfaceTest_hold(3, 2000);
+        interfaceTest_hold(2, 40);
+        interfaceTest_hold(2, 2000);
+    }
+
+    interfaceTest_tap(2);
+    interfaceTest_tap(3);
+    interfaceTest_tap(3);
+    interfaceTest_hold(3, 12);
+    interfaceTest_hold(2, 20);
+    interfaceTest_hold(3, 100);
+    interfaceTest_combo();
+    interfaceTest_combo();
+
+    boardStub_setTemperature(31.7f);
+    boardStub_setSpeed(23456);
+    interfaceTest_refresh();
+    boardStub_setTemperature(24.2f);
+    boardStub_setSpeed(870);
+    interfaceTest_refresh();
+    interfaceTest_refresh();
+
+    /* the time left crosses 10 min, then the timer expires */
+    if(INTERFACE_TEST_TIMERSTATUS == ucMenu){
+        interfaceTest_tap(2);
+        uiTimerConfigTimeSeconds = INTERFACE_TEST_TIMER_S;
+        interfaceTest_tap(3);
+        for(uiIndex = 0; uiIndex < INTERFACE_TEST_TIMER_S / 20U + 2U; uiIndex++){
+            hostBoard_advanceMs(20000);
+            interfaceTest_refresh();
+        }
+        interfaceTest_tap(3);
+        hostBoard_advanceMs(5000);
+        interfaceTest_tap(2);
+    }
+}
+
+/* ************************************************** */
+/* Method name:        interfaceTest_script           */
+/* Method description: Walk every menu from the start */
+/*                     screen                         */
+/* Input params:       n/a                            */
+/* Output params:      n/a                            */
+/* ************************************************** */
+static void interfaceTest_script(void)
+{
+    unsigned char ucMenu;
+
+    /* start screen: UART on, button 4 turns the buttons on, button 2 back off */
+    interfaceTest_refresh();
+    interfaceTest_tap(4);
+    interfaceTest_tap(2);
+    interfaceTest_tap(4);
+
+    for(ucMenu = 0; ucMenu < INTERFACE_TEST_MENUS - 1U; ucMenu++){
+        interfaceTest_tap(4);
+        interfaceTest_menu(ucMenu);
+    }
+
+    /* with the buttons on, the UART menu passes button 4 on to the first menu */
+    interfaceTest_tap(4);
+    interfaceTest_refresh();
+}
+
+/* ************************************************** */
+/* Method name:        interfaceTest_time             */
+/* Method description: Time the refresh of the menu   */
+/*                     shown                          */
+/* Input params:       ucMenu: menu shown             */
+/*                     uiCalls: refreshes             */
+/*                     pTiming: result                */
+/* Output params:      n/a                            */
+/* ************************************************** */
+static void interfaceTest_time(unsigned char ucMenu, unsigned int uiCalls, interface_test_timing_type *pTiming)
+{
+    unsigned int uiIndex, uiWrites;
+    double dStart;
+
+    uiWrites = lcdShim_getWrites();
+    dStart = interfaceTest_getSeconds();
+    for(uiIndex = 0; uiIndex < uiCalls; uiIndex++)
+        fInterfaceTestHandler();
+    pTiming->dIdleNs[ucMenu] = (interfaceTest_getSeconds() - dStart) * 1e9 / uiCalls;
+    pTiming->dIdleWrites[ucMenu] = (double)(lcdShim_getWrites() - uiWrites) / uiCalls;
+
+    uiWrites = lcdShim_getWrites();
+    dStart = interfaceTest_getSeconds();
+    for(uiIndex = 0; uiIndex < uiCalls; uiIndex++){
+        boardStub_setTemperature((uiIndex & 1U) ? 25.0f : 26.0f);
+        fInterfaceTestHandler();
+    }
+    pTiming->dBusyNs[ucMenu] = (interfaceTest_getSeconds() - dStart) * 1e9 / uiCalls;
+    pTiming->dBusyWrites[ucMenu] = (double)(lcdShim_getWrites() - uiWrites) / uiCalls;
+    boardStub_setTemperature(25.0f);
+}
+
+/* ************************************************** */
+/* Method name:        interfaceTest_readAll          */
+/* Method description: Read a block from a pipe       */
+/* Input params:       iFd: pipe                      */
+/*                     pvData, uiSize: block          */
+/* Output params:      1 if it was all read           */
+/* ************************************************** */
+static unsigned char interfaceTest_readAll(int iFd, void *pvData, unsigned int uiSize)
+{
+    unsigned char *pucData = pvData;
+    ssize_t iRead;
+
+    while(uiSize){
+        iRead = read(iFd, pucData, uiSize);
+        if(0 >= iRead)
+            return 0;
+        pucData += iRead;
+        uiSize -= (unsigned int)iRead;
+    }
+    return 1;
+}
+
+/* ************************************************** */
+/* Method name:        interfaceTest_writeAll         */
+/* Method description: Write a block to a pipe        */
+/* Input params:       iFd: pipe                      */
+/*                     pvData, uiSize: block          */
+/* Output params:      n/a                            */
+/* ************************************************** */
+static void interfaceTest_writeAll(int iFd, const void *pvData, unsigned int uiSize)
+{
+    const unsigned char *pucData = pvData;
+    ssize_t iWritten;
+
+    while(uiSize){
+        iWritten = write(iFd, pucData, uiSize);
+        if(0 >= iWritten)
+            _exit(1);
+        pucData += iWritten;
+        uiSize -= (unsigned int)iWritten;
+    }
+}
+
+/* ************************************************** */
+/* Method name:        interfaceTest_run              */
+/* Method description: Run the script and the timing  */
+/*                     with a handler in a process    */
+/*                     started from the same state    */
+/* Input params:       fHandler: handler              */
+/*                     uiCalls: refreshes per menu    */
+/*                     pScreens: screens of the       */
+/*                     script, INTERFACE_TEST_MAX_    */
+/*                     SCREENS at most                */
+/*                     pTiming: timing                */
+/* Output params:      screens recorded, 0 if the     */
+/*                     process failed                 */
+/* ************************************************** */
+static unsigned int interfaceTest_run(void (*fHandler)(void), unsigned int uiCalls,
+                                      interface_test_screen_type *pScreens, interface_test_timing_type *pTiming)
+{
+    unsigned int uiScreens = 0;
+    int iPipe[2], iStatus;
+    pid_t pid;
+
+    fflush(stdout);
+    if(pipe(iPipe))
+        return 0;
+    pid = fork();
+    if(0 > pid)
+        return 0;
+
+    if(0 == pid){
+        interface_test_timing_type timing;
+        unsigned char ucMenu;
+
+        close(iPipe[0]);
+        fInterfaceTestHandler = fHandler;
+
+        /* the UART menu is only shown from the start */
+        interfaceTest_time(INTERFACE_TEST_MENUS - 1U, uiCalls, &timing);
+        interfaceTest_script();
+        for(ucMenu = 0; ucMenu < INTERFACE_TEST_MENUS - 1U; ucMenu++){
+            interfaceTest_time(ucMenu, uiCalls, &timing);
+            interfaceTest_tap(4);
+        }
+        interfaceTest_writeAll(iPipe[1], &uiInterfaceTestScreens, sizeof(uiInterfaceTestScreens));
+        interfaceTest_writeAll(iPipe[1], interfaceTestScreens, uiInterfaceTestScreens * sizeof(interfaceTestScreens[0]));
+        interfaceTest_writeAll(iPipe[1], &timing, sizeof(timing));
+        _exit(0);
+    }
+
+    close(iPipe[1]);
+    if(!interfaceTest_readAll(iPipe[0], &uiScreens, sizeof(uiScreens))
+       || INTERFACE_TEST_MAX_SCREENS < uiScreens
+       || !interfaceTest_readAll(iPipe[0], pScreens, uiScreens * sizeof(pScreens[0]))
+       || !interfaceTest_readAll(iPipe[0], pTiming, sizeof(*pTiming)))
+        uiScreens = 0;
+    close(iPipe[0]);
+    waitpid(pid, &iStatus, 0);
+    if(!WIFEXITED(iStatus) || WEXITSTATUS(iStatus))
+        return 0;
+    return uiScreens;
+}
+
+int main(int argc, char **argv)
+{
+    static interface_test_screen_type legacyScreens[INTERFACE_TEST_MAX_SCREENS], tableScreens[INTERFACE_TEST_MAX_SCREENS];
+    interface_test_timing_type legacyTiming, tableTiming;
+    unsigned int uiCalls = (1 < argc) ? (unsigned int)strtoul(argv[1], 0, 10) : INTERFACE_TEST_CALLS;
+    unsigned int uiLegacy, uiTable, uiIndex, uiDifferent = 0;
+    unsigned char ucMenu, ucLine;
+
+    /* both processes start from here */
+    hostBoard_init();
+    keypadShim_reset();
+    lcdShim_reset();
+    boardStub_setTemperature(25.0f);
+    boardStub_setSpeed(12340);
+
+    uiLegacy = interfaceTest_run(legacy_localInterfaceHandler, uiCalls, legacyScreens, &legacyTiming);
+    uiTable = interfaceTest_run(localInterfaceHandler, uiCalls, tableScreens, &tableTiming);
+
+    hostTest_expect(0 != uiLegacy, "legacy handler run");
+    hostTest_expect(INTERFACE_TEST_MAX_SCREENS > uiLegacy, "script within the screens kept");
+    hostTest_expectInt(uiTable, uiLegacy, "refreshes of the script");
+
+    for(uiIndex = 0; uiIndex < uiLegacy && uiIndex < uiTable; uiIndex++){
+        for(ucLine = 0; ucLine < LCD_SHIM_LINES; ucLine++){
+            if(strcmp(tableScreens[uiIndex].cLine[ucLine], legacyScreens[uiIndex].cLine[ucLine]) && 5U > uiDifferent++)
+                printf("  refresh %u, line %u:\n", uiIndex, ucLine);
+            hostTest_expectString(tableScreens[uiIndex].cLine[ucLine], legacyScreens[uiIndex].cLine[ucLine], "LCD line");
+        }
+    }
+
+    printf("  %u refreshes compared, %u calls per menu timed\n", uiLegacy, uiCalls);
+    printf("  %-8s %10s %10s %10s %10s %12s\n", "menu", "idle old", "idle new", "temp old", "temp new", "writes o/n");
+    for(ucMenu = 0; ucMenu < INTERFACE_TEST_MENUS; ucMenu++)
+        printf("  %-8s %8.1fns %8.1fns %8.1fns %8.1fns %5.2f/%5.2f\n", cInterfaceTestMenus[ucMenu],
+               legacyTiming.dIdleNs[ucMenu], tableTiming.dIdleNs[ucMenu],
+               legacyTiming.dBusyNs[ucMenu], tableTiming.dBusyNs[ucMenu],
+               legacyTiming.dIdleWrites[ucMenu], tableTiming.dIdleWrites[ucMenu]);
+
+    return hostTest_report("interface_test");
+}
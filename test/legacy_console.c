@@ -0,0 +1,199 @@
+/* ***************************************************************** */
+/* File name:        legacy_console.c                                */
+/* File description: debug_printf and the responses of               */
+/*                   communicationStateMachine.c and paramRegistry.c */
+/*                   as they were before console.c, kept for         */
+/*                   console_bench. _doprint is the one of           */
+/*                   print_scan.c, built unchanged                   */
+/* Author name:      Grupo 18 - Renato Pepe                          */
+/*                              Joao Victor Matoso                   */
+/* Creation date:    19oct2026                                       */
+/* Revision date:    19oct2026                                       */
+/* ***************************************************************** */
+
+#include <stdarg.h>
+#include "legacy_console.h"
+#include "print_scan.h"
+#include "paramRegistry.h"
+#include "binaryProtocol.h"
+#include "UART.h"
+#include "util.h"
+
+/*Size of the batched get response line*/
+#define BATCH_LINE_SIZE     200
+
+/* keys of printParserStatistics */
+#define PARSER_STATISTICS   8U
+
+/* parser statistics of communicationStateMachine.c */
+extern unsigned int uiStatRxBytes;
+extern unsigned int uiStatCommands;
+extern unsigned int uiStatDropped;
+extern unsigned int uiStatGarbageBytes;
+extern unsigned int uiStatMaxResync;
+
+/* ************************************************** */
+/* Method name:        legacy_debugPutc               */
+/* Method description: debug_putc of                  */
+/*                     fsl_debug_console.c, one       */
+/*                     character to the UART          */
+/* Input params:       ch: character                  */
+/*                     stream: not used               */
+/* Output params:      0                              */
+/* ************************************************** */
+static int legacy_debugPutc(int ch, void *stream)
+{
+    const unsigned char c = (unsigned char) ch;
+
+    UART0_putChar(c);
+    return 0;
+}
+
+/* ************************************************** */
+/* Method name:        legacy_debugPrintf             */
+/* Method description: debug_printf of                */
+/*                     fsl_debug_console.c, each      */
+/*                     character to UART0_putChar     */
+/* Input params:       fmt_s: format of _doprint      */
+/* Output params:      characters sent                */
+/* ************************************************** */
+int legacy_debugPrintf(const char *fmt_s, ...)
+{
+   va_list  ap;
+   int  result;
+
+   va_start(ap, fmt_s);
+   result = _doprint(NULL, legacy_debugPutc, -1, (char *)fmt_s, ap);
+   va_end(ap);
+
+   return result;
+}
+
+/* ************************************************** */
+/* Method name:        legacy_returnParam             */
+/* Method description: returnParam before console.c,  */
+/*                     for the parameters without a   */
+/*                     printer of their own           */
+/* Input params:       ucParam: parameter letter      */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void legacy_returnParam(unsigned char ucParam){
+    const param_descriptor_type *pParam = param_findGet(ucParam);
+    char cResponseValueString[PARAM_VALUE_SIZE];
+
+    if(!pParam || pParam->fPrint)
+        return;
+
+    /* "<label> = <value> <unit>" */
+    param_formatValue(pParam, cResponseValueString);
+    legacy_debugPrintf(pParam->cLabel);
+    legacy_debugPrintf(" = ");
+    legacy_debugPrintf(cResponseValueString);
+    legacy_debugPrintf(" ");
+    legacy_debugPrintf(pParam->cUnit);
+    legacy_debugPrintf("\n \r");
+}
+
+/* ************************************************** */
+/* Method name:        legacy_returnParamList         */
+/* Method description: returnParamList before         */
+/*                     console.c, the line built with */
+/*                     append_string                  */
+/* Input params:       ucParams: letters, or "*"      */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void legacy_returnParamList(unsigned char *ucParams){
+    char cLine[BATCH_LINE_SIZE] = "";
+    char cValue[PARAM_VALUE_SIZE];
+    char cKey[3] = "x=";
+    const param_descriptor_type *pParam;
+    unsigned char ucIndex;
+
+    for(ucIndex = 0; ; ucIndex++){
+        /* '*' walks the whole registry, otherwise the letters given */
+        if('*' == ucParams[0]){
+            if(param_getCount() <= ucIndex)
+                break;
+            pParam = param_getByIndex(ucIndex);
+            if(!(PARAM_FLAG_GET & pParam->ucFlags))
+                continue;
+        }else{
+            if('\0' == ucParams[ucIndex])
+                break;
+            pParam = param_findGet(ucParams[ucIndex]);
+        }
+
+        /* parameters without a single value (e.g. the schedule table) are skipped */
+        if(param_formatValue(pParam, cValue)){
+            cKey[0] = pParam->ucLetter;
+            append_string(cLine, BATCH_LINE_SIZE, cKey);
+            append_string(cLine, BATCH_LINE_SIZE, cValue);
+            append_string(cLine, BATCH_LINE_SIZE, ";");
+        }
+    }
+    append_string(cLine, BATCH_LINE_SIZE, "\n \r");
+
+    /* one write for the whole response */
+    legacy_debugPrintf(cLine);
+}
+
+/* ************************************************** */
+/* Method name:        legacy_printBaudRate           */
+/* Method description: param_printBaudRate before     */
+/*                     console.c                      */
+/* Input params:       n/a                            */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void legacy_printBaudRate(void)
+{
+    char cValue[PARAM_VALUE_SIZE];
+    int iError = UART0_getBaudError();
+
+    legacy_debugPrintf("Baud rate = ");
+    param_formatUnsigned(UART0_getBaudRate(), cValue);
+    legacy_debugPrintf(cValue);
+    legacy_debugPrintf(" bps, error ");
+    if(0 > iError){
+        legacy_debugPrintf("-");
+        iError = -iError;
+    }
+    param_formatUnsigned((unsigned int)iError / 100, cValue);
+    legacy_debugPrintf(cValue);
+    legacy_debugPrintf(",");
+    unsignedIntToString(cValue, (unsigned int)iError % 100, 2);
+    legacy_debugPrintf(cValue);
+    legacy_debugPrintf(" %%\n \r");
+}
+
+/* ************************************************** */
+/* Method name:        legacy_printParserStatistics   */
+/* Method description: printParserStatistics before   */
+/*                     console.c                      */
+/* Input params:       n/a                            */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void legacy_printParserStatistics(void){
+    static char * const cKeys[PARSER_STATISTICS] = {"rx=", "cmd=", "drop=", "garbage=", "resync=", "frames=", "frameErr=", "overflow="};
+    unsigned int uiValues[PARSER_STATISTICS];
+    char cLine[BATCH_LINE_SIZE] = "";
+    char cValue[PARAM_VALUE_SIZE];
+    unsigned char ucIndex;
+
+    uiValues[0] = uiStatRxBytes;
+    uiValues[1] = uiStatCommands;
+    uiValues[2] = uiStatDropped;
+    uiValues[3] = uiStatGarbageBytes;
+    uiValues[4] = uiStatMaxResync;
+    binaryProtocol_getStatistics(&uiValues[5], &uiValues[6]);
+    uiValues[7] = UART0_getRxOverflows();
+
+    for(ucIndex = 0; ucIndex < PARSER_STATISTICS; ucIndex++){
+        append_string(cLine, BATCH_LINE_SIZE, cKeys[ucIndex]);
+        param_formatUnsigned(uiValues[ucIndex], cValue);
+        append_string(cLine, BATCH_LINE_SIZE, cValue);
+        append_string(cLine, BATCH_LINE_SIZE, ";");
+    }
+    append_string(cLine, BATCH_LINE_SIZE, "\n \r");
+
+    legacy_debugPrintf(cLine);
+}
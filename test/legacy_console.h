@@ -0,0 +1,63 @@
+/* ***************************************************************** */
+/* File name:        legacy_console.h                                */
+/* File description: The responses as they were sent before          */
+/*                   console.c, through debug_printf and the _doprint*/
+/*                   of the SDK, the baseline of console_bench       */
+/* Author name:      Grupo 18 - Renato Pepe                          */
+/*                              Joao Victor Matoso                   */
+/* Creation date:    19oct2026                                       */
+/* Revision date:    19oct2026                                       */
+/* ***************************************************************** */
+
+#ifndef TEST_LEGACY_CONSOLE_H_
+#define TEST_LEGACY_CONSOLE_H_
+
+/* ************************************************** */
+/* Method name:        legacy_debugPrintf             */
+/* Method description: debug_printf of                */
+/*                     fsl_debug_console.c, each      */
+/*                     character to UART0_putChar     */
+/* Input params:       fmt_s: format of _doprint      */
+/* Output params:      characters sent                */
+/* ************************************************** */
+int legacy_debugPrintf(const char *fmt_s, ...);
+
+/* ************************************************** */
+/* Method name:        legacy_returnParam             */
+/* Method description: returnParam before console.c,  */
+/*                     for the parameters without a   */
+/*                     printer of their own           */
+/* Input params:       ucParam: parameter letter      */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void legacy_returnParam(unsigned char ucParam);
+
+/* ************************************************** */
+/* Method name:        legacy_returnParamList         */
+/* Method description: returnParamList before         */
+/*                     console.c, the line built with */
+/*                     append_string                  */
+/* Input params:       ucParams: letters, or "*"      */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void legacy_returnParamList(unsigned char *ucParams);
+
+/* ************************************************** */
+/* Method name:        legacy_printBaudRate           */
+/* Method description: param_printBaudRate before     */
+/*                     console.c                      */
+/* Input params:       n/a                            */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void legacy_printBaudRate(void);
+
+/* ************************************************** */
+/* Method name:        legacy_printParserStatistics   */
+/* Method description: printParserStatistics before   */
+/*                     console.c                      */
+/* Input params:       n/a                            */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void legacy_printParserStatistics(void);
+
+#endif /* TEST_LEGACY_CONSOLE_H_ */
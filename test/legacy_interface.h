@@ -0,0 +1,23 @@
+/* *************************************************************** */
+/* File name:        legacy_interface.h                            */
+/* File description: The local interface before the menu table,   */
+/*                   the baseline of interface_test                */
+/* Author name:      Grupo 18 - Renato Pepe                        */
+/*                              Joao Victor Matoso                 */
+/* Creation date:    16jun2021                                     */
+/* Revision date:    19oct2026                                     */
+/* *************************************************************** */
+
+#ifndef TEST_LEGACY_INTERFACE_H_
+#define TEST_LEGACY_INTERFACE_H_
+
+/* ******************************************************************  */
+/* Method name:        legacy_localInterfaceHandler                    */
+/* Method description: Method that will be called by the interruption, */
+/*                     applies the keypad events and display LCD data  */
+/* Input params:       n/a                                             */
+/* Output params:      n/a                                             */
+/* ******************************************************************  */
+void legacy_localInterfaceHandler(void);
+
+#endif /* TEST_LEGACY_INTERFACE_H_ */
@@ -0,0 +1,100 @@
+/* ***************************************************************** */
+/* File name:        legacy_util.c                                   */
+/* File description: convertFloatToString and convertStringToFloat   */
+/*                   as they were in util.c before numconv, kept for */
+/*                   numconv_bench                                   */
+/* Author name:      dloubach, Joao Victor Matoso, Renato Pepe       */
+/* Creation date:    09jan2015                                       */
+/* Revision date:    18jun2021                                       */
+/* ***************************************************************** */
+
+#include "legacy_util.h"
+
+/* ******************************************************************************************************* */
+/* Method name:        legacy_convertFloatToString                                                         */
+/* Method description: Convert a float number into a string of size uiSize. The algorithm will fit the     */
+/*                     integer part, and the remaining free space will be filled up with the decimal part  */
+/* Input params:       fNumber - number that will be converted into string                                 */
+/*                     cText   - char array where fNumber will be written                                  */
+/*                     uiSize  - size of cText array                                                       */
+/* Output params:      n/a                                                                                 */
+/* ******************************************************************************************************* */
+void legacy_convertFloatToString(float fNumber, char* cText, unsigned int uiSize) {
+    int iPos;
+    int iDigits = 1;
+
+    /* counts how many digits are in the integer part */
+    while(fNumber >= 10){
+        fNumber /= 10;
+        iDigits++;
+    }
+
+    /* if the number doesn't fit inside the string, return string of '9's */
+    if (iDigits >= uiSize) {
+        for(iPos = 0; iPos < uiSize-1; iPos++){
+            cText[iPos] = '9';
+        }
+        cText[iPos] = '\0';
+        return;
+    }
+
+    /* obs: at this point, fNumber is always x.xxxxx */
+    for(iPos = 0; iPos < uiSize-1; iPos++){
+        /* if the loop reaches the comma position */
+        if(0 == iDigits){
+            cText[iPos] = ',';
+        }
+
+        /* everywhere else, extracts the most left digit and save it in the string */
+        else {
+            int iIntPart = (int) fNumber;
+            fNumber -= iIntPart;
+            cText[iPos] = iIntPart + '0';
+            fNumber *= 10;
+        }
+
+        /* decrement integer digits counter */
+        iDigits--;
+    }
+
+    /* remove the ',' in some cases where it would appear X, */
+    if (',' == cText[iPos - 1]) {
+           cText[iPos - 1] = ' ';
+       }
+
+    /* end of string */
+    cText[iPos] = '\0';
+}
+
+
+/* ******************************************************************************************************* */
+/* Method name:        legacy_convertStringToFloat                                                         */
+/* Method description: Convert a string into a float number, ',' marks the decimal point and               */
+/*                      '\0' marks the end of the string                                                   */
+/*                      (obs: if string has more than one ',' then the second one will work as a '\0')     */
+/* Input params:       cText   - start of the string                                                       */
+/* Output params:      float   - converted number                                                          */
+/* ******************************************************************************************************* */
+float legacy_convertStringToFloat(unsigned char *ucText) {
+    float fValue = 0;
+    int iCount = 0;
+
+    /* convert integer part */
+    while (',' != ucText[iCount] && '\0' != ucText[iCount]) {
+        fValue *= 10;
+        fValue += ucText[iCount++] - '0';
+    }
+
+    /* convert decimal part */
+    if (',' == ucText[iCount]) {
+        int d = 10;
+        iCount++;
+        while ('\0' != ucText[iCount] && '0' <= ucText[iCount] && '9' >= ucText[iCount]) {
+            float fAux = ucText[iCount++] - '0';
+            fValue += fAux / d;
+            d *= 10;
+        }
+    }
+
+    return fValue;
+}
@@ -0,0 +1,33 @@
+/* ***************************************************************** */
+/* File name:        legacy_util.h                                   */
+/* File description: The float conversions of util.c before numconv, */
+/*                   the baseline of numconv_bench                   */
+/* Author name:      dloubach, Joao Victor Matoso, Renato Pepe       */
+/* Creation date:    09jan2015                                       */
+/* Revision date:    18jun2021                                       */
+/* ***************************************************************** */
+
+#ifndef TEST_LEGACY_UTIL_H_
+#define TEST_LEGACY_UTIL_H_
+
+/* ******************************************************************************************************* */
+/* Method name:        legacy_convertFloatToString                                                         */
+/* Method description: Convert a float number into a string of size uiSize. The algorithm will fit the     */
+/*                     integer part, and the remaining free space will be filled up with the decimal part  */
+/* Input params:       fNumber - number that will be converted into string                                 */
+/*                     cText   - char array where fNumber will be written                                  */
+/*                     uiSize  - size of cText array                                                       */
+/* Output params:      n/a                                                                                 */
+/* ******************************************************************************************************* */
+void legacy_convertFloatToString(float fNumber, char* cText, unsigned int uiSize);
+
+/* ******************************************************************************************************* */
+/* Method name:        legacy_convertStringToFloat                                                         */
+/* Method description: Convert a string into a float number, ',' marks the decimal point and               */
+/*                      '\0' marks the end of the string                                                   */
+/* Input params:       cText   - start of the string                                                       */
+/* Output params:      float   - converted number                                                          */
+/* ******************************************************************************************************* */
+float legacy_convertStringToFloat(unsigned char *ucText);
+
+#endif /* TEST_LEGACY_UTIL_H_ */
@@ -0,0 +1,413 @@
+/* ***************************************************************** */
+/* File name:        modbus_test.c                                   */
+/* File description: Modbus RTU slave (modbus.c) against a master on */
+/*                   a loopback pseudo-terminal: the master writes   */
+/*                   its requests on the terminal side, as on a USB  */
+/*                   serial port, and the board side of the pair     */
+/*                   feeds the UART and PIT shims in real time.      */
+/*                   Usage: modbus_test [--serve]                    */
+/*                   --serve keeps the board on the terminal printed */
+/*                   for an external master (mbpoll, pymodbus...)    */
+/* Author name:      Grupo 18 - Renato Pepe                          */
+/*                              Joao Victor Matoso                   */
+/* Creation date:    19oct2026                                       */
+/* Revision date:    19oct2026                                       */
+/* ***************************************************************** */
+
+/* posix_openpt, ptsname, clock_gettime */
+#define _XOPEN_SOURCE 600
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <termios.h>
+#include <time.h>
+#include <unistd.h>
+#include "modbus.h"
+#include "pid.h"
+#include "crc16.h"
+#include "UART.h"
+#include "uart_shim.h"
+#include "pit_shim.h"
+#include "board_stubs.h"
+#include "hostboard.h"
+#include "hosttest.h"
+
+/* time the board side serves after a request, far above the silence */
+#define MODBUS_TEST_SERVE_MS    20U
+
+/* gap that splits a request in two on the terminal */
+#define MODBUS_TEST_SPLIT_MS    5U
+
+/* silence above 19200 bps, fixed by the standard */
+#define MODBUS_TEST_FAST_US     1750U
+
+/* silence at 9600 bps, 3.5 characters of 11 bits */
+#define MODBUS_TEST_SLOW_BAUD   9600U
+#define MODBUS_TEST_SLOW_US     (38500000U / MODBUS_TEST_SLOW_BAUD)
+
+typedef struct modbus_test_line_type {
+    int iBoard;                         // pseudo-terminal master, the board UART
+    int iMaster;                        // terminal side, the Modbus master
+    char cName[64];
+} modbus_test_line_type;
+
+/* ************************************************** */
+/* Method name:        modbusTest_getUs               */
+/* Method description: Monotonic time                 */
+/* Input params:       n/a                            */
+/* Output params:      microseconds                   */
+/* ************************************************** */
+static unsigned long long modbusTest_getUs(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (unsigned long long)now.tv_sec * 1000000ULL + (unsigned long long)now.tv_nsec / 1000ULL;
+}
+
+/* ************************************************** */
+/* Method name:        modbusTest_open                */
+/* Method description: Open a pseudo-terminal pair,   */
+/*                     raw, as a serial line          */
+/* Input params:       pLine: line to open            */
+/* Output params:      1 if open, 0 on error          */
+/* ************************************************** */
+static unsigned char modbusTest_open(modbus_test_line_type *pLine)
+{
+    struct termios tty;
+    const char *cName;
+
+    pLine->iBoard = posix_openpt(O_RDWR | O_NOCTTY);
+    if(0 > pLine->iBoard || grantpt(pLine->iBoard) || unlockpt(pLine->iBoard) || !(cName = ptsname(pLine->iBoard)))
+        return 0;
+    snprintf(pLine->cName, sizeof(pLine->cName), "%s", cName);
+
+    pLine->iMaster = open(pLine->cName, O_RDWR | O_NOCTTY);
+    if(0 > pLine->iMaster || tcgetattr(pLine->iMaster, &tty))
+        return 0;
+
+    /* no echo, no line editing, no CR/LF translation */
+    tty.c_iflag = 0;
+    tty.c_oflag = 0;
+    tty.c_lflag = 0;
+    tty.c_cflag = CS8 | CREAD | CLOCAL;
+    tty.c_cc[VMIN] = 0;
+    tty.c_cc[VTIME] = 0;
+    return 0 == tcsetattr(pLine->iMaster, TCSANOW, &tty);
+}
+
+/* ************************************************** */
+/* Method name:        modbusTest_serve               */
+/* Method description: Run the board side: the bytes  */
+/*                     of the terminal go to the UART */
+/*                     interruption, the real time to */
+/*                     the PIT, and the answers back  */
+/* Input params:       pLine: open line               */
+/*                     uiMs: time to serve            */
+/* Output params:      n/a                            */
+/* ************************************************** */
+static void modbusTest_serve(const modbus_test_line_type *pLine, unsigned int uiMs)
+{
+    unsigned long long ullNow = modbusTest_getUs(), ullEnd = ullNow + uiMs * 1000ULL, ullLast = ullNow;
+    struct pollfd board = {pLine->iBoard, POLLIN, 0};
+
+    while(ullNow < ullEnd){
+        unsigned char ucBytes[MODBUS_FRAME_SIZE];
+        const unsigned char *pucTx;
+        unsigned int uiLength;
+        ssize_t iRead = 0, iIndex;
+
+        if(0 < poll(&board, 1, 1) && (board.revents & POLLIN))
+            iRead = read(pLine->iBoard, ucBytes, sizeof(ucBytes));
+
+        /* the silence is measured up to the bytes just read */
+        ullNow = modbusTest_getUs();
+        pitShim_advanceUs((unsigned int)(ullNow - ullLast));
+        ullLast = ullNow;
+        for(iIndex = 0; iIndex < iRead; iIndex++)
+            uartShim_receive(ucBytes[iIndex]);
+
+        modbus_update();
+        pucTx = uartShim_getCapture(&uiLength);
+        if(uiLength && (ssize_t)uiLength != write(pLine->iBoard, pucTx, uiLength))
+            hostTest_expect(0, "answer written on the terminal");
+        uartShim_reset();
+    }
+}
+
+/* ************************************************** */
+/* Method name:        modbusTest_frame               */
+/* Method description: Append the CRC to a request    */
+/* Input params:       pucRequest: request, no CRC    */
+/*                     ucLength: its bytes            */
+/*                     pucFrame: where to store the   */
+/*                     frame, ucLength + 2 bytes      */
+/* Output params:      bytes of the frame             */
+/* ************************************************** */
+static unsigned char modbusTest_frame(const unsigned char *pucRequest, unsigned char ucLength, unsigned char *pucFrame)
+{
+    unsigned short usCrc = crc16_compute(pucRequest, ucLength);
+
+    memcpy(pucFrame, pucRequest, ucLength);
+    pucFrame[ucLength++] = (unsigned char)usCrc;
+    pucFrame[ucLength++] = (unsigned char)(usCrc >> 8);
+    return ucLength;
+}
+
+/* ************************************************** */
+/* Method name:        modbusTest_transact            */
+/* Method description: Write a frame from the master  */
+/*                     and read what the board        */
+/*                     answers                        */
+/* Input params:       pLine: open line               */
+/*                     pucFrame: frame with its CRC   */
+/*                     ucLength: its bytes            */
+/*                     pucAnswer: where to store the  */
+/*                     answer, MODBUS_FRAME_SIZE      */
+/* Output params:      bytes of the answer, 0 if none */
+/* ************************************************** */
+static unsigned int modbusTest_transact(const modbus_test_line_type *pLine, const unsigned char *pucFrame, unsigned char ucLength,
+                                        unsigned char *pucAnswer)
+{
+    unsigned int uiAnswer = 0;
+    ssize_t iRead;
+
+    if(ucLength != write(pLine->iMaster, pucFrame, ucLength))
+        return 0;
+
+    modbusTest_serve(pLine, MODBUS_TEST_SERVE_MS);
+    while(MODBUS_FRAME_SIZE > uiAnswer && 0 < (iRead = read(pLine->iMaster, &pucAnswer[uiAnswer], MODBUS_FRAME_SIZE - uiAnswer)))
+        uiAnswer += (unsigned int)iRead;
+    return uiAnswer;
+}
+
+/* ************************************************** */
+/* Method name:        modbusTest_request             */
+/* Method description: Send a request from the master */
+/*                     with its CRC and read what the */
+/*                     board answers                  */
+/* Input params:       pLine: open line               */
+/*                     pucRequest: request, no CRC    */
+/*                     ucLength: its bytes            */
+/*                     pucAnswer: where to store the  */
+/*                     answer, MODBUS_FRAME_SIZE      */
+/* Output params:      bytes of the answer, 0 if none */
+/* ************************************************** */
+static unsigned int modbusTest_request(const modbus_test_line_type *pLine, const unsigned char *pucRequest, unsigned char ucLength,
+                                       unsigned char *pucAnswer)
+{
+    unsigned char ucFrame[MODBUS_FRAME_SIZE];
+
+    ucLength = modbusTest_frame(pucRequest, ucLength, ucFrame);
+    return modbusTest_transact(pLine, ucFrame, ucLength, pucAnswer);
+}
+
+/* ************************************************** */
+/* Method name:        modbusTest_expectAnswer        */
+/* Method description: Check an answer and its CRC    */
+/* Input params:       pucAnswer: answer read         */
+/*                     uiLength: its bytes            */
+/*                     pucExpected: answer, no CRC    */
+/*                     ucExpected: its bytes          */
+/*                     cWhat: request tested          */
+/* Output params:      n/a                            */
+/* ************************************************** */
+static void modbusTest_expectAnswer(const unsigned char *pucAnswer, unsigned int uiLength, const unsigned char *pucExpected,
+                                    unsigned char ucExpected, const char *cWhat)
+{
+    if(!hostTest_expectInt(uiLength, ucExpected + 2, cWhat))
+        return;
+    hostTest_expect(0 == crc16_compute(pucAnswer, uiLength), cWhat);
+    hostTest_expect(0 == memcmp(pucAnswer, pucExpected, ucExpected), cWhat);
+}
+
+/* ************************************************** */
+/* Method name:        modbusTest_functions           */
+/* Method description: The four functions, read back  */
+/*                     through the firmware           */
+/* Input params:       pLine: open line               */
+/* Output params:      n/a                            */
+/* ************************************************** */
+static void modbusTest_functions(const modbus_test_line_type *pLine)
+{
+    static const unsigned char ucWriteSetpoint[] = {1, MODBUS_WRITE_SINGLE, 0, 0, 0x0D, 0xDE};
+    static const unsigned char ucReadSetpoint[] = {1, MODBUS_READ_HOLDING, 0, 0, 0, 1};
+    static const unsigned char ucSetpoint[] = {1, MODBUS_READ_HOLDING, 2, 0x0D, 0xDE};
+    static const unsigned char ucWriteGains[] = {1, MODBUS_WRITE_MULTIPLE, 0, 1, 0, 3, 6, 0x00, 0xFA, 0x00, 0x7D, 0x00, 0x32};
+    static const unsigned char ucGains[] = {1, MODBUS_WRITE_MULTIPLE, 0, 1, 0, 3};
+    static const unsigned char ucReadInput[] = {1, MODBUS_READ_INPUT, 0, 0, 0, 2};
+    static const unsigned char ucInput[] = {1, MODBUS_READ_INPUT, 4, 0x0A, 0xA5, 0x04, 0xD2};
+    unsigned char ucAnswer[MODBUS_FRAME_SIZE];
+    unsigned int uiLength;
+
+    /* 35.50 C */
+    uiLength = modbusTest_request(pLine, ucWriteSetpoint, sizeof(ucWriteSetpoint), ucAnswer);
+    modbusTest_expectAnswer(ucAnswer, uiLength, ucWriteSetpoint, sizeof(ucWriteSetpoint), "echo of the single write");
+    hostTest_expect(35.5f == pid_getTemperatureSetpoint(), "setpoint written");
+    uiLength = modbusTest_request(pLine, ucReadSetpoint, sizeof(ucReadSetpoint), ucAnswer);
+    modbusTest_expectAnswer(ucAnswer, uiLength, ucSetpoint, sizeof(ucSetpoint), "setpoint read back");
+
+    /* Kp 2.5, Ki 0.125, Kd 0.5 */
+    uiLength = modbusTest_request(pLine, ucWriteGains, sizeof(ucWriteGains), ucAnswer);
+    modbusTest_expectAnswer(ucAnswer, uiLength, ucGains, sizeof(ucGains), "answer of the multiple write");
+    hostTest_expect(2.5f == pid_getKp(), "Kp written");
+    hostTest_expect(0.125f == pid_getKi(), "Ki written");
+    hostTest_expect(0.5f == pid_getKd(), "Kd written");
+
+    /* 27.25 C and 123.4 RPM */
+    boardStub_setTemperature(27.25f);
+    boardStub_setSpeed(1234);
+    uiLength = modbusTest_request(pLine, ucReadInput, sizeof(ucReadInput), ucAnswer);
+    modbusTest_expectAnswer(ucAnswer, uiLength, ucInput, sizeof(ucInput), "input registers");
+}
+
+/* ************************************************** */
+/* Method name:        modbusTest_exceptions          */
+/* Method description: Exception answers, and the     */
+/*                     frames a slave must not answer */
+/* Input params:       pLine: open line               */
+/* Output params:      n/a                            */
+/* ************************************************** */
+static void modbusTest_exceptions(const modbus_test_line_type *pLine)
+{
+    static const unsigned char ucCoil[] = {1, 0x05, 0, 0, 0xFF, 0};
+    static const unsigned char ucIllegalFunction[] = {1, 0x85, MODBUS_ILLEGAL_FUNCTION};
+    static const unsigned char ucPastEnd[] = {1, MODBUS_READ_HOLDING, 0, 8, 0, 5};
+    static const unsigned char ucIllegalAddress[] = {1, 0x83, MODBUS_ILLEGAL_ADDRESS};
+    static const unsigned char ucNoRegister[] = {1, MODBUS_READ_INPUT, 0, 0, 0, 0};
+    static const unsigned char ucIllegalCount[] = {1, 0x84, MODBUS_ILLEGAL_VALUE};
+    static const unsigned char ucTooHot[] = {1, MODBUS_WRITE_SINGLE, 0, 0, 0x26, 0xAC};
+    static const unsigned char ucIllegalValue[] = {1, 0x86, MODBUS_ILLEGAL_VALUE};
+    static const unsigned char ucOtherSlave[] = {7, MODBUS_WRITE_SINGLE, 0, 0, 0x09, 0xC4};
+    static const unsigned char ucBroadcast[] = {0, MODBUS_WRITE_SINGLE, 0, 0, 0x0F, 0xA0};
+    static const unsigned char ucRead[] = {1, MODBUS_READ_HOLDING, 0, 0, 0, 1};
+    unsigned char ucAnswer[MODBUS_FRAME_SIZE], ucBadCrc[sizeof(ucRead) + 2];
+    unsigned int uiLength;
+    float fSetpoint;
+
+    uiLength = modbusTest_request(pLine, ucCoil, sizeof(ucCoil), ucAnswer);
+    modbusTest_expectAnswer(ucAnswer, uiLength, ucIllegalFunction, sizeof(ucIllegalFunction), "illegal function");
+    uiLength = modbusTest_request(pLine, ucPastEnd, sizeof(ucPastEnd), ucAnswer);
+    modbusTest_expectAnswer(ucAnswer, uiLength, ucIllegalAddress, sizeof(ucIllegalAddress), "illegal address");
+    uiLength = modbusTest_request(pLine, ucNoRegister, sizeof(ucNoRegister), ucAnswer);
+    modbusTest_expectAnswer(ucAnswer, uiLength, ucIllegalCount, sizeof(ucIllegalCount), "illegal register count");
+
+    /* 99.00 C is out of the setpoint range */
+    fSetpoint = pid_getTemperatureSetpoint();
+    uiLength = modbusTest_request(pLine, ucTooHot, sizeof(ucTooHot), ucAnswer);
+    modbusTest_expectAnswer(ucAnswer, uiLength, ucIllegalValue, sizeof(ucIllegalValue), "illegal value");
+    hostTest_expect(fSetpoint == pid_getTemperatureSetpoint(), "setpoint kept after an illegal value");
+
+    /* another slave, nothing written and no answer */
+    hostTest_expectInt(modbusTest_request(pLine, ucOtherSlave, sizeof(ucOtherSlave), ucAnswer), 0, "answer to another slave");
+    hostTest_expect(fSetpoint == pid_getTemperatureSetpoint(), "setpoint kept after another slave");
+
+    /* a broadcast is written and never answered */
+    hostTest_expectInt(modbusTest_request(pLine, ucBroadcast, sizeof(ucBroadcast), ucAnswer), 0, "answer to a broadcast");
+    hostTest_expect(40.0f == pid_getTemperatureSetpoint(), "setpoint written by a broadcast");
+
+    /* a bad CRC is dropped, and the next request answered */
+    modbusTest_frame(ucRead, sizeof(ucRead), ucBadCrc);
+    ucBadCrc[sizeof(ucRead)] ^= 0x01U;
+    hostTest_expectInt(modbusTest_transact(pLine, ucBadCrc, sizeof(ucBadCrc), ucAnswer), 0, "answer to a bad CRC");
+    hostTest_expect(0 < modbusTest_request(pLine, ucRead, sizeof(ucRead), ucAnswer), "answer after a bad CRC");
+}
+
+/* ************************************************** */
+/* Method name:        modbusTest_split               */
+/* Method description: A request cut by a gap on the  */
+/*                     terminal is two frames, both   */
+/*                     dropped                        */
+/* Input params:       pLine: open line               */
+/* Output params:      n/a                            */
+/* ************************************************** */
+static void modbusTest_split(const modbus_test_line_type *pLine)
+{
+    static const unsigned char ucRead[] = {1, MODBUS_READ_HOLDING, 0, 0, 0, 1};
+    unsigned char ucFrame[sizeof(ucRead) + 2], ucAnswer[MODBUS_FRAME_SIZE];
+
+    modbusTest_frame(ucRead, sizeof(ucRead), ucFrame);
+    hostTest_expect(4 == write(pLine->iMaster, ucFrame, 4), "first half written");
+    modbusTest_serve(pLine, MODBUS_TEST_SPLIT_MS);
+    hostTest_expect(4 == write(pLine->iMaster, &ucFrame[4], 4), "second half written");
+    modbusTest_serve(pLine, MODBUS_TEST_SERVE_MS);
+    hostTest_expect(0 >= read(pLine->iMaster, ucAnswer, sizeof(ucAnswer)), "answer to a split request");
+}
+
+/* ************************************************** */
+/* Method name:        modbusTest_silence             */
+/* Method description: Frame end at 3.5 characters,   */
+/*                     with the simulated time of the */
+/*                     PIT shim: a gap below it keeps */
+/*                     the frame, one above splits it */
+/* Input params:       uiBaudRate: line speed         */
+/*                     uiSilenceUs: 3.5 characters    */
+/* Output params:      n/a                            */
+/* ************************************************** */
+static void modbusTest_silence(unsigned int uiBaudRate, unsigned int uiSilenceUs)
+{
+    static const unsigned char ucRead[] = {1, MODBUS_READ_HOLDING, 0, 0, 0, 1};
+    unsigned char ucFrame[sizeof(ucRead) + 2];
+    unsigned int uiGap, uiIndex;
+
+    modbusTest_frame(ucRead, sizeof(ucRead), ucFrame);
+    UART0_requestBaudRate(uiBaudRate);
+    modbus_enable();
+
+    /* 10 us short of the silence, then 10 us past it */
+    for(uiGap = uiSilenceUs - 10U; uiGap <= uiSilenceUs + 10U; uiGap += 20U){
+        uartShim_reset();
+        for(uiIndex = 0; uiIndex < sizeof(ucFrame); uiIndex++){
+            uartShim_receive(ucFrame[uiIndex]);
+            pitShim_advanceUs(uiGap);
+            modbus_update();
+        }
+        pitShim_advanceUs(uiSilenceUs);
+        modbus_update();
+        hostTest_expectInt(uartShim_getResponses(), uiGap < uiSilenceUs, "answers with a gap near the silence");
+    }
+    uartShim_reset();
+}
+
+/* ************************************************** */
+/* Method name:        modbusTest_serveForever        */
+/* Method description: Keep the board on the terminal */
+/*                     for an external master         */
+/* Input params:       pLine: open line               */
+/* Output params:      n/a                            */
+/* ************************************************** */
+static void modbusTest_serveForever(modbus_test_line_type *pLine)
+{
+    /* the external master opens the terminal itself */
+    close(pLine->iMaster);
+    printf("Modbus RTU slave %u at %u bps on %s\n", MODBUS_DEFAULT_ADDRESS, UART0_getBaudRate(), pLine->cName);
+    fflush(stdout);
+    for(;;){
+        hostBoard_advanceMs(MODBUS_TEST_SERVE_MS);
+        modbusTest_serve(pLine, MODBUS_TEST_SERVE_MS);
+    }
+}
+
+int main(int argc, char **argv)
+{
+    modbus_test_line_type line;
+
+    hostBoard_init();
+    uartShim_reset();
+    if(!hostTest_expect(modbusTest_open(&line), "pseudo-terminal opened"))
+        return hostTest_report("modbus_test");
+    modbus_enable();
+
+    if(1 < argc && 0 == strcmp(argv[1], "--serve"))
+        modbusTest_serveForever(&line);
+
+    modbusTest_functions(&line);
+    modbusTest_exceptions(&line);
+    modbusTest_split(&line);
+    modbusTest_silence(UART0_getBaudRate(), MODBUS_TEST_FAST_US);
+    modbusTest_silence(MODBUS_TEST_SLOW_BAUD, MODBUS_TEST_SLOW_US);
+    return hostTest_report("modbus_test");
+}
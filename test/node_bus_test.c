@@ -0,0 +1,562 @@
+/* ***************************************************************** */
+/* File name:        node_bus_test.c                                 */
+/* File description: N boards on one simulated RS-485 bus. Each node */
+/*                   is a process running the firmware with the      */
+/*                   shims; the test is the master. The bus moves    */
+/*                   one character per step: every node hears the    */
+/*                   line, and more than one driver in a step is a   */
+/*                   collision. The node ID is set over the UART,    */
+/*                   then the nodes are polled in ASCII, binary and  */
+/*                   Modbus RTU, and the cost per node is compared   */
+/*                   between bus sizes.                              */
+/*                   Usage: node_bus_test [nodes...]                 */
+/* Author name:      Grupo 18 - Renato Pepe                          */
+/*                              Joao Victor Matoso                   */
+/* Creation date:    19oct2026                                       */
+/* Revision date:    19oct2026                                       */
+/* ***************************************************************** */
+
+/* fork, pipe */
+#define _POSIX_C_SOURCE 200112L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include "node.h"
+#include "modbus.h"
+#include "pid.h"
+#include "crc16.h"
+#include "UART.h"
+#include "uart_shim.h"
+#include "pit_shim.h"
+#include "hostboard.h"
+#include "hosttest.h"
+#include "binframe.h"
+
+/* bus sizes tested without arguments */
+#define NODE_BUS_SIZES          {1U, 8U, 32U}
+
+#define NODE_BUS_MAX_NODES      NODE_MAX_ID
+
+/* line speed of the test and one character of 10 bits, in us */
+#define NODE_BUS_BAUD           115200U
+#define NODE_BUS_CHAR_US        ((10U * 1000000U + NODE_BUS_BAUD - 1U) / NODE_BUS_BAUD)
+
+/* silence that ends an answer for the master: a few characters in
+ * ASCII and binary, more than the 1750 us of Modbus RTU */
+#define NODE_BUS_SILENCE        4U
+#define NODE_BUS_MODBUS_SILENCE ((1750U + NODE_BUS_CHAR_US - 1U) / NODE_BUS_CHAR_US + 1U)
+
+/* characters the master waits for the start of an answer */
+#define NODE_BUS_NO_ANSWER      64U
+
+/* messages of a step, 2 bytes each way */
+#define NODE_BUS_IDLE           0U      // to the node: nothing on the line
+#define NODE_BUS_BYTE           1U      // to the node: a character on the line
+#define NODE_BUS_QUIT           2U
+
+/* bytes a node keeps to send */
+#define NODE_BUS_TX_SIZE        256U
+
+/* master answer buffer */
+#define NODE_BUS_ANSWER_SIZE    128U
+
+/* setpoint given to each node, in the range of the parameter */
+#define NODE_BUS_SETPOINT(id)   (23U + (id) % 52U)
+
+/* the master on the line */
+#define NODE_BUS_MASTER         (-2)
+
+typedef struct node_bus_type {
+    unsigned int uiNodes;
+    pid_t pid[NODE_BUS_MAX_NODES];
+    int iDown[NODE_BUS_MAX_NODES];      // master to node
+    int iUp[NODE_BUS_MAX_NODES];        // node to master
+    unsigned char ucDrive[NODE_BUS_MAX_NODES];      // node drives the next step
+    unsigned char ucDriveByte[NODE_BUS_MAX_NODES];
+    unsigned int uiSteps;
+    unsigned int uiCollisions;
+} node_bus_type;
+
+typedef struct node_bus_answer_type {
+    unsigned char ucBytes[NODE_BUS_ANSWER_SIZE];
+    unsigned int uiLength;
+    int iNode;                          // first node that answered, -1 if none
+    unsigned int uiNodes;               // nodes that answered
+    unsigned int uiGap;                 // idle characters before the answer
+    unsigned int uiSteps;               // characters of the whole transaction
+} node_bus_answer_type;
+
+/* cost of one poll per node, in characters */
+typedef struct node_bus_cost_type {
+    unsigned int uiAscii;
+    unsigned int uiBinary;
+    unsigned int uiModbus;
+} node_bus_cost_type;
+
+/* ************************************************** */
+/* Method name:        nodeBus_runNode                */
+/* Method description: Body of a node process: set    */
+/*                     the ID over the UART, then run */
+/*                     the main loop one character at */
+/*                     a time. An answer waits the    */
+/*                     turnaround of UART0_transmit-  */
+/*                     Begin before it takes the line */
+/* Input params:       ucId: node ID                  */
+/*                     iDown, iUp: pipes to the master*/
+/* Output params:      n/a, does not return           */
+/* ************************************************** */
+static void nodeBus_runNode(unsigned char ucId, int iDown, int iUp)
+{
+    unsigned char ucTx[NODE_BUS_TX_SIZE], ucMessage[2], ucReady[2];
+    unsigned int uiTxHead = 0, uiTxTail = 0, uiTurnaround = 0, uiUs = 0;
+    unsigned char ucDriving = 0;
+    char cCommand[16];
+    const char *cByte;
+
+    hostBoard_init();
+    UART0_requestBaudRate(NODE_BUS_BAUD);
+
+    /* the ID is set point to point, before the board joins the bus */
+    snprintf(cCommand, sizeof(cCommand), "#sl%u;", ucId);
+    for(cByte = cCommand; *cByte; cByte++)
+        uartShim_receive((unsigned char)*cByte);
+    UART0_processReceived();
+    ucReady[0] = (ucId == node_getId()) && uartShim_isSharedBus();
+    node_init();
+    ucReady[1] = (ucId == node_getId()) && uartShim_isSharedBus();
+    uartShim_reset();
+    if(sizeof(ucReady) != write(iUp, ucReady, sizeof(ucReady)))
+        _exit(1);
+
+    while(sizeof(ucMessage) == read(iDown, ucMessage, sizeof(ucMessage)) && NODE_BUS_QUIT != ucMessage[0]){
+        const unsigned char *pucCapture;
+        unsigned int uiLength, uiIndex;
+
+        /* the character took its time on the line; the transceiver
+         * does not hear the board while it drives */
+        pitShim_advanceUs(NODE_BUS_CHAR_US);
+        for(uiUs += NODE_BUS_CHAR_US; 1000U <= uiUs; uiUs -= 1000U)
+            hostBoard_advanceMs(1);
+        if(NODE_BUS_BYTE == ucMessage[0] && !ucDriving)
+            uartShim_receive(ucMessage[1]);
+
+        /* main loop */
+        UART0_processReceived();
+        modbus_update();
+
+        pucCapture = uartShim_getCapture(&uiLength);
+        if(uiLength && uiTxHead == uiTxTail)
+            uiTurnaround = UART0_TURNAROUND_CHARS;
+        for(uiIndex = 0; uiIndex < uiLength && NODE_BUS_TX_SIZE > uiTxHead - uiTxTail; uiIndex++)
+            ucTx[uiTxHead++ % NODE_BUS_TX_SIZE] = pucCapture[uiIndex];
+        uartShim_reset();
+
+        /* what the node drives in the next step */
+        ucDriving = 0;
+        if(uiTxHead != uiTxTail){
+            if(uiTurnaround){
+                uiTurnaround--;
+            }else{
+                ucDriving = 1;
+                ucMessage[1] = ucTx[uiTxTail++ % NODE_BUS_TX_SIZE];
+            }
+        }
+        ucMessage[0] = ucDriving;
+        if(sizeof(ucMessage) != write(iUp, ucMessage, sizeof(ucMessage)))
+            break;
+    }
+    _exit(0);
+}
+
+/* ************************************************** */
+/* Method name:        nodeBus_open                   */
+/* Method description: Start the node processes, IDs  */
+/*                     1 to uiNodes                   */
+/* Input params:       pBus: bus                      */
+/*                     uiNodes: nodes on the bus      */
+/* Output params:      1 if started, 0 on error       */
+/* ************************************************** */
+static unsigned char nodeBus_open(node_bus_type *pBus, unsigned int uiNodes)
+{
+    unsigned int uiNode;
+
+    memset(pBus, 0, sizeof(*pBus));
+    fflush(stdout);
+    for(uiNode = 0; uiNode < uiNodes; uiNode++){
+        int iDown[2], iUp[2];
+        unsigned char ucReady[2];
+
+        if(pipe(iDown) || pipe(iUp))
+            return 0;
+        pBus->pid[uiNode] = fork();
+        if(0 > pBus->pid[uiNode])
+            return 0;
+        if(0 == pBus->pid[uiNode]){
+            close(iDown[1]);
+            close(iUp[0]);
+            nodeBus_runNode((unsigned char)(uiNode + 1U), iDown[0], iUp[1]);
+        }
+        close(iDown[0]);
+        close(iUp[1]);
+        pBus->iDown[uiNode] = iDown[1];
+        pBus->iUp[uiNode] = iUp[0];
+        pBus->uiNodes++;
+
+        if(!hostTest_expect(sizeof(ucReady) == read(pBus->iUp[uiNode], ucReady, sizeof(ucReady)), "node started"))
+            return 0;
+        hostTest_expect(ucReady[0], "node ID set over the UART, on a shared bus");
+        hostTest_expect(ucReady[1], "node ID loaded from flash");
+    }
+    return 1;
+}
+
+/* ************************************************** */
+/* Method name:        nodeBus_close                  */
+/* Method description: Stop the node processes        */
+/* Input params:       pBus: bus                      */
+/* Output params:      n/a                            */
+/* ************************************************** */
+static void nodeBus_close(node_bus_type *pBus)
+{
+    static const unsigned char ucQuit[2] = {NODE_BUS_QUIT, 0};
+    unsigned int uiNode;
+    int iStatus;
+
+    for(uiNode = 0; uiNode < pBus->uiNodes; uiNode++){
+        if(sizeof(ucQuit) != write(pBus->iDown[uiNode], ucQuit, sizeof(ucQuit)))
+            hostTest_expect(0, "node stopped");
+        close(pBus->iDown[uiNode]);
+        close(pBus->iUp[uiNode]);
+        waitpid(pBus->pid[uiNode], &iStatus, 0);
+        hostTest_expect(WIFEXITED(iStatus) && 0 == WEXITSTATUS(iStatus), "node exit status");
+    }
+    pBus->uiNodes = 0;
+}
+
+/* ************************************************** */
+/* Method name:        nodeBus_step                   */
+/* Method description: One character time on the bus */
+/* Input params:       pBus: bus                      */
+/*                     iMasterByte: character the     */
+/*                     master sends, -1 if none       */
+/*                     pucLine: character on the line */
+/* Output params:      driver of the line: the node   */
+/*                     index, NODE_BUS_MASTER, or -1  */
+/* ************************************************** */
+static int nodeBus_step(node_bus_type *pBus, int iMasterByte, unsigned char *pucLine)
+{
+    unsigned char ucMessage[2] = {NODE_BUS_IDLE, 0};
+    unsigned int uiNode, uiDrivers = 0;
+    int iDriver = -1;
+
+    if(0 <= iMasterByte){
+        iDriver = NODE_BUS_MASTER;
+        ucMessage[1] = (unsigned char)iMasterByte;
+        uiDrivers++;
+    }
+    for(uiNode = 0; uiNode < pBus->uiNodes; uiNode++){
+        if(!pBus->ucDrive[uiNode])
+            continue;
+        if(0 == uiDrivers++){
+            iDriver = (int)uiNode;
+            ucMessage[1] = pBus->ucDriveByte[uiNode];
+        }
+    }
+    /* two drivers garble the character */
+    if(1 < uiDrivers){
+        pBus->uiCollisions++;
+        ucMessage[1] = 0xFFU;
+    }
+    if(uiDrivers)
+        ucMessage[0] = NODE_BUS_BYTE;
+
+    for(uiNode = 0; uiNode < pBus->uiNodes; uiNode++)
+        if(sizeof(ucMessage) != write(pBus->iDown[uiNode], ucMessage, sizeof(ucMessage)))
+            hostTest_expect(0, "step sent to the node");
+    for(uiNode = 0; uiNode < pBus->uiNodes; uiNode++){
+        unsigned char ucDrive[2] = {0, 0};
+
+        if(sizeof(ucDrive) != read(pBus->iUp[uiNode], ucDrive, sizeof(ucDrive)))
+            hostTest_expect(0, "step answered by the node");
+        pBus->ucDrive[uiNode] = ucDrive[0];
+        pBus->ucDriveByte[uiNode] = ucDrive[1];
+    }
+
+    pBus->uiSteps++;
+    *pucLine = ucMessage[1];
+    return iDriver;
+}
+
+/* ************************************************** */
+/* Method name:        nodeBus_transact               */
+/* Method description: Send a request and collect the */
+/*                     answer until the line is       */
+/*                     silent                         */
+/* Input params:       pBus: bus                      */
+/*                     pucRequest, uiLength: request  */
+/*                     uiSilence: characters that end */
+/*                     the answer                     */
+/*                     pAnswer: answer found          */
+/* Output params:      n/a                            */
+/* ************************************************** */
+static void nodeBus_transact(node_bus_type *pBus, const unsigned char *pucRequest, unsigned int uiLength, unsigned int uiSilence,
+                             node_bus_answer_type *pAnswer)
+{
+    unsigned int uiStart = pBus->uiSteps, uiIdle = 0, uiIndex;
+    unsigned char ucLine, ucAnswered[NODE_BUS_MAX_NODES] = {0};
+    int iDriver;
+
+    memset(pAnswer, 0, sizeof(*pAnswer));
+    pAnswer->iNode = -1;
+
+    for(uiIndex = 0; uiIndex < uiLength; uiIndex++)
+        nodeBus_step(pBus, pucRequest[uiIndex], &ucLine);
+
+    while((pAnswer->uiLength ? uiSilence : NODE_BUS_NO_ANSWER) > uiIdle){
+        iDriver = nodeBus_step(pBus, -1, &ucLine);
+        if(0 > iDriver){
+            uiIdle++;
+            continue;
+        }
+        if(0 > pAnswer->iNode){
+            pAnswer->iNode = iDriver;
+            pAnswer->uiGap = uiIdle;
+        }
+        if(!ucAnswered[iDriver]){
+            ucAnswered[iDriver] = 1;
+            pAnswer->uiNodes++;
+        }
+        if(NODE_BUS_ANSWER_SIZE > pAnswer->uiLength)
+            pAnswer->ucBytes[pAnswer->uiLength++] = ucLine;
+        uiIdle = 0;
+    }
+    pAnswer->uiSteps = pBus->uiSteps - uiStart;
+}
+
+/* ************************************************** */
+/* Method name:        nodeBus_expectAnswer           */
+/* Method description: Check that only the addressed  */
+/*                     node answered, after the       */
+/*                     turnaround                     */
+/* Input params:       pAnswer: answer found          */
+/*                     uiNode: node index addressed   */
+/* Output params:      1 if it did                    */
+/* ************************************************** */
+static unsigned char nodeBus_expectAnswer(const node_bus_answer_type *pAnswer, unsigned int uiNode)
+{
+    if(!hostTest_expectInt(pAnswer->iNode, (int)uiNode, "node that answered"))
+        return 0;
+    hostTest_expectInt(pAnswer->uiNodes, 1, "nodes that answered");
+    return hostTest_expect(UART0_TURNAROUND_CHARS <= pAnswer->uiGap, "turnaround before the answer");
+}
+
+/* ************************************************** */
+/* Method name:        nodeBus_ascii                  */
+/* Method description: ASCII command to a node, with  */
+/*                     the selection prefix           */
+/* Input params:       pBus: bus                      */
+/*                     ucId: node ID                  */
+/*                     cCommand: command text         */
+/*                     uiSilence: characters that end */
+/*                     the answer                     */
+/*                     pAnswer: answer found          */
+/* Output params:      n/a                            */
+/* ************************************************** */
+static void nodeBus_ascii(node_bus_type *pBus, unsigned char ucId, const char *cCommand, unsigned int uiSilence,
+                          node_bus_answer_type *pAnswer)
+{
+    char cRequest[32];
+    int iLength = snprintf(cRequest, sizeof(cRequest), "%c%u%c%s", NODE_SELECT, ucId, NODE_SELECT_END, cCommand);
+
+    nodeBus_transact(pBus, (const unsigned char *)cRequest, (unsigned int)iLength, uiSilence, pAnswer);
+}
+
+/* ************************************************** */
+/* Method name:        nodeBus_binary                 */
+/* Method description: Binary GET to a node selected  */
+/*                     with the prefix                */
+/* Input params:       pBus: bus                      */
+/*                     ucId: node ID                  */
+/*                     cLetters: payload of the GET   */
+/*                     pAnswer: answer found          */
+/*                     pfValue: value of the first    */
+/*                     letter                         */
+/* Output params:      1 if a good frame came back    */
+/*                     with the value                 */
+/* ************************************************** */
+static unsigned char nodeBus_binary(node_bus_type *pBus, unsigned char ucId, const char *cLetters, node_bus_answer_type *pAnswer,
+                                    float *pfValue)
+{
+    unsigned char ucRequest[8 + BINFRAME_MAX_SIZE];
+    binframe_parser_type parser;
+    unsigned int uiLength, uiIndex, uiValue;
+
+    uiLength = (unsigned int)snprintf((char *)ucRequest, sizeof(ucRequest), "%c%u%c", NODE_SELECT, ucId, NODE_SELECT_END);
+    uiLength += binframe_build(BINPROTO_CMD_GET, ucId, (const unsigned char *)cLetters, (unsigned char)strlen(cLetters),
+                               &ucRequest[uiLength]);
+    nodeBus_transact(pBus, ucRequest, uiLength, NODE_BUS_SILENCE, pAnswer);
+
+    binframe_init(&parser);
+    for(uiIndex = 0; uiIndex < pAnswer->uiLength; uiIndex++){
+        if(!binframe_parse(&parser, pAnswer->ucBytes[uiIndex]))
+            continue;
+        if((BINPROTO_CMD_GET | BINPROTO_RESPONSE_MASK) != parser.ucCmd || ucId != parser.ucSeq || 6 != parser.ucLength)
+            return 0;
+        uiValue = binframe_getUnsigned(&parser.ucPayload[2], 4);
+        memcpy(pfValue, &uiValue, sizeof(*pfValue));
+        return 1;
+    }
+    return 0;
+}
+
+/* ************************************************** */
+/* Method name:        nodeBus_modbus                 */
+/* Method description: Modbus read of the setpoint    */
+/*                     register, the slave address is */
+/*                     the node ID                    */
+/* Input params:       pBus: bus                      */
+/*                     ucId: node ID                  */
+/*                     pAnswer: answer found          */
+/*                     puiSetpoint: register read     */
+/* Output params:      1 if a good answer came back   */
+/* ************************************************** */
+static unsigned char nodeBus_modbus(node_bus_type *pBus, unsigned char ucId, node_bus_answer_type *pAnswer, unsigned int *puiSetpoint)
+{
+    unsigned char ucRequest[8] = {0, MODBUS_READ_HOLDING, 0, 0, 0, 1};
+    unsigned short usCrc;
+
+    ucRequest[0] = ucId;
+    usCrc = crc16_compute(ucRequest, 6);
+    ucRequest[6] = (unsigned char)usCrc;
+    ucRequest[7] = (unsigned char)(usCrc >> 8);
+    nodeBus_transact(pBus, ucRequest, sizeof(ucRequest), NODE_BUS_MODBUS_SILENCE, pAnswer);
+
+    if(7 != pAnswer->uiLength || 0 != crc16_compute(pAnswer->ucBytes, 7) || ucId != pAnswer->ucBytes[0])
+        return 0;
+    *puiSetpoint = ((unsigned int)pAnswer->ucBytes[3] << 8) | pAnswer->ucBytes[4];
+    return 1;
+}
+
+/* ************************************************** */
+/* Method name:        nodeBus_run                    */
+/* Method description: Give each node its own         */
+/*                     setpoint, read them back in    */
+/*                     the three protocols and        */
+/*                     measure the poll of each node  */
+/* Input params:       uiNodes: nodes on the bus      */
+/*                     pCost: characters per node of  */
+/*                     each poll                      */
+/* Output params:      n/a                            */
+/* ************************************************** */
+static void nodeBus_run(unsigned int uiNodes, node_bus_cost_type *pCost)
+{
+    node_bus_type bus;
+    node_bus_answer_type answer;
+    unsigned int uiNode, uiRegister, uiStart;
+    unsigned char ucId;
+    char cText[32];
+    float fSetpoint;
+
+    memset(pCost, 0, sizeof(*pCost));
+    if(!nodeBus_open(&bus, uiNodes)){
+        nodeBus_close(&bus);
+        return;
+    }
+
+    /* the others do not take the write */
+    for(uiNode = 0; uiNode < uiNodes; uiNode++){
+        ucId = (unsigned char)(uiNode + 1U);
+        snprintf(cText, sizeof(cText), "#st%u;", NODE_BUS_SETPOINT(ucId));
+        nodeBus_ascii(&bus, ucId, cText, NODE_BUS_SILENCE, &answer);
+        nodeBus_expectAnswer(&answer, uiNode);
+    }
+
+    uiStart = bus.uiSteps;
+    for(uiNode = 0; uiNode < uiNodes; uiNode++){
+        ucId = (unsigned char)(uiNode + 1U);
+        nodeBus_ascii(&bus, ucId, "#gg;", NODE_BUS_SILENCE, &answer);
+        if(!nodeBus_expectAnswer(&answer, uiNode))
+            continue;
+        answer.ucBytes[answer.uiLength] = '\0';
+        snprintf(cText, sizeof(cText), "Temp setPoint = %u,000 C\n \r", NODE_BUS_SETPOINT(ucId));
+        hostTest_expectString((const char *)answer.ucBytes, cText, "ASCII setpoint of the node");
+    }
+    pCost->uiAscii = (bus.uiSteps - uiStart) / uiNodes;
+
+    /* a node that is not on the bus: no answer */
+    nodeBus_ascii(&bus, (unsigned char)(uiNodes + 1U), "#gg;", NODE_BUS_SILENCE, &answer);
+    hostTest_expectInt(answer.uiNodes, 0, "answer to a node not on the bus");
+
+    uiStart = bus.uiSteps;
+    for(uiNode = 0; uiNode < uiNodes; uiNode++){
+        ucId = (unsigned char)(uiNode + 1U);
+        fSetpoint = 0.0f;
+        hostTest_expect(nodeBus_binary(&bus, ucId, "g", &answer, &fSetpoint), "binary answer");
+        nodeBus_expectAnswer(&answer, uiNode);
+        hostTest_expect((float)NODE_BUS_SETPOINT(ucId) == fSetpoint, "binary setpoint of the node");
+    }
+    pCost->uiBinary = (bus.uiSteps - uiStart) / uiNodes;
+
+    /* a frame whose payload reads as a command to another node is
+     * skipped whole by the others */
+    if(1 < uiNodes){
+        snprintf(cText, sizeof(cText), "%c2%c#gg;", NODE_SELECT, NODE_SELECT_END);
+        nodeBus_binary(&bus, 1, cText, &answer, &fSetpoint);
+        nodeBus_expectAnswer(&answer, 0);
+    }
+
+    /* each node answers in ASCII, then listens to Modbus RTU: the
+     * nodes already switched take the traffic that follows as one
+     * frame, the Modbus silence ends it before the next request */
+    for(uiNode = 0; uiNode < uiNodes; uiNode++){
+        nodeBus_ascii(&bus, (unsigned char)(uiNode + 1U), "#sx1;", NODE_BUS_MODBUS_SILENCE, &answer);
+        nodeBus_expectAnswer(&answer, uiNode);
+    }
+    uiStart = bus.uiSteps;
+    for(uiNode = 0; uiNode < uiNodes; uiNode++){
+        ucId = (unsigned char)(uiNode + 1U);
+        uiRegister = 0;
+        hostTest_expect(nodeBus_modbus(&bus, ucId, &answer, &uiRegister), "Modbus answer");
+        nodeBus_expectAnswer(&answer, uiNode);
+        hostTest_expectInt(uiRegister, NODE_BUS_SETPOINT(ucId) * 100U, "Modbus setpoint of the node");
+    }
+    pCost->uiModbus = (bus.uiSteps - uiStart) / uiNodes;
+
+    hostTest_expectInt(bus.uiCollisions, 0, "collisions on the bus");
+    nodeBus_close(&bus);
+}
+
+int main(int argc, char **argv)
+{
+    static const unsigned int uiDefault[] = NODE_BUS_SIZES;
+    unsigned int uiSizes = (1 < argc) ? (unsigned int)(argc - 1) : sizeof(uiDefault) / sizeof(uiDefault[0]);
+    node_bus_cost_type cost, first;
+    unsigned int uiSize, uiNodes;
+
+    printf("nodes polled at %u bps, characters per node and time of a poll of every node\n", NODE_BUS_BAUD);
+    printf("  %5s %7s %7s %7s %10s %10s %10s\n", "nodes", "ASCII", "binary", "Modbus", "ASCII ms", "binary ms", "Modbus ms");
+    for(uiSize = 0; uiSize < uiSizes; uiSize++){
+        uiNodes = (1 < argc) ? (unsigned int)strtoul(argv[uiSize + 1], 0, 10) : uiDefault[uiSize];
+        if(!hostTest_expect(0 < uiNodes && NODE_BUS_MAX_NODES >= uiNodes, "nodes on the bus"))
+            continue;
+        nodeBus_run(uiNodes, &cost);
+        printf("  %5u %7u %7u %7u %10.1f %10.1f %10.1f\n", uiNodes, cost.uiAscii, cost.uiBinary, cost.uiModbus,
+               cost.uiAscii * uiNodes * NODE_BUS_CHAR_US / 1000.0, cost.uiBinary * uiNodes * NODE_BUS_CHAR_US / 1000.0,
+               cost.uiModbus * uiNodes * NODE_BUS_CHAR_US / 1000.0);
+
+        /* the others ignore the traffic: a poll costs the same on any bus,
+         * but for the digits of the longer IDs */
+        if(0 == uiSize){
+            first = cost;
+        }else{
+            hostTest_expect(cost.uiAscii <= first.uiAscii + 2U, "ASCII poll per node against the bus size");
+            hostTest_expect(cost.uiBinary <= first.uiBinary + 2U, "binary poll per node against the bus size");
+            hostTest_expect(cost.uiModbus <= first.uiModbus + 2U, "Modbus poll per node against the bus size");
+        }
+    }
+    return hostTest_report("node_bus_test");
+}
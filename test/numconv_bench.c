@@ -0,0 +1,146 @@
+/* ***************************************************************** */
+/* File name:        numconv_bench.c                                 */
+/* File description: Time of convertFloatToString and                */
+/*                   convertStringToFloat against the versions       */
+/*                   before numconv (legacy_util.c), on the host, on */
+/*                   the values the LCD and the commands use         */
+/*                   Usage: numconv_bench [calls]                    */
+/* Author name:      Grupo 18 - Renato Pepe                          */
+/*                              Joao Victor Matoso                   */
+/* Creation date:    19oct2026                                       */
+/* Revision date:    19oct2026                                       */
+/* ***************************************************************** */
+
+/* clock_gettime */
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "util.h"
+#include "legacy_util.h"
+
+#define NUMCONV_BENCH_CALLS     5000000U
+
+/* values cycled through, a power of 2 */
+#define NUMCONV_BENCH_POOL      4096U
+
+/* "23,50" on the LCD */
+#define NUMCONV_BENCH_FIELD     6U
+
+float fNumconvBenchValues[NUMCONV_BENCH_POOL];
+unsigned char ucNumconvBenchTexts[NUMCONV_BENCH_POOL][NUMCONV_BENCH_FIELD + 2];
+
+/* ************************************************** */
+/* Method name:        numconvBench_getSeconds        */
+/* Method description: Monotonic time                 */
+/* Input params:       n/a                            */
+/* Output params:      seconds                        */
+/* ************************************************** */
+static double numconvBench_getSeconds(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (double)now.tv_sec + (double)now.tv_nsec * 1e-9;
+}
+
+/* ************************************************** */
+/* Method name:        numconvBench_fill              */
+/* Method description: Temperatures and setpoints     */
+/*                     from 0 to 100 C, as values and */
+/*                     as command text                */
+/* Input params:       n/a                            */
+/* Output params:      n/a                            */
+/* ************************************************** */
+static void numconvBench_fill(void)
+{
+    unsigned int uiRandom = 0x1B873593U, uiIndex;
+
+    for(uiIndex = 0; uiIndex < NUMCONV_BENCH_POOL; uiIndex++){
+        uiRandom ^= uiRandom << 13;
+        uiRandom ^= uiRandom >> 17;
+        uiRandom ^= uiRandom << 5;
+        fNumconvBenchValues[uiIndex] = (float)(uiRandom % 100000U) / 1000.0f;
+        snprintf((char *)ucNumconvBenchTexts[uiIndex], sizeof(ucNumconvBenchTexts[uiIndex]), "%u,%02u",
+                 (uiRandom >> 8) % 100U, (uiRandom >> 16) % 100U);
+    }
+}
+
+/* ************************************************** */
+/* Method name:        numconvBench_format            */
+/* Method description: Time a float formatter         */
+/* Input params:       fFormat: function              */
+/*                     uiCalls: calls to time         */
+/*                     puiSum: checksum of the output */
+/* Output params:      ns per call                    */
+/* ************************************************** */
+static double numconvBench_format(void (*fFormat)(float, char *, unsigned int), unsigned int uiCalls, unsigned int *puiSum)
+{
+    char cText[NUMCONV_BENCH_FIELD];
+    unsigned int uiIndex, uiSum = 0;
+    double dStart = numconvBench_getSeconds();
+
+    for(uiIndex = 0; uiIndex < uiCalls; uiIndex++){
+        fFormat(fNumconvBenchValues[uiIndex & (NUMCONV_BENCH_POOL - 1)], cText, NUMCONV_BENCH_FIELD);
+        uiSum += (unsigned char)cText[NUMCONV_BENCH_FIELD - 2];
+    }
+    *puiSum = uiSum;
+    return (numconvBench_getSeconds() - dStart) * 1e9 / uiCalls;
+}
+
+/* ************************************************** */
+/* Method name:        numconvBench_parse             */
+/* Method description: Time a float parser            */
+/* Input params:       fParse: function               */
+/*                     uiCalls: calls to time         */
+/*                     pfSum: checksum of the output  */
+/* Output params:      ns per call                    */
+/* ************************************************** */
+static double numconvBench_parse(float (*fParse)(unsigned char *), unsigned int uiCalls, float *pfSum)
+{
+    unsigned int uiIndex;
+    float fSum = 0.0f;
+    double dStart = numconvBench_getSeconds();
+
+    for(uiIndex = 0; uiIndex < uiCalls; uiIndex++)
+        fSum += fParse(ucNumconvBenchTexts[uiIndex & (NUMCONV_BENCH_POOL - 1)]);
+    *pfSum = fSum;
+    return (numconvBench_getSeconds() - dStart) * 1e9 / uiCalls;
+}
+
+int main(int argc, char **argv)
+{
+    unsigned int uiCalls = (1 < argc) ? (unsigned int)strtoul(argv[1], 0, 10) : NUMCONV_BENCH_CALLS;
+    unsigned int uiIndex, uiDifferent = 0, uiSum;
+    double dLegacy, dNew;
+    float fSum;
+
+    numconvBench_fill();
+
+    /* the same text except where the old code truncated the last digit */
+    for(uiIndex = 0; uiIndex < NUMCONV_BENCH_POOL; uiIndex++){
+        char cLegacy[NUMCONV_BENCH_FIELD], cNew[NUMCONV_BENCH_FIELD];
+
+        legacy_convertFloatToString(fNumconvBenchValues[uiIndex], cLegacy, NUMCONV_BENCH_FIELD);
+        convertFloatToString(fNumconvBenchValues[uiIndex], cNew, NUMCONV_BENCH_FIELD);
+        if(strcmp(cLegacy, cNew))
+            uiDifferent++;
+    }
+
+    printf("%u calls, values 0..100 in a %u char field\n", uiCalls, NUMCONV_BENCH_FIELD - 1);
+    printf("  %-22s %10s %10s %8s\n", "function", "legacy ns", "numconv ns", "speedup");
+
+    dLegacy = numconvBench_format(legacy_convertFloatToString, uiCalls, &uiSum);
+    dNew = numconvBench_format(convertFloatToString, uiCalls, &uiSum);
+    printf("  %-22s %10.1f %10.1f %7.2fx\n", "convertFloatToString", dLegacy, dNew, dLegacy / dNew);
+
+    dLegacy = numconvBench_parse(legacy_convertStringToFloat, uiCalls, &fSum);
+    dNew = numconvBench_parse(convertStringToFloat, uiCalls, &fSum);
+    printf("  %-22s %10.1f %10.1f %7.2fx\n", "convertStringToFloat", dLegacy, dNew, dLegacy / dNew);
+
+    printf("  %u of %u texts differ from the legacy ones (rounded instead of truncated)\n", uiDifferent, NUMCONV_BENCH_POOL);
+    printf("  (checksums %u %g)\n", uiSum, fSum);
+    return 0;
+}
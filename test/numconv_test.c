@@ -0,0 +1,304 @@
+/* ***************************************************************** */
+/* File name:        numconv_test.c                                  */
+/* File description: Host test of numconv.c and of the util.c        */
+/*                   conversions built on it: INT_MIN, overflow, the */
+/*                   ',' separator, rounding and its carry, and a    */
+/*                   random sweep against sprintf/strtol             */
+/* Author name:      Grupo 18 - Renato Pepe                          */
+/*                              Joao Victor Matoso                   */
+/* Creation date:    19oct2026                                       */
+/* Revision date:    19oct2026                                       */
+/* ***************************************************************** */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <math.h>
+#include "numconv.h"
+#include "util.h"
+#include "hosttest.h"
+
+/* values of the random sweep */
+#define NUMCONV_TEST_RANDOM     1000000U
+
+typedef struct numconv_fixed_case_type {
+    int iValue;
+    unsigned char ucDecimals;
+    const char *cText;
+} numconv_fixed_case_type;
+
+typedef struct numconv_parse_case_type {
+    const char *cText;
+    unsigned char ucResult;
+    int iMantissa;
+    unsigned char ucDecimals;
+} numconv_parse_case_type;
+
+typedef struct numconv_round_case_type {
+    const char *cText;
+    unsigned char ucDecimals;
+    int iMin, iMax;
+    unsigned char ucResult;
+    int iValue;
+} numconv_round_case_type;
+
+typedef struct numconv_float_case_type {
+    float fValue;
+    unsigned int uiSize;
+    const char *cText;
+} numconv_float_case_type;
+
+static const numconv_fixed_case_type numconvFixedCases[] = {
+    {0,         0, "0"},
+    {-1,        0, "-1"},
+    {INT_MAX,   0, "2147483647"},
+    {INT_MIN,   0, "-2147483648"},
+    {-1234,     2, "-12,34"},
+    {5,         3, "0,005"},
+    {-5,        3, "-0,005"},
+    {0,         2, "0,00"},
+    {100,       2, "1,00"},
+    {INT_MAX,   9, "2,147483647"},
+    {INT_MIN,   9, "-2,147483648"},
+    {INT_MIN,   1, "-214748364,8"},
+};
+
+static const numconv_parse_case_type numconvParseCases[] = {
+    {"0",               NUMCONV_OK,           0,          0},
+    {"23,5",            NUMCONV_OK,           235,        1},
+    {"-23,05",          NUMCONV_OK,           -2305,      2},
+    {",5",              NUMCONV_OK,           5,          1},
+    {"7,",              NUMCONV_OK,           7,          0},
+    {"2147483647",      NUMCONV_OK,           INT_MAX,    0},
+    {"-2147483648",     NUMCONV_OK,           INT_MIN,    0},
+    {"2147483648",      NUMCONV_ERROR_RANGE,  0,          0},
+    {"-2147483649",     NUMCONV_ERROR_RANGE,  0,          0},
+    {"99999999999",     NUMCONV_ERROR_RANGE,  0,          0},
+    /* decimals that do not fit are only precision */
+    {"2147483647,9",    NUMCONV_OK,           INT_MAX,    0},
+    {"1,23456789012",   NUMCONV_OK,           1234567890, 9},
+    {"",                NUMCONV_ERROR_SYNTAX, 0,          0},
+    {"-",               NUMCONV_ERROR_SYNTAX, 0,          0},
+    {",",               NUMCONV_ERROR_SYNTAX, 0,          0},
+    {"1,2,3",           NUMCONV_ERROR_SYNTAX, 0,          0},
+    {"1.5",             NUMCONV_ERROR_SYNTAX, 0,          0},
+    {"--1",             NUMCONV_ERROR_SYNTAX, 0,          0},
+    {"1-",              NUMCONV_ERROR_SYNTAX, 0,          0},
+    {" 1",              NUMCONV_ERROR_SYNTAX, 0,          0},
+};
+
+static const numconv_round_case_type numconvRoundCases[] = {
+    {"1,25",        1, -1000,   1000,    NUMCONV_OK,          13},
+    {"1,24",        1, -1000,   1000,    NUMCONV_OK,          12},
+    {"-1,25",       1, -1000,   1000,    NUMCONV_OK,          -13},
+    {"-1,24",       1, -1000,   1000,    NUMCONV_OK,          -12},
+    {"9,96",        1, -1000,   1000,    NUMCONV_OK,          100},
+    {"30",          2, 2300,    7400,    NUMCONV_OK,          3000},
+    {"22,994",      2, 2300,    7400,    NUMCONV_ERROR_RANGE, 0},
+    {"22,995",      2, 2300,    7400,    NUMCONV_OK,          2300},
+    {"74,01",       2, 2300,    7400,    NUMCONV_ERROR_RANGE, 0},
+    {"214748365",   1, INT_MIN, INT_MAX, NUMCONV_ERROR_RANGE, 0},
+    {"214748364",   1, INT_MIN, INT_MAX, NUMCONV_OK,          2147483640},
+    {"1,2,",        1, INT_MIN, INT_MAX, NUMCONV_ERROR_SYNTAX,0},
+};
+
+static const numconv_float_case_type numconvFloatCases[] = {
+    {23.5f,     6,  "23,50"},
+    {0.0f,      5,  "0,00"},
+    {0.125f,    5,  "0,13"},
+    {-5.25f,    6,  "-5,25"},
+    /* the rounding carry costs a decimal */
+    {9.999f,    5,  "10,0"},
+    {99.996f,   6,  "100,0"},
+    {99.99f,    4,  "100"},
+    /* no room for the carry: '9's as for a number too big */
+    {99.6f,     3,  "99"},
+    {1.5f,      3,  "2 "},
+    {1234.0f,   4,  "999"},
+    {-12.0f,    3,  "99"},
+    {4.0e9f,    12, "99999999999"},
+};
+
+/* ************************************************** */
+/* Method name:        numconvTest_format             */
+/* Method description: The formatters at their limits */
+/* Input params:       n/a                            */
+/* Output params:      n/a                            */
+/* ************************************************** */
+static void numconvTest_format(void)
+{
+    char cText[NUMCONV_STRING_SIZE];
+    unsigned int uiIndex;
+
+    hostTest_expectInt(numconv_formatUnsigned(0, cText), 1, "formatUnsigned(0) length");
+    hostTest_expectString(cText, "0", "formatUnsigned(0)");
+    hostTest_expectInt(numconv_formatUnsigned(UINT_MAX, cText), 10, "formatUnsigned(UINT_MAX) length");
+    hostTest_expectString(cText, "4294967295", "formatUnsigned(UINT_MAX)");
+    /* both sides of the last value divided by 100 with the 32 bit reciprocal */
+    numconv_formatUnsigned(43698, cText);
+    hostTest_expectString(cText, "43698", "formatUnsigned(43698)");
+    numconv_formatUnsigned(43699, cText);
+    hostTest_expectString(cText, "43699", "formatUnsigned(43699)");
+    numconv_formatUnsignedWidth(7, 3, cText);
+    hostTest_expectString(cText, "007", "formatUnsignedWidth(7, 3)");
+    numconv_formatUnsignedWidth(12345, 3, cText);
+    hostTest_expectString(cText, "12345", "formatUnsignedWidth(12345, 3)");
+    numconv_formatUnsignedWidth(0, 10, cText);
+    hostTest_expectString(cText, "0000000000", "formatUnsignedWidth(0, 10)");
+    hostTest_expectInt(numconv_formatInt(INT_MIN, cText), 11, "formatInt(INT_MIN) length");
+    hostTest_expectString(cText, "-2147483648", "formatInt(INT_MIN)");
+
+    for(uiIndex = 0; uiIndex < sizeof(numconvFixedCases) / sizeof(numconvFixedCases[0]); uiIndex++){
+        const numconv_fixed_case_type *pCase = &numconvFixedCases[uiIndex];
+        unsigned char ucLength = numconv_formatFixed(pCase->iValue, pCase->ucDecimals, cText);
+
+        hostTest_expectString(cText, pCase->cText, "formatFixed");
+        hostTest_expectInt(ucLength, (long long)strlen(pCase->cText), "formatFixed length");
+    }
+}
+
+/* ************************************************** */
+/* Method name:        numconvTest_parse              */
+/* Method description: The parsers: syntax, overflow  */
+/*                     and rounding                   */
+/* Input params:       n/a                            */
+/* Output params:      n/a                            */
+/* ************************************************** */
+static void numconvTest_parse(void)
+{
+    unsigned int uiIndex, uiValue = 0;
+
+    hostTest_expectInt(numconv_parseUnsigned((const unsigned char *)"4294967295", UINT_MAX, &uiValue), NUMCONV_OK, "parseUnsigned(UINT_MAX)");
+    hostTest_expectInt(uiValue, UINT_MAX, "parseUnsigned(UINT_MAX) value");
+    hostTest_expectInt(numconv_parseUnsigned((const unsigned char *)"4294967296", UINT_MAX, &uiValue), NUMCONV_ERROR_RANGE, "parseUnsigned(UINT_MAX + 1)");
+    hostTest_expectInt(numconv_parseUnsigned((const unsigned char *)"100", 100, &uiValue), NUMCONV_OK, "parseUnsigned at the maximum");
+    hostTest_expectInt(numconv_parseUnsigned((const unsigned char *)"101", 100, &uiValue), NUMCONV_ERROR_RANGE, "parseUnsigned over the maximum");
+    hostTest_expectInt(numconv_parseUnsigned((const unsigned char *)"9", 9, &uiValue), NUMCONV_OK, "parseUnsigned at a one digit maximum");
+    hostTest_expectInt(numconv_parseUnsigned((const unsigned char *)"10", 9, &uiValue), NUMCONV_ERROR_RANGE, "parseUnsigned over a one digit maximum");
+    hostTest_expectInt(numconv_parseUnsigned((const unsigned char *)"1", 0, &uiValue), NUMCONV_ERROR_RANGE, "parseUnsigned over a zero maximum");
+    hostTest_expectInt(numconv_parseUnsigned((const unsigned char *)"", 100, &uiValue), NUMCONV_ERROR_SYNTAX, "parseUnsigned(\"\")");
+    hostTest_expectInt(numconv_parseUnsigned((const unsigned char *)"-1", 100, &uiValue), NUMCONV_ERROR_SYNTAX, "parseUnsigned(\"-1\")");
+    hostTest_expectInt(numconv_parseUnsigned((const unsigned char *)"1,0", 100, &uiValue), NUMCONV_ERROR_SYNTAX, "parseUnsigned(\"1,0\")");
+
+    for(uiIndex = 0; uiIndex < sizeof(numconvParseCases) / sizeof(numconvParseCases[0]); uiIndex++){
+        const numconv_parse_case_type *pCase = &numconvParseCases[uiIndex];
+        int iMantissa = 0;
+        unsigned char ucDecimals = 0;
+        char cWhat[64];
+
+        snprintf(cWhat, sizeof(cWhat), "parseDecimal(\"%s\")", pCase->cText);
+        if(!hostTest_expectInt(numconv_parseDecimal((const unsigned char *)pCase->cText, &iMantissa, &ucDecimals), pCase->ucResult, cWhat))
+            continue;
+        if(NUMCONV_OK != pCase->ucResult)
+            continue;
+        hostTest_expectInt(iMantissa, pCase->iMantissa, cWhat);
+        hostTest_expectInt(ucDecimals, pCase->ucDecimals, cWhat);
+    }
+
+    for(uiIndex = 0; uiIndex < sizeof(numconvRoundCases) / sizeof(numconvRoundCases[0]); uiIndex++){
+        const numconv_round_case_type *pCase = &numconvRoundCases[uiIndex];
+        int iValue = 0;
+        char cWhat[64];
+
+        snprintf(cWhat, sizeof(cWhat), "parseFixed(\"%s\", %u)", pCase->cText, pCase->ucDecimals);
+        if(hostTest_expectInt(numconv_parseFixed((const unsigned char *)pCase->cText, pCase->ucDecimals, pCase->iMin, pCase->iMax, &iValue), pCase->ucResult, cWhat)
+           && NUMCONV_OK == pCase->ucResult)
+            hostTest_expectInt(iValue, pCase->iValue, cWhat);
+    }
+}
+
+/* ************************************************** */
+/* Method name:        numconvTest_util               */
+/* Method description: The util.c conversions used by */
+/*                     the LCD and the commands       */
+/* Input params:       n/a                            */
+/* Output params:      n/a                            */
+/* ************************************************** */
+static void numconvTest_util(void)
+{
+    char cText[16];
+    unsigned int uiIndex;
+
+    for(uiIndex = 0; uiIndex < sizeof(numconvFloatCases) / sizeof(numconvFloatCases[0]); uiIndex++){
+        const numconv_float_case_type *pCase = &numconvFloatCases[uiIndex];
+        char cWhat[64];
+
+        snprintf(cWhat, sizeof(cWhat), "convertFloatToString(%g, %u)", pCase->fValue, pCase->uiSize);
+        convertFloatToString(pCase->fValue, cText, pCase->uiSize);
+        hostTest_expectString(cText, pCase->cText, cWhat);
+    }
+    convertFloatToString(NAN, cText, 4);
+    hostTest_expectString(cText, "999", "convertFloatToString(NaN)");
+
+    hostTest_expect(23.5f == convertStringToFloat((unsigned char *)"23,5"), "convertStringToFloat(\"23,5\")");
+    hostTest_expect(-1.5f == convertStringToFloat((unsigned char *)"-1,5"), "convertStringToFloat(\"-1,5\")");
+    hostTest_expect(0.001f == convertStringToFloat((unsigned char *)"0,001"), "convertStringToFloat(\"0,001\")");
+    hostTest_expect(isnan(convertStringToFloat((unsigned char *)"")), "convertStringToFloat(\"\") is NaN");
+    hostTest_expect(isnan(convertStringToFloat((unsigned char *)"1,2,3")), "convertStringToFloat(\"1,2,3\") is NaN");
+    hostTest_expect(isnan(convertStringToFloat((unsigned char *)"2147483648")), "convertStringToFloat overflow is NaN");
+
+    hostTest_expectInt(stringToUnsignedInt((unsigned char *)"4294967295"), UINT_MAX, "stringToUnsignedInt(UINT_MAX)");
+    hostTest_expectInt(stringToUnsignedInt((unsigned char *)"4294967296"), 0, "stringToUnsignedInt overflow");
+    hostTest_expectInt(stringToUnsignedInt((unsigned char *)"12a"), 0, "stringToUnsignedInt(\"12a\")");
+
+    unsignedIntToString(cText, 7, 3);
+    hostTest_expectString(cText, "007", "unsignedIntToString(7, 3)");
+    unsignedIntToString(cText, 999, 3);
+    hostTest_expectString(cText, "999", "unsignedIntToString(999, 3)");
+    unsignedIntToString(cText, 1000, 3);
+    hostTest_expectString(cText, "XXX", "unsignedIntToString(1000, 3)");
+    unsignedIntToString(cText, UINT_MAX, 10);
+    hostTest_expectString(cText, "4294967295", "unsignedIntToString(UINT_MAX, 10)");
+}
+
+/* ************************************************** */
+/* Method name:        numconvTest_random             */
+/* Method description: Random values against the C    */
+/*                     library                        */
+/* Input params:       n/a                            */
+/* Output params:      n/a                            */
+/* ************************************************** */
+static void numconvTest_random(void)
+{
+    unsigned int uiRandom = 0x9E3779B9U, uiIndex, uiFailures = 0;
+
+    for(uiIndex = 0; uiIndex < NUMCONV_TEST_RANDOM && uiFailures < 10; uiIndex++){
+        char cText[NUMCONV_STRING_SIZE], cExpected[24];
+        unsigned char ucDecimals, ucRead;
+        int iValue, iMantissa;
+
+        uiRandom ^= uiRandom << 13;
+        uiRandom ^= uiRandom >> 17;
+        uiRandom ^= uiRandom << 5;
+        /* small values as often as big ones */
+        iValue = (int)(uiRandom >> (uiRandom & 31U));
+        if(uiRandom & 0x100U)
+            iValue = -iValue;
+        ucDecimals = (unsigned char)((uiRandom >> 9) % (NUMCONV_MAX_DECIMALS + 1));
+
+        numconv_formatInt(iValue, cText);
+        snprintf(cExpected, sizeof(cExpected), "%d", iValue);
+        if(!hostTest_expectString(cText, cExpected, "formatInt against sprintf"))
+            uiFailures++;
+
+        /* the text of a fixed-point value reads back the same */
+        numconv_formatFixed(iValue, ucDecimals, cText);
+        if(!hostTest_expect(NUMCONV_OK == numconv_parseDecimal((unsigned char *)cText, &iMantissa, &ucRead)
+                            && iMantissa == iValue && ucRead == ucDecimals, "formatFixed then parseDecimal"))
+            uiFailures++;
+
+        snprintf(cExpected, sizeof(cExpected), "%u", (unsigned int)iValue);
+        if(!hostTest_expectInt(stringToUnsignedInt((unsigned char *)cExpected), (long long)strtoul(cExpected, 0, 10), "stringToUnsignedInt against strtoul"))
+            uiFailures++;
+    }
+}
+
+int main(void)
+{
+    numconvTest_format();
+    numconvTest_parse();
+    numconvTest_util();
+    numconvTest_random();
+    return hostTest_report("numconv_test");
+}
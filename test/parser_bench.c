@@ -0,0 +1,460 @@
+/* ***************************************************************** */
+/* File name:        parser_bench.c                                  */
+/* File description: Throughput and robustness of the command parser */
+/*                   (processByteCommunication) on the host. Random  */
+/*                   ASCII and binary commands, some after malformed */
+/*                   bursts (noise, truncated or corrupted commands, */
+/*                   bad CRC), are fed on a 115200 bps line model.   */
+/*                   Reports commands/s, the response size of each   */
+/*                   kind of command and the bytes lost to resync    */
+/*                   after each burst.                               */
+/*                   Usage: parser_bench [commands] [--check]        */
+/* Author name:      Grupo 18 - Renato Pepe                          */
+/*                              Joao Victor Matoso                   */
+/* Creation date:    19oct2026                                       */
+/* Revision date:    19oct2026                                       */
+/* ***************************************************************** */
+
+/* clock_gettime */
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "communicationStateMachine.h"
+#include "paramRegistry.h"
+#include "binaryProtocol.h"
+#include "node.h"
+#include "UART.h"
+#include "uart_shim.h"
+#include "hostboard.h"
+#include "binframe.h"
+
+#define BENCH_DEFAULT_COMMANDS  2000000U
+
+/* 115200 bps, 10 bits a byte: us of a byte on the line */
+#define BENCH_BYTE_US           ((10U * 1000000U + 115200U - 1U) / 115200U)
+
+/* share of the commands that come after a malformed burst */
+#define BENCH_MALFORMED_PERCENT 20U
+
+/* longest noise burst */
+#define BENCH_MAX_NOISE         32U
+
+/*
+ * --check fails above this: a burst can open a binary frame of the longest
+ * payload, the command that frame ends in is lost too
+ */
+#define BENCH_MAX_LOST_BYTES    (2U * BINFRAME_MAX_SIZE)
+
+/* kinds of well-formed commands */
+#define BENCH_GET               0U      // #g<letter>;
+#define BENCH_BATCH             1U      // #g<letters>;
+#define BENCH_GET_ALL           2U      // #g*;
+#define BENCH_SET               3U      // #s<letter><value>;
+#define BENCH_BIN_PING          4U
+#define BENCH_BIN_GET           5U
+#define BENCH_BIN_SET           6U
+#define BENCH_KINDS             7U
+
+/* kinds of malformed bursts */
+#define BENCH_NOISE             0U      // random bytes
+#define BENCH_TRUNCATED         1U      // a command cut short
+#define BENCH_CORRUPTED         2U      // a command with a byte replaced
+#define BENCH_BAD_CRC           3U      // a binary frame with a wrong CRC
+#define BENCH_BURSTS            4U
+
+typedef struct bench_kind_type {
+    unsigned int uiCount;
+    unsigned int uiFailed;
+    unsigned long long ullRequestBytes;
+    unsigned long long ullResponseBytes;
+    unsigned int uiMaxResponse;
+} bench_kind_type;
+
+typedef struct bench_set_type {
+    unsigned char ucLetter;
+    const char *cValue;
+    float fValue;
+} bench_set_type;
+
+static const char * const cBenchKindNames[BENCH_KINDS] = {
+    "#g<letter>;", "#g<letters>;", "#g*;", "#s<letter><value>;", "bin PING", "bin GET", "bin SET"
+};
+
+static const char * const cBenchBurstNames[BENCH_BURSTS] = {
+    "noise", "truncated", "corrupted", "bad CRC"
+};
+
+/* only settings that leave the board talking to the bench */
+static const bench_set_type benchSets[] = {
+    {'t', "30,5", 30.5f},
+    {'p', "1,25", 1.25f},
+    {'i', "0,5",  0.5f},
+    {'d', "0",    0.0f},
+    {'v', "1500", 1500.0f},
+    {'y', "28",   28.0f},
+    {'n', "60",   60.0f},
+    {'s', "0",    0.0f},
+    {'f', "0",    0.0f},
+};
+
+#define BENCH_SETS              (sizeof(benchSets) / sizeof(benchSets[0]))
+
+/* parser statistics of communicationStateMachine.c */
+extern unsigned int uiStatCommands;
+extern unsigned int uiStatMaxResync;
+
+unsigned int uiBenchRandom = 0x2545F491U;
+unsigned int uiBenchLineUs = 0;
+unsigned char ucBenchSeq = 0;
+
+/* parameters of the get commands */
+unsigned char ucBenchGetLetters[64];
+unsigned int uiBenchGetLetters = 0;
+unsigned char ucBenchValueLetters[64];
+unsigned int uiBenchValueLetters = 0;
+
+/* ************************************************** */
+/* Method name:        bench_random                   */
+/* Method description: xorshift32, the same stream on */
+/*                     every run                      */
+/* Input params:       uiRange: values 0..uiRange-1   */
+/* Output params:      random value                   */
+/* ************************************************** */
+static unsigned int bench_random(unsigned int uiRange)
+{
+    uiBenchRandom ^= uiBenchRandom << 13;
+    uiBenchRandom ^= uiBenchRandom >> 17;
+    uiBenchRandom ^= uiBenchRandom << 5;
+    return uiBenchRandom % uiRange;
+}
+
+/* ************************************************** */
+/* Method name:        bench_getSeconds               */
+/* Method description: Monotonic time                 */
+/* Input params:       n/a                            */
+/* Output params:      seconds                        */
+/* ************************************************** */
+static double bench_getSeconds(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (double)now.tv_sec + (double)now.tv_nsec * 1e-9;
+}
+
+/* ************************************************** */
+/* Method name:        bench_findLetters              */
+/* Method description: Letters of the registry for    */
+/*                     the ASCII gets (any) and the   */
+/*                     binary gets (with a value)     */
+/* Input params:       n/a                            */
+/* Output params:      n/a                            */
+/* ************************************************** */
+static void bench_findLetters(void)
+{
+    unsigned char ucIndex;
+
+    for(ucIndex = 0; ucIndex < param_getCount(); ucIndex++){
+        const param_descriptor_type *pParam = param_getByIndex(ucIndex);
+
+        if(!(pParam->ucFlags & PARAM_FLAG_GET))
+            continue;
+        ucBenchGetLetters[uiBenchGetLetters++] = pParam->ucLetter;
+        if(pParam->fGet)
+            ucBenchValueLetters[uiBenchValueLetters++] = pParam->ucLetter;
+    }
+}
+
+/* ************************************************** */
+/* Method name:        bench_buildCommand             */
+/* Method description: A well-formed command          */
+/* Input params:       uiKind: BENCH_GET..            */
+/*                     pucCommand: BINFRAME_MAX_SIZE  */
+/*                     bytes                          */
+/* Output params:      command size                   */
+/* ************************************************** */
+static unsigned int bench_buildCommand(unsigned int uiKind, unsigned char *pucCommand)
+{
+    unsigned char ucPayload[BINPROTO_MAX_PAYLOAD];
+    unsigned int uiLength = 0, uiCount;
+    const bench_set_type *pSet;
+
+    switch(uiKind){
+    case BENCH_GET:
+        return sprintf((char *)pucCommand, "#g%c;", ucBenchGetLetters[bench_random(uiBenchGetLetters)]);
+
+    case BENCH_BATCH:
+        uiLength = sprintf((char *)pucCommand, "#g");
+        for(uiCount = 2 + bench_random(5); uiCount; uiCount--)
+            pucCommand[uiLength++] = ucBenchValueLetters[bench_random(uiBenchValueLetters)];
+        pucCommand[uiLength++] = ';';
+        return uiLength;
+
+    case BENCH_GET_ALL:
+        return sprintf((char *)pucCommand, "#g*;");
+
+    case BENCH_SET:
+        pSet = &benchSets[bench_random(BENCH_SETS)];
+        return sprintf((char *)pucCommand, "#s%c%s;", pSet->ucLetter, pSet->cValue);
+
+    case BENCH_BIN_PING:
+        return binframe_build(BINPROTO_CMD_PING, ucBenchSeq++, 0, 0, pucCommand);
+
+    case BENCH_BIN_GET:
+        for(uiCount = 1 + bench_random(6); uiCount; uiCount--)
+            ucPayload[uiLength++] = ucBenchValueLetters[bench_random(uiBenchValueLetters)];
+        return binframe_build(BINPROTO_CMD_GET, ucBenchSeq++, ucPayload, uiLength, pucCommand);
+
+    default:
+        for(uiCount = 1 + bench_random(3); uiCount; uiCount--){
+            pSet = &benchSets[bench_random(BENCH_SETS)];
+            ucPayload[uiLength] = pSet->ucLetter;
+            memcpy(&ucPayload[uiLength + 1], &pSet->fValue, sizeof(float));
+            uiLength += 5;
+        }
+        return binframe_build(BINPROTO_CMD_SET, ucBenchSeq++, ucPayload, uiLength, pucCommand);
+    }
+}
+
+/* ************************************************** */
+/* Method name:        bench_buildBurst               */
+/* Method description: A malformed burst              */
+/* Input params:       uiKind: BENCH_NOISE..          */
+/*                     pucBurst: BINFRAME_MAX_SIZE    */
+/*                     bytes                          */
+/* Output params:      burst size                     */
+/* ************************************************** */
+static unsigned int bench_buildBurst(unsigned int uiKind, unsigned char *pucBurst)
+{
+    unsigned int uiLength, uiIndex;
+
+    switch(uiKind){
+    case BENCH_NOISE:
+        uiLength = 1 + bench_random(BENCH_MAX_NOISE);
+        for(uiIndex = 0; uiIndex < uiLength; uiIndex++)
+            pucBurst[uiIndex] = (unsigned char)bench_random(256);
+        return uiLength;
+
+    case BENCH_TRUNCATED:
+        uiLength = bench_buildCommand(bench_random(BENCH_KINDS), pucBurst);
+        return 1 + bench_random(uiLength - 1);
+
+    case BENCH_CORRUPTED:
+        uiLength = bench_buildCommand(bench_random(BENCH_KINDS), pucBurst);
+        pucBurst[bench_random(uiLength)] = (unsigned char)bench_random(256);
+        return uiLength;
+
+    default:
+        uiLength = bench_buildCommand(BENCH_BIN_PING + bench_random(3), pucBurst);
+        pucBurst[uiLength - 1] ^= 1U + bench_random(255);
+        return uiLength;
+    }
+}
+
+/* ************************************************** */
+/* Method name:        bench_feed                     */
+/* Method description: Receive bytes on the line      */
+/*                     model, the time moves with     */
+/*                     them                           */
+/* Input params:       pucBytes, uiLength: bytes      */
+/* Output params:      1 if the last byte ended a     */
+/*                     command that ran               */
+/* ************************************************** */
+static unsigned char bench_feed(const unsigned char *pucBytes, unsigned int uiLength)
+{
+    unsigned int uiCommands = 0, uiFrames = 0, uiFramesNow, uiErrors, uiIndex;
+
+    for(uiIndex = 0; uiIndex < uiLength; uiIndex++){
+        if(uiIndex + 1 == uiLength){
+            uiCommands = uiStatCommands;
+            binaryProtocol_getStatistics(&uiFrames, &uiErrors);
+        }
+        processByteCommunication(pucBytes[uiIndex]);
+        for(uiBenchLineUs += BENCH_BYTE_US; 1000U <= uiBenchLineUs; uiBenchLineUs -= 1000U)
+            hostBoard_advanceMs(1);
+    }
+    binaryProtocol_getStatistics(&uiFramesNow, &uiErrors);
+
+    /* a corrupted '#sl' may have moved the board off node 0 */
+    if(node_getId()){
+        node_setId(0);
+        UART0_processReceived();
+    }
+
+    /* '#sq;' clears uiStatCommands, so any change counts */
+    return (uiCommands != uiStatCommands) || (uiFrames != uiFramesNow);
+}
+
+/* ************************************************** */
+/* Method name:        bench_printRate                */
+/* Method description: Print the throughput of a pass */
+/* Input params:       uiCommands, ullBytes: traffic  */
+/*                     dSeconds: time taken           */
+/* Output params:      n/a                            */
+/* ************************************************** */
+static void bench_printRate(unsigned int uiCommands, unsigned long long ullBytes, double dSeconds)
+{
+    printf("  %u commands, %llu bytes in %.3f s: %.0f commands/s, %.2f MB/s, %.1f ns/byte\n",
+           uiCommands, ullBytes, dSeconds, uiCommands / dSeconds, ullBytes / dSeconds / 1e6, dSeconds * 1e9 / ullBytes);
+}
+
+/* ************************************************** */
+/* Method name:        bench_runClean                 */
+/* Method description: Well-formed commands only:     */
+/*                     throughput and response size   */
+/*                     of each kind                   */
+/* Input params:       uiCommands: commands to send   */
+/* Output params:      commands with no response      */
+/* ************************************************** */
+static unsigned int bench_runClean(unsigned int uiCommands)
+{
+    bench_kind_type kinds[BENCH_KINDS];
+    unsigned char ucCommand[BINFRAME_MAX_SIZE];
+    unsigned long long ullBytes = 0;
+    unsigned int uiIndex, uiFailed = 0;
+    double dStart;
+
+    memset(kinds, 0, sizeof(kinds));
+    uartShim_reset();
+    dStart = bench_getSeconds();
+    for(uiIndex = 0; uiIndex < uiCommands; uiIndex++){
+        unsigned int uiKind = bench_random(BENCH_KINDS);
+        unsigned int uiLength = bench_buildCommand(uiKind, ucCommand);
+        unsigned int uiTxBefore = uartShim_getTxBytes();
+        unsigned int uiResponse;
+
+        if(!bench_feed(ucCommand, uiLength))
+            kinds[uiKind].uiFailed++;
+        uiResponse = uartShim_getTxBytes() - uiTxBefore;
+        kinds[uiKind].uiCount++;
+        kinds[uiKind].ullRequestBytes += uiLength;
+        kinds[uiKind].ullResponseBytes += uiResponse;
+        if(kinds[uiKind].uiMaxResponse < uiResponse)
+            kinds[uiKind].uiMaxResponse = uiResponse;
+        ullBytes += uiLength;
+    }
+
+    printf("well-formed commands\n");
+    bench_printRate(uiCommands, ullBytes, bench_getSeconds() - dStart);
+    printf("  %-20s %9s %8s %10s %10s %8s\n", "command", "count", "req B", "resp B avg", "resp B max", "no resp");
+    for(uiIndex = 0; uiIndex < BENCH_KINDS; uiIndex++){
+        bench_kind_type *pKind = &kinds[uiIndex];
+
+        if(!pKind->uiCount)
+            continue;
+        printf("  %-20s %9u %8.1f %10.1f %10u %8u\n", cBenchKindNames[uiIndex], pKind->uiCount,
+               (double)pKind->ullRequestBytes / pKind->uiCount, (double)pKind->ullResponseBytes / pKind->uiCount,
+               pKind->uiMaxResponse, pKind->uiFailed);
+        uiFailed += pKind->uiFailed;
+    }
+    return uiFailed;
+}
+
+/* ************************************************** */
+/* Method name:        bench_runMixed                 */
+/* Method description: Commands with malformed bursts */
+/*                     in between: throughput and the */
+/*                     well-formed bytes lost until   */
+/*                     the parser is back in sync     */
+/* Input params:       uiCommands: commands to send   */
+/* Output params:      worst resync in bytes          */
+/* ************************************************** */
+static unsigned int bench_runMixed(unsigned int uiCommands)
+{
+    unsigned char ucBytes[BINFRAME_MAX_SIZE];
+    unsigned int uiBursts[BENCH_BURSTS] = {0};
+    unsigned int uiWorst[BENCH_BURSTS] = {0};
+    unsigned long long ullBytes = 0, ullLost = 0;
+    unsigned int uiIndex, uiLost = 0, uiLostCommands = 0, uiResyncs = 0, uiMaxResync = 0;
+    unsigned int uiBurstKind = 0;
+    unsigned char ucResyncing = 0;
+    double dStart;
+
+    uartShim_reset();
+    dStart = bench_getSeconds();
+    for(uiIndex = 0; uiIndex < uiCommands; uiIndex++){
+        unsigned int uiLength;
+
+        /* one burst at a time, the next only after the parser is back */
+        if(!ucResyncing && bench_random(100) < BENCH_MALFORMED_PERCENT){
+            uiBurstKind = bench_random(BENCH_BURSTS);
+            uiLength = bench_buildBurst(uiBurstKind, ucBytes);
+            bench_feed(ucBytes, uiLength);
+            ullBytes += uiLength;
+            uiBursts[uiBurstKind]++;
+            ucResyncing = 1;
+            uiLost = 0;
+            if(uiMaxResync < uiStatMaxResync)
+                uiMaxResync = uiStatMaxResync;
+        }
+
+        uiLength = bench_buildCommand(bench_random(BENCH_KINDS), ucBytes);
+        ullBytes += uiLength;
+        if(bench_feed(ucBytes, uiLength)){
+            if(ucResyncing){
+                uiResyncs++;
+                ullLost += uiLost;
+                if(uiWorst[uiBurstKind] < uiLost)
+                    uiWorst[uiBurstKind] = uiLost;
+                ucResyncing = 0;
+            }
+        }else{
+            uiLostCommands++;
+            uiLost += uiLength;
+        }
+    }
+    if(uiMaxResync < uiStatMaxResync)
+        uiMaxResync = uiStatMaxResync;
+
+    printf("commands after malformed bursts (%u %%)\n", BENCH_MALFORMED_PERCENT);
+    bench_printRate(uiCommands, ullBytes, bench_getSeconds() - dStart);
+    printf("  %u well-formed commands lost, %.2f bytes lost to resync on average\n",
+           uiLostCommands, uiResyncs ? (double)ullLost / uiResyncs : 0.0);
+    printf("  %-20s %9s %14s\n", "burst", "count", "worst resync B");
+    for(uiIndex = 0; uiIndex < BENCH_BURSTS; uiIndex++)
+        printf("  %-20s %9u %14u\n", cBenchBurstNames[uiIndex], uiBursts[uiIndex], uiWorst[uiIndex]);
+    printf("  longest garbage run seen by the parser (#gq max resync): %u bytes\n", uiMaxResync);
+
+    uiMaxResync = 0;
+    for(uiIndex = 0; uiIndex < BENCH_BURSTS; uiIndex++)
+        if(uiMaxResync < uiWorst[uiIndex])
+            uiMaxResync = uiWorst[uiIndex];
+    return uiMaxResync;
+}
+
+int main(int argc, char **argv)
+{
+    unsigned int uiCommands = BENCH_DEFAULT_COMMANDS;
+    unsigned int uiFailed, uiWorst;
+    unsigned char ucCheck = 0;
+    int iArg;
+
+    for(iArg = 1; iArg < argc; iArg++){
+        if(!strcmp(argv[iArg], "--check"))
+            ucCheck = 1;
+        else
+            uiCommands = (unsigned int)strtoul(argv[iArg], 0, 10);
+    }
+
+    hostBoard_init();
+    bench_findLetters();
+
+    uiFailed = bench_runClean(uiCommands);
+    uiWorst = bench_runMixed(uiCommands);
+
+    if(!ucCheck)
+        return 0;
+    if(uiFailed){
+        printf("FAIL: %u well-formed commands without a response\n", uiFailed);
+        return 1;
+    }
+    if(BENCH_MAX_LOST_BYTES < uiWorst){
+        printf("FAIL: %u bytes to resync, more than %u\n", uiWorst, BENCH_MAX_LOST_BYTES);
+        return 1;
+    }
+    printf("parser_bench: OK\n");
+    return 0;
+}
@@ -0,0 +1,67 @@
+/* ***************************************************************** */
+/* File name:        plant.c                                         */
+/* File description: Host model of the heater, fan and temperature:  */
+/*                   first order fan speed, and a heat balance where */
+/*                   the fan raises the loss to the room             */
+/* Author name:      Grupo 18 - Renato Pepe                          */
+/*                              Joao Victor Matoso                   */
+/* Creation date:    19oct2026                                       */
+/* Revision date:    19oct2026                                       */
+/* ***************************************************************** */
+
+#include "plant.h"
+#include "fanControl.h"
+#include "aquecedorECooler.h"
+#include "board_stubs.h"
+
+/* time constants of the fan speed and of the temperature, s */
+#define PLANT_FAN_TAU_S         0.4f
+#define PLANT_THERMAL_TAU_S     60.0f
+
+/* C above the ambient with the heater at full duty, fan off */
+#define PLANT_HEATER_GAIN       60.0f
+
+/* the fan at full speed takes this many times the natural loss */
+#define PLANT_FAN_COOLING       2.0f
+
+/* ************************************************** */
+/* Method name:        plant_init                     */
+/* Method description: Plant at rest, nominal fan     */
+/* Input params:       pPlant: plant                  */
+/*                     fTemperature: start, C         */
+/*                     fHeatLoad: external heat, C    */
+/*                     above the ambient              */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void plant_init(plant_type *pPlant, float fTemperature, float fHeatLoad)
+{
+    pPlant->fTemperature = fTemperature;
+    pPlant->fFanRpm = 0.0f;
+    pPlant->fFanGain = 1.0f;
+    pPlant->fHeatLoad = fHeatLoad;
+    boardStub_setSpeed(0);
+}
+
+/* ************************************************** */
+/* Method name:        plant_run                      */
+/* Method description: Let the plant evolve with the  */
+/*                     duty cycles of the board stubs */
+/*                     and put its speed on the       */
+/*                     tachometer stub                */
+/* Input params:       pPlant: plant                  */
+/*                     fSeconds: time                 */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void plant_run(plant_type *pPlant, float fSeconds)
+{
+    float fHeater = getDutyCycleHeater(), fCooler = getDutyCycleCooler();
+    unsigned int uiSteps = (unsigned int)(fSeconds / PLANT_STEP_S + 0.5f);
+
+    while(uiSteps--){
+        float fLoss = (pPlant->fTemperature - PLANT_AMBIENT) * (1.0f + PLANT_FAN_COOLING * pPlant->fFanRpm / FAN_CONTROL_MAX_RPM);
+
+        pPlant->fFanRpm += (pPlant->fFanGain * fCooler * FAN_CONTROL_MAX_RPM - pPlant->fFanRpm) * PLANT_STEP_S / PLANT_FAN_TAU_S;
+        pPlant->fTemperature += (PLANT_HEATER_GAIN * fHeater + pPlant->fHeatLoad - fLoss) * PLANT_STEP_S / PLANT_THERMAL_TAU_S;
+    }
+    boardStub_setSpeed((unsigned int)(pPlant->fFanRpm * 10.0f + 0.5f));
+}
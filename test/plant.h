@@ -0,0 +1,53 @@
+/* ***************************************************************** */
+/* File name:        plant.h                                         */
+/* File description: Host model of the heater, the cooler fan and    */
+/*                   the resistor temperature, driven by the duty    */
+/*                   cycles the firmware sets. The fan gain can be   */
+/*                   lowered to make a fan disturbance (dirty filter,*/
+/*                   low supply)                                     */
+/* Author name:      Grupo 18 - Renato Pepe                          */
+/*                              Joao Victor Matoso                   */
+/* Creation date:    19oct2026                                       */
+/* Revision date:    19oct2026                                       */
+/* ***************************************************************** */
+
+#ifndef TEST_PLANT_H_
+#define TEST_PLANT_H_
+
+/* room temperature, C */
+#define PLANT_AMBIENT           25.0f
+
+/* step used by plant_run, s */
+#define PLANT_STEP_S            0.01f
+
+typedef struct plant_type {
+    float fTemperature;         // C
+    float fFanRpm;
+    float fFanGain;             // speed reached per duty, 1 nominal
+    float fHeatLoad;            // C above the ambient reached with heater and fan off
+} plant_type;
+
+/* ************************************************** */
+/* Method name:        plant_init                     */
+/* Method description: Plant at rest, nominal fan     */
+/* Input params:       pPlant: plant                  */
+/*                     fTemperature: start, C         */
+/*                     fHeatLoad: external heat, C    */
+/*                     above the ambient              */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void plant_init(plant_type *pPlant, float fTemperature, float fHeatLoad);
+
+/* ************************************************** */
+/* Method name:        plant_run                      */
+/* Method description: Let the plant evolve with the  */
+/*                     duty cycles of the board stubs */
+/*                     and put its speed on the       */
+/*                     tachometer stub                */
+/* Input params:       pPlant: plant                  */
+/*                     fSeconds: time                 */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void plant_run(plant_type *pPlant, float fSeconds);
+
+#endif /* TEST_PLANT_H_ */
@@ -0,0 +1,126 @@
+/* ***************************************************************** */
+/* File name:        schedule_test.c                                 */
+/* File description: Timing of the daily program on rtc.c and        */
+/*                   timer.c, with the RTC shim counting 1 ms at a   */
+/*                   time: an entry 5 s ahead waits on the one-shot  */
+/*                   timer, one 60 s ahead on the RTC alarm then the */
+/*                   timer. Each must run on time, within one timer  */
+/*                   tick and never early, from any RTC phase        */
+/* Author name:      Grupo 18 - Renato Pepe                          */
+/*                              Joao Victor Matoso                   */
+/* Creation date:    19oct2026                                       */
+/* Revision date:    19oct2026                                       */
+/* ***************************************************************** */
+
+#include <stdio.h>
+#include "schedule.h"
+#include "rtc.h"
+#include "pid.h"
+#include "rtc_shim.h"
+#include "hostboard.h"
+#include "hosttest.h"
+
+/* 10:00:00 */
+#define SCHEDULE_TEST_CLOCK_S   36000U
+
+/* setpoint before the entry runs */
+#define SCHEDULE_TEST_SETPOINT  30.0f
+
+/* ************************************************** */
+/* Method name:        scheduleTest_entry             */
+/* Method description: Set an entry ahead of the      */
+/*                     clock, let the time pass and   */
+/*                     check when it ran              */
+/* Input params:       uiPhaseMs: time before setting */
+/*                     the clock, moves the RTC phase */
+/*                     uiAheadS: entry time after the */
+/*                     clock                          */
+/*                     fSetpoint: setpoint it sets    */
+/* Output params:      n/a                            */
+/* ************************************************** */
+static void scheduleTest_entry(unsigned int uiPhaseMs, unsigned int uiAheadS, float fSetpoint)
+{
+    unsigned int uiTargetMs = (SCHEDULE_TEST_CLOCK_S + uiAheadS) * 1000U;
+    unsigned int uiAlarms, uiStart, uiNow, uiDueMs = 0, uiRunMs = 0, uiAlarmMs = 0;
+    unsigned char ucAlarmPath = (uiAheadS * 1000U > RTC_ALARM_STEP_MS);
+    char cCase[64];
+
+    snprintf(cCase, sizeof(cCase), "entry %u s ahead, RTC phase %u ms", uiAheadS, uiPhaseMs);
+    printf("  %s\n", cCase);
+
+    hostBoard_advanceMs(uiPhaseMs);
+    schedule_setClock(SCHEDULE_TEST_CLOCK_S);
+    pid_setTemperatureSetpoint(SCHEDULE_TEST_SETPOINT);
+    hostTest_expectInt(schedule_setEntry(0, SCHEDULE_TEST_CLOCK_S + uiAheadS, SCHEDULE_ACTION_SETPOINT, fSetpoint), 1, "entry set");
+
+    uiAlarms = rtcShim_getAlarms();
+    uiStart = hostBoard_getUptimeMs();
+    do {
+        hostBoard_advanceMs(1);
+        uiNow = hostBoard_getUptimeMs();
+        if(!uiDueMs && rtc_getTimeOfDayMs() >= uiTargetMs)
+            uiDueMs = uiNow;
+        if(!uiRunMs && fSetpoint == pid_getTemperatureSetpoint())
+            uiRunMs = uiNow;
+        if(!uiAlarmMs && uiAlarms != rtcShim_getAlarms())
+            uiAlarmMs = uiNow;
+    } while(uiNow - uiStart < uiAheadS * 1000U + 2U * HOSTBOARD_TICK_MS);
+
+    if(!hostTest_expect(0 != uiRunMs, "entry ran"))
+        return;
+    hostTest_expect(0 != uiDueMs && uiRunMs >= uiDueMs, "entry not run before its time");
+    hostTest_expect(uiRunMs - uiDueMs <= HOSTBOARD_TICK_MS, "entry run within one timer tick");
+    hostTest_expectInt(uiDueMs - uiStart, uiAheadS * 1000U, "time of day of the entry");
+
+    /* the RTC alarm only wakes up for the far entries, up to one RTC step early */
+    hostTest_expectInt(rtcShim_getAlarms() - uiAlarms, ucAlarmPath, "RTC alarms");
+    if(ucAlarmPath && hostTest_expect(0 != uiAlarmMs && uiAlarmMs <= uiDueMs, "RTC alarm before the entry"))
+        hostTest_expect(uiDueMs - uiAlarmMs <= RTC_ALARM_STEP_MS, "RTC alarm within one RTC step of the entry");
+
+    /* it ran once, the next occurrence is tomorrow */
+    pid_setTemperatureSetpoint(SCHEDULE_TEST_SETPOINT);
+    hostBoard_advanceMs(2U * RTC_ALARM_STEP_MS);
+    hostTest_expect(SCHEDULE_TEST_SETPOINT == pid_getTemperatureSetpoint(), "entry run once");
+
+    schedule_setEntry(0, 0, SCHEDULE_ACTION_NONE, 0.0f);
+}
+
+/* ************************************************** */
+/* Method name:        scheduleTest_uptime            */
+/* Method description: The RTC uptime follows the     */
+/*                     simulated time across TSR      */
+/*                     periods, the odd ones with the */
+/*                     prescaler at 32768..65535      */
+/* Input params:       n/a                            */
+/* Output params:      n/a                            */
+/* ************************************************** */
+static void scheduleTest_uptime(void)
+{
+    unsigned int uiStep, uiLast = rtc_getUptimeMs(), uiNow;
+    unsigned char ucMonotonic = 1;
+
+    for(uiStep = 0; uiStep < 4U * RTC_ALARM_STEP_MS; uiStep += 7U){
+        hostBoard_advanceMs(7);
+        uiNow = rtc_getUptimeMs();
+        if(uiNow - uiLast != 7U)
+            ucMonotonic = 0;
+        uiLast = uiNow;
+    }
+    hostTest_expect(ucMonotonic, "RTC uptime steps with the time, over 4 TSR periods");
+    hostTest_expectInt(rtc_getUptimeMs(), hostBoard_getUptimeMs(), "RTC uptime");
+}
+
+int main(void)
+{
+    static const unsigned int uiPhasesMs[] = {0, 1, 99, 12345, RTC_ALARM_STEP_MS - 1U, 20001};
+    unsigned int uiIndex;
+
+    hostBoard_init();
+    scheduleTest_uptime();
+
+    for(uiIndex = 0; uiIndex < sizeof(uiPhasesMs) / sizeof(uiPhasesMs[0]); uiIndex++){
+        scheduleTest_entry(uiPhasesMs[uiIndex], 5, 45.0f);
+        scheduleTest_entry(uiPhasesMs[uiIndex], 60, 60.0f);
+    }
+    return hostTest_report("schedule_test");
+}
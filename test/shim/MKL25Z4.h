@@ -0,0 +1,46 @@
+/* ***************************************************************** */
+/* File name:        MKL25Z4.h                                       */
+/* File description: Host replacement of the device header, found    */
+/*                   before the SDK one by the test Makefile. The    */
+/*                   interrupt masking is a no-op and the RTC        */
+/*                   registers are plain variables, moved by         */
+/*                   rtc_shim.c                                      */
+/* Author name:      Grupo 18 - Renato Pepe                          */
+/*                              Joao Victor Matoso                   */
+/* Creation date:    19oct2026                                       */
+/* Revision date:    19oct2026                                       */
+/* ***************************************************************** */
+
+#ifndef TEST_SHIM_MKL25Z4_H_
+#define TEST_SHIM_MKL25Z4_H_
+
+#include <stdint.h>
+
+/* the host runs the "interruptions" from the same thread */
+static inline uint32_t __get_PRIMASK(void) { return 0; }
+static inline void __set_PRIMASK(uint32_t uiPrimask) { (void)uiPrimask; }
+static inline void __disable_irq(void) {}
+static inline void __enable_irq(void) {}
+
+/* RTC, see rtc_shim.c */
+extern volatile uint32_t RTC_TSR;
+extern volatile uint32_t RTC_TPR;
+extern volatile uint32_t RTC_TAR;
+extern volatile uint32_t RTC_SR;
+extern volatile uint32_t RTC_IER;
+extern volatile uint32_t SIM_SCGC6;
+extern volatile uint32_t SIM_SOPT1;
+
+#define RTC_SR_TCE_MASK                 0x10u
+#define RTC_IER_TAIE_MASK               0x04u
+#define SIM_SCGC6_RTC_MASK              0x20000000u
+#define SIM_SOPT1_OSC32KSEL_MASK        0xC0000u
+#define SIM_SOPT1_OSC32KSEL(x)          (((uint32_t)(x) << 18) & SIM_SOPT1_OSC32KSEL_MASK)
+
+typedef enum IRQn {
+    RTC_IRQn = 20
+} IRQn_Type;
+
+static inline void NVIC_EnableIRQ(IRQn_Type eIrq) { (void)eIrq; }
+
+#endif /* TEST_SHIM_MKL25Z4_H_ */
@@ -0,0 +1,97 @@
+/* ***************************************************************** */
+/* File name:        board_stubs.c                                   */
+/* File description: Host stand-ins for the drivers that touch the   */
+/*                   hardware, see board_stubs.h                     */
+/* Author name:      Grupo 18 - Renato Pepe                          */
+/*                              Joao Victor Matoso                   */
+/* Creation date:    19oct2026                                       */
+/* Revision date:    19oct2026                                       */
+/* ***************************************************************** */
+
+#include <string.h>
+#include "board_stubs.h"
+#include "adc.h"
+#include "aquecedorECooler.h"
+#include "tacometro.h"
+#include "boot.h"
+#include "cyclecounter.h"
+#include "rtc.h"
+#include "nvm.h"
+#include "power.h"
+
+/* a 48MHz core, as on the board */
+#define BOARD_STUB_CYCLES_PER_US    48U
+
+float fBoardStubTemperature = 25.0f;
+unsigned int uiBoardStubDeciRpm = 0;
+float fBoardStubCooler = 0.0f;
+float fBoardStubHeater = 0.0f;
+unsigned char ucBoardStubPolicy = 0;
+unsigned char ucBoardStubNvm[NVM_MAX_RECORD];
+unsigned int uiBoardStubNvmSize = 0;
+
+/* globals of tacometro.c and main.c read by interfacelocal.c */
+unsigned int uiTachometerData = 0;
+unsigned int fFilteredTemperature = 25;
+
+void boardStub_setTemperature(float fTemperature)
+{
+    fBoardStubTemperature = fTemperature;
+    fFilteredTemperature = (unsigned int)fTemperature;
+}
+
+void boardStub_setSpeed(unsigned int uiDeciRpm)
+{
+    uiBoardStubDeciRpm = uiDeciRpm;
+    uiTachometerData = uiDeciRpm / 10;
+}
+
+/* adc.h */
+float adc_getTemperature(void) { return fBoardStubTemperature; }
+
+/* aquecedorECooler.h */
+void coolerfan_PWMDuty(float fCoolerDuty) { fBoardStubCooler = fCoolerDuty; }
+void heater_PWMDuty(float fHeaterDuty)    { fBoardStubHeater = fHeaterDuty; }
+float getDutyCycleCooler()                { return fBoardStubCooler; }
+float getDutyCycleHeater()                { return fBoardStubHeater; }
+
+/* tacometro.h */
+unsigned int tachometer_getSpeed()        { return uiBoardStubDeciRpm / 10; }
+unsigned int tachometer_getSpeedDeciRpm() { return uiBoardStubDeciRpm; }
+unsigned char tachometer_isStalled()      { return 0 == uiBoardStubDeciRpm; }
+
+/* boot.h */
+unsigned int boot_getControlUs(void) { return 0; }
+unsigned int boot_getDoneUs(void)    { return 0; }
+
+/* cyclecounter.h, the cycles follow the simulated RTC time */
+unsigned int cyclecounter_get(void)                         { return rtc_getUptimeMs() * 1000U * BOARD_STUB_CYCLES_PER_US; }
+unsigned int cyclecounter_usToCycles(unsigned int uiUs)     { return uiUs * BOARD_STUB_CYCLES_PER_US; }
+unsigned int cyclecounter_cyclesToUs(unsigned int uiCycles) { return uiCycles / BOARD_STUB_CYCLES_PER_US; }
+
+/* power.h */
+void power_setPolicy(unsigned char ucPolicy) { ucBoardStubPolicy = ucPolicy; }
+unsigned char power_getPolicy(void)          { return ucBoardStubPolicy; }
+
+void power_getStatistics(power_statistics_type *pStatistics)
+{
+    memset(pStatistics, 0, sizeof(*pStatistics));
+}
+
+/* nvm.h, the record is kept in RAM */
+unsigned char nvm_load(void *pvData, unsigned int uiSize)
+{
+    if(uiSize != uiBoardStubNvmSize)
+        return 0;
+    memcpy(pvData, ucBoardStubNvm, uiSize);
+    return 1;
+}
+
+unsigned char nvm_save(const void *pvData, unsigned int uiSize)
+{
+    if(NVM_MAX_RECORD < uiSize)
+        return 0;
+    memcpy(ucBoardStubNvm, pvData, uiSize);
+    uiBoardStubNvmSize = uiSize;
+    return 1;
+}
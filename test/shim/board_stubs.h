@@ -0,0 +1,33 @@
+/* ***************************************************************** */
+/* File name:        board_stubs.h                                   */
+/* File description: Host stand-ins for the drivers that touch the   */
+/*                   hardware (ADC, PWM, tachometer, flash, clocks). */
+/*                   The values the control code reads can be set by */
+/*                   the tests                                       */
+/* Author name:      Grupo 18 - Renato Pepe                          */
+/*                              Joao Victor Matoso                   */
+/* Creation date:    19oct2026                                       */
+/* Revision date:    19oct2026                                       */
+/* ***************************************************************** */
+
+#ifndef TEST_SHIM_BOARD_STUBS_H_
+#define TEST_SHIM_BOARD_STUBS_H_
+
+/* ************************************************** */
+/* Method name:        boardStub_setTemperature       */
+/* Method description: Value of adc_getTemperature    */
+/*                     and of the filtered one        */
+/* Input params:       fTemperature: in C             */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void boardStub_setTemperature(float fTemperature);
+
+/* ************************************************** */
+/* Method name:        boardStub_setSpeed             */
+/* Method description: Value of the tachometer        */
+/* Input params:       uiDeciRpm: speed in 0.1 RPM    */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void boardStub_setSpeed(unsigned int uiDeciRpm);
+
+#endif /* TEST_SHIM_BOARD_STUBS_H_ */
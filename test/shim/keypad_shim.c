@@ -0,0 +1,127 @@
+/* ***************************************************************** */
+/* File name:        keypad_shim.c                                   */
+/* File description: Host model of the McLab2 keyboard, see          */
+/*                   keypad_shim.h                                   */
+/* Author name:      Grupo 18 - Renato Pepe                          */
+/*                              Joao Victor Matoso                   */
+/* Creation date:    19oct2026                                       */
+/* Revision date:    19oct2026                                       */
+/* ***************************************************************** */
+
+#include "keypad_shim.h"
+#include "ledSwi.h"
+#include "keypad.h"
+
+/* setup of each pin, as initKeyboard stores it */
+keyboard kbKeypadShim[KEYPAD_KEYS];
+unsigned char ucKeypadShimPressed[KEYPAD_KEYS];
+
+keypad_event_type keypadShimQueue[KEYPAD_QUEUE_SIZE];
+unsigned char ucKeypadShimHead = 0;
+unsigned char ucKeypadShimTail = 0;
+
+/* ************************************************** */
+/* Method name:        keypadShim_queue               */
+/* Method description: Queue an event, dropped if the */
+/*                     queue is full as on the board  */
+/* Input params:       ucKey: 1 to KEYPAD_KEYS        */
+/*                     ucType: KEYPAD_EVENT_*         */
+/* Output params:      n/a                            */
+/* ************************************************** */
+static void keypadShim_queue(unsigned char ucKey, unsigned char ucType)
+{
+    unsigned char ucNext = (ucKeypadShimHead + 1) % KEYPAD_QUEUE_SIZE;
+
+    if(ucNext == ucKeypadShimTail)
+        return;
+    keypadShimQueue[ucKeypadShimHead].ucKey = ucKey;
+    keypadShimQueue[ucKeypadShimHead].ucType = ucType;
+    ucKeypadShimHead = ucNext;
+}
+
+/* ************************************************** */
+/* Method name:        keypadShim_reset               */
+/* Method description: Keyboard as main.c sets it up, */
+/*                     only button 4, no event queued */
+/* Input params:       n/a                            */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void keypadShim_reset(void)
+{
+    keyboard kbKeyboardOn[KEYPAD_KEYS] = {NOTSET, NOTSET, NOTSET, BUTTON};
+    unsigned char ucKey;
+
+    initKeyboard(kbKeyboardOn);
+    for(ucKey = 0; ucKey < KEYPAD_KEYS; ucKey++)
+        ucKeypadShimPressed[ucKey] = 0;
+    ucKeypadShimHead = 0;
+    ucKeypadShimTail = 0;
+}
+
+/* ************************************************** */
+/* Method name:        keypadShim_press               */
+/* Method description: A button goes down             */
+/* Input params:       ucKey: 1 to KEYPAD_KEYS        */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void keypadShim_press(unsigned char ucKey)
+{
+    ucKeypadShimPressed[ucKey - 1] = 1;
+    keypadShim_queue(ucKey, KEYPAD_EVENT_PRESS);
+}
+
+/* ************************************************** */
+/* Method name:        keypadShim_repeat              */
+/* Method description: A held button repeats          */
+/* Input params:       ucKey: 1 to KEYPAD_KEYS        */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void keypadShim_repeat(unsigned char ucKey)
+{
+    keypadShim_queue(ucKey, KEYPAD_EVENT_REPEAT);
+}
+
+/* ************************************************** */
+/* Method name:        keypadShim_release             */
+/* Method description: A button goes up               */
+/* Input params:       ucKey: 1 to KEYPAD_KEYS        */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void keypadShim_release(unsigned char ucKey)
+{
+    ucKeypadShimPressed[ucKey - 1] = 0;
+    keypadShim_queue(ucKey, KEYPAD_EVENT_RELEASE);
+}
+
+/* ledSwi.h */
+void initKeyboard(keyboard *kbModel)
+{
+    unsigned char ucKey;
+
+    for(ucKey = 0; ucKey < KEYPAD_KEYS; ucKey++)
+        kbKeypadShim[ucKey] = kbModel[ucKey];
+}
+
+int readButton(int iButtonNumber)
+{
+    if(1 > iButtonNumber || KEYPAD_KEYS < iButtonNumber || BUTTON != kbKeypadShim[iButtonNumber - 1])
+        return -1;
+    return ucKeypadShimPressed[iButtonNumber - 1];
+}
+
+/* keypad.h */
+void keypad_configure(void) {}
+
+unsigned char keypad_getEvent(keypad_event_type *pEvent)
+{
+    if(ucKeypadShimHead == ucKeypadShimTail)
+        return 0;
+    *pEvent = keypadShimQueue[ucKeypadShimTail];
+    ucKeypadShimTail = (ucKeypadShimTail + 1) % KEYPAD_QUEUE_SIZE;
+    return 1;
+}
+
+unsigned char keypad_isPressed(unsigned char ucKey)
+{
+    return ucKeypadShimPressed[ucKey - 1];
+}
@@ -0,0 +1,49 @@
+/* ***************************************************************** */
+/* File name:        keypad_shim.h                                   */
+/* File description: Host model of the McLab2 keyboard, so           */
+/*                   interfacelocal.c runs unchanged: the pins set   */
+/*                   up by initKeyboard and the event queue of       */
+/*                   keypad.c, filled by the tests                   */
+/* Author name:      Grupo 18 - Renato Pepe                          */
+/*                              Joao Victor Matoso                   */
+/* Creation date:    19oct2026                                       */
+/* Revision date:    19oct2026                                       */
+/* ***************************************************************** */
+
+#ifndef TEST_SHIM_KEYPAD_SHIM_H_
+#define TEST_SHIM_KEYPAD_SHIM_H_
+
+/* ************************************************** */
+/* Method name:        keypadShim_reset               */
+/* Method description: Keyboard as main.c sets it up, */
+/*                     only button 4, no event queued */
+/* Input params:       n/a                            */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void keypadShim_reset(void);
+
+/* ************************************************** */
+/* Method name:        keypadShim_press               */
+/* Method description: A button goes down             */
+/* Input params:       ucKey: 1 to KEYPAD_KEYS        */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void keypadShim_press(unsigned char ucKey);
+
+/* ************************************************** */
+/* Method name:        keypadShim_repeat              */
+/* Method description: A held button repeats          */
+/* Input params:       ucKey: 1 to KEYPAD_KEYS        */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void keypadShim_repeat(unsigned char ucKey);
+
+/* ************************************************** */
+/* Method name:        keypadShim_release             */
+/* Method description: A button goes up               */
+/* Input params:       ucKey: 1 to KEYPAD_KEYS        */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void keypadShim_release(unsigned char ucKey);
+
+#endif /* TEST_SHIM_KEYPAD_SHIM_H_ */
@@ -0,0 +1,68 @@
+/* ***************************************************************** */
+/* File name:        lcd_shim.c                                      */
+/* File description: Host model of the 2x16 LCD, see lcd_shim.h      */
+/* Author name:      Grupo 18 - Renato Pepe                          */
+/*                              Joao Victor Matoso                   */
+/* Creation date:    19oct2026                                       */
+/* Revision date:    19oct2026                                       */
+/* ***************************************************************** */
+
+#include "lcd_shim.h"
+#include "lcd.h"
+
+char cLcdShimText[LCD_SHIM_LINES][LCD_SHIM_COLUMNS + 1];
+unsigned int uiLcdShimWrites = 0;
+
+/* ************************************************** */
+/* Method name:        lcdShim_reset                  */
+/* Method description: Blank screen, no writes        */
+/* Input params:       n/a                            */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void lcdShim_reset(void)
+{
+    unsigned char ucLine, ucColumn;
+
+    for(ucLine = 0; ucLine < LCD_SHIM_LINES; ucLine++){
+        for(ucColumn = 0; ucColumn < LCD_SHIM_COLUMNS; ucColumn++)
+            cLcdShimText[ucLine][ucColumn] = ' ';
+        cLcdShimText[ucLine][LCD_SHIM_COLUMNS] = '\0';
+    }
+    uiLcdShimWrites = 0;
+}
+
+/* ************************************************** */
+/* Method name:        lcdShim_getLine                */
+/* Method description: Text on a line                 */
+/* Input params:       ucLine: 0 or 1                 */
+/* Output params:      LCD_SHIM_COLUMNS chars, zero   */
+/*                     terminated                     */
+/* ************************************************** */
+const char *lcdShim_getLine(unsigned char ucLine)
+{
+    return cLcdShimText[ucLine];
+}
+
+/* ************************************************** */
+/* Method name:        lcdShim_getWrites              */
+/* Method description: Calls of lcd_writeText since   */
+/*                     the reset                      */
+/* Input params:       n/a                            */
+/* Output params:      writes                         */
+/* ************************************************** */
+unsigned int lcdShim_getWrites(void)
+{
+    return uiLcdShimWrites;
+}
+
+/* lcd.h, the rest of the line is cleared as setGlobalString and lcdDma do */
+void lcd_writeText(unsigned char ucLine, char *cText)
+{
+    unsigned char ucColumn;
+
+    for(ucColumn = 0; ucColumn < LCD_SHIM_COLUMNS && cText[ucColumn]; ucColumn++)
+        cLcdShimText[ucLine][ucColumn] = cText[ucColumn];
+    for(; ucColumn < LCD_SHIM_COLUMNS; ucColumn++)
+        cLcdShimText[ucLine][ucColumn] = ' ';
+    uiLcdShimWrites++;
+}
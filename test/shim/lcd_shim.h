@@ -0,0 +1,44 @@
+/* ***************************************************************** */
+/* File name:        lcd_shim.h                                      */
+/* File description: Host model of the 2x16 LCD: what lcd_writeText  */
+/*                   leaves on each line, padded with spaces as on   */
+/*                   the board, and how many writes it took          */
+/* Author name:      Grupo 18 - Renato Pepe                          */
+/*                              Joao Victor Matoso                   */
+/* Creation date:    19oct2026                                       */
+/* Revision date:    19oct2026                                       */
+/* ***************************************************************** */
+
+#ifndef TEST_SHIM_LCD_SHIM_H_
+#define TEST_SHIM_LCD_SHIM_H_
+
+#define LCD_SHIM_LINES          2U
+#define LCD_SHIM_COLUMNS        16U
+
+/* ************************************************** */
+/* Method name:        lcdShim_reset                  */
+/* Method description: Blank screen, no writes        */
+/* Input params:       n/a                            */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void lcdShim_reset(void);
+
+/* ************************************************** */
+/* Method name:        lcdShim_getLine                */
+/* Method description: Text on a line                 */
+/* Input params:       ucLine: 0 or 1                 */
+/* Output params:      LCD_SHIM_COLUMNS chars, zero   */
+/*                     terminated                     */
+/* ************************************************** */
+const char *lcdShim_getLine(unsigned char ucLine);
+
+/* ************************************************** */
+/* Method name:        lcdShim_getWrites              */
+/* Method description: Calls of lcd_writeText since   */
+/*                     the reset                      */
+/* Input params:       n/a                            */
+/* Output params:      writes                         */
+/* ************************************************** */
+unsigned int lcdShim_getWrites(void);
+
+#endif /* TEST_SHIM_LCD_SHIM_H_ */
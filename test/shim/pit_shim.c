@@ -0,0 +1,79 @@
+/* ***************************************************************** */
+/* File name:        pit_shim.c                                      */
+/* File description: Host model of the PIT, see pit_shim.h           */
+/* Author name:      Grupo 18 - Renato Pepe                          */
+/*                              Joao Victor Matoso                   */
+/* Creation date:    19oct2026                                       */
+/* Revision date:    19oct2026                                       */
+/* ***************************************************************** */
+
+#include "pit.h"
+#include "pit_shim.h"
+
+typedef struct pit_shim_channel_type {
+    unsigned int uiPeriodUs;
+    unsigned int uiLeftUs;              // us to the callback while running
+    unsigned char ucRunning;
+    pit_callback_t fCallback;
+} pit_shim_channel_type;
+
+pit_shim_channel_type pitShimChannels[PIT_CHANNELS];
+
+/* ************************************************** */
+/* Method name:        pitShim_advanceUs              */
+/* Method description: Let the running channels count,*/
+/*                     calling the callbacks of the   */
+/*                     ones that reach zero           */
+/* Input params:       uiUs: microseconds             */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void pitShim_advanceUs(unsigned int uiUs)
+{
+    unsigned char ucChannel;
+
+    for(ucChannel = 0; ucChannel < PIT_CHANNELS; ucChannel++){
+        pit_shim_channel_type *pChannel = &pitShimChannels[ucChannel];
+        unsigned int uiLeft = uiUs;
+
+        /* a callback may stop or restart its channel */
+        while(pChannel->ucRunning && uiLeft >= pChannel->uiLeftUs){
+            uiLeft -= pChannel->uiLeftUs;
+            pChannel->uiLeftUs = pChannel->uiPeriodUs;
+            if(pChannel->fCallback)
+                pChannel->fCallback();
+            if(0 == pChannel->uiPeriodUs)
+                break;
+        }
+        if(pChannel->ucRunning)
+            pChannel->uiLeftUs -= uiLeft;
+    }
+}
+
+/* pit.h, without the hardware */
+
+void pit_setPeriod(unsigned char ucChannel, unsigned int uiPeriodUs, pit_callback_t fCallback)
+{
+    pitShimChannels[ucChannel].uiPeriodUs = uiPeriodUs;
+    pitShimChannels[ucChannel].fCallback = fCallback;
+    pitShimChannels[ucChannel].ucRunning = 0;
+}
+
+void pit_start(unsigned char ucChannel)
+{
+    pitShimChannels[ucChannel].uiLeftUs = pitShimChannels[ucChannel].uiPeriodUs;
+    pitShimChannels[ucChannel].ucRunning = 1;
+}
+
+void pit_stop(unsigned char ucChannel)
+{
+    pitShimChannels[ucChannel].ucRunning = 0;
+}
+
+unsigned char pit_isRunning(unsigned char ucChannel)
+{
+    return pitShimChannels[ucChannel].ucRunning;
+}
+
+void pit_updateClock(void) {}
+
+void PIT_IRQHandler(void) {}
@@ -0,0 +1,26 @@
+/* ***************************************************************** */
+/* File name:        pit_shim.h                                      */
+/* File description: Host model of the PIT, so modbus.c runs         */
+/*                   unchanged: each channel counts down its period  */
+/*                   in us of simulated time and calls its callback  */
+/*                   when it reaches zero                            */
+/* Author name:      Grupo 18 - Renato Pepe                          */
+/*                              Joao Victor Matoso                   */
+/* Creation date:    19oct2026                                       */
+/* Revision date:    19oct2026                                       */
+/* ***************************************************************** */
+
+#ifndef TEST_SHIM_PIT_SHIM_H_
+#define TEST_SHIM_PIT_SHIM_H_
+
+/* ************************************************** */
+/* Method name:        pitShim_advanceUs              */
+/* Method description: Let the running channels count,*/
+/*                     calling the callbacks of the   */
+/*                     ones that reach zero           */
+/* Input params:       uiUs: microseconds             */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void pitShim_advanceUs(unsigned int uiUs);
+
+#endif /* TEST_SHIM_PIT_SHIM_H_ */
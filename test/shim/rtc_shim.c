@@ -0,0 +1,66 @@
+/* ***************************************************************** */
+/* File name:        rtc_shim.c                                      */
+/* File description: Host model of the RTC registers used by rtc.c   */
+/* Author name:      Grupo 18 - Renato Pepe                          */
+/*                              Joao Victor Matoso                   */
+/* Creation date:    19oct2026                                       */
+/* Revision date:    19oct2026                                       */
+/* ***************************************************************** */
+
+#include "rtc_shim.h"
+#include "rtc.h"
+#include <MKL25Z4.h>
+
+volatile uint32_t RTC_TSR = 0;
+volatile uint32_t RTC_TPR = 0;
+volatile uint32_t RTC_TAR = 0;
+volatile uint32_t RTC_SR = 0;
+volatile uint32_t RTC_IER = 0;
+volatile uint32_t SIM_SCGC6 = 0;
+volatile uint32_t SIM_SOPT1 = 0;
+
+/* prescaler of the hardware, 16 bits */
+#define RTC_SHIM_TPR_MAX        0xFFFFU
+#define RTC_SHIM_TPR_BIT14      0x4000U
+
+unsigned int uiRtcShimAlarms = 0;
+
+/* ************************************************** */
+/* Method name:        rtcShim_advanceMs              */
+/* Method description: Let the RTC count, calling     */
+/*                     RTC_IRQHandler on the alarm    */
+/* Input params:       uiMs: milliseconds             */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void rtcShim_advanceMs(unsigned int uiMs)
+{
+    unsigned int uiPrescaler;
+
+    while(uiMs--){
+        if(!(RTC_SR & RTC_SR_TCE_MASK))
+            continue;
+        /* TPR is a 16 bit counter, TSR increments when its bit 14 falls:
+         * 32767 to 32768 and 65535 to 0 */
+        uiPrescaler = RTC_TPR;
+        RTC_TPR = (uiPrescaler + 1U) & RTC_SHIM_TPR_MAX;
+        if(!(uiPrescaler & RTC_SHIM_TPR_BIT14) || (RTC_TPR & RTC_SHIM_TPR_BIT14))
+            continue;
+
+        /* the alarm flag is set when TSR increments from TAR */
+        if(RTC_TSR++ == RTC_TAR && (RTC_IER & RTC_IER_TAIE_MASK)){
+            uiRtcShimAlarms++;
+            RTC_IRQHandler();
+        }
+    }
+}
+
+/* ************************************************** */
+/* Method name:        rtcShim_getAlarms              */
+/* Method description: Alarm interruptions so far     */
+/* Input params:       n/a                            */
+/* Output params:      count                          */
+/* ************************************************** */
+unsigned int rtcShim_getAlarms(void)
+{
+    return uiRtcShimAlarms;
+}
@@ -0,0 +1,34 @@
+/* ***************************************************************** */
+/* File name:        rtc_shim.h                                      */
+/* File description: Host model of the RTC counting the 1kHz LPO,    */
+/*                   so rtc.c runs unchanged: the 16 bit TPR counts  */
+/*                   the ms, TSR increments when TPR bit 14 falls    */
+/*                   (every 32768 ms) and the alarm interruption is  */
+/*                   called when TSR increments from TAR             */
+/* Author name:      Grupo 18 - Renato Pepe                          */
+/*                              Joao Victor Matoso                   */
+/* Creation date:    19oct2026                                       */
+/* Revision date:    19oct2026                                       */
+/* ***************************************************************** */
+
+#ifndef TEST_SHIM_RTC_SHIM_H_
+#define TEST_SHIM_RTC_SHIM_H_
+
+/* ************************************************** */
+/* Method name:        rtcShim_advanceMs              */
+/* Method description: Let the RTC count, calling     */
+/*                     RTC_IRQHandler on the alarm    */
+/* Input params:       uiMs: milliseconds             */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void rtcShim_advanceMs(unsigned int uiMs);
+
+/* ************************************************** */
+/* Method name:        rtcShim_getAlarms              */
+/* Method description: Alarm interruptions so far     */
+/* Input params:       n/a                            */
+/* Output params:      count                          */
+/* ************************************************** */
+unsigned int rtcShim_getAlarms(void);
+
+#endif /* TEST_SHIM_RTC_SHIM_H_ */
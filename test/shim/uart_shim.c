@@ -0,0 +1,177 @@
+/* ***************************************************************** */
+/* File name:        uart_shim.c                                     */
+/* File description: Host replacement of UART.c, see uart_shim.h     */
+/* Author name:      Grupo 18 - Renato Pepe                          */
+/*                              Joao Victor Matoso                   */
+/* Creation date:    19oct2026                                       */
+/* Revision date:    19oct2026                                       */
+/* ***************************************************************** */
+
+#include "uart_shim.h"
+#include "communicationStateMachine.h"
+
+unsigned char ucUartShimCapture[UART_SHIM_CAPTURE_SIZE];
+unsigned int uiUartShimTxBytes = 0;
+unsigned int uiUartShimResponses = 0;
+
+unsigned char ucUartShimRx[UART_SHIM_RX_SIZE];
+unsigned int uiUartShimRxHead = 0;
+unsigned int uiUartShimRxTail = 0;
+uart_receive_callback_t fUartShimCallback = 0;
+
+unsigned int uiUartShimBaudRate = 115200U;
+unsigned char ucUartShimShared = 0;
+unsigned char ucUartShimPendingShared = 0;
+unsigned char ucUartShimChangeShared = 0;
+
+/* ************************************************** */
+/* Method name:        uartShim_reset                 */
+/* Method description: Empty the capture buffer and   */
+/*                     clear the counters             */
+/* Input params:       n/a                            */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void uartShim_reset(void)
+{
+    uiUartShimTxBytes = 0;
+    uiUartShimResponses = 0;
+}
+
+/* ************************************************** */
+/* Method name:        uartShim_receive               */
+/* Method description: A byte arrived on the line:    */
+/*                     what the UART interruption     */
+/*                     does with it                   */
+/* Input params:       ucByte: received byte          */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void uartShim_receive(unsigned char ucByte)
+{
+    if(fUartShimCallback){
+        fUartShimCallback(ucByte);
+        return;
+    }
+    /* a full buffer drops the byte, as on the board */
+    if(UART_SHIM_RX_SIZE == uiUartShimRxHead - uiUartShimRxTail)
+        return;
+    ucUartShimRx[uiUartShimRxHead++ & (UART_SHIM_RX_SIZE - 1)] = ucByte;
+}
+
+/* ************************************************** */
+/* Method name:        uartShim_getCapture            */
+/* Method description: Bytes sent since the last reset*/
+/* Input params:       puiLength: where to store the  */
+/*                     number of bytes kept           */
+/* Output params:      capture buffer                 */
+/* ************************************************** */
+const unsigned char *uartShim_getCapture(unsigned int *puiLength)
+{
+    *puiLength = (UART_SHIM_CAPTURE_SIZE < uiUartShimTxBytes) ? UART_SHIM_CAPTURE_SIZE : uiUartShimTxBytes;
+    return ucUartShimCapture;
+}
+
+/* ************************************************** */
+/* Method name:        uartShim_getTxBytes            */
+/* Method description: Bytes sent since the last      */
+/*                     reset, kept or not             */
+/* Input params:       n/a                            */
+/* Output params:      count                          */
+/* ************************************************** */
+unsigned int uartShim_getTxBytes(void)
+{
+    return uiUartShimTxBytes;
+}
+
+/* ************************************************** */
+/* Method name:        uartShim_getResponses          */
+/* Method description: Responses (UART0_transmitEnd)  */
+/*                     since the last reset           */
+/* Input params:       n/a                            */
+/* Output params:      count                          */
+/* ************************************************** */
+unsigned int uartShim_getResponses(void)
+{
+    return uiUartShimResponses;
+}
+
+/* ************************************************** */
+/* Method name:        uartShim_isSharedBus           */
+/* Method description: Bus mode set by the firmware   */
+/* Input params:       n/a                            */
+/* Output params:      1 on a multi-drop bus          */
+/* ************************************************** */
+unsigned char uartShim_isSharedBus(void)
+{
+    return ucUartShimShared;
+}
+
+/* UART.h, without the hardware */
+
+void UART0_init(void) {}
+void UART0_enableIRQ(void) {}
+void UART0_flush(void) {}
+void UART0_transmitBegin(void) {}
+unsigned int UART0_getRxOverflows(void) { return 0; }
+unsigned char UART0_enterStopClock(void) { return 1; }
+unsigned char UART0_exitStopClock(void) { return 1; }
+unsigned char UART0_isOnStopClock(void) { return 0; }
+unsigned int UART0_getBaudRate(void) { return uiUartShimBaudRate; }
+int UART0_getBaudError(void) { return 0; }
+
+unsigned char UART0_hasReceived(void)
+{
+    return uiUartShimRxHead != uiUartShimRxTail;
+}
+
+unsigned char UART0_isIdle(void)
+{
+    return !UART0_hasReceived() && !ucUartShimChangeShared;
+}
+
+void UART0_processReceived(void)
+{
+    while(uiUartShimRxTail != uiUartShimRxHead)
+        processByteCommunication(ucUartShimRx[uiUartShimRxTail++ & (UART_SHIM_RX_SIZE - 1)]);
+
+    /* the response went out with the transceiver of the old mode */
+    if(ucUartShimChangeShared){
+        ucUartShimShared = ucUartShimPendingShared;
+        ucUartShimChangeShared = 0;
+    }
+}
+
+unsigned char UART0_requestBaudRate(unsigned int uiBaudRate)
+{
+    if(UART0_MIN_BAUD > uiBaudRate || UART0_MAX_BAUD < uiBaudRate)
+        return 0;
+    uiUartShimBaudRate = uiBaudRate;
+    return 1;
+}
+
+void UART0_setReceiveCallback(uart_receive_callback_t fCallback)
+{
+    fUartShimCallback = fCallback;
+}
+
+void UART0_setSharedBus(unsigned char ucShared)
+{
+    ucUartShimShared = ucShared;
+}
+
+void UART0_requestSharedBus(unsigned char ucShared)
+{
+    ucUartShimPendingShared = ucShared;
+    ucUartShimChangeShared = 1;
+}
+
+void UART0_transmitEnd(void)
+{
+    uiUartShimResponses++;
+}
+
+void UART0_putChar(unsigned char ucByte)
+{
+    if(UART_SHIM_CAPTURE_SIZE > uiUartShimTxBytes)
+        ucUartShimCapture[uiUartShimTxBytes] = ucByte;
+    uiUartShimTxBytes++;
+}
@@ -0,0 +1,80 @@
+/* ***************************************************************** */
+/* File name:        uart_shim.h                                     */
+/* File description: Host replacement of UART.c. The bytes sent are  */
+/*                   kept in a capture buffer and each response      */
+/*                   (UART0_transmitBegin/End) is counted; the bytes */
+/*                   given to uartShim_receive go to the receive     */
+/*                   callback or wait for UART0_processReceived,     */
+/*                   like on the board                               */
+/* Author name:      Grupo 18 - Renato Pepe                          */
+/*                              Joao Victor Matoso                   */
+/* Creation date:    19oct2026                                       */
+/* Revision date:    19oct2026                                       */
+/* ***************************************************************** */
+
+#ifndef TEST_SHIM_UART_SHIM_H_
+#define TEST_SHIM_UART_SHIM_H_
+
+#include "UART.h"
+
+/* bytes kept by the capture buffer, the rest is only counted */
+#define UART_SHIM_CAPTURE_SIZE  65536U
+
+/* received bytes waiting for UART0_processReceived, a power of 2 */
+#define UART_SHIM_RX_SIZE       4096U
+
+/* ************************************************** */
+/* Method name:        uartShim_reset                 */
+/* Method description: Empty the capture buffer and   */
+/*                     clear the counters             */
+/* Input params:       n/a                            */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void uartShim_reset(void);
+
+/* ************************************************** */
+/* Method name:        uartShim_receive               */
+/* Method description: A byte arrived on the line:    */
+/*                     what the UART interruption     */
+/*                     does with it                   */
+/* Input params:       ucByte: received byte          */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void uartShim_receive(unsigned char ucByte);
+
+/* ************************************************** */
+/* Method name:        uartShim_getCapture            */
+/* Method description: Bytes sent since the last reset*/
+/* Input params:       puiLength: where to store the  */
+/*                     number of bytes kept           */
+/* Output params:      capture buffer                 */
+/* ************************************************** */
+const unsigned char *uartShim_getCapture(unsigned int *puiLength);
+
+/* ************************************************** */
+/* Method name:        uartShim_getTxBytes            */
+/* Method description: Bytes sent since the last      */
+/*                     reset, kept or not             */
+/* Input params:       n/a                            */
+/* Output params:      count                          */
+/* ************************************************** */
+unsigned int uartShim_getTxBytes(void);
+
+/* ************************************************** */
+/* Method name:        uartShim_getResponses          */
+/* Method description: Responses (UART0_transmitEnd)  */
+/*                     since the last reset           */
+/* Input params:       n/a                            */
+/* Output params:      count                          */
+/* ************************************************** */
+unsigned int uartShim_getResponses(void);
+
+/* ************************************************** */
+/* Method name:        uartShim_isSharedBus           */
+/* Method description: Bus mode set by the firmware   */
+/* Input params:       n/a                            */
+/* Output params:      1 on a multi-drop bus          */
+/* ************************************************** */
+unsigned char uartShim_isSharedBus(void);
+
+#endif /* TEST_SHIM_UART_SHIM_H_ */
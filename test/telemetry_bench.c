@@ -0,0 +1,332 @@
+/* ***************************************************************** */
+/* File name:        telemetry_bench.c                               */
+/* File description: Compression of the telemetry stream: a trace is */
+/*                   sent by telemetry.c in the raw and delta modes, */
+/*                   through the UART shim, and read back with the   */
+/*                   host decoder. Reports the bytes per sample on   */
+/*                   the line and in the payload, the ratio of       */
+/*                   telemetry_getStatistics and the cost of each    */
+/*                   channel. The trace is a heating run of the PID  */
+/*                   on a plant model, or a CSV as telemetry_decode  */
+/*                   prints it. --check fails if the two modes do    */
+/*                   not give back the same samples                  */
+/*                   Usage: telemetry_bench [trace.csv] [--check]    */
+/* Author name:      Grupo 18 - Renato Pepe                          */
+/*                              Joao Victor Matoso                   */
+/* Creation date:    19oct2026                                       */
+/* Revision date:    19oct2026                                       */
+/* ***************************************************************** */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "telemetry.h"
+#include "pid.h"
+#include "filter.h"
+#include "aquecedorECooler.h"
+#include "uart_shim.h"
+#include "board_stubs.h"
+#include "hostboard.h"
+#include "binframe.h"
+#include "telemetry_host.h"
+
+/* 30 minutes of the 100 ms control loop */
+#define TELEMETRY_BENCH_SAMPLES     18000U
+#define TELEMETRY_BENCH_RATE_HZ     10U
+
+#define TELEMETRY_BENCH_BAUD        115200U
+
+/* plant model: ambient, heater gain at full duty, time constant */
+#define TELEMETRY_BENCH_AMBIENT     25.0f
+#define TELEMETRY_BENCH_HEATER_GAIN 60.0f
+#define TELEMETRY_BENCH_TAU_S       120.0f
+
+/* step of the 8 bit ADC table near 40 C and the sensor noise */
+#define TELEMETRY_BENCH_ADC_STEP    0.4f
+#define TELEMETRY_BENCH_NOISE       0.3f
+
+/* a trace row in the units of the CSV: C, C, duty, duty, RPM */
+typedef struct telemetry_bench_row_type {
+    float fValue[TELEMETRY_CHANNELS];
+} telemetry_bench_row_type;
+
+typedef struct telemetry_bench_result_type {
+    telemetry_host_sample_type *pSamples;   // decoded
+    unsigned int uiSamples;
+    unsigned int uiFrames;
+    unsigned int uiLineBytes;
+    unsigned int uiPayloadBytes;
+    unsigned int uiNotDecoded;              // missing, skipped or bad frames
+    /* telemetry_getStatistics over the run */
+    unsigned int uiStatSamples;
+    unsigned int uiStatBytes;
+    unsigned int uiStatRawBytes;
+    unsigned int uiStatDropped;
+} telemetry_bench_result_type;
+
+unsigned int uiTelemetryBenchRandom = 0x9E3779B9U;
+
+/* ************************************************** */
+/* Method name:        telemetryBench_noise           */
+/* Method description: Uniform noise, xorshift32      */
+/* Input params:       fAmplitude: values in          */
+/*                     -fAmplitude..fAmplitude        */
+/* Output params:      noise                          */
+/* ************************************************** */
+static float telemetryBench_noise(float fAmplitude)
+{
+    uiTelemetryBenchRandom ^= uiTelemetryBenchRandom << 13;
+    uiTelemetryBenchRandom ^= uiTelemetryBenchRandom >> 17;
+    uiTelemetryBenchRandom ^= uiTelemetryBenchRandom << 5;
+    return fAmplitude * ((float)(uiTelemetryBenchRandom >> 8) / 8388608.0f - 1.0f);
+}
+
+/* ************************************************** */
+/* Method name:        telemetryBench_synthetic       */
+/* Method description: Heating run: the firmware PID  */
+/*                     and filter on a first order    */
+/*                     plant, setpoint steps 40, 60,  */
+/*                     35 C, fan at half duty         */
+/* Input params:       pRows: TELEMETRY_BENCH_SAMPLES */
+/*                     rows                           */
+/* Output params:      n/a                            */
+/* ************************************************** */
+static void telemetryBench_synthetic(telemetry_bench_row_type *pRows)
+{
+    float fPlant = TELEMETRY_BENCH_AMBIENT, fSetpoint = 0.0f, fHeater = 0.0f;
+    unsigned int uiIndex;
+
+    filter_init(TELEMETRY_BENCH_AMBIENT);
+    pid_turnOnOff(1);
+    for(uiIndex = 0; uiIndex < TELEMETRY_BENCH_SAMPLES; uiIndex++){
+        float fNewSetpoint = (uiIndex < TELEMETRY_BENCH_SAMPLES / 3U) ? 40.0f : (uiIndex < 2U * TELEMETRY_BENCH_SAMPLES / 3U) ? 60.0f : 35.0f;
+        float fSensor, fFiltered;
+
+        /* pid_setTemperatureSetpoint clears the integral, only on a step */
+        if(fNewSetpoint != fSetpoint){
+            fSetpoint = fNewSetpoint;
+            pid_setTemperatureSetpoint(fSetpoint);
+        }
+
+        fSensor = fPlant + telemetryBench_noise(TELEMETRY_BENCH_NOISE);
+        fSensor = TELEMETRY_BENCH_ADC_STEP * (float)(int)(fSensor / TELEMETRY_BENCH_ADC_STEP);
+        fFiltered = filter_dema(fSensor);
+        fHeater = pidUpdateData(fFiltered) / 100.0f;
+
+        pRows[uiIndex].fValue[0] = fFiltered;
+        pRows[uiIndex].fValue[1] = fSetpoint;
+        pRows[uiIndex].fValue[2] = fHeater;
+        pRows[uiIndex].fValue[3] = 0.5f;
+        pRows[uiIndex].fValue[4] = 3000.0f + telemetryBench_noise(5.0f);
+
+        fPlant += (TELEMETRY_BENCH_AMBIENT + TELEMETRY_BENCH_HEATER_GAIN * fHeater - fPlant) / (TELEMETRY_BENCH_TAU_S * TELEMETRY_BENCH_RATE_HZ);
+    }
+    pid_turnOnOff(0);
+}
+
+/* ************************************************** */
+/* Method name:        telemetryBench_load            */
+/* Method description: Read a CSV trace, the lines    */
+/*                     that are not 5 numbers are     */
+/*                     skipped                        */
+/* Input params:       cPath: file                    */
+/*                     puiRows: rows read             */
+/* Output params:      rows, 0 if it cannot be read   */
+/* ************************************************** */
+static telemetry_bench_row_type *telemetryBench_load(const char *cPath, unsigned int *puiRows)
+{
+    telemetry_bench_row_type *pRows = 0, row;
+    unsigned int uiSize = 0;
+    char cLine[256];
+    FILE *pInput = fopen(cPath, "r");
+
+    *puiRows = 0;
+    if(!pInput){
+        perror(cPath);
+        return 0;
+    }
+    while(fgets(cLine, sizeof(cLine), pInput)){
+        if(TELEMETRY_CHANNELS != sscanf(cLine, "%f,%f,%f,%f,%f", &row.fValue[0], &row.fValue[1],
+                                        &row.fValue[2], &row.fValue[3], &row.fValue[4]))
+            continue;
+        if(*puiRows == uiSize){
+            uiSize = uiSize ? 2U * uiSize : 1024U;
+            pRows = realloc(pRows, uiSize * sizeof(*pRows));
+            if(!pRows)
+                break;
+        }
+        pRows[(*puiRows)++] = row;
+    }
+    fclose(pInput);
+    return pRows;
+}
+
+/* ************************************************** */
+/* Method name:        telemetryBench_run             */
+/* Method description: Send a trace in a mode and     */
+/*                     decode the line                */
+/* Input params:       ucMode: RAW or DELTA           */
+/*                     pRows, uiRows: trace           */
+/*                     pResult: counts and samples,   */
+/*                     pSamples with room for uiRows  */
+/* Output params:      n/a                            */
+/* ************************************************** */
+static void telemetryBench_run(unsigned char ucMode, const telemetry_bench_row_type *pRows, unsigned int uiRows,
+                               telemetry_bench_result_type *pResult)
+{
+    unsigned int uiSamples, uiBytes, uiRawBytes, uiDropped, uiIndex;
+    binframe_parser_type parser;
+    telemetry_host_type decoder;
+    telemetry_host_sample_type *pSamples = pResult->pSamples;
+
+    memset(pResult, 0, sizeof(*pResult));
+    pResult->pSamples = pSamples;
+    binframe_init(&parser);
+    telemetryHost_init(&decoder);
+    telemetry_setMode(ucMode);
+    uartShim_reset();
+    telemetry_getStatistics(&uiSamples, &uiBytes, &uiRawBytes, &uiDropped);
+
+    for(uiIndex = 0; uiIndex < uiRows; uiIndex++){
+        const float *pfValue = pRows[uiIndex].fValue;
+        const unsigned char *pucTx;
+        unsigned int uiLength, uiByte;
+
+        /* what the control loop reads, then the main loop */
+        pid_setTemperatureSetpoint(pfValue[1]);
+        heater_PWMDuty(pfValue[2]);
+        coolerfan_PWMDuty(pfValue[3]);
+        boardStub_setSpeed((unsigned int)(pfValue[4] * 10.0f + 0.5f));
+        telemetry_sample(pfValue[0]);
+        telemetry_update();
+
+        pucTx = uartShim_getCapture(&uiLength);
+        for(uiByte = 0; uiByte < uiLength; uiByte++){
+            if(!binframe_parse(&parser, pucTx[uiByte]))
+                continue;
+            pResult->uiLineBytes += BINFRAME_OVERHEAD + parser.ucLength;
+            pResult->uiSamples += telemetryHost_decodeFrame(&decoder, &parser, &pSamples[pResult->uiSamples]);
+        }
+        uartShim_reset();
+    }
+
+    pResult->uiFrames = decoder.uiFrames;
+    pResult->uiPayloadBytes = decoder.uiBytes;
+    pResult->uiNotDecoded = decoder.uiMissingFrames + decoder.uiSkippedFrames + decoder.uiBadFrames + parser.uiErrors;
+    pResult->uiStatSamples = uiSamples;
+    pResult->uiStatBytes = uiBytes;
+    pResult->uiStatRawBytes = uiRawBytes;
+    pResult->uiStatDropped = uiDropped;
+    telemetry_getStatistics(&uiSamples, &uiBytes, &uiRawBytes, &uiDropped);
+    pResult->uiStatSamples = uiSamples - pResult->uiStatSamples;
+    pResult->uiStatBytes = uiBytes - pResult->uiStatBytes;
+    pResult->uiStatRawBytes = uiRawBytes - pResult->uiStatRawBytes;
+    pResult->uiStatDropped = uiDropped - pResult->uiStatDropped;
+    telemetry_setMode(TELEMETRY_MODE_OFF);
+}
+
+/* ************************************************** */
+/* Method name:        telemetryBench_varintSize      */
+/* Method description: Bytes of a zig-zag varint      */
+/* Input params:       iValue: value                  */
+/* Output params:      1 to 5                         */
+/* ************************************************** */
+static unsigned int telemetryBench_varintSize(int iValue)
+{
+    unsigned int uiValue = ((unsigned int)iValue << 1) ^ (unsigned int)(iValue >> 31), uiSize = 1;
+
+    while(0x80U <= uiValue){
+        uiValue >>= 7;
+        uiSize++;
+    }
+    return uiSize;
+}
+
+/* ************************************************** */
+/* Method name:        telemetryBench_print           */
+/* Method description: One line of the mode table     */
+/* Input params:       cMode: name                    */
+/*                     pResult: run                   */
+/* Output params:      n/a                            */
+/* ************************************************** */
+static void telemetryBench_print(const char *cMode, const telemetry_bench_result_type *pResult)
+{
+    double dSamples = pResult->uiSamples ? (double)pResult->uiSamples : 1.0;
+    double dLine = pResult->uiLineBytes / dSamples;
+
+    printf("  %-6s %7u %7u %9.2f %10.2f %10.2f %9.1f %%\n", cMode, pResult->uiSamples, pResult->uiFrames,
+           pResult->uiSamples / (pResult->uiFrames ? (double)pResult->uiFrames : 1.0), pResult->uiPayloadBytes / dSamples,
+           dLine, 100.0 * dLine * 10.0 * TELEMETRY_BENCH_RATE_HZ / TELEMETRY_BENCH_BAUD);
+}
+
+int main(int argc, char **argv)
+{
+    const char *cTrace = 0;
+    unsigned char ucCheck = 0;
+    telemetry_bench_row_type *pRows;
+    telemetry_bench_result_type raw, delta;
+    unsigned int uiRows = TELEMETRY_BENCH_SAMPLES, uiIndex, uiChannel, uiSent, uiDifferent = 0;
+    unsigned int uiChannelBytes[TELEMETRY_CHANNELS] = {0};
+    double dDeltas;
+    int iArg;
+
+    for(iArg = 1; iArg < argc; iArg++){
+        if(!strcmp(argv[iArg], "--check"))
+            ucCheck = 1;
+        else
+            cTrace = argv[iArg];
+    }
+
+    hostBoard_init();
+    if(cTrace)
+        pRows = telemetryBench_load(cTrace, &uiRows);
+    else if((pRows = malloc(uiRows * sizeof(*pRows))))
+        telemetryBench_synthetic(pRows);
+    raw.pSamples = malloc((uiRows + 1U) * sizeof(*raw.pSamples));
+    delta.pSamples = malloc((uiRows + 1U) * sizeof(*delta.pSamples));
+    if(!pRows || !uiRows || !raw.pSamples || !delta.pSamples){
+        fprintf(stderr, "no trace\n");
+        return 1;
+    }
+
+    telemetryBench_run(TELEMETRY_MODE_RAW, pRows, uiRows, &raw);
+    telemetryBench_run(TELEMETRY_MODE_DELTA, pRows, uiRows, &delta);
+
+    /* the two modes carry the same integers, up to the samples still on the board */
+    uiSent = (raw.uiSamples < delta.uiSamples) ? raw.uiSamples : delta.uiSamples;
+    for(uiIndex = 0; uiIndex < uiSent; uiIndex++)
+        if(memcmp(&raw.pSamples[uiIndex], &delta.pSamples[uiIndex], sizeof(delta.pSamples[0])))
+            uiDifferent++;
+
+    /* varint bytes of each channel in the delta frames, keyframes as the board sends them */
+    for(uiIndex = 1; uiIndex < delta.uiSamples; uiIndex++)
+        for(uiChannel = 0; uiChannel < TELEMETRY_CHANNELS; uiChannel++)
+            uiChannelBytes[uiChannel] += telemetryBench_varintSize(delta.pSamples[uiIndex].iValue[uiChannel] -
+                                                                   delta.pSamples[uiIndex - 1U].iValue[uiChannel]);
+
+    printf("%s: %u samples, %.1f min at %u Hz, %u bps\n", cTrace ? cTrace : "plant model heating to 40, 60, 35 C",
+           uiRows, uiRows / (60.0 * TELEMETRY_BENCH_RATE_HZ), TELEMETRY_BENCH_RATE_HZ, TELEMETRY_BENCH_BAUD);
+    printf("  %-6s %7s %7s %9s %10s %10s %11s\n", "mode", "samples", "frames", "per frame", "payload B", "line B", "line load");
+    telemetryBench_print("raw", &raw);
+    telemetryBench_print("delta", &delta);
+    printf("  ratio raw/delta: %.2f on the line, %.2f in the payload, %.2f by telemetry_getStatistics\n",
+           (double)raw.uiLineBytes / delta.uiLineBytes, (double)raw.uiPayloadBytes / delta.uiPayloadBytes,
+           (double)delta.uiStatRawBytes / delta.uiStatBytes);
+    dDeltas = (1U < delta.uiSamples) ? (double)(delta.uiSamples - 1U) : 1.0;
+    printf("  delta bytes per sample by channel: temperature %.2f, setpoint %.2f, heater %.2f, cooler %.2f, speed %.2f\n",
+           uiChannelBytes[0] / dDeltas, uiChannelBytes[1] / dDeltas, uiChannelBytes[2] / dDeltas,
+           uiChannelBytes[3] / dDeltas, uiChannelBytes[4] / dDeltas);
+    printf("  %u of %u samples differ between the modes, %u frames not decoded, %u samples dropped\n",
+           uiDifferent, uiSent, raw.uiNotDecoded + delta.uiNotDecoded, raw.uiStatDropped + delta.uiStatDropped);
+
+    if(ucCheck){
+        unsigned char ucFailed = uiDifferent || raw.uiNotDecoded || delta.uiNotDecoded || raw.uiStatDropped || delta.uiStatDropped
+                              || uiRows - raw.uiSamples >= TELEMETRY_FRAME_SAMPLES || uiRows - delta.uiSamples >= TELEMETRY_FRAME_SAMPLES
+                              || delta.uiStatSamples != delta.uiSamples
+                              || delta.uiStatBytes != delta.uiPayloadBytes || delta.uiLineBytes >= raw.uiLineBytes;
+
+        printf("telemetry_bench: %s\n", ucFailed ? "FAILED" : "OK");
+        return ucFailed;
+    }
+    return 0;
+}
@@ -0,0 +1,70 @@
+/* ***************************************************************** */
+/* File name:        telemetry_decode.c                              */
+/* File description: Print the telemetry sent by the board (#sj1; or */
+/*                   #sj2;) from a capture of the serial line as CSV,*/
+/*                   e.g.                                            */
+/*                     telemetry_decode capture.bin > trace.csv      */
+/*                     telemetry_decode < /dev/ttyACM0               */
+/*                   The columns are the ones telemetry_bench reads. */
+/*                   The ASCII lines and other frames in the capture */
+/*                   are skipped                                     */
+/* Author name:      Grupo 18 - Renato Pepe                          */
+/*                              Joao Victor Matoso                   */
+/* Creation date:    19oct2026                                       */
+/* Revision date:    19oct2026                                       */
+/* ***************************************************************** */
+
+#include <stdio.h>
+#include "binframe.h"
+#include "telemetry_host.h"
+
+int main(int argc, char **argv)
+{
+    FILE *pInput = stdin;
+    binframe_parser_type parser;
+    telemetry_host_type decoder;
+    unsigned int uiWire = 0;
+    int iByte;
+
+    if(1 < argc && !(pInput = fopen(argv[1], "rb"))){
+        perror(argv[1]);
+        return 1;
+    }
+
+    binframe_init(&parser);
+    telemetryHost_init(&decoder);
+    printf("temperature,setpoint,heater,cooler,rpm\n");
+    while(EOF != (iByte = fgetc(pInput))){
+        telemetry_host_sample_type samples[TELEMETRY_HOST_MAX_SAMPLES];
+        unsigned int uiMissing = decoder.uiMissingFrames, uiSkipped = decoder.uiSkippedFrames;
+        unsigned char ucCount, ucIndex;
+
+        if(!binframe_parse(&parser, (unsigned char)iByte) || BINPROTO_CMD_TELEMETRY != parser.ucCmd)
+            continue;
+        uiWire += BINFRAME_OVERHEAD + parser.ucLength;
+        ucCount = telemetryHost_decodeFrame(&decoder, &parser, samples);
+
+        /* comment lines, the CSV stays readable by telemetry_bench */
+        if(uiMissing != decoder.uiMissingFrames)
+            printf("# %u telemetry frames missing\n", decoder.uiMissingFrames - uiMissing);
+        if(uiSkipped != decoder.uiSkippedFrames)
+            printf("# frame skipped, waiting for a keyframe\n");
+        for(ucIndex = 0; ucIndex < ucCount; ucIndex++){
+            const int *piValue = samples[ucIndex].iValue;
+
+            printf("%.2f,%.2f,%.3f,%.3f,%.1f\n", piValue[0] / 100.0, piValue[1] / 100.0,
+                   piValue[2] / 1000.0, piValue[3] / 1000.0, piValue[4] / 10.0);
+        }
+        fflush(stdout);
+    }
+
+    fprintf(stderr, "%u frames (%u keyframes), %u samples, %u frames missing, %u skipped, %u bad frames, %u CRC errors\n",
+            decoder.uiFrames, decoder.uiKeyframes, decoder.uiSamples, decoder.uiMissingFrames,
+            decoder.uiSkippedFrames, decoder.uiBadFrames, parser.uiErrors);
+    if(decoder.uiSamples)
+        fprintf(stderr, "%.2f payload bytes, %.2f line bytes per sample\n",
+                (double)decoder.uiBytes / decoder.uiSamples, (double)uiWire / decoder.uiSamples);
+    if(stdin != pInput)
+        fclose(pInput);
+    return 0;
+}
@@ -0,0 +1,137 @@
+/* ***************************************************************** */
+/* File name:        telemetry_host.c                                */
+/* File description: Host decoder of the telemetry frames            */
+/* Author name:      Grupo 18 - Renato Pepe                          */
+/*                              Joao Victor Matoso                   */
+/* Creation date:    19oct2026                                       */
+/* Revision date:    19oct2026                                       */
+/* ***************************************************************** */
+
+#include <string.h>
+#include "telemetry_host.h"
+
+/* longest varint of a 32 bit value */
+#define TELEMETRY_HOST_VARINT_MAX   5U
+
+/* ************************************************** */
+/* Method name:        telemetryHost_getVarint        */
+/* Method description: Read a zig-zag varint          */
+/* Input params:       pucData: payload               */
+/*                     pucIndex: next byte, moved     */
+/*                     past the varint                */
+/*                     ucLength: payload length       */
+/*                     piValue: value read            */
+/* Output params:      1 if read, 0 if it runs past   */
+/*                     the payload or is too long     */
+/* ************************************************** */
+static unsigned char telemetryHost_getVarint(const unsigned char *pucData, unsigned char *pucIndex,
+                                             unsigned char ucLength, int *piValue)
+{
+    unsigned int uiValue = 0;
+    unsigned char ucShift = 0, ucByte;
+
+    do {
+        if(*pucIndex >= ucLength || 7U * TELEMETRY_HOST_VARINT_MAX <= ucShift)
+            return 0;
+        ucByte = pucData[(*pucIndex)++];
+        uiValue |= (unsigned int)(ucByte & 0x7FU) << ucShift;
+        ucShift += 7U;
+    } while(ucByte & 0x80U);
+
+    *piValue = (int)((uiValue >> 1) ^ (0U - (uiValue & 1U)));
+    return 1;
+}
+
+/* ************************************************** */
+/* Method name:        telemetryHost_init             */
+/* Method description: Clear the decoder state, the   */
+/*                     first frame read must be a     */
+/*                     keyframe or a raw frame        */
+/* Input params:       pTelemetry: decoder            */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void telemetryHost_init(telemetry_host_type *pTelemetry)
+{
+    memset(pTelemetry, 0, sizeof(*pTelemetry));
+}
+
+/* ************************************************** */
+/* Method name:        telemetryHost_decodeFrame      */
+/* Method description: Read the samples of a telemetry*/
+/*                     frame                          */
+/* Input params:       pTelemetry: decoder            */
+/*                     pFrame: frame found by         */
+/*                     binframe_parse                 */
+/*                     pSamples: room for             */
+/*                     TELEMETRY_HOST_MAX_SAMPLES     */
+/* Output params:      samples read, 0 also for a     */
+/*                     frame that is not a telemetry  */
+/*                     frame or cannot be read        */
+/* ************************************************** */
+unsigned char telemetryHost_decodeFrame(telemetry_host_type *pTelemetry, const binframe_parser_type *pFrame,
+                                        telemetry_host_sample_type *pSamples)
+{
+    telemetry_host_sample_type last = pTelemetry->last;
+    unsigned char ucFlags, ucCount, ucSample, ucChannel, ucIndex = 2;
+
+    if(BINPROTO_CMD_TELEMETRY != pFrame->ucCmd)
+        return 0;
+
+    /* SEQ counts the telemetry frames, after a jump the deltas have no base */
+    if(pTelemetry->ucStarted && pFrame->ucSeq != pTelemetry->ucNextSeq){
+        pTelemetry->uiMissingFrames += (unsigned char)(pFrame->ucSeq - pTelemetry->ucNextSeq);
+        pTelemetry->ucSynced = 0;
+    }
+    pTelemetry->ucStarted = 1;
+    pTelemetry->ucNextSeq = pFrame->ucSeq + 1U;
+
+    if(2U > pFrame->ucLength || TELEMETRY_HOST_MAX_SAMPLES < pFrame->ucPayload[1]){
+        pTelemetry->uiBadFrames++;
+        pTelemetry->ucSynced = 0;
+        return 0;
+    }
+    ucFlags = pFrame->ucPayload[0];
+    ucCount = pFrame->ucPayload[1];
+
+    if(!(ucFlags & (TELEMETRY_FLAG_RAW | TELEMETRY_FLAG_KEYFRAME)) && !pTelemetry->ucSynced){
+        pTelemetry->uiSkippedFrames++;
+        return 0;
+    }
+
+    for(ucSample = 0; ucSample < ucCount; ucSample++){
+        for(ucChannel = 0; ucChannel < TELEMETRY_CHANNELS; ucChannel++){
+            int iValue;
+
+            if(ucFlags & TELEMETRY_FLAG_RAW){
+                if(pFrame->ucLength - ucIndex < 4U)
+                    break;
+                iValue = (int)binframe_getUnsigned(&pFrame->ucPayload[ucIndex], 4);
+                ucIndex += 4U;
+            }
+            else if(!telemetryHost_getVarint(pFrame->ucPayload, &ucIndex, pFrame->ucLength, &iValue))
+                break;
+            /* the first sample of a keyframe is absolute */
+            else if(ucSample || !(ucFlags & TELEMETRY_FLAG_KEYFRAME))
+                iValue = (int)((unsigned int)last.iValue[ucChannel] + (unsigned int)iValue);
+            last.iValue[ucChannel] = iValue;
+            pSamples[ucSample].iValue[ucChannel] = iValue;
+        }
+        if(TELEMETRY_CHANNELS != ucChannel)
+            break;
+    }
+
+    if(ucSample != ucCount || ucIndex != pFrame->ucLength){
+        pTelemetry->uiBadFrames++;
+        pTelemetry->ucSynced = 0;
+        return 0;
+    }
+
+    pTelemetry->last = last;
+    pTelemetry->ucSynced = 1;
+    pTelemetry->uiFrames++;
+    if(ucFlags & TELEMETRY_FLAG_KEYFRAME)
+        pTelemetry->uiKeyframes++;
+    pTelemetry->uiSamples += ucCount;
+    pTelemetry->uiBytes += pFrame->ucLength;
+    return ucCount;
+}
@@ -0,0 +1,68 @@
+/* ***************************************************************** */
+/* File name:        telemetry_host.h                                */
+/* File description: Host decoder of the telemetry frames (CMD       */
+/*                   BINPROTO_CMD_TELEMETRY, see telemetry.h): the   */
+/*                   samples back as the integers the board scaled,  */
+/*                   the frames missing from the SEQ count and the   */
+/*                   delta frames skipped until the next keyframe    */
+/* Author name:      Grupo 18 - Renato Pepe                          */
+/*                              Joao Victor Matoso                   */
+/* Creation date:    19oct2026                                       */
+/* Revision date:    19oct2026                                       */
+/* ***************************************************************** */
+
+#ifndef TEST_TELEMETRY_HOST_H_
+#define TEST_TELEMETRY_HOST_H_
+
+#include "binframe.h"
+#include "telemetry.h"
+
+/* most samples in one frame, see TELEMETRY_MAX_FRAME_SAMPLES */
+#define TELEMETRY_HOST_MAX_SAMPLES  16U
+
+typedef struct telemetry_host_sample_type {
+    int iValue[TELEMETRY_CHANNELS];
+} telemetry_host_sample_type;
+
+typedef struct telemetry_host_type {
+    unsigned char ucStarted;
+    unsigned char ucSynced;             // the last sample is known, deltas can be read
+    unsigned char ucNextSeq;
+    telemetry_host_sample_type last;
+    /* totals */
+    unsigned int uiFrames;
+    unsigned int uiKeyframes;
+    unsigned int uiSamples;
+    unsigned int uiBytes;               // payload bytes of the frames read
+    unsigned int uiMissingFrames;       // SEQ gaps
+    unsigned int uiSkippedFrames;       // delta frames without a base
+    unsigned int uiBadFrames;           // COUNT and payload do not agree
+} telemetry_host_type;
+
+/* ************************************************** */
+/* Method name:        telemetryHost_init             */
+/* Method description: Clear the decoder state, the   */
+/*                     first frame read must be a     */
+/*                     keyframe or a raw frame        */
+/* Input params:       pTelemetry: decoder            */
+/* Output params:      n/a                            */
+/* ************************************************** */
+void telemetryHost_init(telemetry_host_type *pTelemetry);
+
+/* ************************************************** */
+/* Method name:        telemetryHost_decodeFrame      */
+/* Method description: Read the samples of a telemetry*/
+/*                     frame                          */
+/* Input params:       pTelemetry: decoder            */
+/*                     pFrame: frame found by         */
+/*                     binframe_parse                 */
+/*                     pSamples: room for             */
+/*                     TELEMETRY_HOST_MAX_SAMPLES     */
+/* Output params:      samples read, 0 also for a     */
+/*                     frame that is not a telemetry  */
+/*                     frame or cannot be read        */
+/* ************************************************** */
+unsigned char telemetryHost_decodeFrame(telemetry_host_type *pTelemetry, const binframe_parser_type *pFrame,
+                                        telemetry_host_sample_type *pSamples);
+
+#endif /* TEST_TELEMETRY_HOST_H_ */
@@ -0,0 +1,397 @@
+/* ***************************************************************** */
+/* File name:        telemetry_test.c                                */
+/* File description: Round trip of the telemetry stream: samples     */
+/*                   taken by telemetry.c, sent by telemetry_update  */
+/*                   through the UART shim and read back with the    */
+/*                   host decoder must be the same integers, in the  */
+/*                   delta and raw modes, with large jumps, negative */
+/*                   values, samples dropped on the board and frames */
+/*                   lost on the line                                */
+/* Author name:      Grupo 18 - Renato Pepe                          */
+/*                              Joao Victor Matoso                   */
+/* Creation date:    19oct2026                                       */
+/* Revision date:    19oct2026                                       */
+/* ***************************************************************** */
+
+#include <stdio.h>
+#include <string.h>
+#include "telemetry.h"
+#include "pid.h"
+#include "aquecedorECooler.h"
+#include "uart_shim.h"
+#include "board_stubs.h"
+#include "hostboard.h"
+#include "hosttest.h"
+#include "binframe.h"
+#include "telemetry_host.h"
+
+/* samples and frames kept from a capture */
+#define TELEMETRY_TEST_SAMPLES  400U
+#define TELEMETRY_TEST_FRAMES   200U
+
+/* no frame left out of the decoding */
+#define TELEMETRY_TEST_NO_DROP  0xFFFFFFFFU
+
+typedef struct telemetry_test_capture_type {
+    binframe_parser_type parser;
+    telemetry_host_type decoder;
+    unsigned int uiOffset;              // capture bytes already parsed
+    unsigned int uiDropFrame;           // frame not decoded, as if lost on the line
+    unsigned int uiFrames;              // telemetry frames on the line
+    unsigned char ucFlags[TELEMETRY_TEST_FRAMES];
+    unsigned int uiFirstSample[TELEMETRY_TEST_FRAMES];
+    telemetry_host_sample_type samples[TELEMETRY_TEST_SAMPLES];
+    unsigned int uiSamples;
+} telemetry_test_capture_type;
+
+/* samples stored by the board, what the decoder must give back */
+telemetry_host_sample_type telemetryTestStored[TELEMETRY_TEST_SAMPLES];
+unsigned int uiTelemetryTestStored;
+
+unsigned int uiTelemetryTestRandom = 0x2545F491U;
+
+/* ************************************************** */
+/* Method name:        telemetryTest_random           */
+/* Method description: xorshift32                     */
+/* Input params:       uiRange: values 0..uiRange-1   */
+/* Output params:      value                          */
+/* ************************************************** */
+static unsigned int telemetryTest_random(unsigned int uiRange)
+{
+    uiTelemetryTestRandom ^= uiTelemetryTestRandom << 13;
+    uiTelemetryTestRandom ^= uiTelemetryTestRandom >> 17;
+    uiTelemetryTestRandom ^= uiTelemetryTestRandom << 5;
+    return uiTelemetryTestRandom % uiRange;
+}
+
+/* ************************************************** */
+/* Method name:        telemetryTest_next             */
+/* Method description: Next sample of a random walk   */
+/*                     with jumps, in the units of    */
+/*                     telemetry.h                    */
+/* Input params:       pSample: previous sample, the  */
+/*                     new one on return              */
+/*                     uiIndex: sample number         */
+/* Output params:      n/a                            */
+/* ************************************************** */
+static void telemetryTest_next(telemetry_host_sample_type *pSample, unsigned int uiIndex)
+{
+    /* temperature: small steps, below zero and far jumps */
+    pSample->iValue[0] += (int)telemetryTest_random(61) - 30;
+    if(0 == uiIndex % 37U)
+        pSample->iValue[0] = (int)telemetryTest_random(20001) - 5000;
+
+    /* setpoint, from 23 to 74 C as pid_setTemperatureSetpoint takes */
+    if(0 == uiIndex % 23U)
+        pSample->iValue[1] = 2300 + (int)telemetryTest_random(5101);
+
+    /* duties: the 5 byte varints come from the jumps of +-3e8 */
+    pSample->iValue[2] = (int)telemetryTest_random(1001);
+    if(0 == uiIndex % 41U)
+        pSample->iValue[2] = (uiIndex & 1U) ? 300000000 : -300000000;
+    pSample->iValue[3] = (0 == uiIndex % 17U) ? (int)telemetryTest_random(1001) : pSample->iValue[3];
+
+    /* speed in 0.1 RPM, a ripple around the set one */
+    pSample->iValue[4] = 30000 + (int)telemetryTest_random(41) - 20;
+    if(0 == uiIndex % 29U)
+        pSample->iValue[4] = (int)telemetryTest_random(100000);
+}
+
+/* ************************************************** */
+/* Method name:        telemetryTest_sample           */
+/* Method description: Put a sample on the stubs and  */
+/*                     take it as the control loop    */
+/*                     does                           */
+/* Input params:       pSample: values, in the units  */
+/*                     of telemetry.h                 */
+/*                     ucUpdate: also run the main    */
+/*                     loop part                      */
+/* Output params:      n/a                            */
+/* ************************************************** */
+static void telemetryTest_sample(const telemetry_host_sample_type *pSample, unsigned char ucUpdate)
+{
+    unsigned int uiSamples, uiBytes, uiRawBytes, uiDropped, uiDroppedBefore;
+
+    pid_setTemperatureSetpoint((float)pSample->iValue[1] / 100.0f);
+    heater_PWMDuty((float)pSample->iValue[2] / 1000.0f);
+    coolerfan_PWMDuty((float)pSample->iValue[3] / 1000.0f);
+    boardStub_setSpeed((unsigned int)pSample->iValue[4]);
+
+    telemetry_getStatistics(&uiSamples, &uiBytes, &uiRawBytes, &uiDroppedBefore);
+    telemetry_sample((float)pSample->iValue[0] / 100.0f);
+    telemetry_getStatistics(&uiSamples, &uiBytes, &uiRawBytes, &uiDropped);
+
+    if(uiDropped == uiDroppedBefore && TELEMETRY_TEST_SAMPLES > uiTelemetryTestStored)
+        telemetryTestStored[uiTelemetryTestStored++] = *pSample;
+    if(ucUpdate)
+        telemetry_update();
+}
+
+/* ************************************************** */
+/* Method name:        telemetryTest_start            */
+/* Method description: Set the mode on an empty line  */
+/* Input params:       ucMode: TELEMETRY_MODE_*       */
+/*                     pCapture: decoding of the line */
+/* Output params:      n/a                            */
+/* ************************************************** */
+static void telemetryTest_start(unsigned char ucMode, telemetry_test_capture_type *pCapture)
+{
+    hostTest_expectInt(telemetry_setMode(ucMode), 1, "mode set");
+    uartShim_reset();
+    uiTelemetryTestStored = 0;
+
+    memset(pCapture, 0, sizeof(*pCapture));
+    binframe_init(&pCapture->parser);
+    telemetryHost_init(&pCapture->decoder);
+    pCapture->uiDropFrame = TELEMETRY_TEST_NO_DROP;
+}
+
+/* ************************************************** */
+/* Method name:        telemetryTest_collect          */
+/* Method description: Decode what went on the line   */
+/*                     since the last call            */
+/* Input params:       pCapture: decoding of the line */
+/* Output params:      n/a                            */
+/* ************************************************** */
+static void telemetryTest_collect(telemetry_test_capture_type *pCapture)
+{
+    unsigned int uiLength;
+    const unsigned char *pucTx = uartShim_getCapture(&uiLength);
+
+    for(; pCapture->uiOffset < uiLength; pCapture->uiOffset++){
+        telemetry_host_sample_type samples[TELEMETRY_HOST_MAX_SAMPLES];
+        unsigned char ucCount;
+
+        if(!binframe_parse(&pCapture->parser, pucTx[pCapture->uiOffset]) || BINPROTO_CMD_TELEMETRY != pCapture->parser.ucCmd)
+            continue;
+        if(TELEMETRY_TEST_FRAMES <= pCapture->uiFrames)
+            break;
+        pCapture->ucFlags[pCapture->uiFrames] = pCapture->parser.ucPayload[0];
+        pCapture->uiFirstSample[pCapture->uiFrames] = pCapture->uiSamples;
+        if(pCapture->uiDropFrame == pCapture->uiFrames++)
+            continue;
+
+        ucCount = telemetryHost_decodeFrame(&pCapture->decoder, &pCapture->parser, samples);
+        if(TELEMETRY_TEST_SAMPLES - pCapture->uiSamples < ucCount)
+            ucCount = (unsigned char)(TELEMETRY_TEST_SAMPLES - pCapture->uiSamples);
+        memcpy(&pCapture->samples[pCapture->uiSamples], samples, ucCount * sizeof(samples[0]));
+        pCapture->uiSamples += ucCount;
+    }
+    hostTest_expectInt(pCapture->parser.uiErrors, 0, "telemetry frames with a bad CRC");
+}
+
+/* ************************************************** */
+/* Method name:        telemetryTest_expectSamples    */
+/* Method description: Compare decoded samples with   */
+/*                     the stored ones                */
+/* Input params:       pDecoded, pStored: samples     */
+/*                     uiCount: samples to compare    */
+/*                     cWhat: description             */
+/* Output params:      1 if all the same              */
+/* ************************************************** */
+static unsigned char telemetryTest_expectSamples(const telemetry_host_sample_type *pDecoded, const telemetry_host_sample_type *pStored,
+                                                 unsigned int uiCount, const char *cWhat)
+{
+    unsigned int uiIndex, uiChannel;
+
+    for(uiIndex = 0; uiIndex < uiCount; uiIndex++)
+        for(uiChannel = 0; uiChannel < TELEMETRY_CHANNELS; uiChannel++)
+            if(!hostTest_expectInt(pDecoded[uiIndex].iValue[uiChannel], pStored[uiIndex].iValue[uiChannel], cWhat)){
+                printf("    sample %u, channel %u\n", uiIndex, uiChannel);
+                return 0;
+            }
+    return 1;
+}
+
+/* ************************************************** */
+/* Method name:        telemetryTest_roundTrip        */
+/* Method description: Every sample back exactly, the */
+/*                     keyframe period and the counts */
+/* Input params:       ucMode: RAW or DELTA           */
+/* Output params:      n/a                            */
+/* ************************************************** */
+static void telemetryTest_roundTrip(unsigned char ucMode)
+{
+    static telemetry_test_capture_type capture;
+    telemetry_host_sample_type sample = {{2500, 4000, 0, 0, 0}};
+    unsigned int uiSamples, uiBytes, uiRawBytes, uiDropped, uiSamplesBefore, uiBytesBefore, uiIndex;
+    unsigned int uiFed = 300;
+
+    telemetryTest_start(ucMode, &capture);
+    telemetry_getStatistics(&uiSamplesBefore, &uiBytesBefore, &uiRawBytes, &uiDropped);
+    for(uiIndex = 0; uiIndex < uiFed; uiIndex++){
+        telemetryTest_next(&sample, uiIndex);
+        telemetryTest_sample(&sample, 1);
+    }
+    telemetryTest_collect(&capture);
+    telemetry_getStatistics(&uiSamples, &uiBytes, &uiRawBytes, &uiDropped);
+
+    hostTest_expectInt(uiTelemetryTestStored, uiFed, "samples stored");
+    hostTest_expect(uiFed - capture.uiSamples < TELEMETRY_FRAME_SAMPLES, "samples left on the board");
+    hostTest_expectInt(capture.uiSamples, uiSamples - uiSamplesBefore, "samples sent");
+    hostTest_expectInt(capture.decoder.uiBytes, uiBytes - uiBytesBefore, "payload bytes sent");
+    hostTest_expectInt(capture.decoder.uiMissingFrames + capture.decoder.uiSkippedFrames + capture.decoder.uiBadFrames, 0,
+                       "frames not decoded");
+    telemetryTest_expectSamples(capture.samples, telemetryTestStored, capture.uiSamples,
+                                (TELEMETRY_MODE_RAW == ucMode) ? "raw sample" : "delta sample");
+
+    /* one keyframe every TELEMETRY_KEYFRAME_PERIOD frames, from the first */
+    for(uiIndex = 0; uiIndex < capture.uiFrames; uiIndex++){
+        unsigned char ucFlags = (0 == uiIndex % TELEMETRY_KEYFRAME_PERIOD) ? TELEMETRY_FLAG_KEYFRAME : 0;
+
+        if(TELEMETRY_MODE_RAW == ucMode)
+            ucFlags |= TELEMETRY_FLAG_RAW;
+        if(!hostTest_expectInt(capture.ucFlags[uiIndex], ucFlags, "FLAGS of a frame"))
+            break;
+    }
+}
+
+/* ************************************************** */
+/* Method name:        telemetryTest_dropped          */
+/* Method description: The main loop late: samples    */
+/*                     dropped on the board, the next */
+/*                     frame is a keyframe and the    */
+/*                     kept samples still decode      */
+/* Input params:       n/a                            */
+/* Output params:      n/a                            */
+/* ************************************************** */
+static void telemetryTest_dropped(void)
+{
+    static telemetry_test_capture_type capture;
+    telemetry_host_sample_type sample = {{-1500, 2300, 1000, 0, 12345}};
+    unsigned int uiSamples, uiBytes, uiRawBytes, uiDropped, uiDroppedBefore, uiIndex, uiGapFrame;
+
+    telemetryTest_start(TELEMETRY_MODE_DELTA, &capture);
+    telemetry_getStatistics(&uiSamples, &uiBytes, &uiRawBytes, &uiDroppedBefore);
+
+    for(uiIndex = 0; uiIndex < 20U; uiIndex++){
+        telemetryTest_next(&sample, uiIndex);
+        telemetryTest_sample(&sample, 1);
+    }
+    telemetryTest_collect(&capture);
+    uiGapFrame = capture.uiFrames;
+
+    /* no telemetry_update for 30 periods, the ring is full */
+    for(; uiIndex < 50U; uiIndex++){
+        telemetryTest_next(&sample, uiIndex);
+        telemetryTest_sample(&sample, 0);
+    }
+    for(; uiIndex < 120U; uiIndex++){
+        telemetryTest_next(&sample, uiIndex);
+        telemetryTest_sample(&sample, 1);
+    }
+    telemetryTest_collect(&capture);
+    telemetry_getStatistics(&uiSamples, &uiBytes, &uiRawBytes, &uiDropped);
+
+    hostTest_expect(uiDropped > uiDroppedBefore, "samples dropped");
+    hostTest_expectInt(uiTelemetryTestStored + uiDropped - uiDroppedBefore, 120, "samples stored and dropped");
+    hostTest_expect(uiGapFrame < capture.uiFrames, "frames after the gap");
+    hostTest_expectInt(capture.ucFlags[uiGapFrame], TELEMETRY_FLAG_KEYFRAME, "first frame after the gap");
+    if(uiGapFrame + TELEMETRY_KEYFRAME_PERIOD < capture.uiFrames)
+        hostTest_expectInt(capture.ucFlags[uiGapFrame + TELEMETRY_KEYFRAME_PERIOD], TELEMETRY_FLAG_KEYFRAME,
+                           "keyframe period restarted by the gap");
+    hostTest_expect(uiTelemetryTestStored - capture.uiSamples < TELEMETRY_FRAME_SAMPLES, "samples left on the board");
+    telemetryTest_expectSamples(capture.samples, telemetryTestStored, capture.uiSamples, "sample around a gap");
+}
+
+/* ************************************************** */
+/* Method name:        telemetryTest_lostFrame        */
+/* Method description: A delta frame lost on the line:*/
+/*                     the decoder finds the SEQ gap, */
+/*                     skips the delta frames and     */
+/*                     starts again at the keyframe   */
+/* Input params:       n/a                            */
+/* Output params:      n/a                            */
+/* ************************************************** */
+static void telemetryTest_lostFrame(void)
+{
+    static telemetry_test_capture_type capture, lossy;
+    telemetry_host_sample_type sample = {{2500, 5000, 500, 0, 30000}};
+    unsigned int uiIndex, uiBefore, uiAfter;
+
+    telemetryTest_start(TELEMETRY_MODE_DELTA, &capture);
+    for(uiIndex = 0; uiIndex < 150U; uiIndex++){
+        telemetryTest_next(&sample, uiIndex);
+        telemetryTest_sample(&sample, 1);
+    }
+    telemetryTest_collect(&capture);
+
+    /* the same line, frame 3 lost */
+    memset(&lossy, 0, sizeof(lossy));
+    binframe_init(&lossy.parser);
+    telemetryHost_init(&lossy.decoder);
+    lossy.uiDropFrame = 3;
+    telemetryTest_collect(&lossy);
+
+    if(!hostTest_expect(2U * TELEMETRY_KEYFRAME_PERIOD < capture.uiFrames, "frames of the lost frame test"))
+        return;
+    uiBefore = capture.uiFirstSample[3];
+    uiAfter = capture.uiFirstSample[TELEMETRY_KEYFRAME_PERIOD];
+    hostTest_expectInt(lossy.decoder.uiMissingFrames, 1, "SEQ gap found");
+    hostTest_expectInt(lossy.decoder.uiSkippedFrames, TELEMETRY_KEYFRAME_PERIOD - 4U, "delta frames skipped");
+    hostTest_expectInt(lossy.uiSamples, uiBefore + capture.uiSamples - uiAfter, "samples decoded");
+    telemetryTest_expectSamples(lossy.samples, capture.samples, uiBefore, "sample before the lost frame");
+    telemetryTest_expectSamples(&lossy.samples[uiBefore], &capture.samples[uiAfter], capture.uiSamples - uiAfter,
+                                "sample from the keyframe");
+}
+
+/* ************************************************** */
+/* Method name:        telemetryTest_decoder          */
+/* Method description: Frames the board does not send:*/
+/*                     a truncated varint, COUNT and  */
+/*                     payload that do not agree      */
+/* Input params:       n/a                            */
+/* Output params:      n/a                            */
+/* ************************************************** */
+static void telemetryTest_decoder(void)
+{
+    /* keyframe of one sample, the last varint cut */
+    static const unsigned char ucTruncated[] = {TELEMETRY_FLAG_KEYFRAME, 1, 2, 4, 6, 8, 0x80};
+    /* keyframe of one sample with a byte left over */
+    static const unsigned char ucLong[] = {TELEMETRY_FLAG_KEYFRAME, 1, 2, 4, 6, 8, 10, 0};
+    /* delta frame of one sample: 1, -1, 2, -2, 64 */
+    static const unsigned char ucDelta[] = {0, 1, 2, 1, 4, 3, 0x80, 0x01};
+    telemetry_host_sample_type samples[TELEMETRY_HOST_MAX_SAMPLES];
+    unsigned char ucFrame[BINFRAME_MAX_SIZE], ucLength, ucIndex, ucCount = 0;
+    binframe_parser_type parser;
+    telemetry_host_type decoder;
+
+    binframe_init(&parser);
+    telemetryHost_init(&decoder);
+
+    ucLength = binframe_build(BINPROTO_CMD_TELEMETRY, 0, ucTruncated, sizeof(ucTruncated), ucFrame);
+    ucLength += binframe_build(BINPROTO_CMD_TELEMETRY, 1, ucLong, sizeof(ucLong), &ucFrame[ucLength]);
+    for(ucIndex = 0; ucIndex < ucLength; ucIndex++)
+        if(binframe_parse(&parser, ucFrame[ucIndex]))
+            ucCount += telemetryHost_decodeFrame(&decoder, &parser, samples);
+    hostTest_expectInt(ucCount, 0, "samples of bad frames");
+    hostTest_expectInt(decoder.uiBadFrames, 2, "bad frames found");
+
+    /* a good keyframe, then a delta frame on it */
+    ucLength = binframe_build(BINPROTO_CMD_TELEMETRY, 2, ucLong, sizeof(ucLong) - 1U, ucFrame);
+    ucLength += binframe_build(BINPROTO_CMD_TELEMETRY, 3, ucDelta, sizeof(ucDelta), &ucFrame[ucLength]);
+    for(ucIndex = 0; ucIndex < ucLength; ucIndex++)
+        if(binframe_parse(&parser, ucFrame[ucIndex]))
+            ucCount = telemetryHost_decodeFrame(&decoder, &parser, samples);
+    if(hostTest_expectInt(ucCount, 1, "samples of the delta frame")){
+        hostTest_expectInt(samples[0].iValue[0], 1 + 1, "delta +1");
+        hostTest_expectInt(samples[0].iValue[1], 2 - 1, "delta -1");
+        hostTest_expectInt(samples[0].iValue[2], 3 + 2, "delta +2");
+        hostTest_expectInt(samples[0].iValue[3], 4 - 2, "delta -2");
+        hostTest_expectInt(samples[0].iValue[4], 5 + 64, "delta of 2 bytes");
+    }
+}
+
+int main(void)
+{
+    hostBoard_init();
+    uartShim_reset();
+
+    telemetryTest_roundTrip(TELEMETRY_MODE_DELTA);
+    telemetryTest_roundTrip(TELEMETRY_MODE_RAW);
+    telemetryTest_dropped();
+    telemetryTest_lostFrame();
+    telemetryTest_decoder();
+    telemetry_setMode(TELEMETRY_MODE_OFF);
+    return hostTest_report("telemetry_test");
+}